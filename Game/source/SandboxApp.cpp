@@ -33,10 +33,19 @@ public:
             NuEngine::Weave::WbcFileHeader header;
             file.read(reinterpret_cast<char*>(&header), sizeof(header));
 
-            realAsset.ByteCode.resize(header.BytecodeSize);
-            file.read(reinterpret_cast<char*>(realAsset.ByteCode.data()), header.BytecodeSize);
+            if (header.Magic != NuEngine::Weave::k_Magic || header.Version != NuEngine::Weave::k_BytecodeVersion)
+            {
+                LOG_ERROR("test_script.wbc has bytecode version {}, expected {} - recompile it in the editor",
+                    header.Version, NuEngine::Weave::k_BytecodeVersion);
+            }
+            else
+            {
+                realAsset.ByteCode.resize(header.BytecodeSize);
+                file.read(reinterpret_cast<char*>(realAsset.ByteCode.data()), header.BytecodeSize);
+                realAsset.OnCollideEntry = header.OnCollideEntry;
 
-            LOG_INFO("Successfully loaded test_script.wbc! Size: {} bytes", realAsset.ByteCode.size());
+                LOG_INFO("Successfully loaded test_script.wbc! Size: {} bytes", realAsset.ByteCode.size());
+            }
         }
         else
         {
@@ -89,6 +98,13 @@ public:
                 NuEngine::Physics::BodyType::Dynamic
             );
 
+            if (auto pipeline = GetPipeline())
+            {
+                auto& renderer = cube.AddComponent<NuEngine::ECS::MeshRendererComponent>();
+                renderer.Mesh = &pipeline->GetCubeMesh();
+                renderer.Material = &pipeline->GetDefaultMaterial();
+            }
+
             auto& weaveComp = cube.AddComponent<NuEngine::Weave::WeaveComponent>();
             weaveComp.Asset = &realAsset;
             weaveComp.Enable();
@@ -107,18 +123,7 @@ public:
     {
         if (auto pipeline = GetPipeline())
         {
-            for (int i = 0; i < (int)m_Cubes.size(); i++)
-            {
-                auto& cube = m_Cubes[i];
-                if (!cube.IsValid()) continue;
-                if (!cube.HasComponent<NuEngine::ECS::TransformComponent>()) continue;
-
-                auto& transform = cube.GetComponent<NuEngine::ECS::TransformComponent>();
-                NuMath::Transform t;
-                t.SetPosition(transform.Position);
-                t.SetRotation(transform.Rotation);
-                pipeline->RenderCube(t, true);
-            }
+            m_Scene->SubmitRenderables(*pipeline);
         }
     }
 };
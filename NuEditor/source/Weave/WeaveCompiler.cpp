@@ -229,6 +229,87 @@ namespace NuEditor::Weave
 		return true;
 	}
 
+	void WeaveCompiler::SplitEntryPoints(const std::vector<int>& order, const WeaveGraphScene& scene,
+		std::vector<int>& outUpdate, std::vector<int>& outCollide) const
+	{
+		const auto& connections = scene.GetConnections();
+
+		// Everything downstream of the seeds
+		auto forward = [&](std::unordered_set<int> seeds) {
+			std::vector<int> stack(seeds.begin(), seeds.end());
+			while (!stack.empty())
+			{
+				const int id = stack.back();
+				stack.pop_back();
+				for (const auto& conn : connections)
+				{
+					if (conn.FromNodeId == id && seeds.insert(conn.ToNodeId).second)
+					{
+						stack.push_back(conn.ToNodeId);
+					}
+				}
+			}
+			return seeds;
+			};
+
+		// Adds every node the set reads from, so each block computes its own inputs
+		auto withInputs = [&](std::unordered_set<int> nodes) {
+			std::vector<int> stack(nodes.begin(), nodes.end());
+			while (!stack.empty())
+			{
+				const int id = stack.back();
+				stack.pop_back();
+				for (const auto& conn : connections)
+				{
+					if (conn.ToNodeId == id && nodes.insert(conn.FromNodeId).second)
+					{
+						stack.push_back(conn.FromNodeId);
+					}
+				}
+			}
+			return nodes;
+			};
+
+		std::unordered_set<int> updateSeeds;
+		std::unordered_set<int> collideSeeds;
+		for (const auto& node : scene.GetNodes())
+		{
+			if (node.Kind == NodeKind::Event_OnUpdate)
+			{
+				updateSeeds.insert(node.Id);
+			}
+			else if (node.Kind == NodeKind::Event_OnCollide)
+			{
+				collideSeeds.insert(node.Id);
+			}
+		}
+
+		const std::unordered_set<int> collideSet = collideSeeds.empty() ? std::unordered_set<int>{} : withInputs(forward(collideSeeds));
+
+		// Nodes no OnCollide needs keep running every frame, as they did before OnCollide had its own block
+		std::unordered_set<int> updateRoots = forward(updateSeeds);
+		for (const auto& node : scene.GetNodes())
+		{
+			if (!collideSet.count(node.Id))
+			{
+				updateRoots.insert(node.Id);
+			}
+		}
+		const std::unordered_set<int> updateSet = withInputs(std::move(updateRoots));
+
+		for (int id : order)
+		{
+			if (updateSet.count(id))
+			{
+				outUpdate.push_back(id);
+			}
+			if (collideSet.count(id))
+			{
+				outCollide.push_back(id);
+			}
+		}
+	}
+
 	void WeaveCompiler::ConstFold(const std::vector<int>& order, const WeaveGraphScene& scene, CompileContext& ctx)
 	{
 		std::unordered_map<int, float> knownConsts;
@@ -392,6 +473,20 @@ namespace NuEditor::Weave
 
 			if (kind == NodeKind::Event_OnUpdate || kind == NodeKind::Event_OnCollide)
 			{
+				// Pin 1 carries the event's value (DeltaTime / Other); fetched only when something reads it
+				bool valueRead = false;
+				for (const auto& conn : scene.GetConnections())
+				{
+					valueRead |= conn.FromNodeId == id && conn.FromPinIdx == 1;
+				}
+
+				if (valueRead)
+				{
+					EmitByte(result, static_cast<uint8_t>(OC::CALL_EXTERNAL));
+					EmitUInt32(result, kind == NodeKind::Event_OnUpdate ? NF::GetDeltaTime : NF::GetOtherEntity);
+					EmitByte(result, 0);
+					EmitByte(result, GetReg(ctx, id, 1));
+				}
 				continue;
 			}
 
@@ -514,6 +609,42 @@ namespace NuEditor::Weave
 				EmitByte(result, GetReg(ctx, id, 1));
 				continue;
 			}
+
+			if (kind == NodeKind::Native_GetContactPoint || kind == NodeKind::Native_GetContactNormal)
+			{
+				const uint32_t firstFunc = kind == NodeKind::Native_GetContactPoint ? NF::GetContactPointX : NF::GetContactNormalX;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					EmitByte(result, static_cast<uint8_t>(OC::CALL_EXTERNAL));
+					EmitUInt32(result, firstFunc + axis);
+					EmitByte(result, 0);
+					EmitByte(result, GetReg(ctx, id, 1 + axis));
+				}
+				continue;
+			}
+
+			if (kind == NodeKind::Native_Raycast)
+			{
+				constexpr int k_FirstArgPin = 1;
+				constexpr int k_ArgCount = 7;
+
+				uint8_t args[k_ArgCount];
+				for (int a = 0; a < k_ArgCount; ++a)
+				{
+					args[a] = inputReg(id, k_FirstArgPin + a);
+				}
+
+				EmitByte(result, static_cast<uint8_t>(OC::CALL_EXTERNAL));
+				EmitUInt32(result, NF::Raycast);
+				EmitByte(result, k_ArgCount);
+				for (uint8_t reg : args)
+				{
+					EmitByte(result, reg);
+				}
+				EmitByte(result, GetReg(ctx, id, k_FirstArgPin + k_ArgCount));
+				EmitByte(result, GetReg(ctx, id, k_FirstArgPin + k_ArgCount + 1));
+				continue;
+			}
 		}
 	}
 
@@ -528,7 +659,7 @@ namespace NuEditor::Weave
 		NuEngine::Weave::WbcFileHeader header{};
 		header.Magic = NuEngine::Weave::k_Magic;
 		header.Version = NuEngine::Weave::k_BytecodeVersion;
-		header.Reserved = 0;
+		header.OnCollideEntry = result.OnCollideEntry;
 		header.BytecodeSize = static_cast<uint32_t>(result.Bytecode.size());
 		header.Checksum = Crc32(result.Bytecode.data(), result.Bytecode.size());
 
@@ -557,7 +688,27 @@ namespace NuEditor::Weave
 
 		RegAlloc(order, scene, ctx);
 
-		Emit(order, scene, ctx, result);
+		// OnUpdate runs from offset 0 to its HALT; OnCollide gets its own block after it
+		std::vector<int> updateOrder;
+		std::vector<int> collideOrder;
+		SplitEntryPoints(order, scene, updateOrder, collideOrder);
+
+		Emit(updateOrder, scene, ctx, result);
+		EmitByte(result, static_cast<uint8_t>(NuEngine::Weave::OpCode::HALT));
+
+		if (!collideOrder.empty())
+		{
+			const uint32_t entry = ctx.CurrentOffset(result);
+			if (entry >= NuEngine::Weave::k_NoEntryPoint)
+			{
+				result.AddError(CompileStage::Emit, k_NoNode, "OnUpdate block is too large - OnCollide entry does not fit in 16 bits.");
+				return result;
+			}
+
+			result.OnCollideEntry = static_cast<uint16_t>(entry);
+			Emit(collideOrder, scene, ctx, result);
+			EmitByte(result, static_cast<uint8_t>(NuEngine::Weave::OpCode::HALT));
+		}
 
 		if (result.HasErrors())
 		{
@@ -47,6 +47,9 @@ namespace NuEditor::Weave
         std::vector<uint8_t> Bytecode;
         std::vector<CompileDiag> Diagnostics;
 
+        // Bytecode offset of the Event_OnCollide block; the OnUpdate block always starts at 0
+        uint16_t OnCollideEntry = NuEngine::Weave::k_NoEntryPoint;
+
         [[nodiscard]] bool HasErrors() const noexcept;
         [[nodiscard]] bool HasWarnings() const noexcept;
 
@@ -84,6 +87,8 @@ namespace NuEditor::Weave
     private:
         [[nodiscard]] bool Validate(const WeaveGraphScene& scene, CompileResult& result);
         [[nodiscard]] bool TopoSort(const WeaveGraphScene& scene, CompileResult& result, std::vector<int>& outOrder);
+        void SplitEntryPoints(const std::vector<int>& order, const WeaveGraphScene& scene,
+            std::vector<int>& outUpdate, std::vector<int>& outCollide) const;
         void ConstFold(const std::vector<int>& order, const WeaveGraphScene& scene, CompileContext& ctx);
         void RegAlloc(const std::vector<int>& order, const WeaveGraphScene& scene, CompileContext& ctx);
         void Emit(const std::vector<int>& order, const WeaveGraphScene& scene, CompileContext& ctx, CompileResult& result);
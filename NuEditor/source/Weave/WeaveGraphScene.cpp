@@ -123,6 +123,38 @@ namespace NuEditor::Weave
              {"B", false, QColor(0xCC,0x88,0x22)},
              {"Dist", true, QColor(0x22,0xCC,0x88)}},
             "Native", {} });
+
+        // Origin is an offset from the entity; Hit is the distance, or -1 on a miss
+        m_Defs.push_back({ WeaveNodeKind::Native_Raycast, "Raycast",
+            QColor(0x1A, 0x3A, 0x5C),
+            {{"►", false, QColor(0xFF,0xFF,0xFF)},
+             {"Origin X", false, QColor(0x22,0xCC,0x88)},
+             {"Origin Y", false, QColor(0x22,0xCC,0x88)},
+             {"Origin Z", false, QColor(0x22,0xCC,0x88)},
+             {"Dir X", false, QColor(0x22,0xCC,0x88)},
+             {"Dir Y", false, QColor(0x22,0xCC,0x88)},
+             {"Dir Z", false, QColor(0x22,0xCC,0x88)},
+             {"Max Dist", false, QColor(0x22,0xCC,0x88)},
+             {"Hit", true, QColor(0x22,0xCC,0x88)},
+             {"Entity", true, QColor(0xCC,0x88,0x22)}},
+            "Native", {"", "0.0", "0.0", "0.0", "0.0", "0.0", "-1.0", "100.0"} });
+
+        // Valid under Event OnCollide; the normal points from this entity toward the other one
+        m_Defs.push_back({ WeaveNodeKind::Native_GetContactPoint, "Get Contact Point",
+            QColor(0x1A, 0x3A, 0x5C),
+            {{"►", false, QColor(0xFF,0xFF,0xFF)},
+             {"X", true, QColor(0x22,0xCC,0x88)},
+             {"Y", true, QColor(0x22,0xCC,0x88)},
+             {"Z", true, QColor(0x22,0xCC,0x88)}},
+            "Native", {} });
+
+        m_Defs.push_back({ WeaveNodeKind::Native_GetContactNormal, "Get Contact Normal",
+            QColor(0x1A, 0x3A, 0x5C),
+            {{"►", false, QColor(0xFF,0xFF,0xFF)},
+             {"X", true, QColor(0x22,0xCC,0x88)},
+             {"Y", true, QColor(0x22,0xCC,0x88)},
+             {"Z", true, QColor(0x22,0xCC,0x88)}},
+            "Native", {} });
     }
 
     WeaveGraphScene::WeaveGraphScene(QObject* parent)
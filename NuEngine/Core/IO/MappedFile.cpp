@@ -0,0 +1,133 @@
+#include <Core/IO/MappedFile.hpp>
+
+#include <utility>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace NuEngine::Core
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_Data(std::exchange(other.m_Data, nullptr))
+        , m_Size(std::exchange(other.m_Size, 0))
+#if defined(_WIN32)
+        , m_File(std::exchange(other.m_File, nullptr))
+        , m_Mapping(std::exchange(other.m_Mapping, nullptr))
+#endif
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            m_Data = std::exchange(other.m_Data, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+#if defined(_WIN32)
+            m_File = std::exchange(other.m_File, nullptr);
+            m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#if defined(_WIN32)
+    Result<MappedFile, FileSystemError> MappedFile::Open(const std::filesystem::path& path)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return Err(FileSystemError(FileSystemErrorCode::FileNotFound, path.string()));
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return Err(FileSystemError(FileSystemErrorCode::ReadFailed, path.string(), "Empty or unreadable file"));
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return Err(FileSystemError(FileSystemErrorCode::PlatformFailure, path.string(), "MapViewOfFile failed"));
+        }
+
+        MappedFile mapped;
+        mapped.m_Data = static_cast<const std::byte*>(view);
+        mapped.m_Size = static_cast<size_t>(size.QuadPart);
+        mapped.m_File = file;
+        mapped.m_Mapping = mapping;
+        return Ok(std::move(mapped));
+    }
+
+    void MappedFile::Close() noexcept
+    {
+        if (m_Data) UnmapViewOfFile(m_Data);
+        if (m_Mapping) CloseHandle(static_cast<HANDLE>(m_Mapping));
+        if (m_File) CloseHandle(static_cast<HANDLE>(m_File));
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Mapping = nullptr;
+        m_File = nullptr;
+    }
+#else
+    Result<MappedFile, FileSystemError> MappedFile::Open(const std::filesystem::path& path)
+    {
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return Err(FileSystemError(FileSystemErrorCode::FileNotFound, path.string()));
+        }
+
+        struct stat info{};
+        if (::fstat(file, &info) != 0 || info.st_size == 0)
+        {
+            ::close(file);
+            return Err(FileSystemError(FileSystemErrorCode::ReadFailed, path.string(), "Empty or unreadable file"));
+        }
+
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        // The mapping keeps its own reference to the file
+        ::close(file);
+        if (view == MAP_FAILED)
+        {
+            return Err(FileSystemError(FileSystemErrorCode::PlatformFailure, path.string(), "mmap failed"));
+        }
+
+        MappedFile mapped;
+        mapped.m_Data = static_cast<const std::byte*>(view);
+        mapped.m_Size = static_cast<size_t>(info.st_size);
+        return Ok(std::move(mapped));
+    }
+
+    void MappedFile::Close() noexcept
+    {
+        if (m_Data)
+        {
+            ::munmap(const_cast<std::byte*>(m_Data), m_Size);
+        }
+
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+#endif
+}
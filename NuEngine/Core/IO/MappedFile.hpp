@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+#include <Core/Types/Result.hpp>
+#include <Core/Errors/FileSystemError.hpp>
+#include <NuEngine/Core/API.hpp>
+
+namespace NuEngine::Core
+{
+    /*
+    * @class MappedFile
+    *
+    * @brief Read-only view of a whole file mapped into memory.
+    *
+    * Pages are loaded by the OS on first touch, so opening is cheap and only the bytes
+    * actually read cost I/O. The view stays valid until the MappedFile is destroyed.
+    */
+    class NU_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /*
+        * @brief Maps the file at path. Empty files cannot be mapped and fail with ReadFailed.
+        */
+        [[nodiscard]] static Result<MappedFile, FileSystemError> Open(const std::filesystem::path& path);
+
+        [[nodiscard]] const std::byte* GetData() const noexcept { return m_Data; }
+        [[nodiscard]] size_t GetSize() const noexcept { return m_Size; }
+        [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return { m_Data, m_Size }; }
+
+        [[nodiscard]] bool IsOpen() const noexcept { return m_Data != nullptr; }
+
+        void Close() noexcept;
+
+    private:
+        const std::byte* m_Data = nullptr;
+        size_t m_Size = 0;
+#if defined(_WIN32)
+        void* m_File = nullptr;
+        void* m_Mapping = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,197 @@
+// Copyright(c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NuEngine::Core
+{
+    /**
+     * @brief Thread-safe pool of byte buffers in power-of-two size classes.
+     *
+     * Meant for large transient buffers (decoded images, file contents) that would otherwise be
+     * allocated and freed by worker threads every time. Released buffers are kept until the
+     * pool holds maxCachedBytes; beyond that they are freed. The pool must outlive its buffers.
+     */
+    class BufferPool
+    {
+    public:
+        static constexpr size_t k_MinBufferSize = 4 * 1024;
+
+        /**
+         * @brief Move-only lease on a pooled buffer. Goes back to the pool when destroyed.
+         */
+        class Buffer
+        {
+        public:
+            Buffer() noexcept = default;
+            ~Buffer() { Release(); }
+
+            Buffer(const Buffer&) = delete;
+            Buffer& operator=(const Buffer&) = delete;
+
+            Buffer(Buffer&& other) noexcept
+                : m_Pool(std::exchange(other.m_Pool, nullptr)), m_Data(std::move(other.m_Data)),
+                  m_Size(std::exchange(other.m_Size, 0)), m_Capacity(std::exchange(other.m_Capacity, 0))
+            {
+            }
+
+            Buffer& operator=(Buffer&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Release();
+                    m_Pool = std::exchange(other.m_Pool, nullptr);
+                    m_Data = std::move(other.m_Data);
+                    m_Size = std::exchange(other.m_Size, 0);
+                    m_Capacity = std::exchange(other.m_Capacity, 0);
+                }
+                return *this;
+            }
+
+            [[nodiscard]] std::byte* Data() noexcept { return m_Data.get(); }
+            [[nodiscard]] const std::byte* Data() const noexcept { return m_Data.get(); }
+
+            /**
+             * @brief Bytes requested; the capacity behind it is the size class.
+             */
+            [[nodiscard]] size_t Size() const noexcept { return m_Size; }
+
+            [[nodiscard]] explicit operator bool() const noexcept { return m_Data != nullptr; }
+
+            /**
+             * @brief Returns the memory to the pool early.
+             */
+            void Release() noexcept
+            {
+                if (m_Pool && m_Data)
+                {
+                    m_Pool->Recycle(std::move(m_Data), m_Capacity);
+                }
+                m_Pool = nullptr;
+                m_Data.reset();
+                m_Size = 0;
+                m_Capacity = 0;
+            }
+
+        private:
+            friend class BufferPool;
+
+            BufferPool* m_Pool = nullptr;
+            std::unique_ptr<std::byte[]> m_Data;
+            size_t m_Size = 0;
+            size_t m_Capacity = 0;
+        };
+
+        explicit BufferPool(size_t maxCachedBytes = 64 * 1024 * 1024) noexcept
+            : m_MaxCachedBytes(maxCachedBytes)
+        {
+        }
+
+        BufferPool(const BufferPool&) = delete;
+        BufferPool& operator=(const BufferPool&) = delete;
+
+        /**
+         * @brief Buffer of at least size bytes, reused from the pool when one of the right class is free.
+         */
+        [[nodiscard]] Buffer Acquire(size_t size)
+        {
+            const size_t capacity = std::bit_ceil(std::max(size, k_MinBufferSize));
+            const size_t sizeClass = static_cast<size_t>(std::countr_zero(capacity));
+
+            Buffer buffer;
+            buffer.m_Pool = this;
+            buffer.m_Size = size;
+            buffer.m_Capacity = capacity;
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (sizeClass < m_Free.size() && !m_Free[sizeClass].empty())
+                {
+                    buffer.m_Data = std::move(m_Free[sizeClass].back());
+                    m_Free[sizeClass].pop_back();
+                    m_CachedBytes -= capacity;
+                    m_Hits++;
+                    return buffer;
+                }
+                m_Misses++;
+            }
+
+            buffer.m_Data = std::make_unique_for_overwrite<std::byte[]>(capacity);
+            return buffer;
+        }
+
+        [[nodiscard]] size_t GetCachedBytes() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_CachedBytes;
+        }
+
+        /**
+         * @brief Acquires served from a free buffer / acquires that had to allocate.
+         */
+        [[nodiscard]] uint64_t GetHits() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Hits;
+        }
+
+        [[nodiscard]] uint64_t GetMisses() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Misses;
+        }
+
+        /**
+         * @brief Frees every cached buffer. Buffers still leased are unaffected.
+         */
+        void Trim()
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Free.clear();
+            m_CachedBytes = 0;
+        }
+
+    private:
+        void Recycle(std::unique_ptr<std::byte[]> data, size_t capacity) noexcept
+        {
+            const size_t sizeClass = static_cast<size_t>(std::countr_zero(capacity));
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_CachedBytes + capacity > m_MaxCachedBytes)
+            {
+                return;
+            }
+
+            try
+            {
+                if (sizeClass >= m_Free.size())
+                {
+                    m_Free.resize(sizeClass + 1);
+                }
+                m_Free[sizeClass].push_back(std::move(data));
+                m_CachedBytes += capacity;
+            }
+            catch (...)
+            {
+                // Out of memory: the buffer is simply freed
+            }
+        }
+
+        mutable std::mutex m_Mutex;
+        std::vector<std::vector<std::unique_ptr<std::byte[]>>> m_Free;
+        size_t m_MaxCachedBytes;
+        size_t m_CachedBytes = 0;
+        uint64_t m_Hits = 0;
+        uint64_t m_Misses = 0;
+    };
+}
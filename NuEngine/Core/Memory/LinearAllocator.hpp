@@ -1,3 +1,161 @@
 // Copyright(c) 2025 Vladyslav Hordiychuk
 // All rights reserved.
-// Unauthorized copying or use of this file is strictly prohibited.
\ No newline at end of file
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace NuEngine::Core
+{
+    /**
+     * @brief Bump allocator for per-frame data. Reset() releases everything at once.
+     *
+     * When the current block is full a new one is chained. Reset() replaces a chain with a
+     * single block big enough for the whole previous frame, so steady-state frames bump one
+     * pointer in one block. Not thread-safe; use one allocator per thread.
+     */
+    class LinearAllocator
+    {
+    public:
+        static constexpr size_t k_BlockAlignment = 64;
+
+        explicit LinearAllocator(size_t capacity = 64 * 1024)
+        {
+            AddBlock(std::max<size_t>(capacity, k_BlockAlignment));
+        }
+
+        ~LinearAllocator()
+        {
+            ReleaseBlocks();
+        }
+
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+        LinearAllocator(LinearAllocator&& other) noexcept
+            : m_Blocks(std::move(other.m_Blocks)), m_Offset(other.m_Offset), m_Used(other.m_Used)
+        {
+            other.m_Blocks.clear();
+            other.m_Offset = 0;
+            other.m_Used = 0;
+        }
+
+        LinearAllocator& operator=(LinearAllocator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                ReleaseBlocks();
+                m_Blocks = std::move(other.m_Blocks);
+                m_Offset = other.m_Offset;
+                m_Used = other.m_Used;
+                other.m_Blocks.clear();
+                other.m_Offset = 0;
+                other.m_Used = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Returns size bytes aligned to alignment (a power of two, at most k_BlockAlignment).
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            Block& block = m_Blocks.back();
+            size_t start = (m_Offset + alignment - 1) & ~(alignment - 1);
+
+            if (start + size > block.Size)
+            {
+                AddBlock(std::max(block.Size * 2, size + alignment));
+                start = 0;
+            }
+
+            m_Offset = start + size;
+            m_Used += size;
+            return m_Blocks.back().Data + start;
+        }
+
+        /**
+         * @brief Uninitialized storage for count objects. T must be trivially destructible; nothing is ever destroyed.
+         */
+        template<typename T>
+        [[nodiscard]] T* AllocateArray(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearAllocator never runs destructors");
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        template<typename T, typename... Args>
+        [[nodiscard]] T* New(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearAllocator never runs destructors");
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Invalidates every allocation. Keeps (and if needed merges) the memory for the next frame.
+         */
+        void Reset() noexcept
+        {
+            if (m_Blocks.size() > 1)
+            {
+                size_t total = 0;
+                for (const Block& block : m_Blocks)
+                {
+                    total += block.Size;
+                }
+
+                ReleaseBlocks();
+                AddBlock(total);
+            }
+
+            m_Offset = 0;
+            m_Used = 0;
+        }
+
+        [[nodiscard]] size_t GetUsed() const noexcept { return m_Used; }
+
+        [[nodiscard]] size_t GetCapacity() const noexcept
+        {
+            size_t total = 0;
+            for (const Block& block : m_Blocks)
+            {
+                total += block.Size;
+            }
+            return total;
+        }
+
+    private:
+        struct Block
+        {
+            std::byte* Data;
+            size_t Size;
+        };
+
+        void AddBlock(size_t size)
+        {
+            std::byte* data = static_cast<std::byte*>(::operator new(size, std::align_val_t{ k_BlockAlignment }));
+            m_Blocks.push_back({ data, size });
+            m_Offset = 0;
+        }
+
+        void ReleaseBlocks() noexcept
+        {
+            for (const Block& block : m_Blocks)
+            {
+                ::operator delete(block.Data, std::align_val_t{ k_BlockAlignment });
+            }
+            m_Blocks.clear();
+        }
+
+        std::vector<Block> m_Blocks;
+        size_t m_Offset = 0;
+        size_t m_Used = 0;
+    };
+}
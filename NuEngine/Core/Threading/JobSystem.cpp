@@ -1,27 +1,65 @@
 #include <Core/Threading/JobSystem.hpp>
 
+#include <algorithm>
+
 namespace NuEngine::Core
 {
-	void JobSystem::Initialize()
+	namespace
 	{
-		unsigned int hwThreads = std::thread::hardware_concurrency();
-		m_numThreads = (hwThreads != 0) ? hwThreads : 2;
+		thread_local unsigned int t_ThreadIndex = 0;
+	}
 
-		m_workers.reserve(m_numThreads - 1);
+	JobSystem::~JobSystem()
+	{
+		Shutdown();
+	}
+
+	void JobSystem::Initialize(unsigned int numWorkers)
+	{
+		if (m_running.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		if (numWorkers == 0)
+		{
+			unsigned int hwThreads = std::thread::hardware_concurrency();
+			numWorkers = (hwThreads > 1) ? hwThreads - 1 : 1;
+		}
+
+		m_numThreads = numWorkers + 1;
+		m_running.store(true, std::memory_order_release);
+
+		m_workers.reserve(numWorkers);
+		for (unsigned int i = 0; i < numWorkers; ++i)
+		{
+			m_workers.emplace_back([this, i]()
+			{
+				WorkerLoop(i + 1);
+			});
+		}
 	}
 
 	void JobSystem::Shutdown()
 	{
-		if (!m_workers.empty())
 		{
-			for (auto& t : m_workers)
+			std::lock_guard lock(m_queueMutex);
+			m_running.store(false, std::memory_order_release);
+		}
+		m_wakeCondition.notify_all();
+
+		for (auto& t : m_workers)
+		{
+			if (t.joinable())
 			{
-				if (t.joinable())
-				{
-					t.join();
-				}
+				t.join();
 			}
-			m_workers.clear();
+		}
+		m_workers.clear();
+		m_numThreads = 1;
+
+		while (TryRunPendingJob())
+		{
 		}
 	}
 
@@ -31,40 +69,106 @@ namespace NuEngine::Core
 		return instance;
 	}
 
-	void JobSystem::ParallelFor(size_t count, std::function<void(size_t, size_t)> job)
+	unsigned int JobSystem::GetThreadIndex() noexcept
+	{
+		return t_ThreadIndex;
+	}
+
+	void JobSystem::Submit(Job job)
 	{
-		constexpr int THRESHOLD = 1000;
-		if (count < THRESHOLD || m_numThreads <= 1)
+		if (m_workers.empty())
 		{
-			job(0, count);
+			job();
 			return;
 		}
 
-		unsigned int chunkSize = count / m_numThreads;
+		{
+			std::lock_guard lock(m_queueMutex);
+			m_queue.push_back(std::move(job));
+		}
+		m_wakeCondition.notify_one();
+	}
 
-		size_t startIndex = 0;
+	bool JobSystem::TryRunPendingJob()
+	{
+		Job job;
+		{
+			std::lock_guard lock(m_queueMutex);
+			if (m_queue.empty())
+			{
+				return false;
+			}
+			job = std::move(m_queue.front());
+			m_queue.pop_front();
+		}
+
+		job();
+		return true;
+	}
+
+	void JobSystem::WaitFor(const std::atomic<uint32_t>& counter)
+	{
+		while (counter.load(std::memory_order_acquire) != 0)
+		{
+			if (!TryRunPendingJob())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::ParallelFor(size_t count, std::function<void(size_t, size_t)> job, size_t minBatchSize)
+	{
+		if (count < minBatchSize || m_numThreads <= 1 || m_workers.empty())
+		{
+			job(0, count);
+			return;
+		}
+
+		const size_t chunkSize = (count + m_numThreads - 1) / m_numThreads;
+		std::atomic<uint32_t> pending = 0;
 
-		for (unsigned int i = 0; i < m_numThreads - 1; ++i)
+		for (size_t startIndex = chunkSize; startIndex < count; startIndex += chunkSize)
 		{
-			size_t endIndex = startIndex + chunkSize;
+			const size_t endIndex = std::min(startIndex + chunkSize, count);
 
-			m_workers.emplace_back([job, startIndex, endIndex]()
+			pending.fetch_add(1, std::memory_order_relaxed);
+			Submit([&job, &pending, startIndex, endIndex]()
 			{
 				job(startIndex, endIndex);
+				pending.fetch_sub(1, std::memory_order_release);
 			});
-
-			startIndex = endIndex;
 		}
 
-		job(startIndex, count);
+		job(0, std::min(chunkSize, count));
 
-		for (auto& t : m_workers)
+		WaitFor(pending);
+	}
+
+	void JobSystem::WorkerLoop(unsigned int threadIndex)
+	{
+		t_ThreadIndex = threadIndex;
+
+		for (;;)
 		{
-			if (t.joinable())
+			Job job;
 			{
-				t.join();
+				std::unique_lock lock(m_queueMutex);
+				m_wakeCondition.wait(lock, [this]()
+				{
+					return !m_queue.empty() || !m_running.load(std::memory_order_relaxed);
+				});
+
+				if (m_queue.empty())
+				{
+					return;
+				}
+
+				job = std::move(m_queue.front());
+				m_queue.pop_front();
 			}
+
+			job();
 		}
-		m_workers.clear();
 	}
-}
\ No newline at end of file
+}
@@ -4,25 +4,91 @@
 
 #pragma once
 
+#include <NuEngine/Core/API.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <thread>
 #include <vector>
-#include <functional>
 
 namespace NuEngine::Core
 {
-	class JobSystem
+	/**
+	 * @brief Engine-wide worker pool.
+	 *
+	 * One set of persistent workers serves every subsystem (physics, scripts, render prep),
+	 * so the frame never runs more threads than there are cores.
+	 */
+	class NU_API JobSystem
 	{
 	public:
-		void Initialize();
+		using Job = std::function<void()>;
 
+		~JobSystem();
+
+		/**
+		 * @brief Starts the workers.
+		 *
+		 * @param numWorkers Number of background workers. 0 picks hardware_concurrency() - 1.
+		 */
+		void Initialize(unsigned int numWorkers = 0);
+
+		/**
+		 * @brief Drains the queue and joins the workers.
+		 */
 		void Shutdown();
 
-		void ParallelFor(size_t count, std::function<void(size_t, size_t)> job);
+		/**
+		 * @brief Queues a job for a worker. Runs it inline when the pool has no workers.
+		 */
+		void Submit(Job job);
+
+		/**
+		 * @brief Splits [0, count) into one range per thread and blocks until all ranges are done.
+		 *
+		 * The calling thread processes the first range and helps with queued jobs while waiting,
+		 * so it is safe to call from inside another job.
+		 */
+		void ParallelFor(size_t count, std::function<void(size_t, size_t)> job, size_t minBatchSize = 1000);
+
+		/**
+		 * @brief Runs queued jobs on the calling thread until the counter reaches zero.
+		 */
+		void WaitFor(const std::atomic<uint32_t>& counter);
+
+		/**
+		 * @brief Pops and runs one queued job on the calling thread.
+		 *
+		 * @return False if the queue was empty.
+		 */
+		bool TryRunPendingJob();
+
+		/**
+		 * @brief Number of threads that execute jobs (workers + the submitting thread).
+		 */
+		[[nodiscard]] unsigned int GetNumThreads() const noexcept { return m_numThreads; }
+
+		[[nodiscard]] bool IsInitialized() const noexcept { return m_running.load(std::memory_order_acquire); }
+
+		/**
+		 * @brief Index of the calling thread: 1..N for pool workers, 0 for any other thread.
+		 */
+		[[nodiscard]] static unsigned int GetThreadIndex() noexcept;
 
 		static JobSystem& Get();
 
 	private:
+		void WorkerLoop(unsigned int threadIndex);
+
 		std::vector<std::thread> m_workers;
-		unsigned int m_numThreads;
+		std::deque<Job> m_queue;
+		std::mutex m_queueMutex;
+		std::condition_variable m_wakeCondition;
+		std::atomic<bool> m_running = false;
+		unsigned int m_numThreads = 1;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace NuEngine::Core
+{
+    /**
+     * @brief FNV-1a over the bytes of text. constexpr, so names can be hashed at compile time.
+     *
+     * Fast and well spread for short identifiers; not meant for untrusted input or cryptography.
+     */
+    [[nodiscard]] constexpr uint32_t Fnv1a32(std::string_view text, uint32_t seed = 2166136261u) noexcept
+    {
+        uint32_t hash = seed;
+        for (const char c : text)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 64-bit FNV-1a, for keys built from large inputs where 32 bits would collide too easily.
+     */
+    [[nodiscard]] constexpr uint64_t Fnv1a64(std::string_view text, uint64_t seed = 14695981039346656037ull) noexcept
+    {
+        uint64_t hash = seed;
+        for (const char c : text)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
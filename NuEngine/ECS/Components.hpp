@@ -2,6 +2,9 @@
 
 #include <NuMath/NuMath.hpp>
 #include <Physics/Bodies/RigidBody.hpp>
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Material.hpp>
+#include <Renderer/Queue/RenderKey.hpp>
 #include <Core/API.hpp>
 
 #include <string>
@@ -30,6 +33,28 @@ namespace NuEngine::ECS
         RigidBodyComponent(const RigidBodyComponent&) = default;
     };
 
+    /**
+     * @brief Draws Mesh with Material at the entity's TransformComponent. Both must outlive the component.
+     */
+    struct NU_API MeshRendererComponent
+    {
+        const Renderer::Mesh* Mesh = nullptr;
+        const Renderer::Material* Material = nullptr;
+        Renderer::RenderPass Pass = Renderer::RenderPass::Opaque;
+        float BoundingRadius = 0.87f;  // Local-space sphere around the origin, scaled by the largest Scale axis; fits a unit cube
+    };
+
+    /**
+     * @brief Box rasterized into the CPU occlusion buffer; whatever it hides is not drawn.
+     *
+     * Local space, centred on the entity and scaled by its transform. Keep it inside the visible
+     * geometry it stands for (walls, floors, buildings), or objects behind the gaps disappear.
+     */
+    struct NU_API OccluderComponent
+    {
+        NuMath::Vector3 HalfExtents = { 0.5f, 0.5f, 0.5f };
+    };
+
     struct NU_API NameComponent
     {
         std::string Name = "Empty entity";
@@ -26,6 +26,9 @@ namespace NuEngine::Graphics
 		Int3,
 		Int4,
 		Bool,
+		Short4,     // Packed attributes for quantized meshes; declare them Normalized to read snorm values
+		Byte4,
+		Half2,
 	};
 
 	static uint32_t ShaderDataTypeSize(ShaderDataType type)
@@ -54,6 +57,12 @@ namespace NuEngine::Graphics
 				return 4 * 4;
 			case ShaderDataType::Bool:
 				return 1;
+			case ShaderDataType::Short4:
+				return 2 * 4;
+			case ShaderDataType::Byte4:
+				return 4;
+			case ShaderDataType::Half2:
+				return 2 * 2;
 		}
 		return 0;
 	}
@@ -65,11 +74,12 @@ namespace NuEngine::Graphics
 		uint32_t Size;
 		uint32_t Offset;
 		bool Normalized;
+		bool PerInstance;  // Advances once per instance instead of once per vertex
 
 		BufferElement() = default;
 
-		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
-			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false, bool perInstance = false)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized), PerInstance(perInstance)
 		{
 		}
 
@@ -99,6 +109,12 @@ namespace NuEngine::Graphics
 					return 4;
 				case ShaderDataType::Bool:
 					return 1;
+				case ShaderDataType::Short4:
+					return 4;
+				case ShaderDataType::Byte4:
+					return 4;
+				case ShaderDataType::Half2:
+					return 2;
 			}
 			return 0;
 		}
@@ -4,8 +4,24 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace NuEngine::Graphics
 {
+	/*
+	* @brief Width of each index. UInt16 halves the index fetch for meshes of up to 65536 vertices.
+	*/
+	enum class IndexFormat : uint32_t
+	{
+		UInt16 = 0,
+		UInt32 = 1
+	};
+
+	[[nodiscard]] constexpr uint32_t IndexFormatSize(IndexFormat format) noexcept
+	{
+		return format == IndexFormat::UInt16 ? 2 : 4;
+	}
+
 	class IIndexBuffer
 	{
 	public:
@@ -15,5 +31,11 @@ namespace NuEngine::Graphics
 		virtual void Unbind() const = 0;
 
 		virtual unsigned int GetCount() const = 0;
+		virtual IndexFormat GetFormat() const = 0;
+
+		/*
+		* @brief Backend name of the buffer, so vertex arrays can attach it without binding it. 0 when there is none.
+		*/
+		virtual uint32_t GetID() const { return 0; }
 	};
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/IVertexBuffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Block of a streaming buffer the CPU may write this frame. Invalid when the request could not fit.
+	*/
+	struct StreamingAllocation
+	{
+		std::byte* Data = nullptr;
+		uint32_t Offset = 0;   // From the start of the whole buffer, as the GPU sees it
+		uint32_t Size = 0;
+
+		[[nodiscard]] bool IsValid() const noexcept { return Data != nullptr; }
+	};
+
+	/*
+	* @brief Counters since creation or the last ResetStats().
+	*/
+	struct StreamingBufferStats
+	{
+		uint32_t Allocations = 0;
+		uint64_t BytesAllocated = 0;
+		uint32_t FenceWaits = 0;       // Region reused after a fence was placed on it
+		uint32_t BlockingWaits = 0;    // ...and the GPU had not finished with it yet
+		uint32_t Overflows = 0;        // A frame ran out of region and had to wait for its own draws
+		uint32_t FailedAllocations = 0;
+	};
+
+	/*
+	* @brief Always-mapped ring of k_RegionCount equal regions for data rewritten every frame.
+	*
+	* The CPU writes into the current region while the GPU still reads the previous ones. Each
+	* NextFrame() fences the region just filled and moves on; a region is only handed out again
+	* once its fence has passed, so nothing is overwritten while in flight and nothing is orphaned.
+	*
+	* Also usable as a vertex buffer: SetData() copies into a fresh allocation aligned to the
+	* layout stride and GetDataOffset() tells where, so draws pick it up through baseInstance.
+	* One SetData() holds at most GetMaxDataSize() bytes; more has to go up in several parts.
+	*/
+	class IStreamingBuffer : public IVertexBuffer
+	{
+	public:
+		static constexpr uint32_t k_RegionCount = 3;
+
+		~IStreamingBuffer() override = default;
+
+		/*
+		* @brief Sub-allocates size bytes from the current region. Offset is a multiple of alignment.
+		*
+		* When the region is full the CPU waits for the draws issued so far and starts it over, so
+		* allocations whose draws have not been issued yet must not be kept across that point.
+		*/
+		[[nodiscard]] virtual StreamingAllocation Allocate(uint32_t size, uint32_t alignment = 16) = 0;
+
+		/*
+		* @brief Call once per frame, after the last draw reading this frame's allocations was issued.
+		*/
+		virtual void NextFrame() = 0;
+
+		virtual uint32_t GetRegionSize() const = 0;
+		virtual uint32_t GetCurrentRegion() const = 0;
+
+		virtual const StreamingBufferStats& GetStats() const = 0;
+		virtual void ResetStats() = 0;
+	};
+}
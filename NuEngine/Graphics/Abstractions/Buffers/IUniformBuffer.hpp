@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstdint>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief GPU copy of a std140 uniform block, attached to a fixed binding point.
+	*
+	* Every shader whose block is bound to the same point (see UniformBlocks) reads it, so data
+	* shared by all draws is uploaded once instead of once per program.
+	*/
+	class IUniformBuffer
+	{
+	public:
+		virtual ~IUniformBuffer() = default;
+
+		/*
+		* @brief Attaches the buffer to its binding point again, in case something else replaced it.
+		*/
+		virtual void Bind() const = 0;
+
+		/*
+		* @brief Overwrites size bytes at offset. The range must fit in GetSize().
+		*/
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		virtual uint32_t GetSize() const = 0;
+		virtual uint32_t GetBinding() const = 0;
+	};
+}
@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 
+#include <Graphics/Abstractions/Core/ResourceID.hpp>
 #include <Graphics/Abstractions/Buffers/IIndexBuffer.hpp>
 #include <Graphics/Abstractions/Buffers/IVertexBuffer.hpp>
 
@@ -25,5 +26,13 @@ namespace NuEngine::Graphics
 
 		virtual const std::vector<std::shared_ptr<IVertexBuffer>>& GetVertexBuffer() const = 0;
 		virtual const std::shared_ptr<IIndexBuffer>& GetIndexBuffer() const = 0;
+
+		/*
+		* @brief Never shared with another vertex array, unlike its address, which a later allocation may reuse.
+		*/
+		uint64_t GetUniqueID() const noexcept { return m_UniqueID; }
+
+	private:
+		uint64_t m_UniqueID = NextResourceID();
 	};
 }
\ No newline at end of file
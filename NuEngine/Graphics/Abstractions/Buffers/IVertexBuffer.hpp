@@ -6,6 +6,8 @@
 
 #include <Graphics/Abstractions/Buffers/BufferLayout.hpp>
 
+#include <cstdint>
+
 namespace NuEngine::Graphics
 {
 	class IVertexBuffer
@@ -16,6 +18,27 @@ namespace NuEngine::Graphics
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
+		/*
+		* @brief Replaces the buffer contents, growing it if needed. Intended for per-frame streaming data.
+		* Returns false when the data could not be placed; GetDataOffset() is meaningless then.
+		*/
+		virtual bool SetData(const void* data, uint32_t size) = 0;
+
+		/*
+		* @brief Byte offset at which the last SetData() placed its data. Always 0 unless the buffer streams.
+		*/
+		virtual uint32_t GetDataOffset() const { return 0; }
+
+		/*
+		* @brief Largest size one SetData() is guaranteed to place. Bigger data has to be uploaded in parts.
+		*/
+		virtual uint32_t GetMaxDataSize() const { return UINT32_MAX; }
+
+		/*
+		* @brief Backend name of the buffer, so vertex arrays can attach it without binding it. 0 when there is none.
+		*/
+		virtual uint32_t GetID() const { return 0; }
+
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 	};
@@ -0,0 +1,101 @@
+#include <Graphics/Abstractions/Buffers/StreamingBuffer.hpp>
+#include <Core/Logging/Logger.hpp>
+
+#include <cstring>
+
+namespace NuEngine::Graphics
+{
+	StreamingAllocation StreamingBuffer::Allocate(uint32_t size, uint32_t alignment)
+	{
+		if (!m_Memory || size == 0 || size > m_RegionSize || alignment == 0)
+		{
+			m_Stats.FailedAllocations++;
+			return {};
+		}
+
+		// Align the absolute offset, so regions need not be a multiple of the alignment
+		const uint64_t regionBase = static_cast<uint64_t>(m_Region) * m_RegionSize;
+		uint64_t offset = (regionBase + m_Cursor + alignment - 1) / alignment * alignment;
+
+		if (offset + size > regionBase + m_RegionSize)
+		{
+			// Out of room mid-frame: everything issued so far has to finish before the region restarts
+			m_Stats.Overflows++;
+			InsertFence(m_Region);
+			m_Fenced[m_Region] = true;
+			WaitRegion(m_Region);
+
+			offset = (regionBase + alignment - 1) / alignment * alignment;
+			if (offset + size > regionBase + m_RegionSize)
+			{
+				m_Cursor = 0;
+				m_Stats.FailedAllocations++;
+				return {};
+			}
+		}
+
+		m_Cursor = static_cast<uint32_t>(offset + size - regionBase);
+		m_Stats.Allocations++;
+		m_Stats.BytesAllocated += size;
+
+		StreamingAllocation allocation;
+		allocation.Data = m_Memory + offset;
+		allocation.Offset = static_cast<uint32_t>(offset);
+		allocation.Size = size;
+		return allocation;
+	}
+
+	void StreamingBuffer::NextFrame()
+	{
+		InsertFence(m_Region);
+		m_Fenced[m_Region] = true;
+
+		m_Region = (m_Region + 1) % k_RegionCount;
+		m_Cursor = 0;
+		WaitRegion(m_Region);
+	}
+
+	bool StreamingBuffer::SetData(const void* data, uint32_t size)
+	{
+		const uint32_t stride = m_Layout.GetStride();
+		const StreamingAllocation allocation = Allocate(size, stride > 0 ? stride : 16);
+		if (!allocation.IsValid())
+		{
+			LOG_ERROR("Streaming buffer cannot fit {} bytes in a {} byte region", size, m_RegionSize);
+			m_DataOffset = 0;
+			return false;
+		}
+
+		std::memcpy(allocation.Data, data, size);
+		m_DataOffset = allocation.Offset;
+		return true;
+	}
+
+	uint32_t StreamingBuffer::GetMaxDataSize() const
+	{
+		const uint32_t stride = m_Layout.GetStride() > 0 ? m_Layout.GetStride() : 16;
+		if (m_RegionSize % stride == 0)
+		{
+			return m_RegionSize;
+		}
+
+		// A region starting off the stride loses up to stride - 1 bytes to alignment
+		const uint32_t strides = m_RegionSize / stride;
+		return strides > 0 ? (strides - 1) * stride : 0;
+	}
+
+	void StreamingBuffer::WaitRegion(uint32_t region)
+	{
+		if (!m_Fenced[region])
+		{
+			return;
+		}
+
+		m_Stats.FenceWaits++;
+		if (WaitFence(region))
+		{
+			m_Stats.BlockingWaits++;
+		}
+		m_Fenced[region] = false;
+	}
+}
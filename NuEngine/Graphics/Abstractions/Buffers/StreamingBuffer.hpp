@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/IStreamingBuffer.hpp>
+#include <NuEngine/Core/API.hpp>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Sub-allocation and fence bookkeeping shared by every IStreamingBuffer backend.
+	*
+	* A backend maps k_RegionCount * regionSize bytes, hands the pointer to SetMappedMemory() and
+	* implements the two fence primitives; allocation, region rotation and the overflow path
+	* live here, so they are tested against the null device.
+	*/
+	class NU_API StreamingBuffer : public IStreamingBuffer
+	{
+	public:
+		[[nodiscard]] StreamingAllocation Allocate(uint32_t size, uint32_t alignment = 16) override;
+		void NextFrame() override;
+
+		/*
+		* @brief Copies into a new allocation aligned to the layout stride, so GetDataOffset() / stride is a valid baseInstance.
+		*/
+		bool SetData(const void* data, uint32_t size) override;
+		uint32_t GetDataOffset() const override { return m_DataOffset; }
+
+		/*
+		* @brief Whole strides that fit in a region however its start is aligned.
+		*/
+		uint32_t GetMaxDataSize() const override;
+
+		const BufferLayout& GetLayout() const override { return m_Layout; }
+		void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		uint32_t GetRegionSize() const override { return m_RegionSize; }
+		uint32_t GetCurrentRegion() const override { return m_Region; }
+
+		const StreamingBufferStats& GetStats() const override { return m_Stats; }
+		void ResetStats() override { m_Stats = {}; }
+
+	protected:
+		explicit StreamingBuffer(uint32_t regionSize) noexcept : m_RegionSize(regionSize) {}
+
+		void SetMappedMemory(std::byte* memory) noexcept { m_Memory = memory; }
+
+		/*
+		* @brief Marks the point after which the GPU is done with everything issued so far for region.
+		*/
+		virtual void InsertFence(uint32_t region) = 0;
+
+		/*
+		* @brief Waits for the fence InsertFence() placed on region. Returns true if the CPU had to block.
+		*/
+		virtual bool WaitFence(uint32_t region) = 0;
+
+	private:
+		void WaitRegion(uint32_t region);
+
+		std::byte* m_Memory = nullptr;
+		uint32_t m_RegionSize;
+		uint32_t m_Region = 0;
+		uint32_t m_Cursor = 0;
+		uint32_t m_DataOffset = 0;
+		bool m_Fenced[k_RegionCount] = {};
+		BufferLayout m_Layout;
+		StreamingBufferStats m_Stats;
+	};
+}
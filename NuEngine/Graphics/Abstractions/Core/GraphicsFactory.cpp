@@ -1,5 +1,7 @@
 #include <Graphics/Abstractions/Core/GraphicsFactory.hpp>
 #include <Graphics/Backends/OpenGL/Core/OpenGLFactory.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/RecordingRenderDevice.hpp>
 
 namespace NuEngine::Graphics
 {
@@ -11,6 +13,12 @@ namespace NuEngine::Graphics
         case GraphicsAPI::OpenGL:
             return OpenGL::OpenGLFactory::CreateDevice(window);
 
+        case GraphicsAPI::Null:
+            return Core::Ok(std::unique_ptr<IRenderDevice>(std::make_unique<Null::NullRenderDevice>()));
+
+        case GraphicsAPI::Recording:
+            return Core::Ok(std::unique_ptr<IRenderDevice>(std::make_unique<Null::RecordingRenderDevice>()));
+
         case GraphicsAPI::Vulkan:
         case GraphicsAPI::DirectX:
         default:
@@ -21,6 +21,8 @@ namespace NuEngine::Graphics
         OpenGL,   //Use OpenGL backend 
         Vulkan,   // Use Vulkan backend (not yet implemented)
         DirectX,  // Use DirectX backend (not yet implemented)
+        Null,     // No-op device with call counters; needs no window or GPU
+        Recording // Null device that also logs every call, for tests
     };
 
     /*
@@ -38,7 +40,7 @@ namespace NuEngine::Graphics
         * @brief Creates a rendering device for the specified graphics API.
         *
         * @param api The graphics API to use (OpenGL, Vulkan, DirectX)
-        * @param window Pointer to the platform window where rendering will occur
+        * @param window Pointer to the platform window where rendering will occur (ignored by Null/Recording)
         * @return A Result containing a unique pointer to IRenderDevice on success or a GraphicsError on failure.
         *
         * @note Vulkan and DirectX are currently not implemented.
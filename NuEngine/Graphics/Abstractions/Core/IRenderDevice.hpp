@@ -6,19 +6,35 @@
 
 #include <Core/Types/Result.hpp>
 #include <Graphics/Errors/GraphicsError.hpp>
+#include <Graphics/Abstractions/Core/PipelineState.hpp>
+#include <Graphics/Abstractions/Core/RenderStateCache.hpp>
 #include <Graphics/Abstractions/Buffers/IVertexArray.hpp>
 #include <Graphics/Abstractions/Buffers/IVertexBuffer.hpp>
 #include <Graphics/Abstractions/Buffers/IIndexBuffer.hpp>
+#include <Graphics/Abstractions/Buffers/IStreamingBuffer.hpp>
+#include <Graphics/Abstractions/Buffers/IUniformBuffer.hpp>
 #include <Graphics/Abstractions/Shaders/IShader.hpp>
 #include <Graphics/Abstractions/Textures/ITexture.hpp>
+#include <Graphics/Abstractions/Textures/TextureStreamer.hpp>
 #include <NuMath/NuMath.hpp>
 
+#include <span>
 #include <string>
+#include <vector>
 
 namespace NuEngine::Graphics
 {
 	class IShader;
 
+	/*
+	* @brief Sources of one shader program, for batch creation with IRenderDevice::CreateShaders.
+	*/
+	struct ShaderSource
+	{
+		std::string Vertex;
+		std::string Fragment;
+	};
+
 	/*
 	* @brief
 	*/
@@ -42,16 +58,98 @@ namespace NuEngine::Graphics
 
 		virtual [[nodiscard]] Core::Result<std::shared_ptr<IShader>, GraphicsError> CreateShader(const std::string& vertexSrc, const std::string& fragmentSrc) noexcept = 0;
 
+		/*
+		* @brief Creates several programs at once, one result per source in the same order.
+		*
+		* Backends that can compile in the background start every program before waiting on any.
+		*/
+		virtual [[nodiscard]] std::vector<Core::Result<std::shared_ptr<IShader>, GraphicsError>> CreateShaders(std::span<const ShaderSource> sources) noexcept
+		{
+			std::vector<Core::Result<std::shared_ptr<IShader>, GraphicsError>> shaders;
+			shaders.reserve(sources.size());
+			for (const ShaderSource& source : sources)
+			{
+				shaders.push_back(CreateShader(source.Vertex, source.Fragment));
+			}
+			return shaders;
+		}
+
 		virtual [[nodiscard]] std::shared_ptr<IVertexArray> CreateVertexArray() = 0;
 		virtual [[nodiscard]] std::shared_ptr<IVertexBuffer> CreateVertexBuffer(float* vertices, unsigned int size) = 0;
+
+		/*
+		* @brief Vertex buffer meant to be refilled every frame through IVertexBuffer::SetData.
+		*/
+		virtual [[nodiscard]] std::shared_ptr<IVertexBuffer> CreateDynamicVertexBuffer(unsigned int size) = 0;
+
+		/*
+		* @brief Persistently mapped ring of IStreamingBuffer::k_RegionCount regions of regionSize bytes each.
+		*/
+		virtual [[nodiscard]] std::shared_ptr<IStreamingBuffer> CreateStreamingBuffer(uint32_t regionSize) = 0;
 		virtual [[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(unsigned int* indices, unsigned int count) = 0;
+
+		/*
+		* @brief Index buffer of count indices of the given width, copied from indices (e.g. straight out of a mapped file).
+		*/
+		virtual [[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(const void* indices, unsigned int count, IndexFormat format) = 0;
 		virtual [[nodiscard]] std::shared_ptr<ITexture> CreateTexture(const std::string& path) = 0;
 
+		/*
+		* @brief Streamer owned by the device. Its Update() must run once per frame on the render thread.
+		*/
+		virtual [[nodiscard]] TextureStreamer& GetTextureStreamer() = 0;
+
+		/*
+		* @brief Returns at once with a placeholder; the file is decoded on the JobSystem and uploaded over the next frames.
+		*/
+		[[nodiscard]] inline std::shared_ptr<ITexture> CreateTextureAsync(const std::string& path)
+		{
+			return GetTextureStreamer().Request(path);
+		}
+
+		/*
+		* @brief Uniform buffer of size bytes attached to binding (one of UniformBlocks::k_*Binding).
+		*/
+		virtual [[nodiscard]] std::shared_ptr<IUniformBuffer> CreateUniformBuffer(uint32_t size, uint32_t binding) = 0;
+
 		/*
 		* @brief
 		*/
 		virtual [[nodiscard]] Core::Result<void, GraphicsError> DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept = 0;
 
+		/*
+		* @brief Makes shader current for the following draws. nullptr unbinds.
+		*
+		* Binding what is already bound is skipped, so callers need not track it or unbind after drawing.
+		*/
+		virtual void BindShader(IShader* shader) noexcept = 0;
+
+		/*
+		* @brief Binds texture to a sampler slot. nullptr unbinds the slot. Redundant binds are skipped.
+		*/
+		virtual void BindTexture(ITexture* texture, uint32_t slot = 0) noexcept = 0;
+
+		/*
+		* @brief Sets depth, blend and cull state for the following draws, changing only the fields that differ.
+		*/
+		virtual void BindPipelineState(const PipelineState& state) noexcept = 0;
+
+		/*
+		* @brief State changes made and binds skipped during the last frame, which Present() ends.
+		*/
+		virtual [[nodiscard]] const StateChangeStats& GetStateChangeStats() const noexcept = 0;
+
+		/*
+		* @brief Draws instanceCount copies of the vertex array. Per-instance attributes start at baseInstance.
+		*
+		* Uses the index buffer when the vertex array has one; otherwise draws vertexCount vertices.
+		*/
+		virtual [[nodiscard]] Core::Result<void, GraphicsError> DrawInstanced(
+			const std::shared_ptr<IVertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0) noexcept = 0;
+
 		/*
 		* @brief
 		*/
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstdint>
+
+namespace NuEngine::Graphics
+{
+	enum class DepthCompare : uint8_t
+	{
+		Less = 0,
+		LessEqual,
+		Equal,
+		Greater,
+		GreaterEqual,
+		Always
+	};
+
+	enum class BlendMode : uint8_t
+	{
+		Opaque = 0,     // Blending off
+		Alpha,          // src * a + dst * (1 - a)
+		Additive,       // src * a + dst
+		Premultiplied   // src + dst * (1 - a)
+	};
+
+	enum class CullMode : uint8_t
+	{
+		None = 0,
+		Back,
+		Front
+	};
+
+	/*
+	* @brief Fixed-function state of a draw. The defaults are what the device starts with.
+	*/
+	struct PipelineStateDesc
+	{
+		bool DepthTest = true;
+		bool DepthWrite = true;
+		DepthCompare Depth = DepthCompare::Less;
+		BlendMode Blend = BlendMode::Opaque;
+		CullMode Cull = CullMode::None;
+
+		[[nodiscard]] bool operator==(const PipelineStateDesc&) const noexcept = default;
+	};
+
+	/*
+	* @brief Immutable PipelineStateDesc, built once and shared by every material that draws with it.
+	*
+	* The whole state packs into GetKey(), so devices decide whether anything changed with a single
+	* compare and only then look at the individual fields.
+	*/
+	class PipelineState
+	{
+	public:
+		PipelineState() noexcept : PipelineState(PipelineStateDesc{}) {}
+
+		explicit PipelineState(const PipelineStateDesc& desc) noexcept
+			: m_Desc(desc)
+			, m_Key(uint32_t(desc.DepthTest)
+				| uint32_t(desc.DepthWrite) << 1
+				| uint32_t(desc.Depth) << 2
+				| uint32_t(desc.Blend) << 8
+				| uint32_t(desc.Cull) << 12)
+		{
+		}
+
+		[[nodiscard]] const PipelineStateDesc& GetDesc() const noexcept { return m_Desc; }
+
+		/*
+		* @brief Equal keys mean equal state.
+		*/
+		[[nodiscard]] uint32_t GetKey() const noexcept { return m_Key; }
+
+		/*
+		* @brief Depth tested and written, no blending, no culling.
+		*/
+		[[nodiscard]] static const PipelineState& Default() noexcept
+		{
+			static const PipelineState state;
+			return state;
+		}
+
+	private:
+		PipelineStateDesc m_Desc;
+		uint32_t m_Key;
+	};
+}
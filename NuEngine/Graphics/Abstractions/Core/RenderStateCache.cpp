@@ -0,0 +1,83 @@
+#include <Graphics/Abstractions/Core/RenderStateCache.hpp>
+
+namespace NuEngine::Graphics
+{
+	bool RenderStateCache::SetShader(uint64_t shader) noexcept
+	{
+		if (m_ShaderKnown && shader == m_Shader)
+		{
+			m_CurrentFrame.RedundantBinds++;
+			return false;
+		}
+
+		m_Shader = shader;
+		m_ShaderKnown = true;
+		m_CurrentFrame.ShaderChanges++;
+		return true;
+	}
+
+	bool RenderStateCache::SetTexture(uint64_t texture, uint32_t slot) noexcept
+	{
+		// Slots past the cache are always bound, never skipped
+		if (slot >= k_MaxTextureSlots)
+		{
+			m_CurrentFrame.TextureChanges++;
+			return true;
+		}
+
+		const uint32_t bit = 1u << slot;
+		if ((m_TexturesKnown & bit) && texture == m_Textures[slot])
+		{
+			m_CurrentFrame.RedundantBinds++;
+			return false;
+		}
+
+		m_Textures[slot] = texture;
+		m_TexturesKnown |= bit;
+		m_CurrentFrame.TextureChanges++;
+		return true;
+	}
+
+	bool RenderStateCache::SetVertexArray(uint64_t vertexArray) noexcept
+	{
+		if (m_VertexArrayKnown && vertexArray == m_VertexArray)
+		{
+			m_CurrentFrame.RedundantBinds++;
+			return false;
+		}
+
+		m_VertexArray = vertexArray;
+		m_VertexArrayKnown = true;
+		m_CurrentFrame.VertexArrayChanges++;
+		return true;
+	}
+
+	bool RenderStateCache::SetPipeline(const PipelineState& state) noexcept
+	{
+		if (m_PipelineKnown && state.GetKey() == m_PipelineKey)
+		{
+			m_CurrentFrame.RedundantBinds++;
+			return false;
+		}
+
+		m_PipelineDesc = state.GetDesc();
+		m_PipelineKey = state.GetKey();
+		m_PipelineKnown = true;
+		m_CurrentFrame.PipelineChanges++;
+		return true;
+	}
+
+	void RenderStateCache::Invalidate() noexcept
+	{
+		m_ShaderKnown = false;
+		m_TexturesKnown = 0;
+		m_VertexArrayKnown = false;
+		m_PipelineKnown = false;
+	}
+
+	void RenderStateCache::EndFrame() noexcept
+	{
+		m_LastFrame = m_CurrentFrame;
+		m_CurrentFrame = {};
+	}
+}
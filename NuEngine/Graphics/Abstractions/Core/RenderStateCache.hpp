@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Core/PipelineState.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief State changes a device actually made during one frame, and the binds it skipped.
+	*/
+	struct StateChangeStats
+	{
+		uint32_t ShaderChanges = 0;
+		uint32_t TextureChanges = 0;
+		uint32_t VertexArrayChanges = 0;
+		uint32_t PipelineChanges = 0;
+		uint32_t RedundantBinds = 0;        // Binds of what was already bound, never sent to the API
+
+		[[nodiscard]] uint32_t GetTotalChanges() const noexcept
+		{
+			return ShaderChanges + TextureChanges + VertexArrayChanges + PipelineChanges;
+		}
+	};
+
+	/*
+	* @brief What a device last bound, so binds that match it can be skipped.
+	*
+	* Each Set*() records the new binding and returns true only when it differs from the current
+	* one; the device issues the API call in that case alone. Resources are compared by GetUniqueID()
+	* (0 for none), never by API name or address, which are reused once freed: a texture created
+	* after the bound one was deleted is still bound. A StreamedTexture reports the ID of what it
+	* wraps, so one whose placeholder was swapped is rebound too.
+	*/
+	class NU_API RenderStateCache
+	{
+	public:
+		static constexpr uint32_t k_MaxTextureSlots = 32;
+
+		[[nodiscard]] bool SetShader(uint64_t shader) noexcept;
+		[[nodiscard]] bool SetTexture(uint64_t texture, uint32_t slot) noexcept;
+		[[nodiscard]] bool SetVertexArray(uint64_t vertexArray) noexcept;
+
+		[[nodiscard]] bool SetPipeline(const PipelineState& state) noexcept;
+
+		/*
+		* @brief The pipeline state bound now, or nullptr when it is not known.
+		*/
+		[[nodiscard]] const PipelineStateDesc* GetPipeline() const noexcept { return m_PipelineKnown ? &m_PipelineDesc : nullptr; }
+
+		/*
+		* @brief Forgets every binding, so the next bind of each kind goes through. For when the API
+		* state was changed behind the device's back.
+		*/
+		void Invalidate() noexcept;
+
+		/*
+		* @brief Closes the current frame; GetFrameStats() then reports it until the next EndFrame().
+		*/
+		void EndFrame() noexcept;
+
+		[[nodiscard]] const StateChangeStats& GetFrameStats() const noexcept { return m_LastFrame; }
+		[[nodiscard]] const StateChangeStats& GetCurrentFrameStats() const noexcept { return m_CurrentFrame; }
+
+	private:
+		uint64_t m_Shader = 0;
+		uint64_t m_Textures[k_MaxTextureSlots] = {};
+		uint64_t m_VertexArray = 0;
+		PipelineStateDesc m_PipelineDesc;
+		uint32_t m_PipelineKey = 0;
+
+		// Null and zero are real bindings too, so validity is tracked separately
+		bool m_ShaderKnown = false;
+		uint32_t m_TexturesKnown = 0;
+		bool m_VertexArrayKnown = false;
+		bool m_PipelineKnown = false;
+
+		StateChangeStats m_CurrentFrame;
+		StateChangeStats m_LastFrame;
+	};
+}
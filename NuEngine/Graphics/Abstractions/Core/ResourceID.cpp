@@ -0,0 +1,13 @@
+#include <Graphics/Abstractions/Core/ResourceID.hpp>
+
+#include <atomic>
+
+namespace NuEngine::Graphics
+{
+	uint64_t NextResourceID() noexcept
+	{
+		// Atomic: nothing ties resource creation to a single thread
+		static std::atomic<uint64_t> s_NextID = 1;
+		return s_NextID.fetch_add(1, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief An ID no other graphics resource in the process ever had. Never 0, so 0 can stand for none.
+	*
+	* API names and addresses are handed out again once freed; these are not, so a cache keyed on them
+	* cannot mistake a new resource for a deleted one.
+	*/
+	[[nodiscard]] NU_API uint64_t NextResourceID() noexcept;
+}
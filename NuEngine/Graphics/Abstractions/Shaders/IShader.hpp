@@ -4,10 +4,10 @@
 
 #pragma once
 
+#include <Graphics/Abstractions/Core/ResourceID.hpp>
+#include <Graphics/Abstractions/Shaders/UniformID.hpp>
 #include <NuMath/NuMath.hpp>
 
-#include <string>
-
 namespace NuEngine::Graphics
 {
 	typedef unsigned int GLuint;
@@ -22,12 +22,26 @@ namespace NuEngine::Graphics
 
 		virtual GLuint GetID() const = 0;
 
-		virtual void SetInt(const std::string& name, int value) = 0;
-		virtual void SetFloat(const std::string& name, float value) = 0;
-		virtual void SetVec2(const std::string& name, const NuMath::Vector2& vec2) = 0;
-		virtual void SetVec3(const std::string& name, const NuMath::Vector3& vec3) = 0;
-		virtual void SetVec4(const std::string& name, const NuMath::Vector4& vec4) = 0;
-		virtual void SetColor(const std::string& name, const NuMath::Color& color) = 0;
-		virtual void SetMat4x4(const std::string& name, const NuMath::Matrix4x4& mat4x4) = 0;
+		/*
+		* @brief Never shared with another shader, unlike GetID(), which GL reuses once the program is deleted.
+		*/
+		uint64_t GetUniqueID() const noexcept { return m_UniqueID; }
+
+		/*
+		* @brief Uniform setters. They write the program directly, bound or not; unknown IDs are ignored (and logged once).
+		*
+		* Camera matrices live in the Frame uniform block rather than per-program uniforms,
+		* see IRenderDevice::CreateUniformBuffer.
+		*/
+		virtual void SetInt(UniformID id, int value) = 0;
+		virtual void SetFloat(UniformID id, float value) = 0;
+		virtual void SetVec2(UniformID id, const NuMath::Vector2& vec2) = 0;
+		virtual void SetVec3(UniformID id, const NuMath::Vector3& vec3) = 0;
+		virtual void SetVec4(UniformID id, const NuMath::Vector4& vec4) = 0;
+		virtual void SetColor(UniformID id, const NuMath::Color& color) = 0;
+		virtual void SetMat4x4(UniformID id, const NuMath::Matrix4x4& mat4x4) = 0;
+
+	private:
+		uint64_t m_UniqueID = NextResourceID();
 	};
 } //namespace NuEngine::Graphics
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/Types/Hash.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <string_view>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Hashed uniform or uniform block name.
+	*
+	* String literals convert at compile time, so SetMat4x4("model", ...) costs no hashing at
+	* draw time. Names only known at run time go through FromName(). Array uniforms are
+	* addressed by their base name ("lights", not "lights[0]").
+	*/
+	struct UniformID
+	{
+		uint32_t Value = 0;
+
+		constexpr UniformID() noexcept = default;
+
+		template<size_t N>
+		consteval UniformID(const char (&name)[N]) noexcept
+			: Value(Core::Fnv1a32(std::string_view(name, N - 1)))
+		{
+		}
+
+		[[nodiscard]] static constexpr UniformID FromName(std::string_view name) noexcept
+		{
+			UniformID id;
+			id.Value = Core::Fnv1a32(name);
+			return id;
+		}
+
+		[[nodiscard]] constexpr bool operator==(const UniformID&) const noexcept = default;
+		[[nodiscard]] constexpr auto operator<=>(const UniformID&) const noexcept = default;
+	};
+
+	/*
+	* @brief Uniforms the built-in shaders (Resources/Shaders) use outside of uniform blocks.
+	*/
+	namespace Uniforms
+	{
+		inline constexpr UniformID Model = "model";
+		inline constexpr UniformID Texture = "u_Texture";
+	}
+
+	/*
+	* @brief Uniform block names and the binding points the shader reflection pass assigns to them.
+	*
+	* GLSL 330 cannot declare a block's binding, so the backend matches block names against this
+	* table after link. The renderer uploads each block once and every program shares it.
+	*/
+	struct UniformBlockBinding
+	{
+		UniformID Block;
+		uint32_t Binding;
+	};
+
+	namespace UniformBlocks
+	{
+		// Camera and other data that is the same for every draw of a frame
+		inline constexpr uint32_t k_FrameBinding = 0;
+
+		inline constexpr UniformBlockBinding k_Bindings[] = {
+			{ "Frame", k_FrameBinding }
+		};
+	}
+}
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <Graphics/Abstractions/Core/ResourceID.hpp>
+
+#include <cstdint>
 #include <string>
 
 namespace NuEngine::Graphics
@@ -20,5 +23,15 @@ namespace NuEngine::Graphics
 		virtual int GetHeight() const = 0;
 
 		virtual const std::string& GetPath() const = 0;
+
+		virtual unsigned int GetID() const = 0;
+
+		/*
+		* @brief Never shared with another texture, unlike GetID(), which GL reuses once the texture is deleted.
+		*/
+		virtual uint64_t GetUniqueID() const { return m_UniqueID; }
+
+	private:
+		uint64_t m_UniqueID = NextResourceID();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Textures/ITexture.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Backend half of texture streaming: creates storage and copies decoded rows into it.
+	*
+	* Only called from the render thread, by TextureStreamer::Update().
+	*/
+	class ITextureUploader
+	{
+	public:
+		virtual ~ITextureUploader() = default;
+
+		/*
+		* @brief Shared 1x1 white texture handed out while the real one is loading or after it failed.
+		*/
+		virtual std::shared_ptr<ITexture> GetPlaceholder() = 0;
+
+		/*
+		* @brief Texture with storage for every mip level and undefined contents. channels is 1 to 4.
+		*/
+		virtual std::shared_ptr<ITexture> CreateTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels) = 0;
+
+		/*
+		* @brief Copies rowCount tightly packed rows, starting at firstRow, into mip level 0.
+		*/
+		virtual void UploadRows(ITexture& texture, uint32_t firstRow, uint32_t rowCount, const std::byte* pixels) = 0;
+
+		/*
+		* @brief Called once every row is uploaded; builds the mip chain.
+		*/
+		virtual void FinishTexture(ITexture& texture) = 0;
+	};
+}
@@ -0,0 +1,70 @@
+#include <Graphics/Abstractions/Textures/NuTexFile.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace NuEngine::Graphics
+{
+	Core::Result<NuTexFile, GraphicsError> NuTexFile::Open(const std::filesystem::path& path)
+	{
+		auto mapped = Core::MappedFile::Open(path);
+		if (mapped.IsError())
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Failed to map texture: " + path.string()));
+		}
+
+		NuTexFile file;
+		file.m_File = std::move(mapped).Unwrap();
+
+		const std::span<const std::byte> bytes = file.m_File.GetBytes();
+		if (bytes.size() < sizeof(NuTex::Header))
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Truncated .nutex header: " + path.string()));
+		}
+
+		NuTex::Header& header = file.m_Header;
+		std::memcpy(&header, bytes.data(), sizeof(header));
+
+		if (header.Magic != NuTex::k_Magic || header.Version != NuTex::k_Version)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Not a version " + std::to_string(NuTex::k_Version) + " .nutex file: " + path.string()));
+		}
+
+		if (header.Format > TexturePixelFormat::BC7 || header.Width == 0 || header.Height == 0
+			|| header.MipCount == 0 || header.MipCount > 32)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Invalid .nutex header: " + path.string()));
+		}
+
+		const size_t tableEnd = sizeof(NuTex::Header) + sizeof(NuTex::Level) * header.MipCount;
+		if (bytes.size() < tableEnd)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Truncated .nutex level table: " + path.string()));
+		}
+
+		// The header is 32 bytes and the mapping page aligned, so the table can be used in place
+		file.m_Levels = { reinterpret_cast<const NuTex::Level*>(bytes.data() + sizeof(NuTex::Header)), header.MipCount };
+
+		for (uint32_t mip = 0; mip < header.MipCount; ++mip)
+		{
+			const NuTex::Level& level = file.m_Levels[mip];
+			const uint32_t width = std::max(header.Width >> mip, 1u);
+			const uint32_t height = std::max(header.Height >> mip, 1u);
+
+			if (level.Width != width || level.Height != height
+				|| level.Size != GetTextureLevelSize(header.Format, width, height)
+				|| level.Offset < tableEnd || level.Offset > bytes.size() || level.Size > bytes.size() - level.Offset)
+			{
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Corrupt .nutex level " + std::to_string(mip) + ": " + path.string()));
+			}
+		}
+
+		return Core::Ok(std::move(file));
+	}
+
+	std::span<const std::byte> NuTexFile::GetLevelData(uint32_t mip) const noexcept
+	{
+		const NuTex::Level& level = m_Levels[mip];
+		return { m_File.GetData() + level.Offset, static_cast<size_t>(level.Size) };
+	}
+}
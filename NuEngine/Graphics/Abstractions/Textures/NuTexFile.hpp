@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/IO/MappedFile.hpp>
+#include <Core/Types/Result.hpp>
+#include <Graphics/Errors/GraphicsError.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Pixel layout of a cooked texture. The BC formats store 4x4 blocks.
+	*/
+	enum class TexturePixelFormat : uint32_t
+	{
+		RGBA8 = 0,
+		BC1 = 1,    // 8 bytes per block, RGB + 1-bit alpha
+		BC3 = 2,    // 16 bytes per block, RGB + interpolated alpha
+		BC7 = 3     // 16 bytes per block, RGBA
+	};
+
+	[[nodiscard]] constexpr bool IsBlockCompressed(TexturePixelFormat format) noexcept
+	{
+		return format != TexturePixelFormat::RGBA8;
+	}
+
+	/*
+	* @brief Bytes in one mip level of width x height pixels (whole blocks for the BC formats).
+	*/
+	[[nodiscard]] constexpr uint64_t GetTextureLevelSize(TexturePixelFormat format, uint32_t width, uint32_t height) noexcept
+	{
+		if (!IsBlockCompressed(format))
+		{
+			return static_cast<uint64_t>(width) * height * 4;
+		}
+
+		const uint64_t blocks = static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+		return blocks * (format == TexturePixelFormat::BC1 ? 8 : 16);
+	}
+
+	/*
+	* @brief On-disk layout of a .nutex file, all little endian.
+	*
+	* NuTexHeader, then MipCount NuTexLevel entries (largest first), then the level data. Each
+	* level starts on a k_DataAlignment boundary so it can be handed to the driver straight
+	* from the mapping. Rows are stored bottom-up, the order GL expects.
+	*/
+	namespace NuTex
+	{
+		inline constexpr uint32_t k_Magic = 0x5854554E;   // "NUTX"
+		inline constexpr uint32_t k_Version = 1;
+		inline constexpr uint32_t k_DataAlignment = 16;
+
+		inline constexpr uint32_t k_FlagSRGB = 1u << 0;
+
+		struct Header
+		{
+			uint32_t Magic;
+			uint32_t Version;
+			TexturePixelFormat Format;
+			uint32_t Flags;
+			uint32_t Width;
+			uint32_t Height;
+			uint32_t MipCount;
+			uint32_t Reserved;
+		};
+
+		struct Level
+		{
+			uint64_t Offset;
+			uint64_t Size;
+			uint32_t Width;
+			uint32_t Height;
+		};
+
+		static_assert(sizeof(Header) == 32);
+		static_assert(sizeof(Level) == 24);
+	}
+
+	/*
+	* @brief Memory-mapped .nutex file. Open() validates the header and every level range, so
+	* GetLevelData() never reads outside the mapping.
+	*/
+	class NU_API NuTexFile
+	{
+	public:
+		[[nodiscard]] static Core::Result<NuTexFile, GraphicsError> Open(const std::filesystem::path& path);
+
+		[[nodiscard]] TexturePixelFormat GetFormat() const noexcept { return m_Header.Format; }
+		[[nodiscard]] bool IsSRGB() const noexcept { return (m_Header.Flags & NuTex::k_FlagSRGB) != 0; }
+		[[nodiscard]] uint32_t GetWidth() const noexcept { return m_Header.Width; }
+		[[nodiscard]] uint32_t GetHeight() const noexcept { return m_Header.Height; }
+		[[nodiscard]] uint32_t GetMipCount() const noexcept { return m_Header.MipCount; }
+
+		[[nodiscard]] const NuTex::Level& GetLevel(uint32_t mip) const noexcept { return m_Levels[mip]; }
+		[[nodiscard]] std::span<const std::byte> GetLevelData(uint32_t mip) const noexcept;
+
+	private:
+		Core::MappedFile m_File;
+		NuTex::Header m_Header{};
+		std::span<const NuTex::Level> m_Levels;
+	};
+}
@@ -0,0 +1,712 @@
+#include <Graphics/Abstractions/Textures/TextureCooker.hpp>
+#include <Core/Memory/AlignedAllocator.hpp>
+#include <Core/Logging/Logger.hpp>
+#include <NuMath/Core/SRGBLut.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numbers>
+
+namespace NuEngine::Graphics
+{
+	namespace
+	{
+		using Backend = NuMath::Simd::MathBackend;
+
+		// RGBA float per pixel, 16-byte aligned so each pixel is one aligned register load
+		using FloatImage = AlignedVector<float, 16>;
+
+		constexpr uint32_t k_KaiserTaps = 6;
+
+		/*
+		* @brief Weights for source pixels 2x-2 .. 2x+3 of output pixel x.
+		*
+		* Sinc at half the source rate, windowed by Kaiser (alpha 4) over three source pixels on
+		* each side, normalized to sum to one. The outer taps are negative.
+		*/
+		std::array<float, k_KaiserTaps> MakeKaiserWeights()
+		{
+			const auto besselI0 = [](double x)
+			{
+				double sum = 1.0, term = 1.0;
+				for (int k = 1; k < 32; ++k)
+				{
+					term *= (x / (2.0 * k)) * (x / (2.0 * k));
+					sum += term;
+				}
+				return sum;
+			};
+
+			constexpr double alpha = 4.0;
+			constexpr double halfWidth = 1.5;   // In output pixels
+
+			std::array<float, k_KaiserTaps> weights{};
+			double total = 0.0;
+			for (uint32_t k = 0; k < k_KaiserTaps; ++k)
+			{
+				const double u = (static_cast<double>(k) - 2.5) * 0.5;
+				const double sinc = std::sin(std::numbers::pi * u) / (std::numbers::pi * u);
+				const double t = u / halfWidth;
+				const double window = besselI0(alpha * std::sqrt(1.0 - t * t)) / besselI0(alpha);
+				weights[k] = static_cast<float>(sinc * window);
+				total += weights[k];
+			}
+
+			for (float& weight : weights)
+			{
+				weight = static_cast<float>(weight / total);
+			}
+			return weights;
+		}
+
+		FloatImage ToLinear(const uint8_t* rgba, uint32_t width, uint32_t height, bool srgb)
+		{
+			FloatImage image(static_cast<size_t>(width) * height * 4);
+			for (size_t i = 0; i < image.size(); ++i)
+			{
+				const bool isAlpha = (i & 3) == 3;
+				image[i] = (srgb && !isAlpha) ? NuMath::SRGBToLinearLUT[rgba[i]] : rgba[i] * (1.0f / 255.0f);
+			}
+			return image;
+		}
+
+		/*
+		* @brief Inverse of SRGBToLinearLUT: the 8-bit code whose decoded value is nearest.
+		*/
+		uint8_t EncodeSRGB(float linear)
+		{
+			const float* lut = NuMath::SRGBToLinearLUT;
+			const float* upper = std::lower_bound(lut, lut + 256, linear);
+			if (upper == lut) return 0;
+			if (upper == lut + 256) return 255;
+			return static_cast<uint8_t>((linear - upper[-1] < *upper - linear) ? upper - lut - 1 : upper - lut);
+		}
+
+		void ToBytes(const FloatImage& image, bool srgb, std::vector<std::byte>& out)
+		{
+			out.resize(image.size());
+			for (size_t i = 0; i < image.size(); ++i)
+			{
+				const float value = std::clamp(image[i], 0.0f, 1.0f);
+				const bool isAlpha = (i & 3) == 3;
+				out[i] = std::byte{ (srgb && !isAlpha) ? EncodeSRGB(value) : static_cast<uint8_t>(value * 255.0f + 0.5f) };
+			}
+		}
+
+		FloatImage DownsampleBox(const FloatImage& source, uint32_t width, uint32_t height, uint32_t outWidth, uint32_t outHeight)
+		{
+			FloatImage result(static_cast<size_t>(outWidth) * outHeight * 4);
+			const Backend::NuVec4 quarter = Backend::SetAll(0.25f);
+
+			for (uint32_t y = 0; y < outHeight; ++y)
+			{
+				const float* row0 = source.data() + static_cast<size_t>(std::min(2 * y, height - 1)) * width * 4;
+				const float* row1 = source.data() + static_cast<size_t>(std::min(2 * y + 1, height - 1)) * width * 4;
+				float* out = result.data() + static_cast<size_t>(y) * outWidth * 4;
+
+				for (uint32_t x = 0; x < outWidth; ++x)
+				{
+					const size_t x0 = static_cast<size_t>(std::min(2 * x, width - 1)) * 4;
+					const size_t x1 = static_cast<size_t>(std::min(2 * x + 1, width - 1)) * 4;
+
+					const Backend::NuVec4 sum = Backend::Add(
+						Backend::Add(Backend::Load(row0 + x0), Backend::Load(row0 + x1)),
+						Backend::Add(Backend::Load(row1 + x0), Backend::Load(row1 + x1)));
+					Backend::Store(out + static_cast<size_t>(x) * 4, Backend::Mul(sum, quarter));
+				}
+			}
+			return result;
+		}
+
+		/*
+		* @brief One separable Kaiser pass. stride/count walk the filtered axis, lineStride/lines the other one.
+		*
+		* An axis that is already one pixel long is copied unchanged.
+		*/
+		void KaiserPass(const float* source, float* dest, uint32_t count, uint32_t outCount, size_t stride, size_t outStride,
+			uint32_t lines, size_t lineStride, size_t outLineStride)
+		{
+			static const std::array<float, k_KaiserTaps> weights = MakeKaiserWeights();
+
+			Backend::NuVec4 taps[k_KaiserTaps];
+			for (uint32_t k = 0; k < k_KaiserTaps; ++k)
+			{
+				taps[k] = Backend::SetAll(weights[k]);
+			}
+
+			for (uint32_t line = 0; line < lines; ++line)
+			{
+				const float* in = source + line * lineStride;
+				float* out = dest + line * outLineStride;
+
+				for (uint32_t i = 0; i < outCount; ++i)
+				{
+					if (count == outCount)
+					{
+						Backend::Store(out + i * outStride, Backend::Load(in + i * stride));
+						continue;
+					}
+
+					Backend::NuVec4 sum = Backend::SetZero();
+					for (uint32_t k = 0; k < k_KaiserTaps; ++k)
+					{
+						const int64_t tap = std::clamp<int64_t>(static_cast<int64_t>(2 * i) - 2 + k, 0, count - 1);
+						sum = Backend::Add(sum, Backend::Mul(Backend::Load(in + static_cast<size_t>(tap) * stride), taps[k]));
+					}
+					Backend::Store(out + i * outStride, sum);
+				}
+			}
+		}
+
+		FloatImage DownsampleKaiser(const FloatImage& source, uint32_t width, uint32_t height, uint32_t outWidth, uint32_t outHeight)
+		{
+			// Rows first into outWidth x height, then columns
+			FloatImage rows(static_cast<size_t>(outWidth) * height * 4);
+			KaiserPass(source.data(), rows.data(), width, outWidth, 4, 4, height, static_cast<size_t>(width) * 4, static_cast<size_t>(outWidth) * 4);
+
+			FloatImage result(static_cast<size_t>(outWidth) * outHeight * 4);
+			KaiserPass(rows.data(), result.data(), height, outHeight, static_cast<size_t>(outWidth) * 4, static_cast<size_t>(outWidth) * 4, outWidth, 4, 4);
+			return result;
+		}
+
+		/*
+		* @brief Principal axis fit: the line through the block's mean along its direction of greatest variance.
+		*
+		* Pixels with include == false are ignored. Returns endpoints e0 at the low and e1 at the high
+		* end of the projections, in 0..255.
+		*/
+		void FitEndpoints(const uint8_t* block, uint32_t channels, const bool* include, float e0[4], float e1[4])
+		{
+			float mean[4] = {};
+			uint32_t count = 0;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (include && !include[i]) continue;
+				for (uint32_t c = 0; c < channels; ++c) mean[c] += block[i * 4 + c];
+				count++;
+			}
+
+			if (count == 0)
+			{
+				std::fill_n(e0, 4, 0.0f);
+				std::fill_n(e1, 4, 0.0f);
+				return;
+			}
+			for (uint32_t c = 0; c < channels; ++c) mean[c] /= static_cast<float>(count);
+
+			float covariance[4][4] = {};
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (include && !include[i]) continue;
+				float d[4] = {};
+				for (uint32_t c = 0; c < channels; ++c) d[c] = block[i * 4 + c] - mean[c];
+				for (uint32_t a = 0; a < channels; ++a)
+				{
+					for (uint32_t b = 0; b < channels; ++b) covariance[a][b] += d[a] * d[b];
+				}
+			}
+
+			// Power iteration seeded with the covariance column of the most varying channel, which is
+			// never orthogonal to the principal axis; a handful of steps is plenty for 16 points
+			uint32_t widest = 0;
+			for (uint32_t c = 1; c < channels; ++c)
+			{
+				if (covariance[c][c] > covariance[widest][widest]) widest = c;
+			}
+
+			float axis[4] = {};
+			for (uint32_t c = 0; c < channels; ++c) axis[c] = covariance[c][widest];
+
+			for (int step = 0; step < 8; ++step)
+			{
+				float next[4] = {};
+				float length = 0.0f;
+				for (uint32_t a = 0; a < channels; ++a)
+				{
+					for (uint32_t b = 0; b < channels; ++b) next[a] += covariance[a][b] * axis[b];
+					length += next[a] * next[a];
+				}
+
+				if (length < 1e-8f)
+				{
+					break;
+				}
+
+				const float invLength = 1.0f / std::sqrt(length);
+				for (uint32_t a = 0; a < channels; ++a) axis[a] = next[a] * invLength;
+			}
+
+			float minT = 0.0f, maxT = 0.0f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (include && !include[i]) continue;
+				float t = 0.0f;
+				for (uint32_t c = 0; c < channels; ++c) t += (block[i * 4 + c] - mean[c]) * axis[c];
+				minT = std::min(minT, t);
+				maxT = std::max(maxT, t);
+			}
+
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				e0[c] = c < channels ? std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f) : 255.0f;
+				e1[c] = c < channels ? std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f) : 255.0f;
+			}
+		}
+
+		uint32_t DistanceSquared(const uint8_t* a, const int* b, uint32_t channels)
+		{
+			uint32_t sum = 0;
+			for (uint32_t c = 0; c < channels; ++c)
+			{
+				const int d = static_cast<int>(a[c]) - b[c];
+				sum += static_cast<uint32_t>(d * d);
+			}
+			return sum;
+		}
+
+		uint16_t To565(const float color[4])
+		{
+			const uint32_t r = static_cast<uint32_t>(color[0] * 31.0f / 255.0f + 0.5f);
+			const uint32_t g = static_cast<uint32_t>(color[1] * 63.0f / 255.0f + 0.5f);
+			const uint32_t b = static_cast<uint32_t>(color[2] * 31.0f / 255.0f + 0.5f);
+			return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+		}
+
+		void From565(uint16_t packed, int color[4])
+		{
+			const int r = (packed >> 11) & 31;
+			const int g = (packed >> 5) & 63;
+			const int b = packed & 31;
+			color[0] = (r << 3) | (r >> 2);
+			color[1] = (g << 2) | (g >> 4);
+			color[2] = (b << 3) | (b >> 2);
+			color[3] = 255;
+		}
+
+		void WriteLE(std::byte* out, uint64_t value, uint32_t bytes)
+		{
+			for (uint32_t i = 0; i < bytes; ++i)
+			{
+				out[i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+			}
+		}
+
+		/*
+		* @brief Appends fields least significant bit first, the order BC7 is specified in.
+		*/
+		struct BitWriter
+		{
+			std::byte* Out;
+			uint32_t Position = 0;
+
+			void Put(uint32_t value, uint32_t bits)
+			{
+				for (uint32_t i = 0; i < bits; ++i, ++Position)
+				{
+					if ((value >> i) & 1)
+					{
+						Out[Position / 8] |= std::byte{ static_cast<uint8_t>(1u << (Position % 8)) };
+					}
+				}
+			}
+		};
+	}
+
+	void TextureCooker::EncodeBlock(TexturePixelFormat format, const uint8_t* block, std::byte* out)
+	{
+		switch (format)
+		{
+		case TexturePixelFormat::BC1:
+			EncodeBC1(block, out, true);
+			break;
+		case TexturePixelFormat::BC3:
+			EncodeBC3Alpha(block, out);
+			EncodeBC1(block, out + 8, false);
+			break;
+		case TexturePixelFormat::BC7:
+			EncodeBC7(block, out);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void TextureCooker::EncodeBC1(const uint8_t* block, std::byte* out, bool allowTransparency)
+	{
+		bool opaque[16];
+		bool transparent = false;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			opaque[i] = !allowTransparency || block[i * 4 + 3] >= 128;
+			transparent |= !opaque[i];
+		}
+
+		float low[4], high[4];
+		FitEndpoints(block, 3, opaque, low, high);
+
+		uint16_t c0 = To565(high);
+		uint16_t c1 = To565(low);
+
+		// c0 > c1 selects four colours, c0 <= c1 three colours plus transparent black
+		if (transparent ? c0 > c1 : c0 < c1)
+		{
+			std::swap(c0, c1);
+		}
+
+		int palette[4][4];
+		From565(c0, palette[0]);
+		From565(c1, palette[1]);
+		const bool fourColor = c0 > c1;
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			if (fourColor)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+
+		uint32_t indices = 0;
+		if (c0 != c1 || transparent)
+		{
+			const uint32_t candidates = fourColor ? 4 : 3;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				uint32_t best = 3;
+				if (opaque[i])
+				{
+					uint32_t bestError = UINT32_MAX;
+					for (uint32_t p = 0; p < candidates; ++p)
+					{
+						const uint32_t error = DistanceSquared(block + i * 4, palette[p], 3);
+						if (error < bestError)
+						{
+							bestError = error;
+							best = p;
+						}
+					}
+				}
+				indices |= best << (2 * i);
+			}
+		}
+
+		WriteLE(out, c0, 2);
+		WriteLE(out + 2, c1, 2);
+		WriteLE(out + 4, indices, 4);
+	}
+
+	void TextureCooker::EncodeBC3Alpha(const uint8_t* block, std::byte* out)
+	{
+		uint8_t a0 = 0, a1 = 255;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			a0 = std::max(a0, block[i * 4 + 3]);
+			a1 = std::min(a1, block[i * 4 + 3]);
+		}
+
+		uint64_t indices = 0;
+		if (a0 != a1)
+		{
+			// a0 > a1: eight-value ramp, index 0 = a0, 1 = a1, 2..7 interpolated from a0 towards a1
+			int palette[8] = { a0, a1 };
+			for (int p = 2; p < 8; ++p)
+			{
+				palette[p] = ((8 - p) * a0 + (p - 1) * a1) / 7;
+			}
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const int alpha = block[i * 4 + 3];
+				uint64_t best = 0;
+				int bestError = INT32_MAX;
+				for (int p = 0; p < 8; ++p)
+				{
+					const int error = std::abs(alpha - palette[p]);
+					if (error < bestError)
+					{
+						bestError = error;
+						best = static_cast<uint64_t>(p);
+					}
+				}
+				indices |= best << (3 * i);
+			}
+		}
+
+		out[0] = std::byte{ a0 };
+		out[1] = std::byte{ a1 };
+		WriteLE(out + 2, indices, 6);
+	}
+
+	void TextureCooker::EncodeBC7(const uint8_t* block, std::byte* out)
+	{
+		static constexpr int k_Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		float endpoints[2][4];
+		FitEndpoints(block, 4, nullptr, endpoints[0], endpoints[1]);
+
+		// Mode 6 endpoints are 7 bits per channel plus one shared low bit per endpoint
+		uint32_t quantized[2][4];
+		uint32_t pbits[2];
+		int colors[2][4];
+		for (uint32_t e = 0; e < 2; ++e)
+		{
+			float bestError = 0.0f;
+			for (uint32_t p = 0; p < 2; ++p)
+			{
+				float error = 0.0f;
+				uint32_t candidate[4];
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					candidate[c] = static_cast<uint32_t>(std::clamp((endpoints[e][c] - static_cast<float>(p)) * 0.5f + 0.5f, 0.0f, 127.0f));
+					const float d = static_cast<float>((candidate[c] << 1) | p) - endpoints[e][c];
+					error += d * d;
+				}
+
+				if (p == 0 || error < bestError)
+				{
+					bestError = error;
+					pbits[e] = p;
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						quantized[e][c] = candidate[c];
+						colors[e][c] = static_cast<int>((candidate[c] << 1) | p);
+					}
+				}
+			}
+		}
+
+		int palette[16][4];
+		for (uint32_t w = 0; w < 16; ++w)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				palette[w][c] = ((64 - k_Weights[w]) * colors[0][c] + k_Weights[w] * colors[1][c] + 32) >> 6;
+			}
+		}
+
+		uint32_t indices[16];
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			uint32_t bestError = UINT32_MAX;
+			for (uint32_t w = 0; w < 16; ++w)
+			{
+				const uint32_t error = DistanceSquared(block + i * 4, palette[w], 4);
+				if (error < bestError)
+				{
+					bestError = error;
+					indices[i] = w;
+				}
+			}
+		}
+
+		// The first index is stored with its top bit implied zero; swapping the endpoints guarantees that
+		if (indices[0] >= 8)
+		{
+			std::swap(quantized[0], quantized[1]);
+			std::swap(pbits[0], pbits[1]);
+			for (uint32_t& index : indices)
+			{
+				index = 15 - index;
+			}
+		}
+
+		std::memset(out, 0, 16);
+		BitWriter bits{ out };
+		bits.Put(1u << 6, 7);
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			bits.Put(quantized[0][c], 7);
+			bits.Put(quantized[1][c], 7);
+		}
+		bits.Put(pbits[0], 1);
+		bits.Put(pbits[1], 1);
+		bits.Put(indices[0], 3);
+		for (uint32_t i = 1; i < 16; ++i)
+		{
+			bits.Put(indices[i], 4);
+		}
+	}
+
+	CookedTexture TextureCooker::Cook(const uint8_t* rgba, uint32_t width, uint32_t height, const TextureCookOptions& options)
+	{
+		CookedTexture cooked;
+		cooked.Format = options.Format;
+		cooked.SRGB = options.SRGB;
+		cooked.Width = width;
+		cooked.Height = height;
+
+		const uint32_t mipCount = options.GenerateMips ? static_cast<uint32_t>(std::bit_width(std::max(width, height))) : 1;
+
+		std::vector<std::vector<std::byte>> rgbaLevels(mipCount);
+		rgbaLevels[0].resize(static_cast<size_t>(width) * height * 4);
+		std::memcpy(rgbaLevels[0].data(), rgba, rgbaLevels[0].size());
+
+		if (mipCount > 1)
+		{
+			FloatImage level = ToLinear(rgba, width, height, options.SRGB);
+			uint32_t levelWidth = width, levelHeight = height;
+
+			for (uint32_t mip = 1; mip < mipCount; ++mip)
+			{
+				const uint32_t nextWidth = std::max(levelWidth / 2, 1u);
+				const uint32_t nextHeight = std::max(levelHeight / 2, 1u);
+
+				level = options.Filter == MipFilter::Box
+					? DownsampleBox(level, levelWidth, levelHeight, nextWidth, nextHeight)
+					: DownsampleKaiser(level, levelWidth, levelHeight, nextWidth, nextHeight);
+
+				ToBytes(level, options.SRGB, rgbaLevels[mip]);
+				levelWidth = nextWidth;
+				levelHeight = nextHeight;
+			}
+		}
+
+		if (!IsBlockCompressed(options.Format))
+		{
+			cooked.Levels = std::move(rgbaLevels);
+			return cooked;
+		}
+
+		const uint32_t blockBytes = options.Format == TexturePixelFormat::BC1 ? 8 : 16;
+		cooked.Levels.resize(mipCount);
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			const uint32_t levelWidth = std::max(width >> mip, 1u);
+			const uint32_t levelHeight = std::max(height >> mip, 1u);
+			const auto* pixels = reinterpret_cast<const uint8_t*>(rgbaLevels[mip].data());
+
+			std::vector<std::byte>& out = cooked.Levels[mip];
+			out.resize(GetTextureLevelSize(options.Format, levelWidth, levelHeight));
+
+			std::byte* dest = out.data();
+			for (uint32_t blockY = 0; blockY < levelHeight; blockY += 4)
+			{
+				for (uint32_t blockX = 0; blockX < levelWidth; blockX += 4, dest += blockBytes)
+				{
+					// Edge blocks repeat the last row/column
+					uint8_t block[64];
+					for (uint32_t y = 0; y < 4; ++y)
+					{
+						const uint32_t sy = std::min(blockY + y, levelHeight - 1);
+						for (uint32_t x = 0; x < 4; ++x)
+						{
+							const uint32_t sx = std::min(blockX + x, levelWidth - 1);
+							std::memcpy(block + (y * 4 + x) * 4, pixels + (static_cast<size_t>(sy) * levelWidth + sx) * 4, 4);
+						}
+					}
+					EncodeBlock(options.Format, block, dest);
+				}
+			}
+		}
+		return cooked;
+	}
+
+	Core::Result<void, GraphicsError> TextureCooker::Save(const CookedTexture& texture, const std::filesystem::path& destination)
+	{
+		const uint32_t mipCount = static_cast<uint32_t>(texture.Levels.size());
+		if (mipCount == 0 || texture.Width == 0 || texture.Height == 0)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::InvalidParameter, "Nothing to save to " + destination.string()));
+		}
+
+		NuTex::Header header{};
+		header.Magic = NuTex::k_Magic;
+		header.Version = NuTex::k_Version;
+		header.Format = texture.Format;
+		header.Flags = texture.SRGB ? NuTex::k_FlagSRGB : 0;
+		header.Width = texture.Width;
+		header.Height = texture.Height;
+		header.MipCount = mipCount;
+
+		const auto align = [](uint64_t offset) { return (offset + NuTex::k_DataAlignment - 1) & ~uint64_t{ NuTex::k_DataAlignment - 1 }; };
+
+		std::vector<NuTex::Level> levels(mipCount);
+		uint64_t offset = align(sizeof(NuTex::Header) + sizeof(NuTex::Level) * mipCount);
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			levels[mip].Width = std::max(texture.Width >> mip, 1u);
+			levels[mip].Height = std::max(texture.Height >> mip, 1u);
+			levels[mip].Size = texture.Levels[mip].size();
+			levels[mip].Offset = offset;
+			offset = align(offset + levels[mip].Size);
+		}
+
+		std::error_code error;
+		if (destination.has_parent_path())
+		{
+			std::filesystem::create_directories(destination.parent_path(), error);
+		}
+
+		// Written beside the target and renamed, so a crash never leaves a half-written .nutex behind
+		std::filesystem::path temporary = destination;
+		temporary += ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+			if (!file)
+			{
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Cannot write " + temporary.string()));
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(levels.data()), static_cast<std::streamsize>(sizeof(NuTex::Level) * mipCount));
+
+			for (uint32_t mip = 0; mip < mipCount; ++mip)
+			{
+				const uint64_t padding = levels[mip].Offset - static_cast<uint64_t>(file.tellp());
+				const char zeros[NuTex::k_DataAlignment] = {};
+				file.write(zeros, static_cast<std::streamsize>(padding));
+				file.write(reinterpret_cast<const char*>(texture.Levels[mip].data()), static_cast<std::streamsize>(levels[mip].Size));
+			}
+
+			if (!file)
+			{
+				file.close();
+				std::filesystem::remove(temporary, error);
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Failed writing " + temporary.string()));
+			}
+		}
+
+		std::filesystem::rename(temporary, destination, error);
+		if (error)
+		{
+			std::filesystem::remove(temporary, error);
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Cannot replace " + destination.string()));
+		}
+		return Core::Ok();
+	}
+
+	Core::Result<void, GraphicsError> TextureCooker::CookFile(const std::filesystem::path& source, const std::filesystem::path& destination, const TextureCookOptions& options)
+	{
+		// Same row order as the runtime decoders: first row at the bottom
+		stbi_set_flip_vertically_on_load_thread(true);
+
+		int width = 0, height = 0, channels = 0;
+		stbi_uc* data = stbi_load(source.string().c_str(), &width, &height, &channels, 4);
+		if (!data)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Failed to load texture: " + source.string()));
+		}
+
+		const CookedTexture cooked = Cook(data, static_cast<uint32_t>(width), static_cast<uint32_t>(height), options);
+		stbi_image_free(data);
+
+		auto saved = Save(cooked, destination);
+		if (saved.IsOk())
+		{
+			LOG_INFO("Cooked texture {} -> {} ({}x{}, {} mips)", source.string(), destination.string(), width, height, cooked.Levels.size());
+		}
+		return saved;
+	}
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Textures/NuTexFile.hpp>
+#include <Core/Types/Result.hpp>
+#include <Graphics/Errors/GraphicsError.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace NuEngine::Graphics
+{
+	enum class MipFilter
+	{
+		Box,        // 2x2 average
+		Kaiser      // 6-tap Kaiser-windowed sinc, keeps small mips sharper
+	};
+
+	struct TextureCookOptions
+	{
+		TexturePixelFormat Format = TexturePixelFormat::RGBA8;
+		MipFilter Filter = MipFilter::Kaiser;
+
+		// Colour data: decoded through SRGBToLinearLUT before filtering and sampled as sRGB at
+		// runtime. Turn off for normal maps, masks and other linear data.
+		bool SRGB = true;
+		bool GenerateMips = true;
+	};
+
+	/*
+	* @brief Output of TextureCooker::Cook(), level 0 first, each level already in Format.
+	*/
+	struct CookedTexture
+	{
+		TexturePixelFormat Format = TexturePixelFormat::RGBA8;
+		bool SRGB = false;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		std::vector<std::vector<std::byte>> Levels;
+	};
+
+	/*
+	* @brief Offline conversion of images into .nutex files the runtime uploads without decoding.
+	*
+	* Mips are filtered in linear float space, one pixel per SIMD register, and each level is
+	* built from the previous float level so rounding does not accumulate. Block compression
+	* runs on the finished 8-bit levels.
+	*/
+	class NU_API TextureCooker
+	{
+	public:
+		/*
+		* @brief Cooks tightly packed RGBA8 pixels, rows in the order they should be stored (bottom-up for GL).
+		*/
+		[[nodiscard]] static CookedTexture Cook(const uint8_t* rgba, uint32_t width, uint32_t height, const TextureCookOptions& options);
+
+		/*
+		* @brief Loads source with stb_image, cooks it and writes destination through a temporary file.
+		*/
+		[[nodiscard]] static Core::Result<void, GraphicsError> CookFile(const std::filesystem::path& source, const std::filesystem::path& destination, const TextureCookOptions& options = {});
+
+		[[nodiscard]] static Core::Result<void, GraphicsError> Save(const CookedTexture& texture, const std::filesystem::path& destination);
+
+		/*
+		* @brief Encodes one 4x4 block of RGBA8 pixels (row-major) into 8 (BC1) or 16 (BC3, BC7) bytes.
+		*
+		* BC1 switches to its 3-colour mode with a transparent index when a pixel's alpha is below 128.
+		* BC7 always uses mode 6: one RGBA endpoint pair with 4-bit indices.
+		*/
+		static void EncodeBlock(TexturePixelFormat format, const uint8_t* block, std::byte* out);
+
+	private:
+		static void EncodeBC1(const uint8_t* block, std::byte* out, bool allowTransparency);
+		static void EncodeBC3Alpha(const uint8_t* block, std::byte* out);
+		static void EncodeBC7(const uint8_t* block, std::byte* out);
+	};
+}
@@ -0,0 +1,177 @@
+#include <Graphics/Abstractions/Textures/TextureStreamer.hpp>
+#include <Core/Threading/JobSystem.hpp>
+#include <Core/Logging/Logger.hpp>
+
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace NuEngine::Graphics
+{
+	TextureStreamer::TextureStreamer(ITextureUploader& uploader, Decoder decoder)
+		: m_Uploader(uploader), m_Decoder(std::move(decoder))
+	{
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		WaitForDecodes();
+	}
+
+	std::shared_ptr<ITexture> TextureStreamer::Request(const std::string& path)
+	{
+		auto pending = std::make_shared<PendingTexture>();
+		pending->Handle = std::make_shared<StreamedTexture>(path, m_Uploader.GetPlaceholder());
+		pending->RequestTime = Clock::now();
+
+		m_Stats.Requested++;
+		m_DecodesInFlight.fetch_add(1, std::memory_order_relaxed);
+		m_Stats.PendingDecode = m_DecodesInFlight.load(std::memory_order_relaxed);
+
+		Core::JobSystem::Get().Submit([this, pending]() mutable
+			{
+				const Clock::time_point start = Clock::now();
+				try
+				{
+					pending->Decoded = m_Decoder(pending->Handle->GetPath(), m_Staging, pending->Image);
+				}
+				catch (...)
+				{
+					pending->Decoded = false;
+				}
+				pending->DecodeMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+				// Handed over before the count drops, so the job keeps no staging buffer alive past the destructor
+				{
+					std::lock_guard<std::mutex> lock(m_DecodedMutex);
+					m_Decoded.push_back(std::move(pending));
+				}
+				m_DecodesInFlight.fetch_sub(1, std::memory_order_release);
+			});
+
+		return pending->Handle;
+	}
+
+	void TextureStreamer::Update(uint32_t budgetBytes)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_DecodedMutex);
+			while (!m_Decoded.empty())
+			{
+				std::shared_ptr<PendingTexture> pending = std::move(m_Decoded.front());
+				m_Decoded.pop_front();
+				m_Stats.DecodeMs += pending->DecodeMs;
+
+				const DecodedImage& image = pending->Image;
+				if (!pending->Decoded || image.Width == 0 || image.Height == 0 || !image.Pixels)
+				{
+					LOG_WARNING("Texture '{}' could not be decoded; keeping the placeholder", pending->Handle->GetPath());
+					pending->Handle->m_Failed = true;
+					m_Stats.Failed++;
+					continue;
+				}
+
+				m_Uploads.push_back(std::move(pending));
+			}
+		}
+
+		m_Stats.UploadBudget = budgetBytes;
+		m_Stats.BytesUploadedLastFrame = 0;
+
+		uint64_t remaining = budgetBytes;
+		bool firstRow = true;
+		while (!m_Uploads.empty())
+		{
+			PendingTexture& pending = *m_Uploads.front();
+			const DecodedImage& image = pending.Image;
+			const uint64_t rowBytes = static_cast<uint64_t>(image.Width) * image.Channels;
+
+			if (remaining < rowBytes && !firstRow)
+			{
+				m_Stats.FramesAtBudget++;
+				break;
+			}
+
+			if (!pending.Target)
+			{
+				pending.Target = m_Uploader.CreateTexture(pending.Handle->GetPath(), image.Width, image.Height, image.Channels);
+			}
+
+			const uint32_t rowsLeft = image.Height - pending.NextRow;
+			const uint32_t rows = static_cast<uint32_t>(std::clamp<uint64_t>(remaining / rowBytes, 1, rowsLeft));
+			m_Uploader.UploadRows(*pending.Target, pending.NextRow, rows, image.Pixels.Data() + pending.NextRow * rowBytes);
+
+			const uint64_t bytes = rows * rowBytes;
+			pending.NextRow += rows;
+			remaining -= std::min(remaining, bytes);
+			m_Stats.BytesUploaded += bytes;
+			m_Stats.BytesUploadedLastFrame += static_cast<uint32_t>(bytes);
+			firstRow = false;
+
+			if (pending.NextRow == image.Height)
+			{
+				Complete(pending);
+				m_Uploads.pop_front();
+			}
+		}
+
+		m_Stats.PendingDecode = m_DecodesInFlight.load(std::memory_order_relaxed);
+		m_Stats.PendingUpload = static_cast<uint32_t>(m_Uploads.size());
+	}
+
+	void TextureStreamer::Complete(PendingTexture& pending)
+	{
+		m_Uploader.FinishTexture(*pending.Target);
+
+		pending.Handle->m_Texture = std::move(pending.Target);
+		pending.Handle->m_Loaded = true;
+		pending.Image.Pixels.Release();
+
+		const double latency = std::chrono::duration<double, std::milli>(Clock::now() - pending.RequestTime).count();
+		m_Stats.Completed++;
+		m_Stats.LastLatencyMs = latency;
+		m_Stats.MaxLatencyMs = std::max(m_Stats.MaxLatencyMs, latency);
+		m_Stats.TotalLatencyMs += latency;
+	}
+
+	void TextureStreamer::WaitForDecodes()
+	{
+		Core::JobSystem::Get().WaitFor(m_DecodesInFlight);
+	}
+
+	bool TextureStreamer::IsIdle() const
+	{
+		std::lock_guard<std::mutex> lock(m_DecodedMutex);
+		return m_DecodesInFlight.load(std::memory_order_acquire) == 0 && m_Decoded.empty() && m_Uploads.empty();
+	}
+
+	bool TextureStreamer::DecodeImageFile(const std::string& path, Core::BufferPool& staging, DecodedImage& image)
+	{
+		int width = 0, height = 0, channels = 0;
+		if (!stbi_info(path.c_str(), &width, &height, &channels))
+		{
+			return false;
+		}
+
+		// GL wants the first row at the bottom; the per-thread flag keeps workers independent
+		stbi_set_flip_vertically_on_load_thread(true);
+
+		const int requested = channels == 3 ? 3 : 4;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, requested);
+		if (!data)
+		{
+			return false;
+		}
+
+		const size_t size = static_cast<size_t>(width) * height * requested;
+		image.Width = static_cast<uint32_t>(width);
+		image.Height = static_cast<uint32_t>(height);
+		image.Channels = static_cast<uint32_t>(requested);
+		image.Pixels = staging.Acquire(size);
+		std::memcpy(image.Pixels.Data(), data, size);
+
+		stbi_image_free(data);
+		return true;
+	}
+}
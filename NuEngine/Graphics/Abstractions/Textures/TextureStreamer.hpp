@@ -0,0 +1,173 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Textures/ITexture.hpp>
+#include <Graphics/Abstractions/Textures/ITextureUploader.hpp>
+#include <Core/Memory/BufferPool.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace NuEngine::Graphics
+{
+	/*
+	* @brief Pixels of one image, tightly packed rows, first row at the bottom (GL convention).
+	*/
+	struct DecodedImage
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Channels = 0;
+		Core::BufferPool::Buffer Pixels;
+	};
+
+	/*
+	* @brief Handle returned by TextureStreamer::Request(). Draws with the placeholder until the upload completes.
+	*/
+	class NU_API StreamedTexture : public ITexture
+	{
+	public:
+		StreamedTexture(std::string path, std::shared_ptr<ITexture> placeholder)
+			: m_Path(std::move(path)), m_Texture(std::move(placeholder)) {}
+
+		void Bind(unsigned int slot = 0) const override { m_Texture->Bind(slot); }
+		void Unbind() const override { m_Texture->Unbind(); }
+
+		int GetWidth() const override { return m_Texture->GetWidth(); }
+		int GetHeight() const override { return m_Texture->GetHeight(); }
+
+		const std::string& GetPath() const override { return m_Path; }
+
+		unsigned int GetID() const override { return m_Texture->GetID(); }
+		uint64_t GetUniqueID() const override { return m_Texture->GetUniqueID(); }
+
+		[[nodiscard]] bool IsLoaded() const noexcept { return m_Loaded; }
+		[[nodiscard]] bool HasFailed() const noexcept { return m_Failed; }
+
+	private:
+		friend class TextureStreamer;
+
+		std::string m_Path;
+		std::shared_ptr<ITexture> m_Texture;
+		bool m_Loaded = false;
+		bool m_Failed = false;
+	};
+
+	/*
+	* @brief Counters since creation; the *LastFrame values describe the latest Update().
+	*
+	* Latency runs from Request() to the frame the real texture replaces the placeholder.
+	*/
+	struct TextureStreamingStats
+	{
+		uint32_t Requested = 0;
+		uint32_t Completed = 0;
+		uint32_t Failed = 0;
+		uint32_t PendingDecode = 0;
+		uint32_t PendingUpload = 0;
+
+		uint64_t BytesUploaded = 0;
+		uint32_t BytesUploadedLastFrame = 0;
+		uint32_t UploadBudget = 0;
+		uint32_t FramesAtBudget = 0;    // Updates that stopped because the budget ran out
+
+		double DecodeMs = 0.0;          // Summed over all decodes, on whichever worker ran them
+		double LastLatencyMs = 0.0;
+		double MaxLatencyMs = 0.0;
+		double TotalLatencyMs = 0.0;
+
+		[[nodiscard]] double GetAverageLatencyMs() const noexcept { return Completed > 0 ? TotalLatencyMs / Completed : 0.0; }
+	};
+
+	/*
+	* @brief Loads textures without stalling the frame.
+	*
+	* Request() returns a StreamedTexture showing the placeholder and queues the decode on the
+	* JobSystem, which writes into pooled staging memory. Update(), once per frame on the render
+	* thread, uploads at most budgetBytes of decoded rows (a large texture takes several frames)
+	* and swaps each finished texture into its handle.
+	*/
+	class NU_API TextureStreamer
+	{
+	public:
+		/*
+		* @brief Fills image from the file at path, taking its pixels from staging. Runs on worker threads.
+		*/
+		using Decoder = std::function<bool(const std::string& path, Core::BufferPool& staging, DecodedImage& image)>;
+
+		static constexpr uint32_t k_DefaultUploadBudget = 4 * 1024 * 1024;
+
+		explicit TextureStreamer(ITextureUploader& uploader, Decoder decoder = DecodeImageFile);
+
+		/*
+		* @brief Waits for decodes still running, since they write into this object.
+		*/
+		~TextureStreamer();
+
+		TextureStreamer(const TextureStreamer&) = delete;
+		TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+		[[nodiscard]] std::shared_ptr<ITexture> Request(const std::string& path);
+
+		/*
+		* @brief Uploads up to budgetBytes (at least one row, so any texture progresses) and swaps finished handles.
+		*/
+		void Update(uint32_t budgetBytes = k_DefaultUploadBudget);
+
+		/*
+		* @brief Blocks until every requested decode has finished, helping the JobSystem meanwhile.
+		*/
+		void WaitForDecodes();
+
+		[[nodiscard]] bool IsIdle() const;
+
+		[[nodiscard]] const TextureStreamingStats& GetStats() const noexcept { return m_Stats; }
+
+		[[nodiscard]] Core::BufferPool& GetStagingPool() noexcept { return m_Staging; }
+
+		/*
+		* @brief stb_image decoder. Three-channel images stay RGB, everything else is expanded to RGBA.
+		*/
+		static bool DecodeImageFile(const std::string& path, Core::BufferPool& staging, DecodedImage& image);
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct PendingTexture
+		{
+			std::shared_ptr<StreamedTexture> Handle;
+			Clock::time_point RequestTime;
+			DecodedImage Image;
+			bool Decoded = false;
+			double DecodeMs = 0.0;
+
+			std::shared_ptr<ITexture> Target;
+			uint32_t NextRow = 0;
+		};
+
+		void Complete(PendingTexture& texture);
+
+		ITextureUploader& m_Uploader;
+		Decoder m_Decoder;
+		Core::BufferPool m_Staging;
+
+		std::atomic<uint32_t> m_DecodesInFlight = 0;
+
+		mutable std::mutex m_DecodedMutex;
+		std::deque<std::shared_ptr<PendingTexture>> m_Decoded;
+
+		// Render thread only
+		std::deque<std::shared_ptr<PendingTexture>> m_Uploads;
+		TextureStreamingStats m_Stats;
+	};
+}
@@ -0,0 +1,174 @@
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/NullResources.hpp>
+#include <Core/Logging/Logger.hpp>
+
+namespace NuEngine::Graphics::Null
+{
+	NullRenderDevice::NullRenderDevice()
+		: m_TextureUploader(std::make_unique<NullTextureUploader>())
+	{
+	}
+
+	NullRenderDevice::~NullRenderDevice() = default;
+
+	Core::Result<void, GraphicsError> NullRenderDevice::Clear(float, float, float, float) noexcept
+	{
+		m_Stats.Clears++;
+		return Core::Ok();
+	}
+
+	Core::Result<std::shared_ptr<IShader>, GraphicsError> NullRenderDevice::CreateShader(const std::string& vertexSrc, const std::string& fragmentSrc) noexcept
+	{
+		if (vertexSrc.empty() || fragmentSrc.empty())
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::InvalidParameter));
+		}
+
+		m_Stats.ShadersCreated++;
+		return Core::Ok(std::static_pointer_cast<IShader>(std::make_shared<NullShader>(m_NextResourceID++)));
+	}
+
+	std::shared_ptr<IVertexArray> NullRenderDevice::CreateVertexArray()
+	{
+		m_Stats.VertexArraysCreated++;
+		return std::make_shared<NullVertexArray>();
+	}
+
+	std::shared_ptr<IVertexBuffer> NullRenderDevice::CreateVertexBuffer(float*, unsigned int size)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullVertexBuffer>(size);
+	}
+
+	std::shared_ptr<IVertexBuffer> NullRenderDevice::CreateDynamicVertexBuffer(unsigned int size)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullVertexBuffer>(size);
+	}
+
+	std::shared_ptr<IStreamingBuffer> NullRenderDevice::CreateStreamingBuffer(uint32_t regionSize)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullStreamingBuffer>(regionSize);
+	}
+
+	std::shared_ptr<IIndexBuffer> NullRenderDevice::CreateIndexBuffer(unsigned int*, unsigned int count)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullIndexBuffer>(count);
+	}
+
+	std::shared_ptr<IIndexBuffer> NullRenderDevice::CreateIndexBuffer(const void*, unsigned int count, IndexFormat format)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullIndexBuffer>(count, format);
+	}
+
+	std::shared_ptr<ITexture> NullRenderDevice::CreateTexture(const std::string& path)
+	{
+		m_Stats.TexturesCreated++;
+		return std::make_shared<NullTexture>(path, m_NextResourceID++);
+	}
+
+	TextureStreamer& NullRenderDevice::GetTextureStreamer()
+	{
+		if (!m_TextureStreamer)
+		{
+			m_TextureStreamer = std::make_unique<TextureStreamer>(*m_TextureUploader);
+		}
+		return *m_TextureStreamer;
+	}
+
+	std::shared_ptr<IUniformBuffer> NullRenderDevice::CreateUniformBuffer(uint32_t size, uint32_t binding)
+	{
+		m_Stats.BuffersCreated++;
+		return std::make_shared<NullUniformBuffer>(size, binding);
+	}
+
+	Core::Result<void, GraphicsError> NullRenderDevice::DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept
+	{
+		if (!vertexArray)
+		{
+			LOG_WARNING("Attempting to draw null vertex array");
+			return Core::Ok();
+		}
+
+		if (!vertexArray->GetIndexBuffer())
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::InvalidParameter));
+		}
+
+		if (m_StateCache.SetVertexArray(vertexArray->GetUniqueID()))
+		{
+			m_Stats.VertexArrayChanges++;
+		}
+
+		m_Stats.DrawCalls++;
+		m_Stats.Instances++;
+		return Core::Ok();
+	}
+
+	void NullRenderDevice::BindShader(IShader* shader) noexcept
+	{
+		m_Stats.ShaderBinds++;
+		if (m_StateCache.SetShader(shader ? shader->GetUniqueID() : 0))
+		{
+			m_Stats.ShaderChanges++;
+		}
+	}
+
+	void NullRenderDevice::BindTexture(ITexture* texture, uint32_t slot) noexcept
+	{
+		m_Stats.TextureBinds++;
+		if (m_StateCache.SetTexture(texture ? texture->GetUniqueID() : 0, slot))
+		{
+			m_Stats.TextureChanges++;
+		}
+	}
+
+	void NullRenderDevice::BindPipelineState(const PipelineState& state) noexcept
+	{
+		m_Stats.PipelineBinds++;
+		if (m_StateCache.SetPipeline(state))
+		{
+			m_Stats.PipelineChanges++;
+		}
+	}
+
+	Core::Result<void, GraphicsError> NullRenderDevice::DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t) noexcept
+	{
+		if (!vertexArray)
+		{
+			LOG_WARNING("Attempting to draw null vertex array");
+			return Core::Ok();
+		}
+
+		if (instanceCount == 0)
+		{
+			return Core::Ok();
+		}
+
+		if (m_StateCache.SetVertexArray(vertexArray->GetUniqueID()))
+		{
+			m_Stats.VertexArrayChanges++;
+		}
+
+		const auto& indexBuffer = vertexArray->GetIndexBuffer();
+		m_Stats.DrawCalls++;
+		m_Stats.Instances += instanceCount;
+		m_Stats.Vertices += static_cast<uint64_t>(indexBuffer ? indexBuffer->GetCount() : vertexCount) * instanceCount;
+		return Core::Ok();
+	}
+
+	Core::Result<void, GraphicsError> NullRenderDevice::Present() noexcept
+	{
+		m_Stats.Presents++;
+		m_StateCache.EndFrame();
+		return Core::Ok();
+	}
+
+	void NullRenderDevice::SetViewport(int, int, int, int) noexcept
+	{
+		m_Stats.ViewportChanges++;
+	}
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Core/IRenderDevice.hpp>
+#include <Graphics/Abstractions/Textures/ITextureUploader.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace NuEngine::Graphics::Null
+{
+	/*
+	* @brief Calls seen by a NullRenderDevice since creation or the last ResetStats().
+	*
+	* *Binds count calls; *Changes count only the calls that bound something different from what was bound.
+	*/
+	struct RenderDeviceStats
+	{
+		uint32_t Clears = 0;
+		uint32_t Presents = 0;
+		uint32_t DrawCalls = 0;
+		uint64_t Instances = 0;
+		uint64_t Vertices = 0;             // Indices (or vertices when not indexed) times instances
+		uint32_t ShaderBinds = 0;
+		uint32_t ShaderChanges = 0;
+		uint32_t TextureBinds = 0;
+		uint32_t TextureChanges = 0;
+		uint32_t PipelineBinds = 0;
+		uint32_t PipelineChanges = 0;
+		uint32_t VertexArrayChanges = 0;   // Draws that switched vertex array
+		uint32_t ViewportChanges = 0;
+		uint32_t ShadersCreated = 0;
+		uint32_t VertexArraysCreated = 0;
+		uint32_t BuffersCreated = 0;
+		uint32_t TexturesCreated = 0;
+	};
+
+	/*
+	* @brief Render device that needs no window, context or GPU.
+	*
+	* Resources are lightweight stand-ins and every draw is a no-op, so the whole frame loop
+	* (culling, sorting, batching) runs as on GL and can be measured or asserted on through GetStats().
+	* Binds go through the same RenderStateCache as on GL, so GetStateChangeStats() matches what GL would issue.
+	*/
+	class NU_API NullRenderDevice : public IRenderDevice
+	{
+	public:
+		NullRenderDevice();
+		~NullRenderDevice() override;
+
+		[[nodiscard]] Core::Result<void, GraphicsError> Clear(float r, float g, float b, float a) noexcept override;
+		[[nodiscard]] Core::Result<std::shared_ptr<IShader>, GraphicsError> CreateShader(const std::string& vertexSrc, const std::string& fragmentSrc) noexcept override;
+		[[nodiscard]] std::shared_ptr<IVertexArray> CreateVertexArray() override;
+		[[nodiscard]] std::shared_ptr<IVertexBuffer> CreateVertexBuffer(float* vertices, unsigned int size) override;
+		[[nodiscard]] std::shared_ptr<IVertexBuffer> CreateDynamicVertexBuffer(unsigned int size) override;
+		[[nodiscard]] std::shared_ptr<IStreamingBuffer> CreateStreamingBuffer(uint32_t regionSize) override;
+		[[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(unsigned int* indices, unsigned int count) override;
+		[[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(const void* indices, unsigned int count, IndexFormat format) override;
+		[[nodiscard]] std::shared_ptr<ITexture> CreateTexture(const std::string& path) override;
+		[[nodiscard]] TextureStreamer& GetTextureStreamer() override;
+		[[nodiscard]] std::shared_ptr<IUniformBuffer> CreateUniformBuffer(uint32_t size, uint32_t binding) override;
+		[[nodiscard]] Core::Result<void, GraphicsError> DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept override;
+		void BindShader(IShader* shader) noexcept override;
+		void BindTexture(ITexture* texture, uint32_t slot) noexcept override;
+		void BindPipelineState(const PipelineState& state) noexcept override;
+		[[nodiscard]] const StateChangeStats& GetStateChangeStats() const noexcept override { return m_StateCache.GetFrameStats(); }
+		[[nodiscard]] Core::Result<void, GraphicsError> DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance) noexcept override;
+		[[nodiscard]] Core::Result<void, GraphicsError> Present() noexcept override;
+		void SetViewport(int x, int y, int width, int height) noexcept override;
+
+		[[nodiscard]] const RenderDeviceStats& GetStats() const noexcept { return m_Stats; }
+
+		/*
+		* @brief Zeroes the counters. The bound shader/textures are kept, so the next change is still detected correctly.
+		*/
+		void ResetStats() noexcept { m_Stats = {}; }
+
+	protected:
+		RenderDeviceStats m_Stats;
+
+	private:
+		RenderStateCache m_StateCache;
+		uint32_t m_NextResourceID = 1;
+
+		std::unique_ptr<ITextureUploader> m_TextureUploader;
+		std::unique_ptr<TextureStreamer> m_TextureStreamer;
+	};
+}
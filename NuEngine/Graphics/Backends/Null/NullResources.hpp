@@ -0,0 +1,239 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/IIndexBuffer.hpp>
+#include <Graphics/Abstractions/Buffers/IUniformBuffer.hpp>
+#include <Graphics/Abstractions/Buffers/StreamingBuffer.hpp>
+#include <Graphics/Abstractions/Buffers/IVertexArray.hpp>
+#include <Graphics/Abstractions/Buffers/IVertexBuffer.hpp>
+#include <Graphics/Abstractions/Shaders/IShader.hpp>
+#include <Graphics/Abstractions/Textures/ITexture.hpp>
+#include <Graphics/Abstractions/Textures/ITextureUploader.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NuEngine::Graphics::Null
+{
+	/*
+	* @brief Shader that accepts every uniform and keeps nothing. IDs are unique per device so sort keys still differ.
+	*/
+	class NullShader : public IShader
+	{
+	public:
+		explicit NullShader(GLuint id) : m_ID(id) {}
+
+		void Bind() override {}
+		void Unbind() override {}
+
+		GLuint GetID() const override { return m_ID; }
+
+		void SetInt(UniformID, int) override {}
+		void SetFloat(UniformID, float) override {}
+		void SetVec2(UniformID, const NuMath::Vector2&) override {}
+		void SetVec3(UniformID, const NuMath::Vector3&) override {}
+		void SetVec4(UniformID, const NuMath::Vector4&) override {}
+		void SetColor(UniformID, const NuMath::Color&) override {}
+		void SetMat4x4(UniformID, const NuMath::Matrix4x4&) override {}
+
+	private:
+		GLuint m_ID;
+	};
+
+	/*
+	* @brief Vertex buffer with a layout and a size but no storage. SetData only tracks the size.
+	*/
+	class NullVertexBuffer : public IVertexBuffer
+	{
+	public:
+		explicit NullVertexBuffer(uint32_t size) : m_Size(size) {}
+
+		void Bind() const override {}
+		void Unbind() const override {}
+
+		bool SetData(const void*, uint32_t size) override
+		{
+			if (size > m_Size) m_Size = size;
+			return true;
+		}
+
+		const BufferLayout& GetLayout() const override { return m_Layout; }
+		void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		uint32_t GetSize() const { return m_Size; }
+
+	private:
+		BufferLayout m_Layout;
+		uint32_t m_Size;
+	};
+
+	/*
+	* @brief Uniform buffer kept in system memory, so tests can read back what a frame uploaded.
+	*/
+	class NullUniformBuffer : public IUniformBuffer
+	{
+	public:
+		NullUniformBuffer(uint32_t size, uint32_t binding) : m_Data(size), m_Binding(binding) {}
+
+		void Bind() const override {}
+
+		void SetData(const void* data, uint32_t size, uint32_t offset) override
+		{
+			if (static_cast<size_t>(offset) + size > m_Data.size()) return;
+			std::memcpy(m_Data.data() + offset, data, size);
+			m_Updates++;
+		}
+
+		uint32_t GetSize() const override { return static_cast<uint32_t>(m_Data.size()); }
+		uint32_t GetBinding() const override { return m_Binding; }
+
+		const std::vector<std::byte>& GetData() const { return m_Data; }
+		uint32_t GetUpdateCount() const { return m_Updates; }
+
+	private:
+		std::vector<std::byte> m_Data;
+		uint32_t m_Binding;
+		uint32_t m_Updates = 0;
+	};
+
+	/*
+	* @brief Streaming buffer over system memory. Fences are counted and always already signalled.
+	*/
+	class NullStreamingBuffer : public StreamingBuffer
+	{
+	public:
+		explicit NullStreamingBuffer(uint32_t regionSize)
+			: StreamingBuffer(regionSize), m_Memory(static_cast<size_t>(regionSize) * k_RegionCount)
+		{
+			SetMappedMemory(m_Memory.data());
+		}
+
+		void Bind() const override {}
+		void Unbind() const override {}
+
+		uint32_t GetFencesInserted() const { return m_FencesInserted; }
+
+	protected:
+		void InsertFence(uint32_t) override { m_FencesInserted++; }
+		bool WaitFence(uint32_t) override { return false; }
+
+	private:
+		std::vector<std::byte> m_Memory;
+		uint32_t m_FencesInserted = 0;
+	};
+
+	class NullIndexBuffer : public IIndexBuffer
+	{
+	public:
+		explicit NullIndexBuffer(unsigned int count, IndexFormat format = IndexFormat::UInt32) : m_Count(count), m_Format(format) {}
+
+		void Bind() const override {}
+		void Unbind() const override {}
+
+		unsigned int GetCount() const override { return m_Count; }
+		IndexFormat GetFormat() const override { return m_Format; }
+
+	private:
+		unsigned int m_Count;
+		IndexFormat m_Format;
+	};
+
+	/*
+	* @brief Keeps its buffers so code that inspects a vertex array (e.g. AttachInstanceBuffer) behaves as on GL.
+	*/
+	class NullVertexArray : public IVertexArray
+	{
+	public:
+		void Bind() const override {}
+		void Unbind() const override {}
+
+		void AddVertexBuffer(const std::shared_ptr<IVertexBuffer>& vertexBuffer) override { m_VertexBuffers.push_back(vertexBuffer); }
+		void SetIndexBuffer(const std::shared_ptr<IIndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+
+		const std::vector<std::shared_ptr<IVertexBuffer>>& GetVertexBuffer() const override { return m_VertexBuffers; }
+		const std::shared_ptr<IIndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+	private:
+		std::vector<std::shared_ptr<IVertexBuffer>> m_VertexBuffers;
+		std::shared_ptr<IIndexBuffer> m_IndexBuffer;
+	};
+
+	/*
+	* @brief Texture that never reads its file. 1x1 unless created with a size by NullTextureUploader.
+	*/
+	class NullTexture : public ITexture
+	{
+	public:
+		NullTexture(const std::string& path, unsigned int id, int width = 1, int height = 1)
+			: m_Path(path), m_ID(id), m_Width(width), m_Height(height) {}
+
+		void Bind(unsigned int) const override {}
+		void Unbind() const override {}
+
+		int GetWidth() const override { return m_Width; }
+		int GetHeight() const override { return m_Height; }
+
+		const std::string& GetPath() const override { return m_Path; }
+
+		unsigned int GetID() const override { return m_ID; }
+
+	private:
+		std::string m_Path;
+		unsigned int m_ID;
+		int m_Width;
+		int m_Height;
+	};
+
+	/*
+	* @brief Uploader that only counts what it was given, so streaming budgets can be checked without a GPU.
+	*/
+	class NullTextureUploader : public ITextureUploader
+	{
+	public:
+		std::shared_ptr<ITexture> GetPlaceholder() override
+		{
+			if (!m_Placeholder)
+			{
+				m_Placeholder = std::make_shared<NullTexture>("<placeholder>", m_NextID++);
+			}
+			return m_Placeholder;
+		}
+
+		std::shared_ptr<ITexture> CreateTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels) override
+		{
+			m_Channels[m_NextID] = channels;
+			m_TexturesCreated++;
+			return std::make_shared<NullTexture>(path, m_NextID++, static_cast<int>(width), static_cast<int>(height));
+		}
+
+		void UploadRows(ITexture& texture, uint32_t, uint32_t rowCount, const std::byte*) override
+		{
+			m_RowsUploaded += rowCount;
+			m_BytesUploaded += static_cast<uint64_t>(texture.GetWidth()) * m_Channels[texture.GetID()] * rowCount;
+		}
+
+		void FinishTexture(ITexture&) override { m_TexturesFinished++; }
+
+		uint32_t GetTexturesCreated() const { return m_TexturesCreated; }
+		uint32_t GetTexturesFinished() const { return m_TexturesFinished; }
+		uint64_t GetRowsUploaded() const { return m_RowsUploaded; }
+		uint64_t GetBytesUploaded() const { return m_BytesUploaded; }
+
+	private:
+		std::shared_ptr<ITexture> m_Placeholder;
+		std::unordered_map<unsigned int, uint32_t> m_Channels;
+		unsigned int m_NextID = 1;
+		uint32_t m_TexturesCreated = 0;
+		uint32_t m_TexturesFinished = 0;
+		uint64_t m_RowsUploaded = 0;
+		uint64_t m_BytesUploaded = 0;
+	};
+}
@@ -0,0 +1,88 @@
+#include <Graphics/Backends/Null/RecordingRenderDevice.hpp>
+
+namespace NuEngine::Graphics::Null
+{
+	void RecordingRenderDevice::Record(const RecordedCommand& command) noexcept
+	{
+		try
+		{
+			m_Commands.push_back(command);
+		}
+		catch (...)
+		{
+			// Out of memory: the counters in GetStats() stay exact, only the log is cut short
+		}
+	}
+
+	Core::Result<void, GraphicsError> RecordingRenderDevice::Clear(float r, float g, float b, float a) noexcept
+	{
+		Record({ RecordedCommandType::Clear });
+		return NullRenderDevice::Clear(r, g, b, a);
+	}
+
+	Core::Result<void, GraphicsError> RecordingRenderDevice::DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept
+	{
+		auto result = NullRenderDevice::DrawIndices(vertexArray);
+		if (result.IsOk() && vertexArray)
+		{
+			RecordedCommand command{ RecordedCommandType::DrawIndices };
+			command.VertexArray = vertexArray.get();
+			command.VertexCount = vertexArray->GetIndexBuffer()->GetCount();
+			command.InstanceCount = 1;
+			Record(command);
+		}
+		return result;
+	}
+
+	void RecordingRenderDevice::BindShader(IShader* shader) noexcept
+	{
+		RecordedCommand command{ RecordedCommandType::BindShader };
+		command.Shader = shader;
+		Record(command);
+		NullRenderDevice::BindShader(shader);
+	}
+
+	void RecordingRenderDevice::BindTexture(ITexture* texture, uint32_t slot) noexcept
+	{
+		RecordedCommand command{ RecordedCommandType::BindTexture };
+		command.Texture = texture;
+		command.Slot = slot;
+		Record(command);
+		NullRenderDevice::BindTexture(texture, slot);
+	}
+
+	void RecordingRenderDevice::BindPipelineState(const PipelineState& state) noexcept
+	{
+		RecordedCommand command{ RecordedCommandType::BindPipelineState };
+		command.Pipeline = &state;
+		Record(command);
+		NullRenderDevice::BindPipelineState(state);
+	}
+
+	Core::Result<void, GraphicsError> RecordingRenderDevice::DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance) noexcept
+	{
+		auto result = NullRenderDevice::DrawInstanced(vertexArray, vertexCount, instanceCount, baseInstance);
+		if (result.IsOk() && vertexArray && instanceCount > 0)
+		{
+			RecordedCommand command{ RecordedCommandType::DrawInstanced };
+			command.VertexArray = vertexArray.get();
+			command.VertexCount = vertexCount;
+			command.InstanceCount = instanceCount;
+			command.BaseInstance = baseInstance;
+			Record(command);
+		}
+		return result;
+	}
+
+	Core::Result<void, GraphicsError> RecordingRenderDevice::Present() noexcept
+	{
+		Record({ RecordedCommandType::Present });
+		return NullRenderDevice::Present();
+	}
+
+	void RecordingRenderDevice::SetViewport(int x, int y, int width, int height) noexcept
+	{
+		Record({ RecordedCommandType::SetViewport });
+		NullRenderDevice::SetViewport(x, y, width, height);
+	}
+}
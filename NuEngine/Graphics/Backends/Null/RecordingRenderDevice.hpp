@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <span>
+#include <vector>
+
+namespace NuEngine::Graphics::Null
+{
+	enum class RecordedCommandType : uint8_t
+	{
+		Clear,
+		BindShader,
+		BindTexture,
+		BindPipelineState,
+		DrawIndices,
+		DrawInstanced,
+		Present,
+		SetViewport
+	};
+
+	/*
+	* @brief One device call. Only the fields that belong to Type are set.
+	*/
+	struct RecordedCommand
+	{
+		RecordedCommandType Type;
+		const IShader* Shader = nullptr;
+		const ITexture* Texture = nullptr;
+		const PipelineState* Pipeline = nullptr;
+		const IVertexArray* VertexArray = nullptr;
+		uint32_t Slot = 0;
+		uint32_t VertexCount = 0;
+		uint32_t InstanceCount = 0;
+		uint32_t BaseInstance = 0;
+	};
+
+	/*
+	* @brief NullRenderDevice that also keeps every call in order, for tests that check what was sent and when.
+	*
+	* The log grows until ClearCommands(); use NullRenderDevice for long headless runs.
+	*/
+	class NU_API RecordingRenderDevice : public NullRenderDevice
+	{
+	public:
+		[[nodiscard]] Core::Result<void, GraphicsError> Clear(float r, float g, float b, float a) noexcept override;
+		[[nodiscard]] Core::Result<void, GraphicsError> DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept override;
+		void BindShader(IShader* shader) noexcept override;
+		void BindTexture(ITexture* texture, uint32_t slot) noexcept override;
+		void BindPipelineState(const PipelineState& state) noexcept override;
+		[[nodiscard]] Core::Result<void, GraphicsError> DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance) noexcept override;
+		[[nodiscard]] Core::Result<void, GraphicsError> Present() noexcept override;
+		void SetViewport(int x, int y, int width, int height) noexcept override;
+
+		[[nodiscard]] std::span<const RecordedCommand> GetCommands() const noexcept { return m_Commands; }
+
+		void ClearCommands() noexcept { m_Commands.clear(); }
+
+	private:
+		void Record(const RecordedCommand& command) noexcept;
+
+		std::vector<RecordedCommand> m_Commands;
+	};
+}
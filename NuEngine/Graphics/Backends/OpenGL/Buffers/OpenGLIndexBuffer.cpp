@@ -5,10 +5,15 @@
 namespace NuEngine::Graphics::OpenGL
 {
 	OpenGLIndexBuffer::OpenGLIndexBuffer(unsigned int* indices, unsigned int count)
-		: m_Count(count)
+		: OpenGLIndexBuffer(indices, count, IndexFormat::UInt32)
+	{
+	}
+
+	OpenGLIndexBuffer::OpenGLIndexBuffer(const void* indices, unsigned int count, IndexFormat format)
+		: m_Count(count), m_Format(format)
 	{
 		glCreateBuffers(1, &m_RendererID);
-		glNamedBufferData(m_RendererID, count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+		glNamedBufferData(m_RendererID, static_cast<GLsizeiptr>(count) * IndexFormatSize(format), indices, GL_STATIC_DRAW);
 	}
 
 	OpenGLIndexBuffer::~OpenGLIndexBuffer()
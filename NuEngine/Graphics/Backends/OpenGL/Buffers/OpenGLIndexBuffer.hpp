@@ -14,15 +14,19 @@ namespace NuEngine::Graphics::OpenGL
 	{
 	public:
 		OpenGLIndexBuffer(unsigned int* indices, unsigned int count);
+		OpenGLIndexBuffer(const void* indices, unsigned int count, IndexFormat format);
 		~OpenGLIndexBuffer();
 
 		void Bind() const override;
 		void Unbind() const override;
 
 		unsigned int GetCount() const override { return m_Count; }
+		IndexFormat GetFormat() const override { return m_Format; }
+		uint32_t GetID() const override { return m_RendererID; }
 
 	private:
 		GLuint m_RendererID;
 		unsigned int m_Count;
+		IndexFormat m_Format;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <Graphics/Backends/OpenGL/Buffers/OpenGLStreamingBuffer.hpp>
+#include <Core/Logging/Logger.hpp>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	// Upper bound for one wait; a frame that takes longer than this has bigger problems
+	static constexpr GLuint64 k_FenceTimeoutNs = 1'000'000'000;
+
+	OpenGLStreamingBuffer::OpenGLStreamingBuffer(uint32_t regionSize)
+		: StreamingBuffer(regionSize)
+	{
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr size = static_cast<GLsizeiptr>(regionSize) * k_RegionCount;
+
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferStorage(m_RendererID, size, nullptr, flags);
+
+		void* memory = glMapNamedBufferRange(m_RendererID, 0, size, flags);
+		if (!memory)
+		{
+			LOG_ERROR("[OpenGL] Failed to map a {} byte streaming buffer", size);
+		}
+		SetMappedMemory(static_cast<std::byte*>(memory));
+	}
+
+	OpenGLStreamingBuffer::~OpenGLStreamingBuffer()
+	{
+		for (GLsync& fence : m_Fences)
+		{
+			if (fence) glDeleteSync(fence);
+		}
+
+		glUnmapNamedBuffer(m_RendererID);
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStreamingBuffer::Bind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+	}
+
+	void OpenGLStreamingBuffer::Unbind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLStreamingBuffer::InsertFence(uint32_t region)
+	{
+		if (m_Fences[region]) glDeleteSync(m_Fences[region]);
+		m_Fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	bool OpenGLStreamingBuffer::WaitFence(uint32_t region)
+	{
+		GLsync fence = m_Fences[region];
+		if (!fence)
+		{
+			return false;
+		}
+
+		// Poll first: with three regions in flight the fence has almost always passed already
+		GLenum status = glClientWaitSync(fence, 0, 0);
+		const bool blocked = status == GL_TIMEOUT_EXPIRED;
+
+		while (status == GL_TIMEOUT_EXPIRED)
+		{
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, k_FenceTimeoutNs);
+		}
+
+		if (status == GL_WAIT_FAILED)
+		{
+			LOG_ERROR("[OpenGL] Waiting on a streaming buffer fence failed");
+		}
+
+		glDeleteSync(fence);
+		m_Fences[region] = nullptr;
+		return blocked;
+	}
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/StreamingBuffer.hpp>
+
+#include <glad/glad.h>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	/*
+	* @brief Immutable storage mapped once with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT.
+	*
+	* Writes through the mapping need no flush or unmap; each region is guarded by a fence sync.
+	*/
+	class OpenGLStreamingBuffer : public StreamingBuffer
+	{
+	public:
+		explicit OpenGLStreamingBuffer(uint32_t regionSize);
+		~OpenGLStreamingBuffer() override;
+
+		void Bind() const override;
+		void Unbind() const override;
+		uint32_t GetID() const override { return m_RendererID; }
+
+	protected:
+		void InsertFence(uint32_t region) override;
+		bool WaitFence(uint32_t region) override;
+
+	private:
+		GLuint m_RendererID = 0;
+		GLsync m_Fences[k_RegionCount] = {};
+	};
+}
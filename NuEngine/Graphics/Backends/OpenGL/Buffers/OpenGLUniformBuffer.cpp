@@ -0,0 +1,36 @@
+#include <Graphics/Backends/OpenGL/Buffers/OpenGLUniformBuffer.hpp>
+#include <Core/Logging/Logger.hpp>
+
+#include <glad/glad.h>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+		: m_Size(size), m_Binding(binding)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_RendererID);
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLUniformBuffer::Bind() const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_RendererID);
+	}
+
+	void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		if (static_cast<uint64_t>(offset) + size > m_Size)
+		{
+			LOG_ERROR("[OpenGL] Uniform buffer update of {} bytes at {} overflows its {} bytes", size, offset, m_Size);
+			return;
+		}
+
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
+}
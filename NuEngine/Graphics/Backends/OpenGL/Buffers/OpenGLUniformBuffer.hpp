@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/IUniformBuffer.hpp>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	typedef unsigned int GLuint;
+
+	class OpenGLUniformBuffer : public IUniformBuffer
+	{
+	public:
+		OpenGLUniformBuffer(uint32_t size, uint32_t binding);
+		~OpenGLUniformBuffer() override;
+
+		void Bind() const override;
+
+		void SetData(const void* data, uint32_t size, uint32_t offset) override;
+
+		uint32_t GetSize() const override { return m_Size; }
+		uint32_t GetBinding() const override { return m_Binding; }
+
+	private:
+		GLuint m_RendererID;
+		uint32_t m_Size;
+		uint32_t m_Binding;
+	};
+}
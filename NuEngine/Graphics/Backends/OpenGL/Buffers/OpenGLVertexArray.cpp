@@ -19,6 +19,9 @@ namespace NuEngine::Graphics::OpenGL
 		case ShaderDataType::Int3:     return GL_INT;
 		case ShaderDataType::Int4:     return GL_INT;
 		case ShaderDataType::Bool:     return GL_BOOL;
+		case ShaderDataType::Short4:   return GL_SHORT;
+		case ShaderDataType::Byte4:    return GL_BYTE;
+		case ShaderDataType::Half2:    return GL_HALF_FLOAT;
 		}
 		return 0;
 	}
@@ -51,39 +54,55 @@ namespace NuEngine::Graphics::OpenGL
 			return;
 		}
 
-		glBindVertexArray(m_RendererID);
-		vertexBuffer->Bind();
-
 		const auto& layout = vertexBuffer->GetLayout();
-		unsigned int index = 0;
 
+		// Setup goes through DSA so it never disturbs the vertex array the device has bound.
+		// The divisor belongs to the binding point, so a buffer mixing per-vertex and per-instance
+		// attributes takes one binding point for each
+		GLuint bindings[2] = { GL_INVALID_INDEX, GL_INVALID_INDEX };
 		for (const auto& element : layout)
 		{
-			glEnableVertexAttribArray(index);
-			glVertexAttribPointer(
-				index,
-				element.GetComponentCount(),
-				ShaderDataTypeToOpenGLBaseType(element.Type),
-				element.Normalized ? GL_TRUE : GL_FALSE,
-				layout.GetStride(),
-				(const void*)(uintptr_t)element.Offset
-			);
-			index++;
+			const uint32_t divisor = element.PerInstance ? 1 : 0;
+			if (bindings[divisor] == GL_INVALID_INDEX)
+			{
+				bindings[divisor] = m_BindingIndex++;
+				glVertexArrayVertexBuffer(m_RendererID, bindings[divisor], vertexBuffer->GetID(), 0, layout.GetStride());
+				glVertexArrayBindingDivisor(m_RendererID, bindings[divisor], divisor);
+			}
 		}
 
-		m_VertexBuffers.push_back(vertexBuffer);
+		// Attribute locations continue across buffers, so a per-instance buffer follows the mesh attributes
+		for (const auto& element : layout)
+		{
+			// Matrices take one vec3/vec4 attribute per column
+			const bool isMatrix = element.Type == ShaderDataType::Mat3 || element.Type == ShaderDataType::Mat4;
+			const uint32_t columns = element.Type == ShaderDataType::Mat3 ? 3 : element.Type == ShaderDataType::Mat4 ? 4 : 1;
+			const uint32_t componentCount = isMatrix ? columns : element.GetComponentCount();
+			const GLuint binding = bindings[element.PerInstance ? 1 : 0];
 
-		glBindVertexArray(0);
+			for (uint32_t column = 0; column < columns; ++column)
+			{
+				glEnableVertexArrayAttrib(m_RendererID, m_VertexAttribIndex);
+				glVertexArrayAttribFormat(
+					m_RendererID,
+					m_VertexAttribIndex,
+					componentCount,
+					ShaderDataTypeToOpenGLBaseType(element.Type),
+					element.Normalized ? GL_TRUE : GL_FALSE,
+					static_cast<GLuint>(element.Offset + column * componentCount * sizeof(float))
+				);
+				glVertexArrayAttribBinding(m_RendererID, m_VertexAttribIndex, binding);
+				m_VertexAttribIndex++;
+			}
+		}
+
+		m_VertexBuffers.push_back(vertexBuffer);
 	}
 
 	void OpenGLVertexArray::SetIndexBuffer(const std::shared_ptr<IIndexBuffer>& indexBuffer)
 	{
-		glBindVertexArray(m_RendererID);
-
-		indexBuffer->Bind();
+		glVertexArrayElementBuffer(m_RendererID, indexBuffer ? indexBuffer->GetID() : 0);
 
 		m_IndexBuffer = indexBuffer;
-
-		glBindVertexArray(0);
 	}
 }
\ No newline at end of file
@@ -33,6 +33,8 @@ namespace NuEngine::Graphics::OpenGL
 
 	private:
 		uint32_t m_RendererID;
+		uint32_t m_VertexAttribIndex = 0;
+		uint32_t m_BindingIndex = 0;
 		std::vector<std::shared_ptr<IVertexBuffer>> m_VertexBuffers;
 		std::shared_ptr<IIndexBuffer> m_IndexBuffer;
 	};
@@ -2,14 +2,24 @@
 
 #include <glad/glad.h>
 
+#include <algorithm>
+
 namespace NuEngine::Graphics::OpenGL
 {
 	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+		: m_Size(size)
 	{
 		glCreateBuffers(1, &m_RendererID);
 		glNamedBufferData(m_RendererID, size, vertices, GL_STATIC_DRAW);
 	}
 
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+		: m_Size(size)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_STREAM_DRAW);
+	}
+
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		glDeleteBuffers(1, &m_RendererID);
@@ -24,4 +34,13 @@ namespace NuEngine::Graphics::OpenGL
 	{
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
+
+	bool OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		// Orphan the old storage so the driver does not stall on draws still reading it
+		m_Size = std::max(m_Size, size);
+		glNamedBufferData(m_RendererID, m_Size, nullptr, GL_STREAM_DRAW);
+		glNamedBufferSubData(m_RendererID, 0, size, data);
+		return true;
+	}
 }
\ No newline at end of file
@@ -14,16 +14,21 @@ namespace NuEngine::Graphics::OpenGL
 	{
 	public:
 		OpenGLVertexBuffer(float* verticies, uint32_t size);
+		explicit OpenGLVertexBuffer(uint32_t size);
 		~OpenGLVertexBuffer() override;
 
 		void Bind() const override;
 		void Unbind() const override;
 
+		bool SetData(const void* data, uint32_t size) override;
+		uint32_t GetID() const override { return m_RendererID; }
+
 		const BufferLayout& GetLayout() const override { return m_Layout; }
 		void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
 	private:
 		GLuint m_RendererID;
+		uint32_t m_Size;
 		BufferLayout m_Layout;
 	};
 }
\ No newline at end of file
@@ -1,37 +1,142 @@
 #include <Graphics/Backends/OpenGL/Core/OpenGLDevice.hpp>
 #include <Graphics/Backends/OpenGL/Shaders/OpenGLShader.hpp>
 #include <Core/Logging/Logger.hpp>
+#include <Core/IO/FileSystem.hpp>
 #include <NuMath/Algebra/Color/Color.hpp>
 
 #include <Graphics/Backends/OpenGL/Buffers/OpenGLVertexArray.hpp>
 #include <Graphics/Backends/OpenGL/Buffers/OpenGLVertexBuffer.hpp>
 #include <Graphics/Backends/OpenGL/Buffers/OpenGLIndexBuffer.hpp>
+#include <Graphics/Backends/OpenGL/Buffers/OpenGLStreamingBuffer.hpp>
+#include <Graphics/Backends/OpenGL/Buffers/OpenGLUniformBuffer.hpp>
 #include <Graphics/Backends/OpenGL/Textures/OpenGLTexture.hpp>
 
 #include <glad/glad.h>
 
 namespace NuEngine::Graphics::OpenGL
 {
+    namespace
+    {
+        GLenum ToGLIndexType(IndexFormat format) noexcept
+        {
+            return format == IndexFormat::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        }
+
+        GLenum ToGLDepthFunc(DepthCompare compare) noexcept
+        {
+            switch (compare)
+            {
+            case DepthCompare::Less:         return GL_LESS;
+            case DepthCompare::LessEqual:    return GL_LEQUAL;
+            case DepthCompare::Equal:        return GL_EQUAL;
+            case DepthCompare::Greater:      return GL_GREATER;
+            case DepthCompare::GreaterEqual: return GL_GEQUAL;
+            case DepthCompare::Always:       return GL_ALWAYS;
+            }
+            return GL_LESS;
+        }
+
+        void SetCapability(GLenum capability, bool enabled) noexcept
+        {
+            if (enabled)
+            {
+                glEnable(capability);
+            }
+            else
+            {
+                glDisable(capability);
+            }
+        }
+
+        void ApplyBlend(BlendMode blend) noexcept
+        {
+            SetCapability(GL_BLEND, blend != BlendMode::Opaque);
+            switch (blend)
+            {
+            case BlendMode::Opaque:        break;
+            case BlendMode::Alpha:         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+            case BlendMode::Additive:      glBlendFunc(GL_SRC_ALPHA, GL_ONE); break;
+            case BlendMode::Premultiplied: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); break;
+            }
+        }
+
+        void ApplyCull(CullMode cull) noexcept
+        {
+            SetCapability(GL_CULL_FACE, cull != CullMode::None);
+            if (cull != CullMode::None)
+            {
+                glCullFace(cull == CullMode::Front ? GL_FRONT : GL_BACK);
+            }
+        }
+    }
+
     OpenGLDevice::OpenGLDevice(std::unique_ptr<IGraphicsContext> context)
-        : m_Context(std::move(context))
+        : m_Context(std::move(context)), m_ProgramCache(Core::FileSystem::GetPath("Cache/Shaders"))
     {
         if (m_Context)
         {
             m_Context->MakeCurrent();
+            BindPipelineState(PipelineState::Default());
+            m_ProgramCache.Initialize();
         }
     }
 
     Core::Result<std::shared_ptr<IShader>, GraphicsError> OpenGLDevice::CreateShader(const std::string& vertexSrc, const std::string& fragmentSrc) noexcept
     {
-        auto shader = std::make_shared<OpenGLShader>();
+        const ShaderSource source{ vertexSrc, fragmentSrc };
+        auto shaders = CreateShaders(std::span<const ShaderSource>(&source, 1));
+        return std::move(shaders.front());
+    }
+
+    std::vector<Core::Result<std::shared_ptr<IShader>, GraphicsError>> OpenGLDevice::CreateShaders(std::span<const ShaderSource> sources) noexcept
+    {
+        struct PendingShader
+        {
+            std::shared_ptr<OpenGLShader> Shader;
+            uint64_t Key;
+            bool Compiling;
+        };
+
+        // Every cache miss is submitted before any is waited on, so parallel-compile drivers overlap them
+        std::vector<PendingShader> pending;
+        pending.reserve(sources.size());
+        for (const ShaderSource& source : sources)
+        {
+            PendingShader entry{ std::make_shared<OpenGLShader>(), m_ProgramCache.MakeKey(source.Vertex, source.Fragment), false };
+
+            if (const GLuint program = m_ProgramCache.Load(entry.Key))
+            {
+                entry.Shader->InitializeFromProgram(program);
+            }
+            else
+            {
+                entry.Shader->BeginCompile(source.Vertex, source.Fragment);
+                entry.Compiling = true;
+            }
 
-        auto initResult = shader->Initialize(vertexSrc, fragmentSrc);
+            pending.push_back(std::move(entry));
+        }
 
-        if (initResult.IsError())
+        std::vector<Core::Result<std::shared_ptr<IShader>, GraphicsError>> shaders;
+        shaders.reserve(pending.size());
+        for (PendingShader& entry : pending)
         {
-            return Core::Err(initResult.UnwrapError());
+            if (entry.Compiling)
+            {
+                auto compileResult = entry.Shader->FinishCompile();
+                if (compileResult.IsError())
+                {
+                    shaders.push_back(Core::Err(compileResult.UnwrapError()));
+                    continue;
+                }
+
+                m_ProgramCache.Store(entry.Key, entry.Shader->GetID());
+            }
+
+            shaders.push_back(Core::Ok(std::static_pointer_cast<IShader>(entry.Shader)));
         }
-        return Core::Ok(std::static_pointer_cast<IShader>(shader));
+
+        return shaders;
     }
 
     Core::Result<void, GraphicsError> OpenGLDevice::Clear(float r, float g, float b, float a) noexcept
@@ -52,16 +157,58 @@ namespace NuEngine::Graphics::OpenGL
         return std::make_shared<OpenGLVertexBuffer>(vertices, size);
     }
 
+    std::shared_ptr<IVertexBuffer> OpenGLDevice::CreateDynamicVertexBuffer(unsigned int size)
+    {
+        return std::make_shared<OpenGLVertexBuffer>(size);
+    }
+
+    std::shared_ptr<IStreamingBuffer> OpenGLDevice::CreateStreamingBuffer(uint32_t regionSize)
+    {
+        return std::make_shared<OpenGLStreamingBuffer>(regionSize);
+    }
+
     std::shared_ptr<IIndexBuffer> OpenGLDevice::CreateIndexBuffer(unsigned int* indices, unsigned int count)
     {
         return std::make_shared<OpenGLIndexBuffer>(indices, count);
     }
 
+    std::shared_ptr<IIndexBuffer> OpenGLDevice::CreateIndexBuffer(const void* indices, unsigned int count, IndexFormat format)
+    {
+        return std::make_shared<OpenGLIndexBuffer>(indices, count, format);
+    }
+
     std::shared_ptr<ITexture> OpenGLDevice::CreateTexture(const std::string& path)
     {
+        // Cooked textures need no decode: the mapped levels go straight to the driver
+        if (std::filesystem::path(path).extension() == ".nutex")
+        {
+            auto file = NuTexFile::Open(path);
+            if (file.IsError())
+            {
+                LOG_ERROR("{}", file.UnwrapError().ToString());
+                return nullptr;
+            }
+            return std::make_shared<OpenGLTexture>(path, file.Unwrap());
+        }
+
         return std::make_shared<OpenGLTexture>(path);
     }
 
+    TextureStreamer& OpenGLDevice::GetTextureStreamer()
+    {
+        if (!m_TextureStreamer)
+        {
+            m_TextureUploader = std::make_unique<OpenGLTextureUploader>();
+            m_TextureStreamer = std::make_unique<TextureStreamer>(*m_TextureUploader);
+        }
+        return *m_TextureStreamer;
+    }
+
+    std::shared_ptr<IUniformBuffer> OpenGLDevice::CreateUniformBuffer(uint32_t size, uint32_t binding)
+    {
+        return std::make_shared<OpenGLUniformBuffer>(size, binding);
+    }
+
     Core::Result<void, GraphicsError> OpenGLDevice::DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept
     {
         if (!m_Context)
@@ -75,10 +222,117 @@ namespace NuEngine::Graphics::OpenGL
             return Core::Ok();
         }
 
-        vertexArray->Bind();
-        uint32_t count = vertexArray->GetIndexBuffer()->GetCount();
-        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
-        vertexArray->Unbind();
+        BindVertexArray(vertexArray.get());
+        const auto& indexBuffer = vertexArray->GetIndexBuffer();
+        glDrawElements(GL_TRIANGLES, indexBuffer->GetCount(), ToGLIndexType(indexBuffer->GetFormat()), nullptr);
+
+        return Core::Ok();
+    }
+
+    void OpenGLDevice::BindShader(IShader* shader) noexcept
+    {
+        if (!m_StateCache.SetShader(shader ? shader->GetUniqueID() : 0))
+        {
+            return;
+        }
+
+        if (shader)
+        {
+            shader->Bind();
+        }
+        else
+        {
+            glUseProgram(0);
+        }
+    }
+
+    void OpenGLDevice::BindTexture(ITexture* texture, uint32_t slot) noexcept
+    {
+        if (!m_StateCache.SetTexture(texture ? texture->GetUniqueID() : 0, slot))
+        {
+            return;
+        }
+
+        if (texture)
+        {
+            texture->Bind(slot);
+        }
+        else
+        {
+            glBindTextureUnit(slot, 0);
+        }
+    }
+
+    void OpenGLDevice::BindPipelineState(const PipelineState& state) noexcept
+    {
+        // Copied before the cache moves on, so only the fields that differ reach the driver
+        const PipelineStateDesc* bound = m_StateCache.GetPipeline();
+        const bool known = bound != nullptr;
+        const PipelineStateDesc previous = known ? *bound : PipelineStateDesc{};
+
+        if (!m_StateCache.SetPipeline(state))
+        {
+            return;
+        }
+
+        const PipelineStateDesc& desc = state.GetDesc();
+        if (!known || desc.DepthTest != previous.DepthTest)
+        {
+            SetCapability(GL_DEPTH_TEST, desc.DepthTest);
+        }
+        if (!known || desc.DepthWrite != previous.DepthWrite)
+        {
+            glDepthMask(desc.DepthWrite ? GL_TRUE : GL_FALSE);
+        }
+        if (!known || desc.Depth != previous.Depth)
+        {
+            glDepthFunc(ToGLDepthFunc(desc.Depth));
+        }
+        if (!known || desc.Blend != previous.Blend)
+        {
+            ApplyBlend(desc.Blend);
+        }
+        if (!known || desc.Cull != previous.Cull)
+        {
+            ApplyCull(desc.Cull);
+        }
+    }
+
+    void OpenGLDevice::BindVertexArray(const IVertexArray* vertexArray) noexcept
+    {
+        if (m_StateCache.SetVertexArray(vertexArray->GetUniqueID()))
+        {
+            vertexArray->Bind();
+        }
+    }
+
+    Core::Result<void, GraphicsError> OpenGLDevice::DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance) noexcept
+    {
+        if (!m_Context)
+        {
+            return Core::Err(GraphicsError(GraphicsErrorCode::InvalidContext));
+        }
+
+        if (!vertexArray)
+        {
+            LOG_WARNING("Attempting to draw null vertex array");
+            return Core::Ok();
+        }
+
+        if (instanceCount == 0)
+        {
+            return Core::Ok();
+        }
+
+        BindVertexArray(vertexArray.get());
+        if (const auto& indexBuffer = vertexArray->GetIndexBuffer())
+        {
+            glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexBuffer->GetCount(), ToGLIndexType(indexBuffer->GetFormat()), nullptr, instanceCount, baseInstance);
+        }
+        else
+        {
+            glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, baseInstance);
+        }
 
         return Core::Ok();
     }
@@ -86,6 +340,7 @@ namespace NuEngine::Graphics::OpenGL
     Core::Result<void, GraphicsError> OpenGLDevice::Present() noexcept
     {
         if (!m_Context) return Core::Err(GraphicsError(GraphicsErrorCode::InvalidContext));
+        m_StateCache.EndFrame();
         return m_Context->SwapBuffers();
     }
 
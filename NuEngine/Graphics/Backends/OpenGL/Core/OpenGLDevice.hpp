@@ -6,8 +6,11 @@
 
 #include <Graphics/Abstractions/Core/IRenderDevice.hpp>
 #include <Graphics/Abstractions/Core/IGraphicsContext.hpp>
+#include <Graphics/Abstractions/Core/RenderStateCache.hpp>
 #include <Graphics/Abstractions/Buffers/IVertexArray.hpp>
 #include <Graphics/Abstractions/Shaders/IShader.hpp>
+#include <Graphics/Backends/OpenGL/Shaders/OpenGLProgramCache.hpp>
+#include <Graphics/Backends/OpenGL/Textures/OpenGLTextureUploader.hpp>
 #include <Core/Types/Result.hpp>
 
 #include <Graphics/Abstractions/Buffers/IVertexArray.hpp>
@@ -32,17 +35,40 @@ namespace NuEngine::Graphics::OpenGL
 		~OpenGLDevice() override = default;
 
 		[[nodiscard]] Core::Result<std::shared_ptr<IShader>, GraphicsError> CreateShader(const std::string& vertexSrc, const std::string& fragmentSrc) noexcept override;
+		[[nodiscard]] std::vector<Core::Result<std::shared_ptr<IShader>, GraphicsError>> CreateShaders(std::span<const ShaderSource> sources) noexcept override;
 		[[nodiscard]] Core::Result<void, GraphicsError> Clear(float r, float g, float b, float a) noexcept override;
 		[[nodiscard]] std::shared_ptr<IVertexArray> CreateVertexArray() override;
 		[[nodiscard]] std::shared_ptr<IVertexBuffer> CreateVertexBuffer(float* vertices, unsigned int size) override;
+		[[nodiscard]] std::shared_ptr<IVertexBuffer> CreateDynamicVertexBuffer(unsigned int size) override;
+		[[nodiscard]] std::shared_ptr<IStreamingBuffer> CreateStreamingBuffer(uint32_t regionSize) override;
 		[[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(unsigned int* indices, unsigned int count) override;
+		[[nodiscard]] std::shared_ptr<IIndexBuffer> CreateIndexBuffer(const void* indices, unsigned int count, IndexFormat format) override;
 		[[nodiscard]] std::shared_ptr<ITexture> CreateTexture(const std::string& path) override;
+		[[nodiscard]] TextureStreamer& GetTextureStreamer() override;
+		[[nodiscard]] std::shared_ptr<IUniformBuffer> CreateUniformBuffer(uint32_t size, uint32_t binding) override;
 		[[nodiscard]] Core::Result<void, GraphicsError> DrawIndices(const std::shared_ptr<IVertexArray>& vertexArray) noexcept override;
+		void BindShader(IShader* shader) noexcept override;
+		void BindTexture(ITexture* texture, uint32_t slot) noexcept override;
+		void BindPipelineState(const PipelineState& state) noexcept override;
+		[[nodiscard]] const StateChangeStats& GetStateChangeStats() const noexcept override { return m_StateCache.GetFrameStats(); }
+		[[nodiscard]] Core::Result<void, GraphicsError> DrawInstanced(const std::shared_ptr<IVertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance) noexcept override;
 		[[nodiscard]] Core::Result<void, GraphicsError> Present() noexcept override;
 		void SetViewport(int x, int y, int width, int height) noexcept override;
 
+		/*
+		* @brief Forgets the cached bindings. Call after GL state was changed outside the device (e.g. by an overlay).
+		*/
+		void InvalidateStateCache() noexcept { m_StateCache.Invalidate(); }
+
 	private:
+		void BindVertexArray(const IVertexArray* vertexArray) noexcept;
+
 		std::unique_ptr<IGraphicsContext> m_Context;
-		std::shared_ptr<IShader> m_Shader;
+		OpenGLProgramCache m_ProgramCache;
+		RenderStateCache m_StateCache;
+
+		// Created on first use, when the context is current; destroyed before it
+		std::unique_ptr<OpenGLTextureUploader> m_TextureUploader;
+		std::unique_ptr<TextureStreamer> m_TextureStreamer;
 	};
 }
\ No newline at end of file
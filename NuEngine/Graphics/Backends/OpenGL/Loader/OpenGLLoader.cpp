@@ -17,6 +17,25 @@ namespace NuEngine::Graphics::OpenGL
 		return p;
 	}
 
+	static bool s_ParallelShaderCompile = false;
+
+	static void LoadParallelShaderCompile() noexcept
+	{
+		using MaxShaderCompilerThreadsFn = void (APIENTRYP)(GLuint count);
+
+		const char* function = nullptr;
+		if (OpenGLLoader::HasExtension("GL_KHR_parallel_shader_compile")) function = "glMaxShaderCompilerThreadsKHR";
+		else if (OpenGLLoader::HasExtension("GL_ARB_parallel_shader_compile")) function = "glMaxShaderCompilerThreadsARB";
+
+		auto maxShaderCompilerThreads = function ? reinterpret_cast<MaxShaderCompilerThreadsFn>(GetAnyGLFuncAddress(function)) : nullptr;
+		if (maxShaderCompilerThreads)
+		{
+			// 0xFFFFFFFF lets the driver choose how many threads to use
+			maxShaderCompilerThreads(0xFFFFFFFFu);
+			s_ParallelShaderCompile = true;
+		}
+	}
+
 	Core::Result<void, GraphicsError> OpenGLLoader::LoadFunctions() noexcept
 	{
 		if (!gladLoadGLLoader((GLADloadproc)GetAnyGLFuncAddress))
@@ -29,6 +48,28 @@ namespace NuEngine::Graphics::OpenGL
 			return Core::Err(GraphicsError(GraphicsErrorCode::FunctionLoadFailed, "OpenGL context invalid"));
 		}
 
+		LoadParallelShaderCompile();
+
 		return Core::Ok();
 	}
+
+	bool OpenGLLoader::HasExtension(std::string_view name) noexcept
+	{
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+		for (GLint i = 0; i < count; ++i)
+		{
+			const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+			if (extension && name == extension)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool OpenGLLoader::HasParallelShaderCompile() noexcept
+	{
+		return s_ParallelShaderCompile;
+	}
 }
\ No newline at end of file
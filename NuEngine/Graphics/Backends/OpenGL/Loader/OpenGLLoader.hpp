@@ -7,6 +7,13 @@
 #include <Core/Types/Result.hpp>
 #include <Graphics/Errors/GraphicsError.hpp>
 
+#include <string_view>
+
+// GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile (same value); not in the generated loader
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace NuEngine::Graphics::OpenGL
 {
 	/*
@@ -19,5 +26,17 @@ namespace NuEngine::Graphics::OpenGL
 		* 
 		*/
 		static Core::Result<void, GraphicsError> LoadFunctions() noexcept;
+
+		/*
+		* @brief Whether the current context lists the extension. Needs a current context.
+		*/
+		[[nodiscard]] static bool HasExtension(std::string_view name) noexcept;
+
+		/*
+		* @brief True when the driver compiles shaders on its own threads (KHR or ARB parallel_shader_compile).
+		*
+		* Detected by LoadFunctions(), which also lets the driver pick its thread count.
+		*/
+		[[nodiscard]] static bool HasParallelShaderCompile() noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include <Graphics/Backends/OpenGL/Shaders/OpenGLProgramCache.hpp>
+#include <Core/Logging/Logger.hpp>
+#include <Core/Types/Hash.hpp>
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <system_error>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	static std::string GetGLString(GLenum name)
+	{
+		const GLubyte* value = glGetString(name);
+		return value ? reinterpret_cast<const char*>(value) : "";
+	}
+
+	OpenGLProgramCache::OpenGLProgramCache(std::filesystem::path directory)
+		: m_Directory(std::move(directory))
+	{
+	}
+
+	void OpenGLProgramCache::Initialize()
+	{
+		GLint formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+		m_DriverID = GetGLString(GL_VENDOR) + '|' + GetGLString(GL_RENDERER) + '|' + GetGLString(GL_VERSION);
+		m_Enabled = formats > 0;
+
+		if (!m_Enabled)
+		{
+			LOG_INFO("[OpenGL] Driver offers no program binary formats; shaders are compiled on every launch");
+			return;
+		}
+
+		std::error_code error;
+		std::filesystem::create_directories(m_Directory, error);
+		if (error)
+		{
+			LOG_WARNING("[OpenGL] Program cache disabled, cannot create '{}': {}", m_Directory.string(), error.message());
+			m_Enabled = false;
+		}
+	}
+
+	GLuint OpenGLProgramCache::Load(uint64_t key)
+	{
+		if (!m_Enabled)
+		{
+			return 0;
+		}
+
+		const std::filesystem::path path = GetEntryPath(key);
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return 0;
+		}
+
+		std::vector<char> entry(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(entry.data(), static_cast<std::streamsize>(entry.size()));
+		file.close();
+
+		GLenum format = 0;
+		std::span<const std::byte> binary;
+		GLuint program = 0;
+		if (Decode(entry, key, format, binary))
+		{
+			program = glCreateProgram();
+			glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+			GLint isLinked = 0;
+			glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+			if (isLinked == GL_FALSE)
+			{
+				glDeleteProgram(program);
+				program = 0;
+			}
+		}
+
+		if (!program)
+		{
+			// Stale or from another driver build: drop it so the recompiled program replaces it
+			std::error_code error;
+			std::filesystem::remove(path, error);
+		}
+
+		return program;
+	}
+
+	void OpenGLProgramCache::Store(uint64_t key, GLuint program)
+	{
+		if (!m_Enabled)
+		{
+			return;
+		}
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+		{
+			return;
+		}
+
+		std::vector<std::byte> binary(static_cast<size_t>(length));
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+
+		const std::vector<char> entry = Encode(key, format, std::span<const std::byte>(binary.data(), static_cast<size_t>(length)));
+
+		// Written aside and renamed, so a crash never leaves a truncated entry behind
+		const std::filesystem::path path = GetEntryPath(key);
+		std::filesystem::path temporary = path;
+		temporary += ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+			file.write(entry.data(), static_cast<std::streamsize>(entry.size()));
+			if (!file)
+			{
+				LOG_WARNING("[OpenGL] Could not write program cache entry '{}'", temporary.string());
+				return;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temporary, path, error);
+		if (error)
+		{
+			LOG_WARNING("[OpenGL] Could not store program cache entry '{}': {}", path.string(), error.message());
+			std::filesystem::remove(temporary, error);
+		}
+	}
+
+	uint64_t OpenGLProgramCache::MakeKey(std::string_view driverID, std::string_view vertexSrc, std::string_view fragmentSrc) noexcept
+	{
+		// Separators keep ("ab", "c") and ("a", "bc") apart
+		constexpr std::string_view separator("\0", 1);
+
+		uint64_t key = Core::Fnv1a64(driverID);
+		key = Core::Fnv1a64(separator, key);
+		key = Core::Fnv1a64(vertexSrc, key);
+		key = Core::Fnv1a64(separator, key);
+		return Core::Fnv1a64(fragmentSrc, key);
+	}
+
+	std::vector<char> OpenGLProgramCache::Encode(uint64_t key, GLenum format, std::span<const std::byte> binary)
+	{
+		EntryHeader header{};
+		header.Magic = k_Magic;
+		header.Version = k_Version;
+		header.Key = key;
+		header.Format = format;
+		header.Size = static_cast<uint32_t>(binary.size());
+
+		std::vector<char> entry(sizeof(header) + binary.size());
+		std::memcpy(entry.data(), &header, sizeof(header));
+		if (!binary.empty())
+		{
+			std::memcpy(entry.data() + sizeof(header), binary.data(), binary.size());
+		}
+		return entry;
+	}
+
+	bool OpenGLProgramCache::Decode(std::span<const char> entry, uint64_t key, GLenum& format, std::span<const std::byte>& binary) noexcept
+	{
+		if (entry.size() < sizeof(EntryHeader))
+		{
+			return false;
+		}
+
+		EntryHeader header;
+		std::memcpy(&header, entry.data(), sizeof(header));
+
+		if (header.Magic != k_Magic || header.Version != k_Version || header.Key != key
+			|| header.Size == 0 || header.Size != entry.size() - sizeof(header))
+		{
+			return false;
+		}
+
+		format = header.Format;
+		binary = std::span<const std::byte>(reinterpret_cast<const std::byte*>(entry.data() + sizeof(header)), header.Size);
+		return true;
+	}
+
+	std::filesystem::path OpenGLProgramCache::GetEntryPath(uint64_t key) const
+	{
+		return m_Directory / std::format("{:016x}.bin", key);
+	}
+}
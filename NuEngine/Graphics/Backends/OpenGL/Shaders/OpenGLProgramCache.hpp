@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuEngine/Core/API.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	typedef unsigned int GLuint;
+	typedef unsigned int GLenum;
+
+	/*
+	* @brief On-disk cache of linked programs (glGetProgramBinary), one file per program.
+	*
+	* Entries are keyed by the shader sources and the driver (vendor, renderer, version), so a
+	* driver update or an edited shader simply misses. Any entry the driver refuses is deleted
+	* and the caller compiles from source as before. All GL calls need a current context.
+	*/
+	class NU_API OpenGLProgramCache
+	{
+	public:
+		static constexpr uint32_t k_Magic = 0x4250554E; // "NUPB"
+		static constexpr uint32_t k_Version = 1;
+
+		/*
+		* @brief File header; the driver's binary follows directly.
+		*/
+		struct EntryHeader
+		{
+			uint32_t Magic;
+			uint32_t Version;
+			uint64_t Key;
+			uint32_t Format;
+			uint32_t Size;
+		};
+
+		explicit OpenGLProgramCache(std::filesystem::path directory);
+
+		/*
+		* @brief Reads the driver identity and whether it can save binaries at all. Call once the context is current.
+		*/
+		void Initialize();
+
+		[[nodiscard]] bool IsEnabled() const noexcept { return m_Enabled; }
+
+		[[nodiscard]] uint64_t MakeKey(std::string_view vertexSrc, std::string_view fragmentSrc) const noexcept
+		{
+			return MakeKey(m_DriverID, vertexSrc, fragmentSrc);
+		}
+
+		/*
+		* @brief New linked program from the cached binary, or 0 on a miss or a rejected binary.
+		*/
+		[[nodiscard]] GLuint Load(uint64_t key);
+
+		/*
+		* @brief Saves a successfully linked program. Failures are logged and otherwise ignored.
+		*/
+		void Store(uint64_t key, GLuint program);
+
+		// File format, free of GL so it can be tested headless
+
+		[[nodiscard]] static uint64_t MakeKey(std::string_view driverID, std::string_view vertexSrc, std::string_view fragmentSrc) noexcept;
+
+		[[nodiscard]] static std::vector<char> Encode(uint64_t key, GLenum format, std::span<const std::byte> binary);
+
+		/*
+		* @brief Validates an entry read from disk; on success format and binary describe the driver's blob inside it.
+		*/
+		[[nodiscard]] static bool Decode(std::span<const char> entry, uint64_t key, GLenum& format, std::span<const std::byte>& binary) noexcept;
+
+	private:
+		[[nodiscard]] std::filesystem::path GetEntryPath(uint64_t key) const;
+
+		std::filesystem::path m_Directory;
+		std::string m_DriverID;
+		bool m_Enabled = false;
+	};
+}
@@ -1,99 +1,211 @@
 #include <Graphics/Backends/OpenGL/Shaders/OpenGLShader.hpp>
 #include <Core/Logging/Logger.hpp>
+#include <Graphics/Backends/OpenGL/Loader/OpenGLLoader.hpp>
 
+#include <algorithm>
+#include <string_view>
 #include <vector>
 
 namespace NuEngine::Graphics::OpenGL
 {
-	Core::Result<void, GraphicsError> OpenGLShader::Initialize(const std::string& vertexSrc, const std::string& fragmentSrc)
+	static std::string GetShaderLog(GLuint shader)
 	{
-		auto vsRes = CompileShader(GL_VERTEX_SHADER, vertexSrc);
-		if (vsRes.IsError())
+		GLint maxLength = 0;
+		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+		if (maxLength <= 0)
 		{
-			return Core::Err(vsRes.UnwrapError());
+			return "Unknown Compile Error";
 		}
-		GLuint vs = vsRes.Unwrap();
 
-		auto fsRes = CompileShader(GL_FRAGMENT_SHADER, fragmentSrc);
-		if (fsRes.IsError())
+		std::vector<GLchar> infoLog(maxLength);
+		glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
+		return std::string(infoLog.begin(), infoLog.begin() + maxLength);
+	}
+
+	static std::string GetProgramLog(GLuint program)
+	{
+		GLint maxLength = 0;
+		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+		if (maxLength <= 0)
 		{
-			glDeleteShader(vs);
-			return Core::Err(fsRes.UnwrapError());
+			return "Unknown Link Error";
 		}
-		GLuint fs = fsRes.Unwrap();
+
+		std::vector<GLchar> infoLog(maxLength);
+		glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+		return std::string(infoLog.begin(), infoLog.begin() + maxLength);
+	}
+
+	Core::Result<void, GraphicsError> OpenGLShader::Initialize(const std::string& vertexSrc, const std::string& fragmentSrc)
+	{
+		BeginCompile(vertexSrc, fragmentSrc);
+		return FinishCompile();
+	}
+
+	void OpenGLShader::BeginCompile(const std::string& vertexSrc, const std::string& fragmentSrc)
+	{
+		m_VertexShader = CompileShader(GL_VERTEX_SHADER, vertexSrc);
+		m_FragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentSrc);
 
 		m_RendererID = glCreateProgram();
-		glAttachShader(m_RendererID, vs);
-		glAttachShader(m_RendererID, fs);
+		glProgramParameteri(m_RendererID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		glAttachShader(m_RendererID, m_VertexShader);
+		glAttachShader(m_RendererID, m_FragmentShader);
+
+		// Linking a program whose stages failed is harmless: its status is just false
 		glLinkProgram(m_RendererID);
+	}
 
-		GLint isLinked = 0;
-		glGetProgramiv(m_RendererID, GL_LINK_STATUS, &isLinked);
-		if (isLinked == GL_FALSE)
+	Core::Result<void, GraphicsError> OpenGLShader::FinishCompile()
+	{
+		const GLuint stages[] = { m_VertexShader, m_FragmentShader };
+
+		std::string errorMsg;
+		for (GLuint stage : stages)
 		{
-			GLint maxLength = 0;
-			glGetProgramiv(m_RendererID, GL_INFO_LOG_LENGTH, &maxLength);
+			GLint isCompiled = 0;
+			glGetShaderiv(stage, GL_COMPILE_STATUS, &isCompiled);
+			if (isCompiled == GL_FALSE && errorMsg.empty())
+			{
+				errorMsg = GetShaderLog(stage);
+			}
+		}
 
-			std::string errorMsg = "Unknown Link Error";
-			if (maxLength > 0)
+		GLint isLinked = 0;
+		if (errorMsg.empty())
+		{
+			glGetProgramiv(m_RendererID, GL_LINK_STATUS, &isLinked);
+			if (isLinked == GL_FALSE)
 			{
-				std::vector<GLchar> infoLog(maxLength);
-				glGetProgramInfoLog(m_RendererID, maxLength, &maxLength, &infoLog[0]);
-				errorMsg = std::string(infoLog.begin(), infoLog.end());
+				errorMsg = GetProgramLog(m_RendererID);
 			}
+		}
 
+		for (GLuint stage : stages)
+		{
+			glDetachShader(m_RendererID, stage);
+			glDeleteShader(stage);
+		}
+		m_VertexShader = 0;
+		m_FragmentShader = 0;
+
+		if (!errorMsg.empty())
+		{
 			glDeleteProgram(m_RendererID);
-			glDeleteShader(vs);
-			glDeleteShader(fs);
 			m_RendererID = 0;
 
 			return Core::Err(GraphicsError(GraphicsErrorCode::CompilationFailed, errorMsg));
 		}
 
-		glDetachShader(m_RendererID, vs);
-		glDetachShader(m_RendererID, fs);
-		glDeleteShader(vs);
-		glDeleteShader(fs);
+		Reflect();
 
 		return Core::Ok();
 	}
 
-	OpenGLShader::~OpenGLShader()
+	void OpenGLShader::InitializeFromProgram(GLuint program)
 	{
-		if (m_RendererID)
+		m_RendererID = program;
+		Reflect();
+	}
+
+	bool OpenGLShader::IsCompileComplete() const
+	{
+		if (!OpenGLLoader::HasParallelShaderCompile())
 		{
-			glDeleteProgram(m_RendererID);
+			return true;
 		}
+
+		GLint complete = GL_TRUE;
+		glGetProgramiv(m_RendererID, GL_COMPLETION_STATUS_KHR, &complete);
+		return complete == GL_TRUE;
 	}
 
-	Core::Result<GLuint, GraphicsError> OpenGLShader::CompileShader(GLenum type, const std::string& source)
+	void OpenGLShader::Reflect()
 	{
-		GLuint shader = glCreateShader(type);
-		const GLchar* sourceCStr = source.c_str();
-		glShaderSource(shader, 1, &sourceCStr, 0);
-		glCompileShader(shader);
+		m_Uniforms.clear();
+
+		GLint uniformCount = 0;
+		GLint maxNameLength = 0;
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
 
-		GLint isCompiled = 0;
-		glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-		if (isCompiled == GL_FALSE)
+		std::vector<GLchar> name(std::max(maxNameLength, 1));
+		m_Uniforms.reserve(uniformCount);
+		for (GLint i = 0; i < uniformCount; ++i)
 		{
-			GLint maxLength = 0;
-			glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
 
-			std::string errorMsg = "Unknown Compile Error";
-			if (maxLength > 0)
+			// Members of uniform blocks have no location and are set through the block's buffer
+			const GLint location = glGetUniformLocation(m_RendererID, name.data());
+			if (location == -1)
 			{
-				std::vector<GLchar> infoLog(maxLength);
-				glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
-				errorMsg = std::string(infoLog.begin(), infoLog.end());
+				continue;
 			}
 
-			glDeleteShader(shader);
+			std::string_view uniformName(name.data(), length);
+			if (uniformName.ends_with("[0]"))
+			{
+				uniformName.remove_suffix(3);
+			}
 
-			return Core::Err(GraphicsError(GraphicsErrorCode::CompilationFailed, errorMsg));
+			m_Uniforms.push_back({ UniformID::FromName(uniformName), location });
+		}
+
+		std::sort(m_Uniforms.begin(), m_Uniforms.end(),
+			[](const UniformSlot& a, const UniformSlot& b) { return a.ID < b.ID; });
+
+		for (size_t i = 1; i < m_Uniforms.size(); ++i)
+		{
+			if (m_Uniforms[i].ID == m_Uniforms[i - 1].ID)
+			{
+				LOG_ERROR("[OpenGL] Two uniforms of program {} hash to 0x{:08x}; rename one of them", m_RendererID, m_Uniforms[i].ID.Value);
+			}
+		}
+
+		GLint blockCount = 0;
+		GLint maxBlockNameLength = 0;
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+		std::vector<GLchar> blockName(std::max(maxBlockNameLength, 1));
+		for (GLint i = 0; i < blockCount; ++i)
+		{
+			GLsizei length = 0;
+			glGetActiveUniformBlockName(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(blockName.size()), &length, blockName.data());
+
+			const UniformID id = UniformID::FromName(std::string_view(blockName.data(), length));
+			const auto binding = std::find_if(std::begin(UniformBlocks::k_Bindings), std::end(UniformBlocks::k_Bindings),
+				[id](const UniformBlockBinding& entry) { return entry.Block == id; });
+
+			if (binding == std::end(UniformBlocks::k_Bindings))
+			{
+				LOG_WARNING("[OpenGL] Uniform block '{}' has no binding point and will read nothing", blockName.data());
+				continue;
+			}
+
+			glUniformBlockBinding(m_RendererID, static_cast<GLuint>(i), binding->Binding);
+		}
+	}
+
+	OpenGLShader::~OpenGLShader()
+	{
+		if (m_RendererID)
+		{
+			glDeleteProgram(m_RendererID);
 		}
+	}
 
-		return Core::Ok(shader);
+	GLuint OpenGLShader::CompileShader(GLenum type, const std::string& source)
+	{
+		// The status is read in FinishCompile(), so drivers with parallel compile are not forced to wait here
+		GLuint shader = glCreateShader(type);
+		const GLchar* sourceCStr = source.c_str();
+		glShaderSource(shader, 1, &sourceCStr, 0);
+		glCompileShader(shader);
+		return shader;
 	}
 
 	void OpenGLShader::Bind()
@@ -106,54 +218,53 @@ namespace NuEngine::Graphics::OpenGL
 		glUseProgram(0);
 	}
 
-	GLint OpenGLShader::GetUniformLocation(const std::string& name)
+	GLint OpenGLShader::GetUniformLocation(UniformID id)
 	{
-		auto [it, inserted] = m_UniformLocationCache.try_emplace(name, -1);
+		auto it = std::lower_bound(m_Uniforms.begin(), m_Uniforms.end(), id,
+			[](const UniformSlot& slot, UniformID value) { return slot.ID < value; });
 
-		if (inserted)
+		if (it != m_Uniforms.end() && it->ID == id)
 		{
-			it->second = glGetUniformLocation(m_RendererID, name.c_str());
-			if (it->second == -1)
-			{
-				LOG_WARNING("[OpenGL] Uniform '{}' doesn't exist!", name);
-			}
+			return it->Location;
 		}
 
-		return it->second;
+		LOG_WARNING("[OpenGL] Uniform 0x{:08x} doesn't exist in program {}!", id.Value, m_RendererID);
+		m_Uniforms.insert(it, { id, -1 });
+		return -1;
 	}
 
-	void OpenGLShader::SetInt(const std::string& name, int value)
+	void OpenGLShader::SetInt(UniformID id, int value)
 	{
-		glUniform1i(GetUniformLocation(name), value);
+		glProgramUniform1i(m_RendererID, GetUniformLocation(id), value);
 	}
 
-	void OpenGLShader::SetFloat(const std::string& name, float value)
+	void OpenGLShader::SetFloat(UniformID id, float value)
 	{
-		glUniform1f(GetUniformLocation(name), value);
+		glProgramUniform1f(m_RendererID, GetUniformLocation(id), value);
 	}
 
-	void OpenGLShader::SetVec2(const std::string& name, const NuMath::Vector2& vec2)
+	void OpenGLShader::SetVec2(UniformID id, const NuMath::Vector2& vec2)
 	{
-		glUniform2fv(GetUniformLocation(name), 1, vec2.Data());
+		glProgramUniform2fv(m_RendererID, GetUniformLocation(id), 1, vec2.Data());
 	}
 
-	void OpenGLShader::SetVec3(const std::string& name, const NuMath::Vector3& vec3)
+	void OpenGLShader::SetVec3(UniformID id, const NuMath::Vector3& vec3)
 	{
-		glUniform3fv(GetUniformLocation(name), 1, vec3.Data());
+		glProgramUniform3fv(m_RendererID, GetUniformLocation(id), 1, vec3.Data());
 	}
 
-	void OpenGLShader::SetVec4(const std::string& name, const NuMath::Vector4& vec4)
+	void OpenGLShader::SetVec4(UniformID id, const NuMath::Vector4& vec4)
 	{
-		glUniform4fv(GetUniformLocation(name), 1, vec4.Data());
+		glProgramUniform4fv(m_RendererID, GetUniformLocation(id), 1, vec4.Data());
 	}
 
-	void OpenGLShader::SetColor(const std::string& name, const NuMath::Color& color)
+	void OpenGLShader::SetColor(UniformID id, const NuMath::Color& color)
 	{
-		glUniform4fv(GetUniformLocation(name), 1, color.Data());
+		glProgramUniform4fv(m_RendererID, GetUniformLocation(id), 1, color.Data());
 	}
 
-	void OpenGLShader::SetMat4x4(const std::string& name, const NuMath::Matrix4x4& mat4x4)
+	void OpenGLShader::SetMat4x4(UniformID id, const NuMath::Matrix4x4& mat4x4)
 	{
-		glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, mat4x4.Data());
+		glProgramUniformMatrix4fv(m_RendererID, GetUniformLocation(id), 1, GL_FALSE, mat4x4.Data());
 	}
 }
\ No newline at end of file
@@ -11,7 +11,7 @@
 
 #include <glad/glad.h>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace NuEngine::Graphics::OpenGL
 {
@@ -21,25 +21,70 @@ namespace NuEngine::Graphics::OpenGL
 		OpenGLShader() = default;
 		~OpenGLShader() override;
 
+		/*
+		* @brief Compiles and links from source, blocking until done. Same as BeginCompile() + FinishCompile().
+		*/
 		[[nodiscard]] Core::Result<void, GraphicsError> Initialize(const std::string& vertexSrc, const std::string& fragmentSrc);
 
+		/*
+		* @brief Submits compile and link without reading any status back.
+		*
+		* With GL_KHR_parallel_shader_compile the driver works on it in the background, so starting
+		* every variant before finishing the first one compiles them in parallel.
+		*/
+		void BeginCompile(const std::string& vertexSrc, const std::string& fragmentSrc);
+
+		/*
+		* @brief Waits for the work BeginCompile() submitted and reports errors. Reflects the program on success.
+		*/
+		[[nodiscard]] Core::Result<void, GraphicsError> FinishCompile();
+
+		/*
+		* @brief Takes ownership of a program already linked from a cached binary.
+		*/
+		void InitializeFromProgram(GLuint program);
+
+		/*
+		* @brief False while a parallel compile is still running, so FinishCompile() would block. Always true without the extension.
+		*/
+		[[nodiscard]] bool IsCompileComplete() const;
+
 		void Bind() override;
 		void Unbind() override;
 
 		GLuint GetID() const { return m_RendererID; }
 
-		void SetInt(const std::string& name, int value) override;
-		void SetFloat(const std::string& name, float value) override;
-		void SetVec2(const std::string& name, const NuMath::Vector2& vec2) override;
-		void SetVec3(const std::string& name, const NuMath::Vector3& vec3) override;
-		void SetVec4(const std::string& name, const NuMath::Vector4& vec4) override;
-		void SetColor(const std::string& name, const NuMath::Color& color) override;
-		void SetMat4x4(const std::string& name, const NuMath::Matrix4x4& mat4x4) override;
+		void SetInt(UniformID id, int value) override;
+		void SetFloat(UniformID id, float value) override;
+		void SetVec2(UniformID id, const NuMath::Vector2& vec2) override;
+		void SetVec3(UniformID id, const NuMath::Vector3& vec3) override;
+		void SetVec4(UniformID id, const NuMath::Vector4& vec4) override;
+		void SetColor(UniformID id, const NuMath::Color& color) override;
+		void SetMat4x4(UniformID id, const NuMath::Matrix4x4& mat4x4) override;
 	private:
-		GLint GetUniformLocation(const std::string& name);
+		struct UniformSlot
+		{
+			UniformID ID;
+			GLint Location;
+		};
+
+		/*
+		* @brief Binary search in the reflected table. Misses are added with location -1 so they warn only once.
+		*/
+		GLint GetUniformLocation(UniformID id);
+
+		/*
+		* @brief Runs once after link: records every active uniform's location by ID and binds known uniform blocks.
+		*/
+		void Reflect();
+
+		GLuint CompileShader(GLenum type, const std::string& source);
 
-		[[nodiscard]] Core::Result<GLuint, GraphicsError> CompileShader(GLenum type, const std::string& source);
 		GLuint m_RendererID = 0;
-		std::unordered_map<std::string, GLint> m_UniformLocationCache;
+		GLuint m_VertexShader = 0;
+		GLuint m_FragmentShader = 0;
+
+		// Sorted by ID; a handful of entries, so a flat array beats any hash map here
+		std::vector<UniformSlot> m_Uniforms;
 	};
 }
\ No newline at end of file
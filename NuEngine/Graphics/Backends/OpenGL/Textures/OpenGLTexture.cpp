@@ -2,6 +2,17 @@
 #include <Core/Logging/Logger.hpp>
 #include <stb/stb_image.h>
 
+#include <algorithm>
+#include <bit>
+
+// EXT_texture_compression_s3tc / EXT_texture_sRGB, present on every desktop driver but not in the core header
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
 namespace NuEngine::Graphics::OpenGL
 {
 	OpenGLTexture::OpenGLTexture(const std::string& path)
@@ -10,6 +21,73 @@ namespace NuEngine::Graphics::OpenGL
 		Initialize();
 	}
 
+	OpenGLTexture::OpenGLTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels)
+		: m_Path(path), m_RendererID(0), m_Width(static_cast<int>(width)), m_Height(static_cast<int>(height)), m_BPP(static_cast<int>(channels))
+	{
+		switch (channels)
+		{
+		case 1:  m_InternalFormat = GL_R8;    m_DataFormat = GL_RED;  break;
+		case 2:  m_InternalFormat = GL_RG8;   m_DataFormat = GL_RG;   break;
+		case 3:  m_InternalFormat = GL_RGB8;  m_DataFormat = GL_RGB;  break;
+		default: m_InternalFormat = GL_RGBA8; m_DataFormat = GL_RGBA; break;
+		}
+
+		const GLsizei levels = static_cast<GLsizei>(std::bit_width(std::max(width, height)));
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+		glTextureStorage2D(m_RendererID, std::max(levels, 1), m_InternalFormat, m_Width, m_Height);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+
+	OpenGLTexture::OpenGLTexture(const std::string& path, const NuTexFile& file)
+		: m_Path(path), m_RendererID(0), m_Width(static_cast<int>(file.GetWidth())), m_Height(static_cast<int>(file.GetHeight())), m_BPP(4)
+	{
+		const bool srgb = file.IsSRGB();
+		m_DataFormat = GL_RGBA;
+		switch (file.GetFormat())
+		{
+		case TexturePixelFormat::BC1: m_InternalFormat = srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+		case TexturePixelFormat::BC3: m_InternalFormat = srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+		case TexturePixelFormat::BC7: m_InternalFormat = srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM; break;
+		default:                      m_InternalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8; break;
+		}
+
+		const uint32_t mipCount = file.GetMipCount();
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+		glTextureStorage2D(m_RendererID, static_cast<GLsizei>(mipCount), m_InternalFormat, m_Width, m_Height);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, mipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			const NuTex::Level& level = file.GetLevel(mip);
+			const std::span<const std::byte> data = file.GetLevelData(mip);
+
+			if (IsBlockCompressed(file.GetFormat()))
+			{
+				glCompressedTextureSubImage2D(m_RendererID, static_cast<GLint>(mip), 0, 0, static_cast<GLsizei>(level.Width), static_cast<GLsizei>(level.Height),
+					m_InternalFormat, static_cast<GLsizei>(data.size()), data.data());
+			}
+			else
+			{
+				glTextureSubImage2D(m_RendererID, static_cast<GLint>(mip), 0, 0, static_cast<GLsizei>(level.Width), static_cast<GLsizei>(level.Height),
+					GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+			}
+		}
+
+		LOG_INFO("Cooked texture loaded: {} ({}x{}, {} mips)", m_Path, m_Width, m_Height, mipCount);
+	}
+
 	OpenGLTexture::~OpenGLTexture()
 	{
 		if (m_RendererID)
@@ -50,16 +128,19 @@ namespace NuEngine::Graphics::OpenGL
             return Core::Err(GraphicsError(GraphicsErrorCode::InvalidParameter, "Unsupported texture format (channels must be 3 or 4)"));
         }
 
+        const GLsizei levels = static_cast<GLsizei>(std::bit_width(static_cast<uint32_t>(std::max(m_Width, m_Height))));
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-        glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
+        glTextureStorage2D(m_RendererID, levels, m_InternalFormat, m_Width, m_Height);
 
-        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
         glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
         glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        glGenerateTextureMipmap(m_RendererID);
 
         stbi_image_free(data);
 
@@ -67,6 +148,19 @@ namespace NuEngine::Graphics::OpenGL
         return Core::Ok();
 	}
 
+    void OpenGLTexture::UploadRows(uint32_t firstRow, uint32_t rowCount, const void* pixels)
+    {
+        // Decoded rows are tightly packed; RGB rows are not 4-byte aligned in general
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTextureSubImage2D(m_RendererID, 0, 0, static_cast<GLint>(firstRow), m_Width, static_cast<GLsizei>(rowCount), m_DataFormat, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    void OpenGLTexture::GenerateMipmaps()
+    {
+        glGenerateTextureMipmap(m_RendererID);
+    }
+
     void OpenGLTexture::Bind(unsigned int slot) const
     {
         glBindTextureUnit(slot, m_RendererID);
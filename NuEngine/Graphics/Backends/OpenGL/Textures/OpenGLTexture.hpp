@@ -5,6 +5,7 @@
 #pragma once
 
 #include <Graphics/Abstractions/Textures/ITexture.hpp>
+#include <Graphics/Abstractions/Textures/NuTexFile.hpp>
 #include <Core/Types/Result.hpp>
 #include <Graphics/Errors/GraphicsError.hpp>
 #include <glad/glad.h>
@@ -15,6 +16,16 @@ namespace NuEngine::Graphics::OpenGL
 	{
 	public:
 		OpenGLTexture(const std::string& path);
+
+		/*
+		* @brief Empty texture with storage for the full mip chain, filled later through UploadRows().
+		*/
+		OpenGLTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels);
+
+		/*
+		* @brief Uploads every level of a cooked texture straight from its mapping, compressed levels as they are.
+		*/
+		OpenGLTexture(const std::string& path, const NuTexFile& file);
 		~OpenGLTexture() override;
 
 		[[nodiscard]] Core::Result<void, GraphicsError> Initialize();
@@ -24,8 +35,19 @@ namespace NuEngine::Graphics::OpenGL
 
 		int GetWidth() const override { return m_Width; }
 		int GetHeight() const override { return m_Height; }
+		int GetChannels() const { return m_BPP; }
 
 		const std::string& GetPath() const override { return m_Path; }
+
+		unsigned int GetID() const override { return m_RendererID; }
+
+		/*
+		* @brief glTextureSubImage2D of whole rows into level 0. pixels is an offset when a pixel unpack buffer is bound.
+		*/
+		void UploadRows(uint32_t firstRow, uint32_t rowCount, const void* pixels);
+
+		void GenerateMipmaps();
+
 	private:
 		std::string m_Path;
 		GLuint m_RendererID;
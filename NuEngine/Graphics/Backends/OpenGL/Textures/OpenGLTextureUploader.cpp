@@ -0,0 +1,60 @@
+#include <Graphics/Backends/OpenGL/Textures/OpenGLTextureUploader.hpp>
+#include <Graphics/Backends/OpenGL/Textures/OpenGLTexture.hpp>
+
+#include <glad/glad.h>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	OpenGLTextureUploader::OpenGLTextureUploader()
+	{
+		glCreateBuffers(1, &m_PixelBuffer);
+	}
+
+	OpenGLTextureUploader::~OpenGLTextureUploader()
+	{
+		if (m_PixelBuffer)
+		{
+			glDeleteBuffers(1, &m_PixelBuffer);
+		}
+	}
+
+	std::shared_ptr<ITexture> OpenGLTextureUploader::GetPlaceholder()
+	{
+		if (!m_Placeholder)
+		{
+			const std::byte white[4] = { std::byte{ 255 }, std::byte{ 255 }, std::byte{ 255 }, std::byte{ 255 } };
+			m_Placeholder = std::make_shared<OpenGLTexture>("<placeholder>", 1, 1, 4);
+			m_Placeholder->UploadRows(0, 1, white);
+		}
+		return m_Placeholder;
+	}
+
+	std::shared_ptr<ITexture> OpenGLTextureUploader::CreateTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels)
+	{
+		return std::make_shared<OpenGLTexture>(path, width, height, channels);
+	}
+
+	void OpenGLTextureUploader::UploadRows(ITexture& texture, uint32_t firstRow, uint32_t rowCount, const std::byte* pixels)
+	{
+		auto& glTexture = static_cast<OpenGLTexture&>(texture);
+
+		if (!m_PixelBuffer)
+		{
+			glTexture.UploadRows(firstRow, rowCount, pixels);
+			return;
+		}
+
+		const GLsizeiptr size = static_cast<GLsizeiptr>(glTexture.GetWidth()) * glTexture.GetChannels() * rowCount;
+		glNamedBufferData(m_PixelBuffer, size, nullptr, GL_STREAM_DRAW);
+		glNamedBufferSubData(m_PixelBuffer, 0, size, pixels);
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PixelBuffer);
+		glTexture.UploadRows(firstRow, rowCount, nullptr);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void OpenGLTextureUploader::FinishTexture(ITexture& texture)
+	{
+		static_cast<OpenGLTexture&>(texture).GenerateMipmaps();
+	}
+}
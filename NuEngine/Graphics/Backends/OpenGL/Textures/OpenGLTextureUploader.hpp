@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Textures/ITextureUploader.hpp>
+
+namespace NuEngine::Graphics::OpenGL
+{
+	typedef unsigned int GLuint;
+
+	class OpenGLTexture;
+
+	/*
+	* @brief Copies rows through a pixel unpack buffer, so glTextureSubImage2D returns without waiting on the copy.
+	*
+	* The buffer is orphaned before each fill to avoid waiting on the previous transfer. Without
+	* one (creation failed) rows go straight from client memory.
+	*/
+	class OpenGLTextureUploader : public ITextureUploader
+	{
+	public:
+		OpenGLTextureUploader();
+		~OpenGLTextureUploader() override;
+
+		std::shared_ptr<ITexture> GetPlaceholder() override;
+		std::shared_ptr<ITexture> CreateTexture(const std::string& path, uint32_t width, uint32_t height, uint32_t channels) override;
+		void UploadRows(ITexture& texture, uint32_t firstRow, uint32_t rowCount, const std::byte* pixels) override;
+		void FinishTexture(ITexture& texture) override;
+
+	private:
+		GLuint m_PixelBuffer = 0;
+		std::shared_ptr<OpenGLTexture> m_Placeholder;
+	};
+}
@@ -0,0 +1,320 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+// Kernel bodies behind the batch dispatch. Each NuMath/src/BatchKernels*.cpp instantiates them with
+// one backend under that backend's compiler flags, so this header must stay free of anything that
+// would drag ISA-specific inline code into other translation units (no Vector/Frustum includes).
+// For the same reason kernels call no inline function that is not templated on the backend (std::abs
+// included): unless it is file-local, the linker may keep the AVX-512 object's copy for every caller.
+
+#include <NuMath/Core/Common.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
+
+#include <cstdint>
+
+namespace NuMath::Detail::Batch::Kernels
+{
+    constexpr size_t PlaneCount = 6;
+
+    namespace
+    {
+        NU_FORCEINLINE float Abs(float x) noexcept
+        {
+            return x < 0.0f ? -x : x;
+        }
+
+        /**
+         * @brief Writes base + lane for every set bit of visibleMask and returns the new count.
+         *
+         * Branchless: every lane is stored and only the visible ones advance the cursor, so
+         * outVisible must have room for Pack entries past written.
+         */
+        template <size_t Pack>
+        NU_FORCEINLINE size_t AppendVisible(uint32_t* outVisible, size_t written, size_t base, int visibleMask) noexcept
+        {
+            for (size_t lane = 0; lane < Pack; ++lane)
+            {
+                outVisible[written] = static_cast<uint32_t>(base + lane);
+                written += static_cast<size_t>((visibleMask >> lane) & 1);
+            }
+            return written;
+        }
+
+        // Same expression as the SIMD path, so both agree on the boundary
+        NU_FORCEINLINE float PlaneDistance(const float* plane, float x, float y, float z) noexcept
+        {
+            return (plane[0] * x + plane[1] * y) + (plane[2] * z + plane[3]);
+        }
+    }
+
+    template <typename Backend>
+    struct AddOp
+    {
+        template <typename T>
+        NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Add(a, b); }
+        NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a + b; }
+    };
+
+    template <typename Backend>
+    struct SubOp
+    {
+        template <typename T>
+        NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Sub(a, b); }
+        NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a - b; }
+    };
+
+    template <typename Backend>
+    struct MulOp
+    {
+        template <typename T>
+        NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Mul(a, b); }
+        NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a * b; }
+    };
+
+    template <typename Backend>
+    struct DivOp
+    {
+        template <typename T>
+        NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Div(a, b); }
+        NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a / b; }
+    };
+
+    /**
+     * @brief Elements to handle one by one before out is aligned for Backend::Stream.
+     */
+    template <typename Backend>
+    NU_FORCEINLINE size_t AlignmentHead(const float* out, size_t count) noexcept
+    {
+        constexpr size_t Pack = Backend::Width;
+        const size_t offset = (reinterpret_cast<uintptr_t>(out) / sizeof(float)) % Pack;
+        const size_t head = offset ? Pack - offset : 0;
+        return head < count ? head : count;
+    }
+
+    /**
+     * @brief r[i] = op(a[i], b[i]). Inputs are loaded unaligned, the output is streamed once aligned.
+     */
+    template <typename Backend, typename Op>
+    void Binary(float* r, const float* a, const float* b, size_t count) noexcept
+    {
+        constexpr size_t Pack = Backend::Width;
+        const Op op;
+
+        size_t i = 0;
+        for (const size_t head = AlignmentHead<Backend>(r, count); i < head; ++i)
+        {
+            r[i] = op(a[i], b[i]);
+        }
+
+        for (; i + Pack <= count; i += Pack)
+        {
+            Backend::Stream(r + i, op(Backend::LoadUnaligned(a + i), Backend::LoadUnaligned(b + i)));
+        }
+
+        for (; i < count; ++i)
+        {
+            r[i] = op(a[i], b[i]);
+        }
+    }
+
+    /**
+     * @brief r[i] = sum over d of a[d][i] * b[d][i].
+     */
+    template <typename Backend>
+    void Dot(float* r, const float* const* a, const float* const* b, size_t dims, size_t count) noexcept
+    {
+        using Register = typename Backend::Register;
+        constexpr size_t Pack = Backend::Width;
+
+        const auto scalarDot = [&](size_t i) noexcept
+        {
+            float sum = 0.0f;
+            for (size_t d = 0; d < dims; ++d)
+            {
+                sum += a[d][i] * b[d][i];
+            }
+            r[i] = sum;
+        };
+
+        size_t i = 0;
+        for (const size_t head = AlignmentHead<Backend>(r, count); i < head; ++i)
+        {
+            scalarDot(i);
+        }
+
+        for (; i + Pack <= count; i += Pack)
+        {
+            Register sum = Backend::SetZero();
+            for (size_t d = 0; d < dims; ++d)
+            {
+                sum = Backend::MulAdd(Backend::LoadUnaligned(a[d] + i), Backend::LoadUnaligned(b[d] + i), sum);
+            }
+            Backend::Stream(r + i, sum);
+        }
+
+        for (; i < count; ++i)
+        {
+            scalarDot(i);
+        }
+    }
+
+    /**
+     * @brief Frustum planes broadcast into registers once per call.
+     */
+    template <typename Backend>
+    struct FrustumRegisters
+    {
+        using Register = typename Backend::Register;
+
+        Register X[PlaneCount], Y[PlaneCount], Z[PlaneCount], D[PlaneCount];
+        Register AbsX[PlaneCount], AbsY[PlaneCount], AbsZ[PlaneCount];
+
+        NU_FORCEINLINE explicit FrustumRegisters(const float* planes) noexcept
+        {
+            for (size_t p = 0; p < PlaneCount; ++p)
+            {
+                const float* plane = planes + p * 4;
+                X[p] = Backend::SetAll(plane[0]);
+                Y[p] = Backend::SetAll(plane[1]);
+                Z[p] = Backend::SetAll(plane[2]);
+                D[p] = Backend::SetAll(plane[3]);
+                AbsX[p] = Backend::SetAll(Abs(plane[0]));
+                AbsY[p] = Backend::SetAll(Abs(plane[1]));
+                AbsZ[p] = Backend::SetAll(Abs(plane[2]));
+            }
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Register SignedDistance(size_t p, Register x, Register y, Register z) const noexcept
+        {
+            return Backend::Add(
+                Backend::Add(Backend::Mul(X[p], x), Backend::Mul(Y[p], y)),
+                Backend::Add(Backend::Mul(Z[p], z), D[p]));
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Register Reach(size_t p, Register ex, Register ey, Register ez) const noexcept
+        {
+            return Backend::Add(
+                Backend::Add(Backend::Mul(AbsX[p], ex), Backend::Mul(AbsY[p], ey)),
+                Backend::Mul(AbsZ[p], ez));
+        }
+    };
+
+    template <typename Backend>
+    size_t CullSpheres(const float* planes, const float* cx, const float* cy, const float* cz,
+        const float* radii, size_t count, uint32_t* outVisible) noexcept
+    {
+        using Register = typename Backend::Register;
+        constexpr size_t Pack = Backend::Width;
+        constexpr int AllLanes = (1 << Pack) - 1;
+
+        const FrustumRegisters<Backend> frustum(planes);
+        const Register zero = Backend::SetZero();
+
+        size_t visible = 0;
+        size_t i = 0;
+
+        for (; i + Pack <= count; i += Pack)
+        {
+            const Register x = Backend::LoadUnaligned(cx + i);
+            const Register y = Backend::LoadUnaligned(cy + i);
+            const Register z = Backend::LoadUnaligned(cz + i);
+
+            // The radius is the same for every plane, so only the closest plane matters
+            Register distance = frustum.SignedDistance(0, x, y, z);
+            for (size_t p = 1; p < PlaneCount; ++p)
+            {
+                distance = Backend::Min(distance, frustum.SignedDistance(p, x, y, z));
+            }
+
+            const Register reach = Backend::Add(distance, Backend::LoadUnaligned(radii + i));
+            const int culled = Backend::LessMask(reach, zero);
+            visible = AppendVisible<Pack>(outVisible, visible, i, ~culled & AllLanes);
+        }
+
+        for (; i < count; ++i)
+        {
+            bool inside = true;
+            for (size_t p = 0; p < PlaneCount; ++p)
+            {
+                inside &= PlaneDistance(planes + p * 4, cx[i], cy[i], cz[i]) + radii[i] >= 0.0f;
+            }
+
+            outVisible[visible] = static_cast<uint32_t>(i);
+            visible += inside ? 1 : 0;
+        }
+
+        return visible;
+    }
+
+    template <typename Backend>
+    size_t CullAABBs(const float* planes, const float* cx, const float* cy, const float* cz,
+        const float* ex, const float* ey, const float* ez, size_t count, uint32_t* outVisible) noexcept
+    {
+        using Register = typename Backend::Register;
+        constexpr size_t Pack = Backend::Width;
+        constexpr int AllLanes = (1 << Pack) - 1;
+
+        const FrustumRegisters<Backend> frustum(planes);
+        const Register zero = Backend::SetZero();
+
+        size_t visible = 0;
+        size_t i = 0;
+
+        for (; i + Pack <= count; i += Pack)
+        {
+            const Register x = Backend::LoadUnaligned(cx + i);
+            const Register y = Backend::LoadUnaligned(cy + i);
+            const Register z = Backend::LoadUnaligned(cz + i);
+            const Register hx = Backend::LoadUnaligned(ex + i);
+            const Register hy = Backend::LoadUnaligned(ey + i);
+            const Register hz = Backend::LoadUnaligned(ez + i);
+
+            // Distance of the corner furthest along each plane normal
+            Register distance = Backend::Add(frustum.SignedDistance(0, x, y, z), frustum.Reach(0, hx, hy, hz));
+            for (size_t p = 1; p < PlaneCount; ++p)
+            {
+                distance = Backend::Min(distance, Backend::Add(frustum.SignedDistance(p, x, y, z), frustum.Reach(p, hx, hy, hz)));
+            }
+
+            const int culled = Backend::LessMask(distance, zero);
+            visible = AppendVisible<Pack>(outVisible, visible, i, ~culled & AllLanes);
+        }
+
+        for (; i < count; ++i)
+        {
+            bool inside = true;
+            for (size_t p = 0; p < PlaneCount; ++p)
+            {
+                const float* plane = planes + p * 4;
+                const float reach = (Abs(plane[0]) * ex[i] + Abs(plane[1]) * ey[i]) + Abs(plane[2]) * ez[i];
+                inside &= PlaneDistance(plane, cx[i], cy[i], cz[i]) + reach >= 0.0f;
+            }
+
+            outVisible[visible] = static_cast<uint32_t>(i);
+            visible += inside ? 1 : 0;
+        }
+
+        return visible;
+    }
+
+    /**
+     * @brief Kernel table for one backend. Instantiate it only in the translation unit built for that backend.
+     */
+    template <typename Backend>
+    constexpr BatchKernels MakeBatchKernels(Simd::SimdLevel level) noexcept
+    {
+        return BatchKernels{
+            level,
+            &Binary<Backend, AddOp<Backend>>,
+            &Binary<Backend, SubOp<Backend>>,
+            &Binary<Backend, MulOp<Backend>>,
+            &Binary<Backend, DivOp<Backend>>,
+            &Dot<Backend>,
+            &CullSpheres<Backend>,
+            &CullAABBs<Backend>
+        };
+    }
+} // namespace NuMath::Detail::Batch::Kernels
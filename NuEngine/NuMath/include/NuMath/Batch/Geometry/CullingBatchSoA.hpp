@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Core/Common.hpp>
+#include <NuMath/Core/StorageTypes.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
+#include <NuMath/Geometry/Primitives/Frustum.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace NuMath::Detail::Batch::SoA
+{
+    /**
+     * @brief The frustum planes as the (nx, ny, nz, d) quadruples the dispatched cull kernels take.
+     */
+    NU_FORCEINLINE std::array<float, Frustum::PlaneCount * 4> PackPlanes(const Frustum& frustum) noexcept
+    {
+        std::array<float, Frustum::PlaneCount * 4> planes;
+        for (size_t p = 0; p < Frustum::PlaneCount; ++p)
+        {
+            const Plane& plane = frustum.Planes[p];
+            planes[p * 4 + 0] = plane.Normal.X();
+            planes[p * 4 + 1] = plane.Normal.Y();
+            planes[p * 4 + 2] = plane.Normal.Z();
+            planes[p * 4 + 3] = plane.Distance;
+        }
+        return planes;
+    }
+} // namespace NuMath::Detail::Batch::SoA
+
+namespace NuMath::Batch::SoA
+{
+    /**
+     * @brief Tests count bounding spheres against the frustum and writes the indices of the visible ones.
+     *
+     * Same result as Intersects(Frustum, Sphere) per element, on the kernels picked for this CPU
+     * (SimdDispatch.hpp). Streams need no particular alignment.
+     *
+     * @param outVisible Room for count indices; visible indices are written in ascending order.
+     * @return Number of visible spheres.
+     */
+    template <typename ViewC>
+    NU_FORCEINLINE size_t CullSpheres(const Frustum& frustum, ViewC centers, const float* radii, size_t count, uint32_t* outVisible) noexcept
+    {
+        static_assert(ViewC::Size == 3, "CullSpheres: Centers must be a 3D view");
+
+        const auto planes = Detail::Batch::SoA::PackPlanes(frustum);
+        return Detail::Batch::GetBatchKernels().CullSpheres(planes.data(),
+            centers.streams[0], centers.streams[1], centers.streams[2], radii, count, outVisible);
+    }
+
+    /**
+     * @brief Tests count boxes, given as centre and half-size streams, against the frustum.
+     *
+     * Same result as Intersects(Frustum, AABB) per element. Streams need no particular alignment.
+     *
+     * @param outVisible Room for count indices; visible indices are written in ascending order.
+     * @return Number of visible boxes.
+     */
+    template <typename ViewC, typename ViewE>
+    NU_FORCEINLINE size_t CullAABBs(const Frustum& frustum, ViewC centers, ViewE extents, size_t count, uint32_t* outVisible) noexcept
+    {
+        static_assert(ViewC::Size == 3 && ViewE::Size == 3, "CullAABBs: Centers and extents must be 3D views");
+
+        const auto planes = Detail::Batch::SoA::PackPlanes(frustum);
+        return Detail::Batch::GetBatchKernels().CullAABBs(planes.data(),
+            centers.streams[0], centers.streams[1], centers.streams[2],
+            extents.streams[0], extents.streams[1], extents.streams[2], count, outVisible);
+    }
+} // namespace NuMath::Batch::SoA
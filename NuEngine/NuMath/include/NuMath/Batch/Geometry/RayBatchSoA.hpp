@@ -0,0 +1,529 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Core/Common.hpp>
+#include <NuMath/Core/StorageTypes.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+#include <NuMath/Geometry/Collision/IntersectRay.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace NuMath::Detail::Batch::SoA
+{
+    /**
+     * @brief Loads Width floats from stream + i; past count the lanes are zero.
+     *
+     * Only the last, partial pack takes the copy, so the branch is predicted everywhere else.
+     */
+    template <typename B>
+    NU_FORCEINLINE typename B::Register LoadPack(const float* stream, size_t i, size_t count) noexcept
+    {
+        if (i + B::Width <= count)
+        {
+            return B::Load(stream + i);
+        }
+
+        alignas(32) float tail[B::Width] = {};
+        for (size_t lane = 0; i + lane < count; ++lane)
+        {
+            tail[lane] = stream[i + lane];
+        }
+        return B::Load(tail);
+    }
+
+    template <size_t Pack>
+    NU_FORCEINLINE int ValidLanes(size_t i, size_t count) noexcept
+    {
+        const size_t remaining = count - i;
+        return remaining >= Pack ? (1 << Pack) - 1 : (1 << remaining) - 1;
+    }
+
+    template <typename B>
+    struct Vec3Register
+    {
+        using Register = typename B::Register;
+
+        Register X, Y, Z;
+
+        template <typename View>
+        [[nodiscard]] static NU_FORCEINLINE Vec3Register Load(View view, size_t i, size_t count) noexcept
+        {
+            return { LoadPack<B>(view.streams[0], i, count), LoadPack<B>(view.streams[1], i, count), LoadPack<B>(view.streams[2], i, count) };
+        }
+
+        [[nodiscard]] static NU_FORCEINLINE Vec3Register Broadcast(const Vector3& v) noexcept
+        {
+            return { B::SetAll(v.X()), B::SetAll(v.Y()), B::SetAll(v.Z()) };
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Vec3Register Sub(const Vec3Register& other) const noexcept
+        {
+            return { B::Sub(X, other.X), B::Sub(Y, other.Y), B::Sub(Z, other.Z) };
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Register Dot(const Vec3Register& other) const noexcept
+        {
+            return B::Add(B::Add(B::Mul(X, other.X), B::Mul(Y, other.Y)), B::Mul(Z, other.Z));
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Vec3Register Cross(const Vec3Register& other) const noexcept
+        {
+            return {
+                B::Sub(B::Mul(Y, other.Z), B::Mul(Z, other.Y)),
+                B::Sub(B::Mul(Z, other.X), B::Mul(X, other.Z)),
+                B::Sub(B::Mul(X, other.Y), B::Mul(Y, other.X))
+            };
+        }
+    };
+
+    /**
+     * @brief Division-free Moller-Trumbore over one pack.
+     *
+     * Every term is scaled by det * det instead of divided by det, which keeps the sign tests
+     * exact and leaves Div (and its near-zero assert) out of the loop. The real t, u and v are
+     * TScaled / DetSquared and so on; callers divide only for the lanes that win.
+     */
+    template <typename B>
+    struct TrianglePack
+    {
+        using Register = typename B::Register;
+
+        Register TScaled, UScaled, VScaled, DetSquared;
+        int Hit;
+
+        NU_FORCEINLINE TrianglePack(const Vec3Register<B>& origin, const Vec3Register<B>& direction,
+            const Vec3Register<B>& v0, const Vec3Register<B>& edge1, const Vec3Register<B>& edge2, Register maxDistance) noexcept
+        {
+            const Register zero = B::SetZero();
+
+            const Vec3Register<B> p = direction.Cross(edge2);
+            const Register det = edge1.Dot(p);
+            const Vec3Register<B> s = origin.Sub(v0);
+            const Vec3Register<B> q = s.Cross(edge1);
+
+            DetSquared = B::Mul(det, det);
+            UScaled = B::Mul(s.Dot(p), det);
+            VScaled = B::Mul(direction.Dot(q), det);
+            TScaled = B::Mul(edge2.Dot(q), det);
+
+            const int miss = B::LessMask(DetSquared, B::SetAll(k_RayTriangleEpsilon * k_RayTriangleEpsilon))
+                | B::LessMask(UScaled, zero)
+                | B::LessMask(VScaled, zero)
+                | B::LessMask(DetSquared, B::Add(UScaled, VScaled));
+
+            Hit = B::LessMask(zero, TScaled) & B::LessMask(TScaled, B::Mul(maxDistance, DetSquared)) & ~miss;
+        }
+    };
+
+    /**
+     * @brief Slab test over one pack; Distance is the entry distance, clamped to zero.
+     */
+    template <typename B>
+    struct AABBPack
+    {
+        using Register = typename B::Register;
+
+        Register Distance;
+        int Hit;
+
+        NU_FORCEINLINE AABBPack(const Vec3Register<B>& origin, const Vec3Register<B>& invDirection,
+            const Vec3Register<B>& min, const Vec3Register<B>& max, Register maxDistance) noexcept
+        {
+            const Vec3Register<B> t1 = MulComponents(min.Sub(origin), invDirection);
+            const Vec3Register<B> t2 = MulComponents(max.Sub(origin), invDirection);
+
+            const Register tNear = B::Max(
+                B::Max(B::Min(t1.X, t2.X), B::Min(t1.Y, t2.Y)),
+                B::Max(B::Min(t1.Z, t2.Z), B::SetZero()));
+            const Register tFar = B::Min(
+                B::Min(B::Max(t1.X, t2.X), B::Max(t1.Y, t2.Y)),
+                B::Max(t1.Z, t2.Z));
+
+            Distance = tNear;
+            Hit = ~B::LessMask(tFar, tNear) & B::LessMask(tNear, maxDistance);
+        }
+
+        [[nodiscard]] static NU_FORCEINLINE Vec3Register<B> MulComponents(const Vec3Register<B>& a, const Vec3Register<B>& b) noexcept
+        {
+            return { B::Mul(a.X, b.X), B::Mul(a.Y, b.Y), B::Mul(a.Z, b.Z) };
+        }
+    };
+
+    /**
+     * @brief Ray against solid spheres over one pack; directions must be normalized.
+     */
+    template <typename B>
+    struct SpherePack
+    {
+        using Register = typename B::Register;
+
+        Register Distance;
+        int Hit;
+
+        NU_FORCEINLINE SpherePack(const Vec3Register<B>& origin, const Vec3Register<B>& direction,
+            const Vec3Register<B>& center, Register radius, Register maxDistance) noexcept
+        {
+            const Register zero = B::SetZero();
+
+            const Vec3Register<B> offset = origin.Sub(center);
+            const Register b = direction.Dot(offset);
+            const Register c = B::Sub(offset.Dot(offset), B::Mul(radius, radius));
+            const Register discriminant = B::Sub(B::Mul(b, b), c);
+            const Register root = B::Sqrt(B::Max(discriminant, zero));
+
+            // Starting inside gives a negative near root; clamp it like the slab test does
+            Distance = B::Max(B::Sub(B::Neg(b), root), zero);
+            const Register exit = B::Sub(root, b);
+
+            Hit = ~(B::LessMask(discriminant, zero) | B::LessMask(exit, zero)) & B::LessMask(Distance, maxDistance);
+        }
+    };
+} // namespace NuMath::Detail::Batch::SoA
+
+namespace NuMath::Batch::SoA
+{
+    using Backend = NuMath::Simd::BatchBackend;
+
+    /**
+     * @brief Closest hit per ray for a packet of rays, one stream per field.
+     *
+     * In/out: Distance holds the current closest distance (the ray's max distance before the
+     * first call) and is only overwritten by strictly closer hits, so several primitives can be
+     * tested against the same packet in turn. U and V are barycentrics for triangles, zero otherwise.
+     */
+    struct RayHitsSoA
+    {
+        float* Distance;
+        float* U;
+        float* V;
+        uint32_t* Primitive;
+    };
+
+    /**
+     * @brief Sets count hits to "nothing closer than maxDistance".
+     */
+    NU_FORCEINLINE void ResetHits(RayHitsSoA hits, size_t count, float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            hits.Distance[i] = maxDistance;
+            hits.U[i] = 0.0f;
+            hits.V[i] = 0.0f;
+            hits.Primitive[i] = RayHit::k_NoPrimitive;
+        }
+    }
+
+    /**
+     * @brief Tests count rays against one triangle, B::Width rays per iteration.
+     *
+     * Same result as Intersects(Ray, Triangle, ...) per ray. Pass SSE_Traits or AVX_Traits as B
+     * to pick the packet width explicitly. Streams must be aligned for B::Load; any count works.
+     *
+     * @param primitive Written to hits.Primitive for the rays this triangle is closest for.
+     */
+    template <typename B = Backend, typename ViewO, typename ViewD>
+    NU_FORCEINLINE void IntersectRays(ViewO origins, ViewD directions, size_t count, const Triangle& triangle, uint32_t primitive, RayHitsSoA hits) noexcept
+    {
+        static_assert(ViewO::Size == 3 && ViewD::Size == 3, "IntersectRays: Origins and directions must be 3D views");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 v0 = Vec3::Broadcast(triangle.V0);
+        const Vec3 edge1 = Vec3::Broadcast(triangle.GetEdge1());
+        const Vec3 edge2 = Vec3::Broadcast(triangle.GetEdge2());
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::TrianglePack<B> pack(
+                Vec3::Load(origins, i, count), Vec3::Load(directions, i, count),
+                v0, edge1, edge2, Detail::Batch::SoA::LoadPack<B>(hits.Distance, i, count));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack], u[Pack], v[Pack], det[Pack];
+            B::Store(t, pack.TScaled);
+            B::Store(u, pack.UScaled);
+            B::Store(v, pack.VScaled);
+            B::Store(det, pack.DetSquared);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                const float invDet = 1.0f / det[lane];
+                hits.Distance[i + lane] = t[lane] * invDet;
+                hits.U[i + lane] = u[lane] * invDet;
+                hits.V[i + lane] = v[lane] * invDet;
+                hits.Primitive[i + lane] = primitive;
+            }
+        }
+    }
+
+    /**
+     * @brief Tests count rays against one box.
+     *
+     * Takes 1 / direction per component instead of the direction (infinite for axis-parallel
+     * rays), since every box test of a packet reuses it.
+     */
+    template <typename B = Backend, typename ViewO, typename ViewI>
+    NU_FORCEINLINE void IntersectRays(ViewO origins, ViewI invDirections, size_t count, const AABB& box, uint32_t primitive, RayHitsSoA hits) noexcept
+    {
+        static_assert(ViewO::Size == 3 && ViewI::Size == 3, "IntersectRays: Origins and inverse directions must be 3D views");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 min = Vec3::Broadcast(box.Min);
+        const Vec3 max = Vec3::Broadcast(box.Max);
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::AABBPack<B> pack(
+                Vec3::Load(origins, i, count), Vec3::Load(invDirections, i, count),
+                min, max, Detail::Batch::SoA::LoadPack<B>(hits.Distance, i, count));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack];
+            B::Store(t, pack.Distance);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                hits.Distance[i + lane] = t[lane];
+                hits.U[i + lane] = 0.0f;
+                hits.V[i + lane] = 0.0f;
+                hits.Primitive[i + lane] = primitive;
+            }
+        }
+    }
+
+    /**
+     * @brief Tests count rays against one sphere. Directions must be normalized.
+     */
+    template <typename B = Backend, typename ViewO, typename ViewD>
+    NU_FORCEINLINE void IntersectRays(ViewO origins, ViewD directions, size_t count, const Sphere& sphere, uint32_t primitive, RayHitsSoA hits) noexcept
+    {
+        static_assert(ViewO::Size == 3 && ViewD::Size == 3, "IntersectRays: Origins and directions must be 3D views");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 center = Vec3::Broadcast(sphere.Center);
+        const typename B::Register radius = B::SetAll(sphere.Radius);
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::SpherePack<B> pack(
+                Vec3::Load(origins, i, count), Vec3::Load(directions, i, count),
+                center, radius, Detail::Batch::SoA::LoadPack<B>(hits.Distance, i, count));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack];
+            B::Store(t, pack.Distance);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                hits.Distance[i + lane] = t[lane];
+                hits.U[i + lane] = 0.0f;
+                hits.V[i + lane] = 0.0f;
+                hits.Primitive[i + lane] = primitive;
+            }
+        }
+    }
+
+    /**
+     * @brief Closest of count triangles along one ray, B::Width triangles per iteration.
+     *
+     * Triangles are given as V0 plus the precomputed edges V1 - V0 and V2 - V0, which is what
+     * the test consumes. Streams must be aligned for B::Load; any count works.
+     *
+     * @return The closest hit nearer than maxDistance; Primitive is the triangle's index.
+     */
+    template <typename B = Backend, typename View0, typename ViewE1, typename ViewE2>
+    [[nodiscard]] NU_FORCEINLINE RayHit IntersectTriangles(const Ray& ray, View0 v0, ViewE1 edge1, ViewE2 edge2, size_t count,
+        float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+    {
+        static_assert(View0::Size == 3 && ViewE1::Size == 3 && ViewE2::Size == 3, "IntersectTriangles: Vertex and edge streams must be 3D views");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 origin = Vec3::Broadcast(ray.Origin);
+        const Vec3 direction = Vec3::Broadcast(ray.Direction);
+
+        RayHit best;
+        best.Distance = maxDistance;
+        float bestScaled = 0.0f;
+        float bestDet = 1.0f;
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::TrianglePack<B> pack(origin, direction,
+                Vec3::Load(v0, i, count), Vec3::Load(edge1, i, count), Vec3::Load(edge2, i, count), B::SetAll(best.Distance));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack], u[Pack], v[Pack], det[Pack];
+            B::Store(t, pack.TScaled);
+            B::Store(u, pack.UScaled);
+            B::Store(v, pack.VScaled);
+            B::Store(det, pack.DetSquared);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                // t[a] / det[a] < t[b] / det[b] without dividing; both determinants are positive
+                if (best.IsHit() && t[lane] * bestDet >= bestScaled * det[lane])
+                {
+                    continue;
+                }
+
+                bestScaled = t[lane];
+                bestDet = det[lane];
+                best.Primitive = static_cast<uint32_t>(i + lane);
+                best.U = u[lane];
+                best.V = v[lane];
+            }
+
+            if (best.IsHit())
+            {
+                best.Distance = bestScaled / bestDet;
+            }
+        }
+
+        if (best.IsHit())
+        {
+            best.U /= bestDet;
+            best.V /= bestDet;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Closest of count boxes, given as min and max corner streams, along one ray.
+     */
+    template <typename B = Backend, typename ViewMin, typename ViewMax>
+    [[nodiscard]] NU_FORCEINLINE RayHit IntersectAABBs(const Ray& ray, ViewMin mins, ViewMax maxs, size_t count,
+        float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+    {
+        static_assert(ViewMin::Size == 3 && ViewMax::Size == 3, "IntersectAABBs: Corner streams must be 3D views");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 origin = Vec3::Broadcast(ray.Origin);
+        const Vec3 invDirection = Vec3::Broadcast(Vector3(1.0f / ray.Direction.X(), 1.0f / ray.Direction.Y(), 1.0f / ray.Direction.Z()));
+
+        RayHit best;
+        best.Distance = maxDistance;
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::AABBPack<B> pack(origin, invDirection,
+                Vec3::Load(mins, i, count), Vec3::Load(maxs, i, count), B::SetAll(best.Distance));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack];
+            B::Store(t, pack.Distance);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                if (t[lane] < best.Distance)
+                {
+                    best.Distance = t[lane];
+                    best.Primitive = static_cast<uint32_t>(i + lane);
+                }
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Closest of count spheres along one ray. The ray direction must be normalized.
+     */
+    template <typename B = Backend, typename ViewC>
+    [[nodiscard]] NU_FORCEINLINE RayHit IntersectSpheres(const Ray& ray, ViewC centers, const float* radii, size_t count,
+        float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+    {
+        static_assert(ViewC::Size == 3, "IntersectSpheres: Centers must be a 3D view");
+
+        using Vec3 = Detail::Batch::SoA::Vec3Register<B>;
+        constexpr size_t Pack = B::Width;
+
+        const Vec3 origin = Vec3::Broadcast(ray.Origin);
+        const Vec3 direction = Vec3::Broadcast(ray.Direction);
+
+        RayHit best;
+        best.Distance = maxDistance;
+
+        for (size_t i = 0; i < count; i += Pack)
+        {
+            const Detail::Batch::SoA::SpherePack<B> pack(origin, direction,
+                Vec3::Load(centers, i, count), Detail::Batch::SoA::LoadPack<B>(radii, i, count), B::SetAll(best.Distance));
+
+            int mask = pack.Hit & Detail::Batch::SoA::ValidLanes<Pack>(i, count);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float t[Pack];
+            B::Store(t, pack.Distance);
+
+            while (mask)
+            {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+
+                if (t[lane] < best.Distance)
+                {
+                    best.Distance = t[lane];
+                    best.Primitive = static_cast<uint32_t>(i + lane);
+                }
+            }
+        }
+
+        return best;
+    }
+} // namespace NuMath::Batch::SoA
@@ -8,6 +8,7 @@
 #include <NuMath/Core/StorageTypes.hpp>
 #include <NuMath/Algebra/Vector/VectorAPI.hpp>
 #include <NuMath/Batch/Common/BatchLoop.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -74,24 +75,26 @@ namespace NuMath::Batch
 		Detail::Batch::ProcessLoopTernary(r, a, b, c, count, func, VecImpl::LoadOp{}, VecImpl::StreamOp{});
 	}
 
+	// Component-wise ops see the storage as one flat float array and run on the dispatched kernels
+
 	NU_FORCEINLINE void Add(NuVecStorage4* NU_RESTRICT r, const NuVecStorage4* NU_RESTRICT a, const NuVecStorage4* NU_RESTRICT b, size_t count) noexcept
 	{
-		Detail::Batch::ProcessLoopBinary(r, a, b, count, VecImpl::AddOp{}, VecImpl::LoadOp{}, VecImpl::StreamOp{});
+		Detail::Batch::GetBatchKernels().Add(&r->x, &a->x, &b->x, count * 4);
 	}
 
 	NU_FORCEINLINE void Sub(NuVecStorage4* NU_RESTRICT r, const NuVecStorage4* NU_RESTRICT a, const NuVecStorage4* NU_RESTRICT b, size_t count) noexcept
 	{
-		Detail::Batch::ProcessLoopBinary(r, a, b, count, VecImpl::SubOp{}, VecImpl::LoadOp{}, VecImpl::StreamOp{});
+		Detail::Batch::GetBatchKernels().Sub(&r->x, &a->x, &b->x, count * 4);
 	}
 
 	NU_FORCEINLINE void Mul(NuVecStorage4* NU_RESTRICT r, const NuVecStorage4* NU_RESTRICT a, const NuVecStorage4* NU_RESTRICT b, size_t count) noexcept
 	{
-		Detail::Batch::ProcessLoopBinary(r, a, b, count, VecImpl::MulOp{}, VecImpl::LoadOp{}, VecImpl::StreamOp{});
+		Detail::Batch::GetBatchKernels().Mul(&r->x, &a->x, &b->x, count * 4);
 	}
 
 	NU_FORCEINLINE void Div(NuVecStorage4* NU_RESTRICT r, const NuVecStorage4* NU_RESTRICT a, const NuVecStorage4* NU_RESTRICT b, size_t count) noexcept
 	{
-		Detail::Batch::ProcessLoopBinary(r, a, b, count, VecImpl::DivOp{}, VecImpl::LoadOp{}, VecImpl::StreamOp{});
+		Detail::Batch::GetBatchKernels().Div(&r->x, &a->x, &b->x, count * 4);
 	}
 
 	NU_FORCEINLINE void Dot(float* NU_RESTRICT r, const NuVecStorage4* NU_RESTRICT a, const NuVecStorage4* NU_RESTRICT b, size_t count) noexcept
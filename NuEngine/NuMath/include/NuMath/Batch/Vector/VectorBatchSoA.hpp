@@ -5,73 +5,60 @@
 #pragma once
 
 #include <NuMath/Core/Common.hpp>
-#include <NuMath/Detail/SIMD/SimdBackend.hpp>
-#include <NuMath/Batch/Common/BatchLoopSoA.hpp>
+#include <NuMath/Core/StorageTypes.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
 
-namespace NuMath::Batch::SoA
-{
-    using Backend = NuMath::Simd::BatchBackend;
+#include <array>
+#include <type_traits>
 
-    // =============================================================
-    // OPERATIONS
-    // =============================================================
-    namespace Ops
+namespace NuMath::Detail::Batch::SoA
+{
+    /**
+     * @brief Runs a flat dispatched kernel over each dimension of the views.
+     */
+    template <typename ViewR, typename ViewA, typename ViewB>
+    NU_FORCEINLINE void RunBinaryDispatched(ViewR r, ViewA a, ViewB b, size_t count, BatchKernels::BinaryFn kernel) noexcept
     {
-        struct Add
-        {
-            template <typename T>
-            NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Add(a, b); }
-            NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a + b; }
-        };
-
-        struct Sub
-        {
-            template <typename T>
-            NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Sub(a, b); }
-            NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a - b; }
-        };
-
-        struct Mul
-        {
-            template <typename T>
-            NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Mul(a, b); }
-            NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a * b; }
-        };
+        static_assert(ViewR::Size == ViewA::Size && ViewA::Size == ViewB::Size, "Binary: Input and Output dimensions must match!");
 
-        struct Div
+        for (size_t d = 0; d < ViewR::Size; ++d)
         {
-            template <typename T>
-            NU_FORCEINLINE T operator()(T a, T b) const noexcept { return Backend::Div(a, b); }
-            NU_FORCEINLINE float operator()(float a, float b) const noexcept { return a / b; }
-        };
-    } // namespace Ops
+            kernel(r.streams[d], a.streams[d], b.streams[d], count);
+        }
+    }
+} // namespace NuMath::Detail::Batch::SoA
 
+namespace NuMath::Batch::SoA
+{
     // =============================================================
     // PUBLIC API
     // =============================================================
+    //
+    // Every call goes through the kernel table picked for this CPU at startup (see SimdDispatch.hpp),
+    // so streams need no particular alignment.
 
     template <typename ViewR, typename ViewA, typename ViewB>
     NU_FORCEINLINE void Add(ViewR r, ViewA a, ViewB b, size_t count) noexcept
     {
-        Detail::Batch::SoA::RunBinary<Backend>(r, a, b, count, Ops::Add{});
+        Detail::Batch::SoA::RunBinaryDispatched(r, a, b, count, Detail::Batch::GetBatchKernels().Add);
     }
 
     template <typename ViewR, typename ViewA, typename ViewB>
     NU_FORCEINLINE void Sub(ViewR r, ViewA a, ViewB b, size_t count) noexcept
     {
-        Detail::Batch::SoA::RunBinary<Backend>(r, a, b, count, Ops::Sub{});
+        Detail::Batch::SoA::RunBinaryDispatched(r, a, b, count, Detail::Batch::GetBatchKernels().Sub);
     }
 
     template <typename ViewR, typename ViewA, typename ViewB>
     NU_FORCEINLINE void Mul(ViewR r, ViewA a, ViewB b, size_t count) noexcept
     {
-        Detail::Batch::SoA::RunBinary<Backend>(r, a, b, count, Ops::Mul{});
+        Detail::Batch::SoA::RunBinaryDispatched(r, a, b, count, Detail::Batch::GetBatchKernels().Mul);
     }
 
     template <typename ViewR, typename ViewA, typename ViewB>
     NU_FORCEINLINE void Div(ViewR r, ViewA a, ViewB b, size_t count) noexcept
     {
-        Detail::Batch::SoA::RunBinary<Backend>(r, a, b, count, Ops::Div{});
+        Detail::Batch::SoA::RunBinaryDispatched(r, a, b, count, Detail::Batch::GetBatchKernels().Div);
     }
 
     template <typename ViewR, typename ViewA, typename ViewB>
@@ -89,39 +76,16 @@ namespace NuMath::Batch::SoA
             static_assert(ViewR::Size == 1, "Dot: Output View must be scalar (Size 1)");
             outPtr = r.streams[0];
         }
-        
-        using Register = typename Backend::Register;
-        constexpr size_t N = ViewA::Size;
-        constexpr size_t Pack = Backend::Width;
 
-        size_t i = 0;
-        const size_t limit = (count / Pack) * Pack;
-
-        for (; i < limit; i += Pack)
+        constexpr size_t N = ViewA::Size;
+        std::array<const float*, N> as;
+        std::array<const float*, N> bs;
+        for (size_t d = 0; d < N; ++d)
         {
-            Register sum = Backend::SetZero();
-            for (size_t d = 0; d < N; ++d)
-            {
-                Register va = Backend::Load(a.streams[d] + i);
-                Register vb = Backend::Load(b.streams[d] + i);
-
-#if defined(__FMA__)
-                sum = _mm256_fmadd_ps(va, vb, sum);
-#else
-                sum = Backend::Add(sum, Backend::Mul(va, vb));
-#endif
-            }
-            Backend::Stream(outPtr + i, sum);
+            as[d] = a.streams[d];
+            bs[d] = b.streams[d];
         }
 
-        for (; i < count; ++i)
-        {
-            float sum = 0.0f;
-            for (size_t d = 0; d < N; ++d)
-            {
-                sum += a.streams[d][i] * b.streams[d][i];
-            }
-            outPtr[i] = sum;
-        }
+        Detail::Batch::GetBatchKernels().Dot(outPtr, as.data(), bs.data(), N, count);
     }
-} // namespace NuMath::Batch::SoA
\ No newline at end of file
+} // namespace NuMath::Batch::SoA
@@ -43,6 +43,20 @@
     #define NU_USE_AVX 1
 #endif
 
+// NuMath's few compiled symbols (the batch dispatch) live in the NuEngine shared library, which
+// builds them with NU_MATH_BUILD_DLL; everything linking NuEngine imports that single copy
+#if defined(_WIN32)
+    #if defined(NU_MATH_BUILD_DLL)
+        #define NU_MATH_API __declspec(dllexport)
+    #else
+        #define NU_MATH_API __declspec(dllimport)
+    #endif
+#elif defined(NU_MATH_BUILD_DLL)
+    #define NU_MATH_API __attribute__((visibility("default")))
+#else
+    #define NU_MATH_API
+#endif
+
 #if defined(_MSC_VER)
     #define NU_NORETURN __declspec(noreturn)
 #elif defined(__GNUC__) || defined(__clang__)
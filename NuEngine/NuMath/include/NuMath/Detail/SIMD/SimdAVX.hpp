@@ -35,6 +35,11 @@ namespace NuMath::Detail
 			return _mm256_load_ps(ptr);
 		}
 
+		[[nodiscard]] static NU_FORCEINLINE Register LoadUnaligned(const float* ptr) noexcept
+		{
+			return _mm256_loadu_ps(ptr);
+		}
+
 		static NU_FORCEINLINE void Store(float* ptr, Register val) noexcept
 		{
 			_mm256_store_ps(ptr, val);
@@ -83,5 +88,49 @@ namespace NuMath::Detail
 		{
 			return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));
 		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Min(Register a, Register b) noexcept
+		{
+			return _mm256_min_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Max(Register a, Register b) noexcept
+		{
+			return _mm256_max_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Abs(Register a) noexcept
+		{
+			return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Sqrt(Register a) noexcept
+		{
+			return _mm256_sqrt_ps(a);
+		}
+
+		/**
+		 * @brief a * b + c, fused when the translation unit is built with FMA (MSVC's /arch:AVX2 implies it).
+		 */
+		[[nodiscard]] static NU_FORCEINLINE Register MulAdd(Register a, Register b, Register c) noexcept
+		{
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+			return _mm256_fmadd_ps(a, b, c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+		}
+
+		// =============================================
+		// Comparison
+		// =============================================
+
+		/**
+		 * @brief Bit i is set when lane i of a is less than lane i of b.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE int LessMask(Register a, Register b) noexcept
+		{
+			return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath::Detail
+{
+	/**
+	 * @brief 16-wide batch backend. Needs AVX-512F only; sign tricks go through integer ops to avoid DQ.
+	 */
+	struct AVX512_Traits
+	{
+		// =============================================
+		// Types & Constants
+		// =============================================
+
+		using Register = __m512;
+
+		static constexpr int Width = 16;
+
+		// =============================================
+		// Load / Store
+		// =============================================
+
+		[[nodiscard]] static NU_FORCEINLINE Register Load(const float* ptr) noexcept
+		{
+			return _mm512_load_ps(ptr);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register LoadUnaligned(const float* ptr) noexcept
+		{
+			return _mm512_loadu_ps(ptr);
+		}
+
+		static NU_FORCEINLINE void Store(float* ptr, Register val) noexcept
+		{
+			_mm512_store_ps(ptr, val);
+		}
+
+		static NU_FORCEINLINE void Stream(float* ptr, Register val) noexcept
+		{
+			_mm512_stream_ps(ptr, val);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register SetZero() noexcept
+		{
+			return _mm512_setzero_ps();
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register SetAll(float v) noexcept
+		{
+			return _mm512_set1_ps(v);
+		}
+
+		// =============================================
+		// Arithmetic
+		// =============================================
+
+		[[nodiscard]] static NU_FORCEINLINE Register Add(Register a, Register b) noexcept
+		{
+			return _mm512_add_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Sub(Register a, Register b) noexcept
+		{
+			return _mm512_sub_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Mul(Register a, Register b) noexcept
+		{
+			return _mm512_mul_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Div(Register a, Register b) noexcept
+		{
+			return _mm512_div_ps(a, b);
+		}
+
+		/**
+		 * @brief a * b + c. Always fused: every AVX-512 CPU has FMA.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE Register MulAdd(Register a, Register b, Register c) noexcept
+		{
+			return _mm512_fmadd_ps(a, b, c);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Neg(Register a) noexcept
+		{
+			return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(static_cast<int>(0x80000000u))));
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Min(Register a, Register b) noexcept
+		{
+			return _mm512_min_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Max(Register a, Register b) noexcept
+		{
+			return _mm512_max_ps(a, b);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Abs(Register a) noexcept
+		{
+			return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7FFFFFFF)));
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE Register Sqrt(Register a) noexcept
+		{
+			return _mm512_sqrt_ps(a);
+		}
+
+		// =============================================
+		// Comparison
+		// =============================================
+
+		/**
+		 * @brief Bit i is set when lane i of a is less than lane i of b.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE int LessMask(Register a, Register b) noexcept
+		{
+			return static_cast<int>(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ));
+		}
+	};
+}
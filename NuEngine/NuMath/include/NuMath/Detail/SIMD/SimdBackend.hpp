@@ -4,12 +4,13 @@
 
 #pragma once
 
+// Always available: it is the NU_MATH_FORCE_SCALAR backend and the fallback of the batch dispatch
+#include <NuMath/Detail/SIMD/SimdScalar.hpp>
+
 #if defined(__SSE__) || defined(_M_X64)
     #include <NuMath/Detail/SIMD/SimdSSE.hpp>
 #elif defined(__ARM_NEON) || defined(__aarch64__)
     #include <NuMath/Detail/SIMD/SimdNEON.hpp>
-#else
-    #include <NuMath/Detail/SIMD/SimdScalar.hpp>
 #endif
 
 #if defined(__AVX__) || defined(__AVX2__)
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Core/Common.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace NuMath::Simd
+{
+	/**
+	 * @brief Instruction set a batch kernel table was compiled for, ordered from weakest to strongest.
+	 */
+	enum class SimdLevel : uint8_t
+	{
+		Scalar = 0,
+		SSE41,
+		AVX2,      // AVX2 + FMA
+		AVX512     // AVX-512F
+	};
+
+	[[nodiscard]] constexpr const char* ToString(SimdLevel level) noexcept
+	{
+		switch (level)
+		{
+		case SimdLevel::SSE41:  return "SSE4.1";
+		case SimdLevel::AVX2:   return "AVX2+FMA";
+		case SimdLevel::AVX512: return "AVX-512";
+		default:                return "Scalar";
+		}
+	}
+
+	/**
+	 * @brief Best level this CPU and OS can run, probed with CPUID once and cached.
+	 *
+	 * Levels whose kernels were not built into this binary (non-x86 targets) are never reported.
+	 */
+	[[nodiscard]] NU_MATH_API SimdLevel DetectSimdLevel() noexcept;
+
+	/**
+	 * @brief Level the NuMath::Batch kernels currently run at.
+	 *
+	 * The first call picks DetectSimdLevel(), or Scalar when NuMath was built with NU_MATH_FORCE_SCALAR
+	 * or the NU_MATH_FORCE_SCALAR environment variable is set to anything but "0".
+	 */
+	[[nodiscard]] NU_MATH_API SimdLevel GetBatchLevel() noexcept;
+
+	/**
+	 * @brief Switches the batch kernels to level, clamped to DetectSimdLevel().
+	 *
+	 * Not meant to race with batch calls on other threads: a call already running finishes on the
+	 * old kernels.
+	 *
+	 * @return The level now in effect.
+	 */
+	NU_MATH_API SimdLevel SetBatchLevel(SimdLevel level) noexcept;
+}
+
+namespace NuMath::Detail::Batch
+{
+	/**
+	 * @brief Batch kernels compiled for one instruction set.
+	 *
+	 * Streams are plain float arrays with no alignment requirement. Planes are the six frustum planes
+	 * as (nx, ny, nz, d) quadruples; outVisible needs room for count indices.
+	 */
+	struct BatchKernels
+	{
+		using BinaryFn = void (*)(float* r, const float* a, const float* b, size_t count) noexcept;
+		using DotFn = void (*)(float* r, const float* const* a, const float* const* b, size_t dims, size_t count) noexcept;
+		using CullSpheresFn = size_t (*)(const float* planes, const float* cx, const float* cy, const float* cz,
+			const float* radii, size_t count, uint32_t* outVisible) noexcept;
+		using CullAABBsFn = size_t (*)(const float* planes, const float* cx, const float* cy, const float* cz,
+			const float* ex, const float* ey, const float* ez, size_t count, uint32_t* outVisible) noexcept;
+
+		Simd::SimdLevel Level;
+
+		BinaryFn Add;
+		BinaryFn Sub;
+		BinaryFn Mul;
+		BinaryFn Div;
+		DotFn Dot;
+		CullSpheresFn CullSpheres;
+		CullAABBsFn CullAABBs;
+	};
+
+	// Null until the first batch call or SetBatchLevel(). One table per process, exported from NuEngine
+	extern NU_MATH_API std::atomic<const BatchKernels*> g_BatchKernels;
+
+	[[nodiscard]] NU_MATH_API const BatchKernels& SelectBatchKernels() noexcept;
+
+	/**
+	 * @brief Table for the current level. Picked on first use; afterwards one relaxed load.
+	 */
+	[[nodiscard]] NU_FORCEINLINE const BatchKernels& GetBatchKernels() noexcept
+	{
+		const BatchKernels* kernels = g_BatchKernels.load(std::memory_order_relaxed);
+		return kernels ? *kernels : SelectBatchKernels();
+	}
+}
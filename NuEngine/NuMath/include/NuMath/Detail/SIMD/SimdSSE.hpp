@@ -87,12 +87,22 @@ namespace NuMath::Detail
 			return _mm_load_ps(ptr);
 		}
 
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 LoadUnaligned(const float* ptr) noexcept
+		{
+			return _mm_loadu_ps(ptr);
+		}
+
 		// \copydoc NuMath::VectorAPI::Store
 		static NU_FORCEINLINE void Store(NuVecStorage4& vec, NuVec4 val) noexcept
 		{
 			_mm_store_ps(&vec.x, val);
 		}
 
+		static NU_FORCEINLINE void Store(float* ptr, NuVec4 val) noexcept
+		{
+			_mm_store_ps(ptr, val);
+		}
+
 		// \copydoc NuMath::VectorAPI::Stream
 		static NU_FORCEINLINE void Stream(float* ptr, NuVec4 val) noexcept
 		{
@@ -228,6 +238,31 @@ namespace NuMath::Detail
 			return _mm_and_ps(v, mask);
 		}
 
+		/**
+		 * @brief Bit i is set when lane i of a is less than lane i of b.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE int LessMask(NuVec4 a, NuVec4 b) noexcept
+		{
+			return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+		}
+
+		/**
+		 * @brief a * b + c, fused when the translation unit is built with FMA.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 MulAdd(NuVec4 a, NuVec4 b, NuVec4 c) noexcept
+		{
+#if defined(__FMA__)
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 Sqrt(NuVec4 v) noexcept
+		{
+			return _mm_sqrt_ps(v);
+		}
+
 		// \copydoc NuMath::VectorAPI::Div
 		[[nodiscard]] static NU_FORCEINLINE NuVec4 Div(NuVec4 a, NuVec4 b) noexcept
 		{
@@ -6,7 +6,7 @@
 
 #include <NuMath/Core/Common.hpp>
 #include <NuMath/Core/StorageTypes.hpp>
-#include <NuMath/Core/MathConstants.hpp>
+#include <NuMath/Core/Constants.hpp>
 #include <NuMath/Core/Math.hpp>
 
 #include <bit>
@@ -67,12 +67,22 @@ namespace NuMath::Detail
 			return { ptr[0], ptr[1], ptr[2], ptr[3] };
 		}
 
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 LoadUnaligned(const float* ptr) noexcept
+		{
+			return { ptr[0], ptr[1], ptr[2], ptr[3] };
+		}
+
 		// \copydoc NuMath::VectorAPI::Store
 		static NU_FORCEINLINE void Store(NuVecStorage4& vec, NuVec4 val) noexcept
 		{
 			vec.x = val.x; vec.y = val.y; vec.z = val.z; vec.w = val.w;
 		}
 
+		static NU_FORCEINLINE void Store(float* ptr, NuVec4 val) noexcept
+		{
+			ptr[0] = val.x; ptr[1] = val.y; ptr[2] = val.z; ptr[3] = val.w;
+		}
+
 		// \copydoc NuMath::VectorAPI::Stream
 		static NU_FORCEINLINE void Stream(float* ptr, NuVec4 val) noexcept
 		{
@@ -201,6 +211,27 @@ namespace NuMath::Detail
 			return { std::fabs(v.x), std::fabs(v.y), std::fabs(v.z), std::fabs(v.w) };
 		}
 
+		/**
+		 * @brief Bit i is set when lane i of a is less than lane i of b.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE int LessMask(const NuVec4& a, const NuVec4& b) noexcept
+		{
+			return (a.x < b.x ? 1 : 0) | (a.y < b.y ? 2 : 0) | (a.z < b.z ? 4 : 0) | (a.w < b.w ? 8 : 0);
+		}
+
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 Sqrt(const NuVec4& v) noexcept
+		{
+			return { std::sqrt(v.x), std::sqrt(v.y), std::sqrt(v.z), std::sqrt(v.w) };
+		}
+
+		/**
+		 * @brief a * b + c.
+		 */
+		[[nodiscard]] static NU_FORCEINLINE NuVec4 MulAdd(const NuVec4& a, const NuVec4& b, const NuVec4& c) noexcept
+		{
+			return { a.x * b.x + c.x, a.y * b.y + c.y, a.z * b.z + c.z, a.w * b.w + c.w };
+		}
+
 		// \copydoc NuMath::VectorAPI::Equal
 		[[nodiscard]] static NU_FORCEINLINE bool Equal(const NuVec4& a, const NuVec4& b) noexcept
 		{
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Geometry/Primitives/AABB.hpp>
+#include <NuMath/Geometry/Primitives/Sphere.hpp>
+#include <NuMath/Geometry/Primitives/Frustum.hpp>
+#include <NuMath/Core/Common.hpp>
+
+#include <cmath>
+
+namespace NuMath
+{
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const AABB& a, const AABB& b) noexcept
+    {
+        return a.Min.X() <= b.Max.X() && a.Max.X() >= b.Min.X()
+            && a.Min.Y() <= b.Max.Y() && a.Max.Y() >= b.Min.Y()
+            && a.Min.Z() <= b.Max.Z() && a.Max.Z() >= b.Min.Z();
+    }
+
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const AABB& box, const Sphere& sphere) noexcept
+    {
+        const Vector3 closest = sphere.Center.Max(box.Min).Min(box.Max);
+        return (closest - sphere.Center).LengthSquared() <= sphere.Radius * sphere.Radius;
+    }
+
+    /**
+     * @brief False only if the box lies entirely behind one of the frustum planes.
+     *
+     * Tests the corner furthest along each plane normal, via centre and extents:
+     * the box reaches Dot(|n|, extents) past its centre towards the plane.
+     */
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Frustum& frustum, const AABB& box) noexcept
+    {
+        const Vector3 center = box.GetCenter();
+        const Vector3 extents = box.GetExtents();
+
+        for (const Plane& plane : frustum.Planes)
+        {
+            const float reach = std::abs(plane.Normal.X()) * extents.X()
+                + std::abs(plane.Normal.Y()) * extents.Y()
+                + std::abs(plane.Normal.Z()) * extents.Z();
+
+            if (plane.SignedDistance(center) < -reach)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Geometry/Primitives/Ray.hpp>
+#include <NuMath/Geometry/Primitives/Triangle.hpp>
+#include <NuMath/Geometry/Primitives/AABB.hpp>
+#include <NuMath/Geometry/Primitives/Sphere.hpp>
+#include <NuMath/Core/Common.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace NuMath
+{
+    // Triangles whose determinant is below this are treated as parallel to the ray
+    inline constexpr float k_RayTriangleEpsilon = 1.0e-8f;
+
+    /**
+     * @brief Closest hit of one ray, as returned by the batch kernels.
+     */
+    struct RayHit
+    {
+        static constexpr uint32_t k_NoPrimitive = 0xFFFFFFFFu;
+
+        uint32_t Primitive = k_NoPrimitive;
+        float Distance = std::numeric_limits<float>::infinity();
+        float U = 0.0f;  // Barycentrics for triangles, zero otherwise
+        float V = 0.0f;
+
+        [[nodiscard]] NU_FORCEINLINE bool IsHit() const noexcept { return Primitive != k_NoPrimitive; }
+    };
+
+    /**
+     * @brief Double-sided Moller-Trumbore test.
+     *
+     * @param outU, outV Barycentrics of the hit point; see Triangle::GetPoint.
+     * @return True for a hit at a distance greater than zero.
+     */
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Ray& ray, const Triangle& triangle, float& outDistance, float& outU, float& outV) noexcept
+    {
+        const Vector3 edge1 = triangle.GetEdge1();
+        const Vector3 edge2 = triangle.GetEdge2();
+
+        const Vector3 p = ray.Direction.Cross(edge2);
+        const float det = edge1.Dot(p);
+        if (std::abs(det) < k_RayTriangleEpsilon)
+        {
+            return false;
+        }
+
+        const float invDet = 1.0f / det;
+        const Vector3 s = ray.Origin - triangle.V0;
+        const float u = s.Dot(p) * invDet;
+        if (u < 0.0f || u > 1.0f)
+        {
+            return false;
+        }
+
+        const Vector3 q = s.Cross(edge1);
+        const float v = ray.Direction.Dot(q) * invDet;
+        if (v < 0.0f || u + v > 1.0f)
+        {
+            return false;
+        }
+
+        const float t = edge2.Dot(q) * invDet;
+        if (t <= 0.0f)
+        {
+            return false;
+        }
+
+        outDistance = t;
+        outU = u;
+        outV = v;
+        return true;
+    }
+
+    /**
+     * @brief Slab test. A ray starting inside the box hits it at distance zero.
+     */
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Ray& ray, const AABB& box, float& outDistance) noexcept
+    {
+        const float invX = 1.0f / ray.Direction.X();
+        const float invY = 1.0f / ray.Direction.Y();
+        const float invZ = 1.0f / ray.Direction.Z();
+
+        const float t1x = (box.Min.X() - ray.Origin.X()) * invX;
+        const float t2x = (box.Max.X() - ray.Origin.X()) * invX;
+        const float t1y = (box.Min.Y() - ray.Origin.Y()) * invY;
+        const float t2y = (box.Max.Y() - ray.Origin.Y()) * invY;
+        const float t1z = (box.Min.Z() - ray.Origin.Z()) * invZ;
+        const float t2z = (box.Max.Z() - ray.Origin.Z()) * invZ;
+
+        const float tNear = std::max({ std::min(t1x, t2x), std::min(t1y, t2y), std::min(t1z, t2z), 0.0f });
+        const float tFar = std::min({ std::max(t1x, t2x), std::max(t1y, t2y), std::max(t1z, t2z) });
+        if (tNear > tFar)
+        {
+            return false;
+        }
+
+        outDistance = tNear;
+        return true;
+    }
+
+    /**
+     * @brief Ray against solid sphere; expects a normalized direction.
+     *
+     * Like the box test, a ray starting inside the sphere hits it at distance zero.
+     */
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Ray& ray, const Sphere& sphere, float& outDistance) noexcept
+    {
+        const Vector3 offset = ray.Origin - sphere.Center;
+        const float b = ray.Direction.Dot(offset);
+        const float c = offset.LengthSquared() - sphere.Radius * sphere.Radius;
+        const float discriminant = b * b - c;
+        if (discriminant < 0.0f)
+        {
+            return false;
+        }
+
+        const float root = std::sqrt(discriminant);
+        if (-b + root < 0.0f)
+        {
+            return false;
+        }
+
+        outDistance = std::max(-b - root, 0.0f);
+        return true;
+    }
+}
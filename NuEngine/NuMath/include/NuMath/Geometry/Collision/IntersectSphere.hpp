@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Geometry/Primitives/Sphere.hpp>
+#include <NuMath/Geometry/Primitives/Frustum.hpp>
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath
+{
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Sphere& a, const Sphere& b) noexcept
+    {
+        const float radii = a.Radius + b.Radius;
+        return (a.Center - b.Center).LengthSquared() <= radii * radii;
+    }
+
+    /**
+     * @brief False only if the sphere lies entirely behind one of the frustum planes.
+     *
+     * Conservative near the frustum corners, where a sphere outside the volume can still
+     * straddle two planes; that is the usual trade-off for culling.
+     */
+    [[nodiscard]] NU_FORCEINLINE bool Intersects(const Frustum& frustum, const Sphere& sphere) noexcept
+    {
+        for (const Plane& plane : frustum.Planes)
+        {
+            if (plane.SignedDistance(sphere.Center) < -sphere.Radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
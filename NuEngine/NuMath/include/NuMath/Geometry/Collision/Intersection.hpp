@@ -0,0 +1,9 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Geometry/Collision/IntersectSphere.hpp>
+#include <NuMath/Geometry/Collision/IntersectAABB.hpp>
+#include <NuMath/Geometry/Collision/IntersectRay.hpp>
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Algebra/Vector/Vector3.hpp>
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath
+{
+    /**
+     * @brief Axis-aligned bounding box given by its minimum and maximum corners.
+     */
+    struct AABB
+    {
+        Vector3 Min;
+        Vector3 Max;
+
+        NU_FORCEINLINE AABB() noexcept
+            : Min(0.0f, 0.0f, 0.0f)
+            , Max(0.0f, 0.0f, 0.0f)
+        {
+        }
+
+        NU_FORCEINLINE AABB(const Vector3& min, const Vector3& max) noexcept
+            : Min(min)
+            , Max(max)
+        {
+        }
+
+        /**
+         * @brief Box spanning center - extents to center + extents.
+         */
+        [[nodiscard]] static NU_FORCEINLINE AABB FromCenterExtents(const Vector3& center, const Vector3& extents) noexcept
+        {
+            return AABB(center - extents, center + extents);
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetCenter() const noexcept
+        {
+            return (Min + Max) * 0.5f;
+        }
+
+        /**
+         * @brief Half the size of the box along each axis.
+         */
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetExtents() const noexcept
+        {
+            return (Max - Min) * 0.5f;
+        }
+
+        [[nodiscard]] NU_FORCEINLINE bool Contains(const Vector3& point) const noexcept
+        {
+            return point.X() >= Min.X() && point.X() <= Max.X()
+                && point.Y() >= Min.Y() && point.Y() <= Max.Y()
+                && point.Z() >= Min.Z() && point.Z() <= Max.Z();
+        }
+
+        /**
+         * @brief Grows the box to also cover other.
+         */
+        [[nodiscard]] NU_FORCEINLINE AABB Merge(const AABB& other) const noexcept
+        {
+            return AABB(Min.Min(other.Min), Max.Max(other.Max));
+        }
+    };
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Geometry/Primitives/Plane.hpp>
+#include <NuMath/Algebra/Matrix/Matrix4x4.hpp>
+#include <NuMath/Core/Common.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace NuMath
+{
+    /**
+     * @brief View volume bounded by six planes whose normals point inwards.
+     *
+     * A point is inside when its signed distance to every plane is non-negative.
+     */
+    struct Frustum
+    {
+        enum PlaneIndex : uint32_t
+        {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            PlaneCount
+        };
+
+        std::array<Plane, PlaneCount> Planes;
+
+        /**
+         * @brief Extracts the planes of a projection * view matrix (Gribb-Hartmann).
+         *
+         * Each plane is row 3 plus or minus another row, which assumes OpenGL clip space
+         * (-w <= z <= w). Planes come out in world space for a view-projection matrix and
+         * in view space for a bare projection matrix.
+         */
+        [[nodiscard]] static NU_FORCEINLINE Frustum FromViewProjection(const Matrix4x4& viewProjection) noexcept
+        {
+            const auto combine = [&viewProjection](int row, float sign)
+            {
+                return Plane::FromCoefficients(
+                    viewProjection(3, 0) + sign * viewProjection(row, 0),
+                    viewProjection(3, 1) + sign * viewProjection(row, 1),
+                    viewProjection(3, 2) + sign * viewProjection(row, 2),
+                    viewProjection(3, 3) + sign * viewProjection(row, 3));
+            };
+
+            Frustum frustum;
+            frustum.Planes[Left] = combine(0, 1.0f);
+            frustum.Planes[Right] = combine(0, -1.0f);
+            frustum.Planes[Bottom] = combine(1, 1.0f);
+            frustum.Planes[Top] = combine(1, -1.0f);
+            frustum.Planes[Near] = combine(2, 1.0f);
+            frustum.Planes[Far] = combine(2, -1.0f);
+            return frustum;
+        }
+
+        [[nodiscard]] NU_FORCEINLINE bool Contains(const Vector3& point) const noexcept
+        {
+            for (const Plane& plane : Planes)
+            {
+                if (plane.SignedDistance(point) < 0.0f)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Algebra/Vector/Vector3.hpp>
+#include <NuMath/Core/Common.hpp>
+
+#include <cmath>
+
+namespace NuMath
+{
+    /**
+     * @brief Plane of points p where Dot(Normal, p) + Distance == 0.
+     *
+     * Normal is expected to be normalized; SignedDistance() is then in world units,
+     * positive on the side the normal points to.
+     */
+    struct Plane
+    {
+        Vector3 Normal;
+        float Distance;
+
+        NU_FORCEINLINE Plane() noexcept
+            : Normal(0.0f, 1.0f, 0.0f)
+            , Distance(0.0f)
+        {
+        }
+
+        NU_FORCEINLINE Plane(const Vector3& normal, float distance) noexcept
+            : Normal(normal)
+            , Distance(distance)
+        {
+        }
+
+        /**
+         * @brief Builds the plane ax + by + cz + d = 0, rescaled so the normal has unit length.
+         */
+        [[nodiscard]] static NU_FORCEINLINE Plane FromCoefficients(float a, float b, float c, float d) noexcept
+        {
+            const float length = std::sqrt(a * a + b * b + c * c);
+            const float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+            return Plane(Vector3(a * invLength, b * invLength, c * invLength), d * invLength);
+        }
+
+        /**
+         * @brief Distance from the plane to point, negative behind it.
+         */
+        [[nodiscard]] NU_FORCEINLINE float SignedDistance(const Vector3& point) const noexcept
+        {
+            return Normal.X() * point.X() + Normal.Y() * point.Y() + Normal.Z() * point.Z() + Distance;
+        }
+    };
+}
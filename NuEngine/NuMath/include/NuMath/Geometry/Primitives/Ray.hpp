@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Algebra/Vector/Vector3.hpp>
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath
+{
+    /**
+     * @brief Half-line defined by an origin and a direction.
+     *
+     * Direction is expected to be normalized; distances along the ray are then in world units.
+     */
+    struct Ray
+    {
+        Vector3 Origin;
+        Vector3 Direction;
+
+        NU_FORCEINLINE Ray() noexcept
+            : Origin(0.0f, 0.0f, 0.0f)
+            , Direction(0.0f, 0.0f, 1.0f)
+        {
+        }
+
+        NU_FORCEINLINE Ray(const Vector3& origin, const Vector3& direction) noexcept
+            : Origin(origin)
+            , Direction(direction)
+        {
+        }
+
+        /**
+         * @brief Point at distance t along the ray.
+         */
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetPoint(float t) const noexcept
+        {
+            return Origin + Direction * t;
+        }
+    };
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Algebra/Vector/Vector3.hpp>
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath
+{
+    /**
+     * @brief Bounding sphere given by its centre and radius.
+     */
+    struct Sphere
+    {
+        Vector3 Center;
+        float Radius;
+
+        NU_FORCEINLINE Sphere() noexcept
+            : Center(0.0f, 0.0f, 0.0f)
+            , Radius(0.0f)
+        {
+        }
+
+        NU_FORCEINLINE Sphere(const Vector3& center, float radius) noexcept
+            : Center(center)
+            , Radius(radius)
+        {
+        }
+
+        [[nodiscard]] NU_FORCEINLINE bool Contains(const Vector3& point) const noexcept
+        {
+            return (point - Center).LengthSquared() <= Radius * Radius;
+        }
+    };
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/Algebra/Vector/Vector3.hpp>
+#include <NuMath/Core/Common.hpp>
+
+namespace NuMath
+{
+    /**
+     * @brief Triangle given by its three corners. Counter-clockwise winding faces the normal.
+     */
+    struct Triangle
+    {
+        Vector3 V0;
+        Vector3 V1;
+        Vector3 V2;
+
+        NU_FORCEINLINE Triangle() noexcept = default;
+
+        NU_FORCEINLINE Triangle(const Vector3& v0, const Vector3& v1, const Vector3& v2) noexcept
+            : V0(v0)
+            , V1(v1)
+            , V2(v2)
+        {
+        }
+
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetEdge1() const noexcept { return V1 - V0; }
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetEdge2() const noexcept { return V2 - V0; }
+
+        /**
+         * @brief Unit normal; zero for a degenerate triangle.
+         */
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetNormal() const noexcept
+        {
+            const Vector3 normal = GetEdge1().Cross(GetEdge2());
+            const float lengthSq = normal.LengthSquared();
+            return lengthSq > 0.0f ? normal * (1.0f / std::sqrt(lengthSq)) : normal;
+        }
+
+        /**
+         * @brief Point at barycentric coordinates (u, v) as returned by the ray tests.
+         */
+        [[nodiscard]] NU_FORCEINLINE Vector3 GetPoint(float u, float v) const noexcept
+        {
+            return V0 + GetEdge1() * u + GetEdge2() * v;
+        }
+    };
+}
@@ -38,3 +38,12 @@
 
 // Geometry
 
+#include <NuMath/Geometry/Primitives/Ray.hpp>
+#include <NuMath/Geometry/Primitives/Triangle.hpp>
+#include <NuMath/Geometry/Primitives/Plane.hpp>
+#include <NuMath/Geometry/Primitives/Sphere.hpp>
+#include <NuMath/Geometry/Primitives/AABB.hpp>
+#include <NuMath/Geometry/Primitives/Frustum.hpp>
+
+#include <NuMath/Geometry/Collision/Intersection.hpp>
+
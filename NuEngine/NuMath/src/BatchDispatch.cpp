@@ -0,0 +1,172 @@
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
+#include <NuMath/Detail/SIMD/SimdScalar.hpp>
+#include <NuMath/Batch/Common/BatchKernels.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define NU_MATH_X86_DISPATCH 1
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace NuMath::Detail::Batch
+{
+	std::atomic<const BatchKernels*> g_BatchKernels{ nullptr };
+
+	static const BatchKernels& GetBatchKernelsScalar() noexcept
+	{
+		static constexpr BatchKernels kernels = Kernels::MakeBatchKernels<Scalar_Traits>(Simd::SimdLevel::Scalar);
+		return kernels;
+	}
+
+#if defined(NU_MATH_X86_DISPATCH)
+	// One per BatchKernels*.cpp, each compiled for its own instruction set
+	const BatchKernels& GetBatchKernelsSSE41() noexcept;
+	const BatchKernels& GetBatchKernelsAVX2() noexcept;
+	const BatchKernels& GetBatchKernelsAVX512() noexcept;
+#endif
+
+	static const BatchKernels& GetKernelsFor(Simd::SimdLevel level) noexcept
+	{
+		switch (level)
+		{
+#if defined(NU_MATH_X86_DISPATCH)
+		case Simd::SimdLevel::SSE41:  return GetBatchKernelsSSE41();
+		case Simd::SimdLevel::AVX2:   return GetBatchKernelsAVX2();
+		case Simd::SimdLevel::AVX512: return GetBatchKernelsAVX512();
+#endif
+		default:                      return GetBatchKernelsScalar();
+		}
+	}
+
+	static Simd::SimdLevel GetDefaultLevel() noexcept
+	{
+#if defined(NU_MATH_FORCE_SCALAR)
+		return Simd::SimdLevel::Scalar;
+#else
+		const char* forceScalar = std::getenv("NU_MATH_FORCE_SCALAR");
+		if (forceScalar && *forceScalar && std::strcmp(forceScalar, "0") != 0)
+		{
+			return Simd::SimdLevel::Scalar;
+		}
+		return Simd::DetectSimdLevel();
+#endif
+	}
+
+	const BatchKernels& SelectBatchKernels() noexcept
+	{
+		// Leaves the table alone if SetBatchLevel() got there first
+		const BatchKernels& kernels = GetKernelsFor(GetDefaultLevel());
+		const BatchKernels* expected = nullptr;
+		g_BatchKernels.compare_exchange_strong(expected, &kernels, std::memory_order_relaxed);
+		return *g_BatchKernels.load(std::memory_order_relaxed);
+	}
+}
+
+namespace NuMath::Simd
+{
+#if defined(NU_MATH_X86_DISPATCH)
+	namespace
+	{
+		struct CpuidRegisters
+		{
+			uint32_t Eax = 0, Ebx = 0, Ecx = 0, Edx = 0;
+		};
+
+		CpuidRegisters Cpuid(uint32_t leaf, uint32_t subleaf) noexcept
+		{
+			CpuidRegisters r;
+#if defined(_MSC_VER)
+			int regs[4];
+			__cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+			r = { uint32_t(regs[0]), uint32_t(regs[1]), uint32_t(regs[2]), uint32_t(regs[3]) };
+#else
+			__get_cpuid_count(leaf, subleaf, &r.Eax, &r.Ebx, &r.Ecx, &r.Edx);
+#endif
+			return r;
+		}
+
+		// Register state the OS saves on context switch; only valid when CPUID reports OSXSAVE
+		uint64_t ReadXCR0() noexcept
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32_t eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (uint64_t(edx) << 32) | eax;
+#endif
+		}
+
+		SimdLevel ProbeSimdLevel() noexcept
+		{
+			const uint32_t maxLeaf = Cpuid(0, 0).Eax;
+			if (maxLeaf < 1)
+			{
+				return SimdLevel::Scalar;
+			}
+
+			const CpuidRegisters leaf1 = Cpuid(1, 0);
+			const bool sse41 = leaf1.Ecx & (1u << 19);
+			const bool fma = leaf1.Ecx & (1u << 12);
+			const bool osxsave = leaf1.Ecx & (1u << 27);
+			const bool avx = leaf1.Ecx & (1u << 28);
+
+			if (!sse41)
+			{
+				return SimdLevel::Scalar;
+			}
+			if (!osxsave || !avx || maxLeaf < 7)
+			{
+				return SimdLevel::SSE41;
+			}
+
+			const uint64_t xcr0 = ReadXCR0();
+			const bool ymmState = (xcr0 & 0x6) == 0x6;     // SSE + AVX
+			const bool zmmState = (xcr0 & 0xE6) == 0xE6;   // + opmask, ZMM0-15 upper halves, ZMM16-31
+
+			const CpuidRegisters leaf7 = Cpuid(7, 0);
+			const bool avx2 = leaf7.Ebx & (1u << 5);
+			const bool avx512f = leaf7.Ebx & (1u << 16);
+
+			if (!ymmState || !avx2 || !fma)
+			{
+				return SimdLevel::SSE41;
+			}
+			if (!zmmState || !avx512f)
+			{
+				return SimdLevel::AVX2;
+			}
+			return SimdLevel::AVX512;
+		}
+	}
+#endif
+
+	SimdLevel DetectSimdLevel() noexcept
+	{
+#if defined(NU_MATH_X86_DISPATCH)
+		static const SimdLevel level = ProbeSimdLevel();
+		return level;
+#else
+		return SimdLevel::Scalar;
+#endif
+	}
+
+	SimdLevel GetBatchLevel() noexcept
+	{
+		return Detail::Batch::GetBatchKernels().Level;
+	}
+
+	SimdLevel SetBatchLevel(SimdLevel level) noexcept
+	{
+		const SimdLevel detected = DetectSimdLevel();
+		const SimdLevel effective = level < detected ? level : detected;
+		Detail::Batch::g_BatchKernels.store(&Detail::Batch::GetKernelsFor(effective), std::memory_order_relaxed);
+		return effective;
+	}
+}
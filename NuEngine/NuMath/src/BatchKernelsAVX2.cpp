@@ -0,0 +1,16 @@
+// Built with AVX2 and FMA enabled (see NuMath/CMakeLists.txt); only reached after DetectSimdLevel() allowed it
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#include <NuMath/Detail/SIMD/SimdAVX.hpp>
+#include <NuMath/Batch/Common/BatchKernels.hpp>
+
+namespace NuMath::Detail::Batch
+{
+	const BatchKernels& GetBatchKernelsAVX2() noexcept
+	{
+		static constexpr BatchKernels kernels = Kernels::MakeBatchKernels<AVX_Traits>(Simd::SimdLevel::AVX2);
+		return kernels;
+	}
+}
+
+#endif
@@ -0,0 +1,16 @@
+// Built with AVX-512F enabled (see NuMath/CMakeLists.txt); only reached after DetectSimdLevel() allowed it
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#include <NuMath/Detail/SIMD/SimdAVX512.hpp>
+#include <NuMath/Batch/Common/BatchKernels.hpp>
+
+namespace NuMath::Detail::Batch
+{
+	const BatchKernels& GetBatchKernelsAVX512() noexcept
+	{
+		static constexpr BatchKernels kernels = Kernels::MakeBatchKernels<AVX512_Traits>(Simd::SimdLevel::AVX512);
+		return kernels;
+	}
+}
+
+#endif
@@ -0,0 +1,16 @@
+// Built with SSE4.1 enabled (see NuMath/CMakeLists.txt); only reached after DetectSimdLevel() allowed it
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#include <NuMath/Detail/SIMD/SimdSSE.hpp>
+#include <NuMath/Batch/Common/BatchKernels.hpp>
+
+namespace NuMath::Detail::Batch
+{
+	const BatchKernels& GetBatchKernelsSSE41() noexcept
+	{
+		static constexpr BatchKernels kernels = Kernels::MakeBatchKernels<SSE_Traits>(Simd::SimdLevel::SSE41);
+		return kernels;
+	}
+}
+
+#endif
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Physics/Bodies/RigidBody.hpp>
+
+#include <NuMath/NuMath.hpp>
+
+namespace NuEngine::Physics
+{
+    enum class ShapeType : uint8_t
+    {
+        Box,
+        Sphere,
+        Capsule
+    };
+
+    /**
+     * @brief Parameters of a collision shape. Equal descriptions share one cached Jolt shape.
+     */
+    struct ShapeDesc
+    {
+        ShapeType Type = ShapeType::Box;
+        NuMath::Vector3 HalfExtents = NuMath::Vector3(0.5f, 0.5f, 0.5f);  // Box
+        float Radius = 0.5f;                                              // Sphere, Capsule
+        float HalfHeight = 0.5f;                                          // Capsule (cylinder part)
+
+        [[nodiscard]] static ShapeDesc Box(const NuMath::Vector3& halfExtents) noexcept
+        {
+            ShapeDesc desc;
+            desc.Type = ShapeType::Box;
+            desc.HalfExtents = halfExtents;
+            return desc;
+        }
+
+        [[nodiscard]] static ShapeDesc Sphere(float radius) noexcept
+        {
+            ShapeDesc desc;
+            desc.Type = ShapeType::Sphere;
+            desc.Radius = radius;
+            return desc;
+        }
+
+        [[nodiscard]] static ShapeDesc Capsule(float halfHeight, float radius) noexcept
+        {
+            ShapeDesc desc;
+            desc.Type = ShapeType::Capsule;
+            desc.HalfHeight = halfHeight;
+            desc.Radius = radius;
+            return desc;
+        }
+    };
+
+    /**
+     * @brief Everything needed to create one rigid body through PhysicsEngine::CreateBodies.
+     */
+    struct BodyDesc
+    {
+        ShapeDesc Shape;
+        NuMath::Vector3 Position = NuMath::Vector3(0.0f, 0.0f, 0.0f);
+        NuMath::Quaternion Rotation;
+        BodyType Type = BodyType::Dynamic;
+        float Restitution = 0.6f;
+        float Friction = 0.5f;
+    };
+}
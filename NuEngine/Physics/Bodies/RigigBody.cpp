@@ -11,6 +11,14 @@ namespace NuEngine::Physics
     {
         if (!IsValid()) return NuMath::Vector3(0.0f, 0.0f, 0.0f);
 
+        // While a step is in flight, read the pose published from the last completed one
+        NuMath::Vector3 position;
+        NuMath::Quaternion rotation;
+        if (PhysicsEngine::IsAsync() && PhysicsEngine::GetPublishedPose(m_Handle, position, rotation))
+        {
+            return position;
+        }
+
         auto& bodyInterface = PhysicsEngine::GetBodyInterface();
         JPH::BodyID bodyID(m_Handle);
 
@@ -22,6 +30,13 @@ namespace NuEngine::Physics
     {
         if (!IsValid()) return NuMath::Quaternion();
 
+        NuMath::Vector3 position;
+        NuMath::Quaternion rotation;
+        if (PhysicsEngine::IsAsync() && PhysicsEngine::GetPublishedPose(m_Handle, position, rotation))
+        {
+            return rotation;
+        }
+
         auto& bodyInterface = PhysicsEngine::GetBodyInterface();
         JPH::BodyID bodyID(m_Handle);
 
@@ -32,21 +47,45 @@ namespace NuEngine::Physics
     void RigidBody::SetPosition(const NuMath::Vector3& position)
     {
         if (!IsValid()) return;
+
+        if (PhysicsEngine::IsAsync())
+        {
+            PhysicsEngine::QueueCommand({ PhysicsCommandType::SetPosition, m_Handle, position });
+            return;
+        }
+
         auto& bodyInterface = PhysicsEngine::GetBodyInterface();
         bodyInterface.SetPosition(JPH::BodyID(m_Handle), JPH::Vec3(position.X(), position.Y(), position.Z()), JPH::EActivation::Activate);
+        PhysicsEngine::MarkBodyDirty(m_Handle);
     }
 
     void RigidBody::SetLinearVelocity(const NuMath::Vector3& velocity)
     {
         if (!IsValid()) return;
+
+        if (PhysicsEngine::IsAsync())
+        {
+            PhysicsEngine::QueueCommand({ PhysicsCommandType::SetLinearVelocity, m_Handle, velocity });
+            return;
+        }
+
         auto& bodyInterface = PhysicsEngine::GetBodyInterface();
         bodyInterface.SetLinearVelocity(JPH::BodyID(m_Handle), JPH::Vec3(velocity.X(), velocity.Y(), velocity.Z()));
+        PhysicsEngine::MarkBodyDirty(m_Handle);
     }
 
     void RigidBody::AddForce(const NuMath::Vector3& force)
     {
         if (!IsValid()) return;
+
+        if (PhysicsEngine::IsAsync())
+        {
+            PhysicsEngine::QueueCommand({ PhysicsCommandType::AddForce, m_Handle, force });
+            return;
+        }
+
         auto& bodyInterface = PhysicsEngine::GetBodyInterface();
         bodyInterface.AddForce(JPH::BodyID(m_Handle), JPH::Vec3(force.X(), force.Y(), force.Z()));
+        PhysicsEngine::MarkBodyDirty(m_Handle);
     }
 }
\ No newline at end of file
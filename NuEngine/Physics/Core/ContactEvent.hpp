@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+
+#include <cstdint>
+
+namespace NuEngine::Physics
+{
+    /**
+     * @brief A body pair that started touching during the last step.
+     *
+     * Body1 < Body2 always holds, so one pair maps to one event.
+     */
+    struct ContactEvent
+    {
+        uint32_t Body1;
+        uint32_t Body2;
+        NuMath::Vector3 Point;    // World-space contact point on Body1
+        NuMath::Vector3 Normal;   // From Body1 towards Body2
+        float Impulse;            // Estimated from approach speed and reduced mass, before the solver runs
+    };
+}
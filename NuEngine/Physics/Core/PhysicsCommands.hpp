@@ -0,0 +1,29 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+
+#include <cstdint>
+
+namespace NuEngine::Physics
+{
+    enum class PhysicsCommandType : uint8_t
+    {
+        SetPosition,
+        SetLinearVelocity,
+        AddForce
+    };
+
+    /**
+     * @brief Deferred body write, applied by PhysicsEngine at the next step boundary in async mode.
+     */
+    struct PhysicsCommand
+    {
+        PhysicsCommandType Type;
+        uint32_t Body;
+        NuMath::Vector3 Value;
+    };
+}
@@ -1,42 +1,688 @@
 #include <Physics/Core/PhysicsEngine.hpp>
 #include <Physics/Core/PhysicsLayers.hpp>
+#include <Physics/Core/PhysicsJobSystem.hpp>
+#include <Physics/Core/PhysicsUtils.hpp>
 
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include <Core/Logging/Logger.hpp>
-#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Core/Threading/JobSystem.hpp>
+#include <Jolt/Physics/Body/Body.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Collision/ContactListener.h>
+#include <Jolt/Physics/StateRecorder.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
 
 namespace NuEngine::Physics
 {
-	static JPH::TempAllocatorImpl* s_TempAllocator = nullptr;
-	static JPH::JobSystemThreadPool* s_JobSystem = nullptr;
+	namespace
+	{
+		/**
+		 * @brief Relaxed counter split into cache-line sized slots, one per Core::JobSystem thread index.
+		 */
+		class StepCounter
+		{
+		public:
+			void Increment() noexcept
+			{
+				m_Slots[Core::JobSystem::GetThreadIndex() % k_NumSlots].Value.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			uint32_t Consume() noexcept
+			{
+				uint32_t total = 0;
+				for (auto& slot : m_Slots)
+				{
+					total += slot.Value.exchange(0, std::memory_order_relaxed);
+				}
+				return total;
+			}
+
+		private:
+			static constexpr size_t k_NumSlots = 64;
+
+			struct alignas(64) Slot
+			{
+				std::atomic<uint32_t> Value = 0;
+			};
+
+			std::array<Slot, k_NumSlots> m_Slots;
+		};
+
+		/**
+		 * @brief TempAllocatorImpl that records its high-water mark.
+		 *
+		 * Physics worker jobs allocate from it as well as the Update thread, but Jolt orders
+		 * those jobs through barrier dependencies so no two allocations overlap and frees
+		 * stay LIFO. The unsynchronized counters below rely on that serialization.
+		 */
+		class TrackingTempAllocator final : public JPH::TempAllocator
+		{
+		public:
+			explicit TrackingTempAllocator(size_t size)
+				: m_Impl(static_cast<JPH::uint>(size))
+			{
+			}
+
+			void* Allocate(JPH::uint inSize) override
+			{
+				m_Used += JPH::AlignUp(inSize, JPH_RVECTOR_ALIGNMENT);
+				m_HighWater = std::max(m_HighWater, m_Used);
+				return m_Impl.Allocate(inSize);
+			}
+
+			void Free(void* inAddress, JPH::uint inSize) override
+			{
+				m_Used -= JPH::AlignUp(inSize, JPH_RVECTOR_ALIGNMENT);
+				m_Impl.Free(inAddress, inSize);
+			}
+
+			size_t ConsumeHighWater() noexcept
+			{
+				const size_t highWater = m_HighWater;
+				m_HighWater = m_Used;
+				return highWater;
+			}
+
+		private:
+			JPH::TempAllocatorImpl m_Impl;
+			size_t m_Used = 0;
+			size_t m_HighWater = 0;
+		};
+
+		class CountingObjectLayerPairFilter final : public ObjectLayersPairFilterImpl
+		{
+		public:
+			bool ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const override
+			{
+				const bool collide = ObjectLayersPairFilterImpl::ShouldCollide(inObject1, inObject2);
+				if (collide)
+				{
+					Pairs.Increment();
+				}
+				return collide;
+			}
+
+			mutable StepCounter Pairs;
+		};
+
+		/**
+		 * @brief Fixed-capacity contact record queues, one per Core::JobSystem thread index.
+		 *
+		 * Producers only bump their own queue's counter, so pushes never block or contend across
+		 * workers. Threads outside the JobSystem share queue 0; the atomic slot claim keeps that safe.
+		 */
+		class ContactEventQueues
+		{
+		public:
+			void Initialize(size_t numQueues, uint32_t capacity)
+			{
+				m_NumQueues = std::max<size_t>(numQueues, 1);
+				m_Capacity = capacity;
+				m_Queues = std::make_unique<Queue[]>(m_NumQueues);
+				for (size_t i = 0; i < m_NumQueues; ++i)
+				{
+					m_Queues[i].Records.resize(capacity);
+				}
+			}
+
+			void Shutdown()
+			{
+				m_Queues.reset();
+				m_NumQueues = 0;
+				m_Capacity = 0;
+			}
+
+			void Push(const ContactEvent& event) noexcept
+			{
+				if (m_NumQueues == 0)
+				{
+					return;
+				}
+
+				Queue& queue = m_Queues[Core::JobSystem::GetThreadIndex() % m_NumQueues];
+				const uint32_t slot = queue.Count.fetch_add(1, std::memory_order_relaxed);
+				if (slot < m_Capacity)
+				{
+					queue.Records[slot] = event;
+				}
+			}
+
+			/**
+			 * @brief Drains every queue into out, sorted by body pair with one event per pair. Call between steps.
+			 *
+			 * @return Number of records that did not fit.
+			 */
+			uint32_t Merge(std::vector<ContactEvent>& out)
+			{
+				out.clear();
+
+				uint32_t dropped = 0;
+				for (size_t i = 0; i < m_NumQueues; ++i)
+				{
+					Queue& queue = m_Queues[i];
+					const uint32_t count = queue.Count.exchange(0, std::memory_order_relaxed);
+					const uint32_t kept = std::min(count, m_Capacity);
+					out.insert(out.end(), queue.Records.begin(), queue.Records.begin() + kept);
+					dropped += count - kept;
+				}
+
+				// Several sub-shape manifolds can start touching in one step; keep the hardest hit per pair
+				std::sort(out.begin(), out.end(), [](const ContactEvent& a, const ContactEvent& b)
+				{
+					if (a.Body1 != b.Body1) return a.Body1 < b.Body1;
+					if (a.Body2 != b.Body2) return a.Body2 < b.Body2;
+					return a.Impulse > b.Impulse;
+				});
+				out.erase(std::unique(out.begin(), out.end(), [](const ContactEvent& a, const ContactEvent& b)
+				{
+					return a.Body1 == b.Body1 && a.Body2 == b.Body2;
+				}), out.end());
+
+				return dropped;
+			}
+
+		private:
+			struct alignas(64) Queue
+			{
+				std::atomic<uint32_t> Count = 0;
+				std::vector<ContactEvent> Records;
+			};
+
+			std::unique_ptr<Queue[]> m_Queues;
+			size_t m_NumQueues = 0;
+			uint32_t m_Capacity = 0;
+		};
+
+		float InverseMass(const JPH::Body& body) noexcept
+		{
+			return body.IsDynamic() ? body.GetMotionProperties()->GetInverseMass() : 0.0f;
+		}
+
+		/**
+		 * @brief Counts manifolds for PhysicsStats and records new body pairs as ContactEvents.
+		 *
+		 * Runs on physics job threads; everything here is wait-free.
+		 */
+		class PhysicsContactListener final : public JPH::ContactListener
+		{
+		public:
+			void OnContactAdded(const JPH::Body& inBody1, const JPH::Body& inBody2, const JPH::ContactManifold& inManifold, JPH::ContactSettings&) override
+			{
+				Contacts.Increment();
+
+				const bool swap = inBody2.GetID() < inBody1.GetID();
+				const JPH::Body& body1 = swap ? inBody2 : inBody1;
+				const JPH::Body& body2 = swap ? inBody1 : inBody2;
+				const JPH::RVec3 point = swap ? inManifold.GetWorldSpaceContactPointOn2(0) : inManifold.GetWorldSpaceContactPointOn1(0);
+				const JPH::Vec3 normal = swap ? -inManifold.mWorldSpaceNormal : inManifold.mWorldSpaceNormal;
+
+				const float approachSpeed = std::max(0.0f, -(body2.GetPointVelocity(point) - body1.GetPointVelocity(point)).Dot(normal));
+				const float inverseMassSum = InverseMass(body1) + InverseMass(body2);
+
+				ContactEvent event;
+				event.Body1 = body1.GetID().GetIndexAndSequenceNumber();
+				event.Body2 = body2.GetID().GetIndexAndSequenceNumber();
+				event.Point = NuMath::Vector3(static_cast<float>(point.GetX()), static_cast<float>(point.GetY()), static_cast<float>(point.GetZ()));
+				event.Normal = NuMath::Vector3(normal.GetX(), normal.GetY(), normal.GetZ());
+				event.Impulse = inverseMassSum > 0.0f ? approachSpeed / inverseMassSum : 0.0f;
+				Events.Push(event);
+			}
+
+			void OnContactPersisted(const JPH::Body&, const JPH::Body&, const JPH::ContactManifold&, JPH::ContactSettings&) override
+			{
+				Contacts.Increment();
+			}
+
+			StepCounter Contacts;
+			ContactEventQueues Events;
+		};
+
+		JPH::BodyCreationSettings MakeCreationSettings(const BodyDesc& desc, const JPH::RefConst<JPH::Shape>& shape)
+		{
+			JPH::EMotionType motionType;
+			JPH::ObjectLayer layer;
+
+			switch (desc.Type)
+			{
+			case BodyType::Static:
+				motionType = JPH::EMotionType::Static;
+				layer = Layers::STATIC;
+				break;
+			case BodyType::Kinematic:
+				motionType = JPH::EMotionType::Kinematic;
+				layer = Layers::DYNAMIC;
+				break;
+			case BodyType::Dynamic:
+			default:
+				motionType = JPH::EMotionType::Dynamic;
+				layer = Layers::DYNAMIC;
+				break;
+			}
+
+			JPH::BodyCreationSettings bodySettings(
+				shape,
+				JPH::RVec3(desc.Position.X(), desc.Position.Y(), desc.Position.Z()),
+				ToJolt(desc.Rotation),
+				motionType,
+				layer
+			);
+
+			bodySettings.mRestitution = desc.Restitution;
+			bodySettings.mFriction = desc.Friction;
+			return bodySettings;
+		}
+
+		/**
+		 * @brief StateRecorder over a flat byte buffer; avoids the stringstream behind JPH::StateRecorderImpl.
+		 */
+		class ByteStateRecorder final : public JPH::StateRecorder
+		{
+		public:
+			explicit ByteStateRecorder(std::vector<uint8_t>& buffer)
+				: m_Write(&buffer)
+			{
+				buffer.clear();
+			}
+
+			explicit ByteStateRecorder(std::span<const uint8_t> data)
+				: m_Read(data)
+			{
+			}
+
+			void WriteBytes(const void* inData, size_t inNumBytes) override
+			{
+				if (!m_Write)
+				{
+					m_Failed = true;
+					return;
+				}
+
+				const uint8_t* bytes = static_cast<const uint8_t*>(inData);
+				m_Write->insert(m_Write->end(), bytes, bytes + inNumBytes);
+			}
+
+			void ReadBytes(void* outData, size_t inNumBytes) override
+			{
+				if (m_ReadPos + inNumBytes > m_Read.size())
+				{
+					std::memset(outData, 0, inNumBytes);
+					m_Failed = true;
+					return;
+				}
+
+				std::memcpy(outData, m_Read.data() + m_ReadPos, inNumBytes);
+				m_ReadPos += inNumBytes;
+			}
+
+			bool IsEOF() const override { return m_ReadPos >= m_Read.size(); }
+			bool IsFailed() const override { return m_Failed; }
+
+		private:
+			std::vector<uint8_t>* m_Write = nullptr;
+			std::span<const uint8_t> m_Read;
+			size_t m_ReadPos = 0;
+			bool m_Failed = false;
+		};
+
+		/**
+		 * @brief Saves bodies whose change stamp is newer than the baseline's save.
+		 *
+		 * Unstamped bodies have not moved or been written since then, so the baseline still holds their state.
+		 */
+		class DeltaStateFilter final : public JPH::StateRecorderFilter
+		{
+		public:
+			DeltaStateFilter(const std::vector<uint64_t>& changeStamps, uint64_t baselineStamp)
+				: m_ChangeStamps(changeStamps)
+				, m_BaselineStamp(baselineStamp)
+			{
+			}
+
+			bool ShouldSaveBody(const JPH::Body& inBody) const override
+			{
+				const uint32_t index = inBody.GetID().GetIndex();
+				return index >= m_ChangeStamps.size() || m_ChangeStamps[index] > m_BaselineStamp;
+			}
+
+		private:
+			const std::vector<uint64_t>& m_ChangeStamps;
+			uint64_t m_BaselineStamp;
+		};
+
+		/**
+		 * @brief Logs once when a counter crosses 90% of its limit and re-arms when it drops below.
+		 */
+		void WarnNearLimit(const char* name, size_t value, size_t limit, bool& warned)
+		{
+			const bool nearLimit = limit > 0 && value * 10 >= limit * 9;
+			if (nearLimit && !warned)
+			{
+				LOG_WARNING("Physics {} at {}/{} - raise PhysicsSettings before it overflows", name, value, limit);
+			}
+			warned = nearLimit;
+		}
+	}
+
+	static TrackingTempAllocator* s_TempAllocator = nullptr;
+	static JPH::JobSystem* s_JobSystem = nullptr;
 	static JPH::PhysicsSystem* s_PhysicsSystem = nullptr;
 
 	static BPLayerInterfaceImpl s_BPLayerInterface;
 	static ObjectVsBroadPhaseLayerFilterImpl s_ObjVsBpFilter;
-	static ObjectLayersPairFilterImpl s_ObjPairFilter;
+	static CountingObjectLayerPairFilter s_ObjPairFilter;
+	static PhysicsContactListener s_ContactListener;
+
+	static ShapeCache s_ShapeCache;
+	static PhysicsSettings s_Settings;
+	static PhysicsStats s_Stats;
+
+	static bool s_BodiesWarned = false;
+	static bool s_PairsWarned = false;
+	static bool s_ContactsWarned = false;
+	static bool s_TempWarned = false;
+
+	// Async stepping: the in-flight step, poses published from the last completed one, queued writes
+	struct PublishedPose
+	{
+		NuMath::Vector3 Position;
+		NuMath::Quaternion Rotation;
+		uint32_t Handle = k_InvalidBodyHandle;
+	};
+
+	static std::atomic<uint32_t> s_StepInFlight = 0;
+	static float s_StepDeltaTime = 0.0f;
+	static bool s_StepRequested = false;
+	static bool s_StepUnreported = false;
+	static bool s_StepThreadExit = false;
+	static std::mutex s_StepMutex;
+	static std::condition_variable s_StepWake;
+	static std::thread s_StepThread;
+	static PhysicsStats s_StepStats;
+	static std::vector<ContactEvent> s_StepContactEvents;
+	static std::vector<ContactEvent> s_ContactEvents;
+	static std::vector<PublishedPose> s_Poses;
+	static JPH::BodyIDVector s_PublishedActive;
+	static bool s_RepublishAll = true;
+
+	static std::mutex s_CommandMutex;
+	static std::vector<PhysicsCommand> s_Commands;
+	static std::vector<PhysicsCommand> s_CommandsApplying;
 
-    Core::Result<void, PhysicsError> PhysicsEngine::Initialize() noexcept
+	// Delta snapshots: s_ChangeStamps[body index] is the s_StateStamp current when the body last
+	// moved or was written. A PhysicsDeltaBaseline keeps the stamp of its save, so each baseline
+	// diffs on its own and no SaveState call disturbs another's chain. Never reset, so baselines
+	// from before a re-Initialize still see every new body as changed.
+	static std::vector<uint64_t> s_ChangeStamps;
+	static uint64_t s_StateStamp = 1;
+
+	static void MarkChanged(const JPH::BodyID& id)
+	{
+		const uint32_t index = id.GetIndex();
+		if (index < s_ChangeStamps.size())
+		{
+			s_ChangeStamps[index] = s_StateStamp;
+		}
+	}
+
+	/**
+	 * @brief Stamps every active body. Called before and after each step, so bodies that fall
+	 * asleep or are woken by a contact during the step are both caught.
+	 */
+	static void MarkActiveChanged()
+	{
+		static JPH::BodyIDVector activeBodies;
+		s_PhysicsSystem->GetActiveBodies(JPH::EBodyType::RigidBody, activeBodies);
+		for (const JPH::BodyID& id : activeBodies)
+		{
+			MarkChanged(id);
+		}
+	}
+
+	static void WritePose(const JPH::BodyID& id)
+	{
+		JPH::RVec3 position;
+		JPH::Quat rotation;
+		s_PhysicsSystem->GetBodyInterfaceNoLock().GetPositionAndRotation(id, position, rotation);
+
+		PublishedPose& pose = s_Poses[id.GetIndex()];
+		pose.Position = NuMath::Vector3(static_cast<float>(position.GetX()), static_cast<float>(position.GetY()), static_cast<float>(position.GetZ()));
+		pose.Rotation = NuMath::Quaternion(rotation.GetX(), rotation.GetY(), rotation.GetZ(), rotation.GetW());
+		pose.Handle = id.GetIndexAndSequenceNumber();
+	}
+
+	/**
+	 * @brief Copies poses of bodies that may have moved: active now, or active at the previous publish
+	 * (bodies that fell asleep during the step).
+	 */
+	static void PublishPoses()
+	{
+		static JPH::BodyIDVector bodies;
+
+		if (s_RepublishAll)
+		{
+			s_PhysicsSystem->GetBodies(bodies);
+			for (const JPH::BodyID& id : bodies)
+			{
+				WritePose(id);
+			}
+			s_RepublishAll = false;
+		}
+		else
+		{
+			for (const JPH::BodyID& id : s_PublishedActive)
+			{
+				WritePose(id);
+			}
+		}
+
+		s_PhysicsSystem->GetActiveBodies(JPH::EBodyType::RigidBody, s_PublishedActive);
+		for (const JPH::BodyID& id : s_PublishedActive)
+		{
+			WritePose(id);
+		}
+	}
+
+	static void ApplyCommands()
+	{
+		{
+			std::lock_guard lock(s_CommandMutex);
+			s_CommandsApplying.swap(s_Commands);
+		}
+
+		JPH::BodyInterface& bodyInterface = s_PhysicsSystem->GetBodyInterfaceNoLock();
+		for (const PhysicsCommand& command : s_CommandsApplying)
+		{
+			const JPH::BodyID id(command.Body);
+			if (!bodyInterface.IsAdded(id))
+			{
+				continue;
+			}
+
+			switch (command.Type)
+			{
+			case PhysicsCommandType::SetPosition:
+				bodyInterface.SetPosition(id, JPH::RVec3(ToJolt(command.Value)), JPH::EActivation::Activate);
+				WritePose(id);
+				break;
+			case PhysicsCommandType::SetLinearVelocity:
+				bodyInterface.SetLinearVelocity(id, ToJolt(command.Value));
+				break;
+			case PhysicsCommandType::AddForce:
+				bodyInterface.AddForce(id, ToJolt(command.Value));
+				break;
+			}
+			MarkChanged(id);
+		}
+		s_CommandsApplying.clear();
+	}
+
+	/**
+	 * @brief Runs one Jolt update and gathers its counters into s_StepStats. May run on a worker.
+	 */
+	static void StepSimulation(float deltaTime)
+	{
+		MarkActiveChanged();
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		s_PhysicsSystem->Update(deltaTime, s_Settings.CollisionSteps, s_TempAllocator, s_JobSystem);
+		const auto end = std::chrono::high_resolution_clock::now();
+
+		MarkActiveChanged();
+
+		s_StepStats.StepTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
+		s_StepStats.NumBodies = s_PhysicsSystem->GetNumBodies();
+		s_StepStats.NumActiveBodies = s_PhysicsSystem->GetNumActiveBodies(JPH::EBodyType::RigidBody);
+		s_StepStats.NumBroadPhasePairs = s_ObjPairFilter.Pairs.Consume();
+		s_StepStats.NumContactConstraints = s_ContactListener.Contacts.Consume();
+		s_StepStats.NumContactEventsDropped = s_ContactListener.Events.Merge(s_StepContactEvents);
+		s_StepStats.NumContactEvents = static_cast<uint32_t>(s_StepContactEvents.size());
+		s_StepStats.TempAllocatorHighWater = s_TempAllocator->ConsumeHighWater();
+	}
+
+	/**
+	 * @brief Makes the finished step's counters visible on the calling (main) thread.
+	 */
+	static void ReportStepStats()
+	{
+		const size_t peak = std::max(s_Stats.TempAllocatorPeak, s_StepStats.TempAllocatorHighWater);
+		s_Stats = s_StepStats;
+		s_Stats.TempAllocatorPeak = peak;
+		s_ContactEvents.swap(s_StepContactEvents);
+
+		if (s_Stats.NumContactEventsDropped > 0)
+		{
+			LOG_WARNING("Physics dropped {} contact events - raise PhysicsSettings::MaxContactEventsPerThread", s_Stats.NumContactEventsDropped);
+		}
+
+		WarnNearLimit("bodies", s_Stats.NumBodies, s_Settings.MaxBodies, s_BodiesWarned);
+		WarnNearLimit("broadphase pairs", s_Stats.NumBroadPhasePairs, s_Settings.MaxBodyPairs, s_PairsWarned);
+		WarnNearLimit("contact constraints", s_Stats.NumContactConstraints, s_Settings.MaxContactConstraints, s_ContactsWarned);
+		WarnNearLimit("temp allocator bytes", s_Stats.TempAllocatorHighWater, s_Settings.TempAllocatorSize, s_TempWarned);
+	}
+
+	/**
+	 * @brief Body of the async step thread.
+	 *
+	 * The step gets its own thread instead of a Core::JobSystem job: a job would hold a worker
+	 * while Jolt waits on its barriers for jobs queued behind it on the same pool, which can stall
+	 * with few workers. Here the pool stays free for the Jolt jobs (and the Jolt barrier runs
+	 * ready jobs itself while it waits).
+	 */
+	static void StepThreadLoop()
+	{
+		for (;;)
+		{
+			float deltaTime;
+			{
+				std::unique_lock lock(s_StepMutex);
+				s_StepWake.wait(lock, []() { return s_StepRequested || s_StepThreadExit; });
+				if (s_StepThreadExit)
+				{
+					return;
+				}
+				s_StepRequested = false;
+				deltaTime = s_StepDeltaTime;
+			}
+
+			StepSimulation(deltaTime);
+			s_StepInFlight.store(0, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * @brief Closes the current stamp for baseline and starts a new one for later changes.
+	 */
+	static void CloseBaseline(PhysicsDeltaBaseline* baseline)
+	{
+		if (baseline)
+		{
+			baseline->Stamp = s_StateStamp;
+		}
+		++s_StateStamp;
+	}
+
+    Core::Result<void, PhysicsError> PhysicsEngine::Initialize(const PhysicsSettings& settings) noexcept
     {
         LOG_INFO("Initializing Jolt Physics Engine Backend...");
 
+        if (settings.MaxBodies == 0 || settings.MaxBodies > JPH::BodyID::cMaxBodyIndex
+            || settings.MaxBodyPairs == 0 || settings.MaxContactConstraints == 0
+            || settings.TempAllocatorSize == 0 || settings.CollisionSteps < 1)
+        {
+            return Core::Err(PhysicsError(PhysicsErrorCode::InvalidParameter, "PhysicsSettings limits must be non-zero"));
+        }
+
+        if (settings.NumBodyMutexes > 64 || (settings.NumBodyMutexes & (settings.NumBodyMutexes - 1)) != 0)
+        {
+            return Core::Err(PhysicsError(PhysicsErrorCode::InvalidParameter, "NumBodyMutexes must be 0 or a power of two up to 64"));
+        }
+
+        s_Settings = settings;
+        s_Stats = PhysicsStats{};
+        s_StepStats = PhysicsStats{};
+        s_Poses.assign(s_Settings.MaxBodies, PublishedPose{});
+        s_ChangeStamps.assign(s_Settings.MaxBodies, 0);
+        s_PublishedActive.clear();
+        s_RepublishAll = true;
+
         JPH::RegisterDefaultAllocator();
         JPH::Factory::sInstance = new JPH::Factory();
         JPH::RegisterTypes();
 
-        s_TempAllocator = new JPH::TempAllocatorImpl(10 * 1024 * 1024);
-        s_JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, std::thread::hardware_concurrency() - 1);
+        s_TempAllocator = new TrackingTempAllocator(s_Settings.TempAllocatorSize);
+
+        if (s_Settings.JobBackend == PhysicsJobBackend::JoltThreadPool)
+        {
+            const unsigned int hwThreads = std::thread::hardware_concurrency();
+            s_JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, hwThreads > 1 ? static_cast<int>(hwThreads) - 1 : 1);
+        }
+        else
+        {
+            Core::JobSystem& jobSystem = Core::JobSystem::Get();
+            if (!jobSystem.IsInitialized())
+            {
+                jobSystem.Initialize();
+            }
+            s_JobSystem = new PhysicsJobSystem(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+        }
+
+        // Jolt pool threads are not JobSystem threads and all land in queue 0
+        s_ContactListener.Events.Initialize(Core::JobSystem::Get().GetNumThreads() + 1, s_Settings.MaxContactEventsPerThread);
+        s_StepContactEvents.clear();
+        s_ContactEvents.clear();
 
-        // Параметри для Init: 
-        // 1. maxBodies (збільшуємо з 1024 до 5000)
-        // 2. numBodyMutexes (0 — дефолт)
-        // 3. maxBodyPairs (максимальна кількість пар для обробки колізій, збільшуємо пропорційно)
-        // 4. maxContactConstraints (ліміт одночасних контактів між тілами)
         s_PhysicsSystem = new JPH::PhysicsSystem();
-        s_PhysicsSystem->Init(5000, 0, 10000, 10000, s_BPLayerInterface, s_ObjVsBpFilter, s_ObjPairFilter);
+        s_PhysicsSystem->Init(
+            s_Settings.MaxBodies,
+            s_Settings.NumBodyMutexes,
+            s_Settings.MaxBodyPairs,
+            s_Settings.MaxContactConstraints,
+            s_BPLayerInterface, s_ObjVsBpFilter, s_ObjPairFilter);
+        s_PhysicsSystem->SetContactListener(&s_ContactListener);
+
+        s_StepUnreported = false;
+        if (s_Settings.AsyncStep)
+        {
+            s_StepRequested = false;
+            s_StepThreadExit = false;
+            s_StepThread = std::thread(StepThreadLoop);
+        }
+
+        LOG_INFO("Physics capacity: {} bodies, {} pairs, {} contacts, {} KB temp memory",
+            s_Settings.MaxBodies, s_Settings.MaxBodyPairs, s_Settings.MaxContactConstraints, s_Settings.TempAllocatorSize / 1024);
 
         return Core::Ok();
     }
@@ -44,19 +690,183 @@ namespace NuEngine::Physics
 	void PhysicsEngine::Shutdown() noexcept
 	{
 		LOG_INFO("Shutting down Jolt Physics Engine...");
+		WaitForStep();
+		if (s_StepThread.joinable())
+		{
+			{
+				std::lock_guard lock(s_StepMutex);
+				s_StepThreadExit = true;
+			}
+			s_StepWake.notify_one();
+			s_StepThread.join();
+		}
+		s_StepUnreported = false;
+		{
+			std::lock_guard lock(s_CommandMutex);
+			s_Commands.clear();
+		}
+		s_Poses.clear();
+		s_ContactListener.Events.Shutdown();
+		s_StepContactEvents.clear();
+		s_ContactEvents.clear();
 		delete s_PhysicsSystem;
+		s_PhysicsSystem = nullptr;
+		s_ShapeCache.Clear();
+		s_ChangeStamps.clear();
 		delete s_JobSystem;
+		s_JobSystem = nullptr;
 		delete s_TempAllocator;
+		s_TempAllocator = nullptr;
+		if (JPH::Factory::sInstance)
+		{
+			JPH::UnregisterTypes();
+		}
 		delete JPH::Factory::sInstance;
 		JPH::Factory::sInstance = nullptr;
 	}
 
 	void PhysicsEngine::Update(float deltaTime) noexcept
 	{
-		if (s_PhysicsSystem)
+		CompleteStep();
+		BeginStep(deltaTime);
+	}
+
+	void PhysicsEngine::CompleteStep() noexcept
+	{
+		if (!s_StepUnreported)
 		{
-			s_PhysicsSystem->Update(deltaTime, 1, s_TempAllocator, s_JobSystem);
+			return;
 		}
+
+		WaitForStep();
+		ReportStepStats();
+		PublishPoses();
+		s_StepUnreported = false;
+	}
+
+	void PhysicsEngine::BeginStep(float deltaTime) noexcept
+	{
+		if (!s_PhysicsSystem)
+		{
+			return;
+		}
+
+		// Callers that skip CompleteStep still get the previous step reported before the next starts
+		CompleteStep();
+		ApplyCommands();
+
+		if (!s_Settings.AsyncStep)
+		{
+			StepSimulation(deltaTime);
+			ReportStepStats();
+			return;
+		}
+
+		s_StepInFlight.store(1, std::memory_order_relaxed);
+		{
+			std::lock_guard lock(s_StepMutex);
+			s_StepDeltaTime = deltaTime;
+			s_StepRequested = true;
+		}
+		s_StepUnreported = true;
+		s_StepWake.notify_one();
+	}
+
+	bool PhysicsEngine::IsStepInFlight() noexcept
+	{
+		return s_StepInFlight.load(std::memory_order_acquire) != 0;
+	}
+
+	void PhysicsEngine::WaitForStep() noexcept
+	{
+		Core::JobSystem::Get().WaitFor(s_StepInFlight);
+	}
+
+	bool PhysicsEngine::IsAsync() noexcept
+	{
+		return s_PhysicsSystem != nullptr && s_Settings.AsyncStep;
+	}
+
+	bool PhysicsEngine::GetPublishedPose(uint32_t body, NuMath::Vector3& outPosition, NuMath::Quaternion& outRotation) noexcept
+	{
+		const uint32_t index = JPH::BodyID(body).GetIndex();
+		if (index >= s_Poses.size() || s_Poses[index].Handle != body)
+		{
+			return false;
+		}
+
+		outPosition = s_Poses[index].Position;
+		outRotation = s_Poses[index].Rotation;
+		return true;
+	}
+
+	void PhysicsEngine::QueueCommand(const PhysicsCommand& command) noexcept
+	{
+		std::lock_guard lock(s_CommandMutex);
+		s_Commands.push_back(command);
+	}
+
+	void PhysicsEngine::MarkBodyDirty(uint32_t body) noexcept
+	{
+		MarkChanged(JPH::BodyID(body));
+	}
+
+	Core::Result<void, PhysicsError> PhysicsEngine::SaveState(PhysicsSnapshot& outSnapshot, PhysicsSaveMode mode, PhysicsDeltaBaseline* baseline) noexcept
+	{
+		if (!s_PhysicsSystem)
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "SaveState called before PhysicsEngine::Initialize"));
+		}
+
+		WaitForStep();
+
+		if (!baseline || !baseline->IsValid())
+		{
+			mode = PhysicsSaveMode::Full;
+		}
+
+		ByteStateRecorder recorder(outSnapshot.Data);
+		if (mode == PhysicsSaveMode::Delta)
+		{
+			const DeltaStateFilter filter(s_ChangeStamps, baseline->Stamp);
+			s_PhysicsSystem->SaveState(recorder, JPH::EStateRecorderState::All, &filter);
+		}
+		else
+		{
+			s_PhysicsSystem->SaveState(recorder);
+		}
+
+		outSnapshot.Mode = mode;
+		CloseBaseline(baseline);
+
+		return Core::Ok();
+	}
+
+	Core::Result<void, PhysicsError> PhysicsEngine::RestoreState(const PhysicsSnapshot& snapshot, PhysicsDeltaBaseline* baseline) noexcept
+	{
+		if (!s_PhysicsSystem)
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "RestoreState called before PhysicsEngine::Initialize"));
+		}
+
+		WaitForStep();
+
+		ByteStateRecorder recorder(std::span<const uint8_t>(snapshot.Data));
+		if (!s_PhysicsSystem->RestoreState(recorder) || recorder.IsFailed())
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SimulationError, "Physics snapshot does not match the current world"));
+		}
+
+		// Any body may differ from what other baselines saved; only the caller's baseline matches the restored world
+		std::fill(s_ChangeStamps.begin(), s_ChangeStamps.end(), s_StateStamp);
+		CloseBaseline(baseline);
+		s_RepublishAll = true;
+		if (s_Settings.AsyncStep)
+		{
+			PublishPoses();
+		}
+
+		return Core::Ok();
 	}
 
 	JPH::PhysicsSystem& PhysicsEngine::GetSystem() noexcept
@@ -69,55 +879,60 @@ namespace NuEngine::Physics
 		return s_PhysicsSystem->GetBodyInterface();
 	}
 
+	bool PhysicsEngine::IsInitialized() noexcept
+	{
+		return s_PhysicsSystem != nullptr;
+	}
+
+	const PhysicsSettings& PhysicsEngine::GetSettings() noexcept
+	{
+		return s_Settings;
+	}
+
+	std::span<const ContactEvent> PhysicsEngine::GetContactEvents() noexcept
+	{
+		return s_ContactEvents;
+	}
+
+	const PhysicsStats& PhysicsEngine::GetStats() noexcept
+	{
+		return s_Stats;
+	}
+
     RigidBody PhysicsEngine::CreateBox(
         const NuMath::Vector3& halfExtents,
         const NuMath::Vector3& position,
         BodyType type) noexcept
     {
-        JPH::BoxShapeSettings shapeSettings(
-            JPH::Vec3(halfExtents.X(), halfExtents.Y(), halfExtents.Z())
-        );
-
-        JPH::ShapeSettings::ShapeResult shapeResult = shapeSettings.Create();
-        if (shapeResult.HasError())
+        if (!s_PhysicsSystem)
         {
-            LOG_ERROR("Failed to create box shape: {}", shapeResult.GetError().c_str());
+            LOG_ERROR("CreateBox called before PhysicsEngine::Initialize");
             return RigidBody{};
         }
 
-        JPH::EMotionType motionType;
-        JPH::ObjectLayer layer;
-
-        switch (type)
-        {
-        case BodyType::Static:
-            motionType = JPH::EMotionType::Static;
-            layer = Layers::STATIC;
-            break;
-        case BodyType::Kinematic:
-            motionType = JPH::EMotionType::Kinematic;
-            layer = Layers::DYNAMIC;
-            break;
-        case BodyType::Dynamic:
-        default:
-            motionType = JPH::EMotionType::Dynamic;
-            layer = Layers::DYNAMIC;
-            break;
+        WaitForStep();
+
+        if (s_PhysicsSystem->GetNumBodies() >= s_Settings.MaxBodies)
+        {
+            LOG_ERROR("CreateBox: {} ({} bodies), raise PhysicsSettings::MaxBodies",
+                ToErrorString(PhysicsErrorCode::MaxBodiesExceeded), s_Settings.MaxBodies);
+            return RigidBody{};
         }
 
-        JPH::BodyCreationSettings bodySettings(
-            shapeResult.Get(),
-            JPH::RVec3(position.X(), position.Y(), position.Z()),
-            JPH::Quat::sIdentity(),
-            motionType,
-            layer
-        );
+        BodyDesc desc;
+        desc.Shape = ShapeDesc::Box(halfExtents);
+        desc.Position = position;
+        desc.Type = type;
 
-        bodySettings.mRestitution = 0.6f;  // ← додай це
-        bodySettings.mFriction = 0.5f;
+        auto shapeResult = s_ShapeCache.GetOrCreate(desc.Shape);
+        if (shapeResult.IsError())
+        {
+            LOG_ERROR("Failed to create box shape: {}", shapeResult.UnwrapError().ToString());
+            return RigidBody{};
+        }
 
         JPH::BodyID bodyID = s_PhysicsSystem->GetBodyInterface()
-            .CreateAndAddBody(bodySettings, JPH::EActivation::Activate);
+            .CreateAndAddBody(MakeCreationSettings(desc, shapeResult.Unwrap()), JPH::EActivation::Activate);
 
         if (bodyID.IsInvalid())
         {
@@ -125,6 +940,94 @@ namespace NuEngine::Physics
             return RigidBody{};
         }
 
+        WritePose(bodyID);
+        MarkChanged(bodyID);
+
         return RigidBody{ bodyID.GetIndexAndSequenceNumber() };
     }
-}
\ No newline at end of file
+
+    Core::Result<std::vector<RigidBody>, PhysicsError> PhysicsEngine::CreateBodies(std::span<const BodyDesc> descs) noexcept
+    {
+        if (!s_PhysicsSystem)
+        {
+            return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "CreateBodies called before PhysicsEngine::Initialize"));
+        }
+
+        WaitForStep();
+
+        if (s_PhysicsSystem->GetNumBodies() + descs.size() > s_Settings.MaxBodies)
+        {
+            return Core::Err(PhysicsError(PhysicsErrorCode::MaxBodiesExceeded,
+                std::format("{} + {} bodies exceeds PhysicsSettings::MaxBodies ({})",
+                    s_PhysicsSystem->GetNumBodies(), descs.size(), s_Settings.MaxBodies)));
+        }
+
+        JPH::BodyInterface& bodyInterface = s_PhysicsSystem->GetBodyInterface();
+
+        // Statics first so both groups are contiguous for their own Prepare/Finalize batch
+        std::vector<JPH::BodyID> bodyIDs;
+        bodyIDs.reserve(descs.size());
+        std::vector<JPH::BodyID> staticIDs;
+        std::vector<JPH::BodyID> movingIDs;
+        movingIDs.reserve(descs.size());
+
+        auto destroyCreated = [&bodyInterface, &bodyIDs]()
+        {
+            if (!bodyIDs.empty())
+            {
+                bodyInterface.DestroyBodies(bodyIDs.data(), static_cast<int>(bodyIDs.size()));
+            }
+        };
+
+        for (const BodyDesc& desc : descs)
+        {
+            auto shapeResult = s_ShapeCache.GetOrCreate(desc.Shape);
+            if (shapeResult.IsError())
+            {
+                destroyCreated();
+                return Core::Err(shapeResult.UnwrapError());
+            }
+
+            JPH::Body* body = bodyInterface.CreateBody(MakeCreationSettings(desc, shapeResult.Unwrap()));
+            if (!body)
+            {
+                destroyCreated();
+                return Core::Err(PhysicsError(PhysicsErrorCode::BodyCreationFailed, "BodyInterface::CreateBody returned null"));
+            }
+
+            bodyIDs.push_back(body->GetID());
+            (desc.Type == BodyType::Static ? staticIDs : movingIDs).push_back(body->GetID());
+        }
+
+        // AddBodiesPrepare may reorder the array it is given, so the batches use their own copies
+        if (!staticIDs.empty())
+        {
+            const int count = static_cast<int>(staticIDs.size());
+            JPH::BodyInterface::AddState state = bodyInterface.AddBodiesPrepare(staticIDs.data(), count);
+            bodyInterface.AddBodiesFinalize(staticIDs.data(), count, state, JPH::EActivation::DontActivate);
+        }
+
+        if (!movingIDs.empty())
+        {
+            const int count = static_cast<int>(movingIDs.size());
+            JPH::BodyInterface::AddState state = bodyInterface.AddBodiesPrepare(movingIDs.data(), count);
+            bodyInterface.AddBodiesFinalize(movingIDs.data(), count, state, JPH::EActivation::Activate);
+        }
+
+        std::vector<RigidBody> bodies;
+        bodies.reserve(bodyIDs.size());
+        for (const JPH::BodyID& id : bodyIDs)
+        {
+            WritePose(id);
+            MarkChanged(id);
+            bodies.emplace_back(id.GetIndexAndSequenceNumber());
+        }
+
+        return Core::Ok(std::move(bodies));
+    }
+
+    ShapeCache& PhysicsEngine::GetShapeCache() noexcept
+    {
+        return s_ShapeCache;
+    }
+}
@@ -7,22 +7,153 @@
 #include <Core/Types/Result.hpp>
 #include <Physics/Errors/PhysicsError.hpp>
 #include <Physics/Bodies/RigidBody.hpp>
+#include <Physics/Core/PhysicsSettings.hpp>
+#include <Physics/Core/PhysicsState.hpp>
+#include <Physics/Core/PhysicsCommands.hpp>
+#include <Physics/Core/ContactEvent.hpp>
+#include <Physics/Core/ShapeCache.hpp>
+#include <Physics/Bodies/BodyDesc.hpp>
+#include <Physics/Queries/QueryTypes.hpp>
 #include <NuMath/NuMath.hpp>
 #include <NuEngine/Core/API.hpp>
 
+#include <span>
+#include <vector>
+
 namespace NuEngine::Physics
 {
     class NU_API PhysicsEngine
     {
     public:
-        static Core::Result<void, PhysicsError> Initialize() noexcept;
+        static Core::Result<void, PhysicsError> Initialize(const PhysicsSettings& settings = PhysicsSettings()) noexcept;
         static void Shutdown() noexcept;
+        /**
+         * @brief Steps the world: CompleteStep() followed by BeginStep().
+         */
         static void Update(float deltaTime) noexcept;
+
+        /**
+         * @brief Finishes the in-flight async step: waits for it, reports its stats and contact
+         * events and publishes its body poses. No-op without PhysicsSettings::AsyncStep or when
+         * no step is outstanding.
+         *
+         * Between CompleteStep and BeginStep the world holds the last completed step and nothing
+         * runs in the background, so queries there never wait. Scene runs scripts in this window.
+         */
+        static void CompleteStep() noexcept;
+
+        /**
+         * @brief Applies queued commands and steps the world. With PhysicsSettings::AsyncStep the
+         * step runs on the physics step thread (its Jolt jobs on Core::JobSystem) and this returns
+         * immediately.
+         */
+        static void BeginStep(float deltaTime) noexcept;
+
+        [[nodiscard]] static bool IsStepInFlight() noexcept;
+
+        /**
+         * @brief Blocks until the in-flight async step (if any) completes.
+         *
+         * Call before touching GetSystem()/GetBodyInterface() directly in async mode; the
+         * PhysicsEngine entry points already do.
+         */
+        static void WaitForStep() noexcept;
+
+        [[nodiscard]] static bool IsAsync() noexcept;
+
+        /**
+         * @brief Pose of the body after the last completed step.
+         *
+         * @return False if the handle is unknown or stale.
+         */
+        static bool GetPublishedPose(uint32_t body, NuMath::Vector3& outPosition, NuMath::Quaternion& outRotation) noexcept;
+
+        /**
+         * @brief Queues a body write for the next step boundary. Thread-safe.
+         */
+        static void QueueCommand(const PhysicsCommand& command) noexcept;
         static JPH::PhysicsSystem& GetSystem() noexcept;
         static JPH::BodyInterface& GetBodyInterface() noexcept;
+        static const PhysicsSettings& GetSettings() noexcept;
+        static const PhysicsStats& GetStats() noexcept;
+
+        /**
+         * @brief Body pairs that started touching during the last completed step, sorted by (Body1, Body2).
+         *
+         * Valid until the next CompleteStep (or Update).
+         */
+        [[nodiscard]] static std::span<const ContactEvent> GetContactEvents() noexcept;
         static RigidBody CreateBox(
             const NuMath::Vector3& halfExtents,
             const NuMath::Vector3& position,
             BodyType type) noexcept;
+
+        /**
+         * @brief Creates all bodies, then inserts them into the broadphase in one batch per motion type.
+         *
+         * Shapes are shared through the shape cache. On failure no body is left behind.
+         *
+         * @return Handles in the same order as descs.
+         */
+        static Core::Result<std::vector<RigidBody>, PhysicsError> CreateBodies(std::span<const BodyDesc> descs) noexcept;
+
+        static ShapeCache& GetShapeCache() noexcept;
+
+        [[nodiscard]] static bool IsInitialized() noexcept;
+
+        /**
+         * @brief Serializes the world through JPH::StateRecorder into outSnapshot.
+         *
+         * PhysicsSaveMode::Delta saves only bodies changed since baseline and falls back to Full when
+         * baseline is null or unset. baseline, if given, then points at the state just saved.
+         */
+        static Core::Result<void, PhysicsError> SaveState(PhysicsSnapshot& outSnapshot, PhysicsSaveMode mode = PhysicsSaveMode::Full,
+            PhysicsDeltaBaseline* baseline = nullptr) noexcept;
+
+        /**
+         * @brief Applies a snapshot. baseline, if given, then points at the restored state.
+         */
+        static Core::Result<void, PhysicsError> RestoreState(const PhysicsSnapshot& snapshot, PhysicsDeltaBaseline* baseline = nullptr) noexcept;
+
+        /**
+         * @brief Records that a body changed outside a step, so Delta saves include it.
+         *
+         * RigidBody setters and queued commands already do this; call it after writing to a body
+         * through GetBodyInterface() directly.
+         */
+        static void MarkBodyDirty(uint32_t body) noexcept;
+
+        /**
+         * @brief Closest hit for every ray, spread over Core::JobSystem workers.
+         *
+         * Queries answer from the last completed step. Issue them between CompleteStep and
+         * BeginStep to never block; a query made while an async step is in flight waits for it,
+         * since Jolt does not allow queries against a world that is mid-update. The same holds for
+         * CastShapes and Overlap.
+         *
+         * @param ignoreBodies Empty, or one RigidBody handle per ray that the ray must skip (e.g. the caster).
+         */
+        static Core::Result<void, PhysicsError> CastRays(
+            std::span<const NuMath::Ray> rays,
+            float maxDistance,
+            const CastHitsSoA& outHits,
+            std::span<const uint32_t> ignoreBodies = {}) noexcept;
+
+        /**
+         * @brief Sweeps one shape along every ray and reports the first hit.
+         */
+        static Core::Result<void, PhysicsError> CastShapes(
+            const ShapeDesc& shape,
+            std::span<const NuMath::Ray> sweeps,
+            float maxDistance,
+            const CastHitsSoA& outHits) noexcept;
+
+        /**
+         * @brief Collects the bodies overlapping the shape placed at each position.
+         */
+        static Core::Result<void, PhysicsError> Overlap(
+            const ShapeDesc& shape,
+            std::span<const NuMath::Vector3> positions,
+            const OverlapHitsSoA& outHits) noexcept;
     };
 }
\ No newline at end of file
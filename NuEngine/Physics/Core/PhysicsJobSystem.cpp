@@ -0,0 +1,81 @@
+#include <Physics/Core/PhysicsJobSystem.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <thread>
+
+namespace NuEngine::Physics
+{
+	PhysicsJobSystem::PhysicsJobSystem(JPH::uint maxJobs, JPH::uint maxBarriers)
+		: JPH::JobSystemWithBarrier(maxBarriers)
+	{
+		m_Jobs.Init(maxJobs, maxJobs);
+	}
+
+	PhysicsJobSystem::~PhysicsJobSystem()
+	{
+		// A worker may still be inside Release() after the barrier reported completion.
+		while (m_InFlight.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	int PhysicsJobSystem::GetMaxConcurrency() const
+	{
+		return static_cast<int>(Core::JobSystem::Get().GetNumThreads());
+	}
+
+	JPH::JobSystem::JobHandle PhysicsJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+	{
+		JPH::uint32 index;
+		for (;;)
+		{
+			index = m_Jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+			if (index != AvailableJobs::cInvalidObjectIndex)
+			{
+				break;
+			}
+
+			JPH_ASSERT(false, "No physics jobs available!");
+			std::this_thread::yield();
+		}
+
+		Job* job = &m_Jobs.Get(index);
+
+		// The handle keeps the job alive; it may finish before QueueJob returns.
+		JobHandle handle(job);
+
+		if (inNumDependencies == 0)
+		{
+			QueueJob(job);
+		}
+
+		return handle;
+	}
+
+	void PhysicsJobSystem::QueueJob(Job* inJob)
+	{
+		inJob->AddRef();
+		m_InFlight.fetch_add(1, std::memory_order_relaxed);
+
+		Core::JobSystem::Get().Submit([this, inJob]()
+		{
+			inJob->Execute();
+			inJob->Release();
+			m_InFlight.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	void PhysicsJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+	{
+		for (JPH::uint i = 0; i < inNumJobs; ++i)
+		{
+			QueueJob(inJobs[i]);
+		}
+	}
+
+	void PhysicsJobSystem::FreeJob(Job* inJob)
+	{
+		m_Jobs.DestructObject(inJob);
+	}
+}
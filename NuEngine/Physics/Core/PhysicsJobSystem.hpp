@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+
+#include <atomic>
+
+namespace NuEngine::Physics
+{
+	/**
+	 * @brief Jolt job system that executes physics jobs on Core::JobSystem workers.
+	 *
+	 * Replaces JPH::JobSystemThreadPool, so physics no longer spins up a second
+	 * set of threads that competes with the engine pool for the same cores.
+	 */
+	class PhysicsJobSystem final : public JPH::JobSystemWithBarrier
+	{
+	public:
+		PhysicsJobSystem(JPH::uint maxJobs, JPH::uint maxBarriers);
+		~PhysicsJobSystem() override;
+
+		int GetMaxConcurrency() const override;
+
+		JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+	protected:
+		void QueueJob(Job* inJob) override;
+		void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+		void FreeJob(Job* inJob) override;
+
+	private:
+		using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+
+		AvailableJobs m_Jobs;
+
+		/* @brief Jobs handed to Core::JobSystem that have not released their reference yet. */
+		std::atomic<JPH::uint32> m_InFlight = 0;
+	};
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NuEngine::Physics
+{
+    /**
+     * @brief Which job system drives PhysicsSystem::Update.
+     */
+    enum class PhysicsJobBackend
+    {
+        EngineJobSystem,  // Jolt jobs run on Core::JobSystem workers
+        JoltThreadPool    // Dedicated JPH::JobSystemThreadPool (hardware_concurrency() - 1 threads)
+    };
+
+    /**
+     * @brief Capacity and stepping parameters for the physics world.
+     *
+     * All limits are fixed at PhysicsEngine::Initialize; size them for the largest scene you load.
+     */
+    struct PhysicsSettings
+    {
+        uint32_t MaxBodies = 5000;
+        uint32_t NumBodyMutexes = 0;          // 0 = let Jolt pick; otherwise a power of two in [1, 64]
+        uint32_t MaxBodyPairs = 10000;        // Broadphase pairs buffered per step
+        uint32_t MaxContactConstraints = 10000;
+        size_t TempAllocatorSize = 10 * 1024 * 1024;
+        int CollisionSteps = 1;
+        PhysicsJobBackend JobBackend = PhysicsJobBackend::EngineJobSystem;
+        uint32_t MaxContactEventsPerThread = 4096;  // New contacts recorded per job thread per step; extra ones are dropped
+
+        /**
+         * @brief Step frame N on a dedicated physics thread while frame N renders.
+         *
+         * RigidBody reads return the last completed step; RigidBody writes are queued
+         * and applied at the next PhysicsEngine::BeginStep.
+         */
+        bool AsyncStep = false;
+    };
+
+    /**
+     * @brief Counters gathered during the last PhysicsEngine::Update.
+     */
+    struct PhysicsStats
+    {
+        uint32_t NumBodies = 0;
+        uint32_t NumActiveBodies = 0;
+        uint32_t NumBroadPhasePairs = 0;      // Candidate pairs that passed the object layer filter
+        uint32_t NumContactConstraints = 0;   // Manifolds added or persisted this step
+        uint32_t NumContactEvents = 0;        // Distinct body pairs that started touching this step
+        uint32_t NumContactEventsDropped = 0; // New contacts lost to full per-thread queues
+        size_t TempAllocatorHighWater = 0;    // Peak temp allocator usage during the last step
+        size_t TempAllocatorPeak = 0;         // Peak temp allocator usage since Initialize
+        float StepTimeMs = 0.0f;
+    };
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace NuEngine::Physics
+{
+    enum class PhysicsSaveMode : uint8_t
+    {
+        Full,   // Every body, constraint and contact
+        Delta   // Only bodies changed since the PhysicsDeltaBaseline's previous save or restore
+    };
+
+    /**
+     * @brief Marks the world state a Delta save is diffed against.
+     *
+     * Every SaveState/RestoreState given the baseline moves it to the state just saved or restored;
+     * calls with other baselines (or none) leave it alone. Keep one per snapshot chain.
+     */
+    struct PhysicsDeltaBaseline
+    {
+        uint64_t Stamp = 0;
+
+        [[nodiscard]] bool IsValid() const noexcept { return Stamp != 0; }
+    };
+
+    /**
+     * @brief Serialized physics world state produced by PhysicsEngine::SaveState.
+     *
+     * A Delta snapshot only makes sense applied on top of the state its baseline was at.
+     * Snapshots assume the set of bodies does not change between save and restore.
+     * Keep the object around between saves: Data keeps its capacity.
+     */
+    struct PhysicsSnapshot
+    {
+        std::vector<uint8_t> Data;
+        PhysicsSaveMode Mode = PhysicsSaveMode::Full;
+    };
+}
@@ -0,0 +1,99 @@
+#include <Physics/Core/ShapeCache.hpp>
+
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+
+#include <bit>
+
+namespace NuEngine::Physics
+{
+    size_t ShapeCache::ShapeKeyHash::operator()(const ShapeKey& key) const noexcept
+    {
+        // FNV-1a over the type and parameter bits
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](uint32_t value)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        };
+
+        mix(static_cast<uint32_t>(key.Type));
+        for (uint32_t param : key.Params)
+        {
+            mix(param);
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    ShapeCache::ShapeKey ShapeCache::MakeKey(const ShapeDesc& desc) noexcept
+    {
+        ShapeKey key{ desc.Type, { 0, 0, 0 } };
+        switch (desc.Type)
+        {
+        case ShapeType::Box:
+            key.Params = {
+                std::bit_cast<uint32_t>(desc.HalfExtents.X()),
+                std::bit_cast<uint32_t>(desc.HalfExtents.Y()),
+                std::bit_cast<uint32_t>(desc.HalfExtents.Z()) };
+            break;
+        case ShapeType::Sphere:
+            key.Params[0] = std::bit_cast<uint32_t>(desc.Radius);
+            break;
+        case ShapeType::Capsule:
+            key.Params[0] = std::bit_cast<uint32_t>(desc.HalfHeight);
+            key.Params[1] = std::bit_cast<uint32_t>(desc.Radius);
+            break;
+        }
+        return key;
+    }
+
+    Core::Result<JPH::RefConst<JPH::Shape>, PhysicsError> ShapeCache::GetOrCreate(const ShapeDesc& desc)
+    {
+        const ShapeKey key = MakeKey(desc);
+
+        std::lock_guard lock(m_Mutex);
+
+        auto it = m_Shapes.find(key);
+        if (it != m_Shapes.end())
+        {
+            return Core::Ok(it->second);
+        }
+
+        JPH::ShapeSettings::ShapeResult shapeResult;
+        switch (desc.Type)
+        {
+        case ShapeType::Box:
+            shapeResult = JPH::BoxShapeSettings(JPH::Vec3(desc.HalfExtents.X(), desc.HalfExtents.Y(), desc.HalfExtents.Z())).Create();
+            break;
+        case ShapeType::Sphere:
+            shapeResult = JPH::SphereShapeSettings(desc.Radius).Create();
+            break;
+        case ShapeType::Capsule:
+            shapeResult = JPH::CapsuleShapeSettings(desc.HalfHeight, desc.Radius).Create();
+            break;
+        }
+
+        if (!shapeResult.IsValid())
+        {
+            return Core::Err(PhysicsError(PhysicsErrorCode::ShapeCreationFailed,
+                shapeResult.HasError() ? std::string(shapeResult.GetError().c_str()) : std::string()));
+        }
+
+        JPH::RefConst<JPH::Shape> shape = shapeResult.Get();
+        m_Shapes.emplace(key, shape);
+        return Core::Ok(shape);
+    }
+
+    void ShapeCache::Clear()
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Shapes.clear();
+    }
+
+    size_t ShapeCache::GetSize() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Shapes.size();
+    }
+}
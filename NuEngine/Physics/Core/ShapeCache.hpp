@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <Core/Types/Result.hpp>
+#include <Physics/Bodies/BodyDesc.hpp>
+#include <Physics/Errors/PhysicsError.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace NuEngine::Physics
+{
+    /**
+     * @brief Deduplicates Jolt shapes by their parameters.
+     *
+     * Thousands of identical crates end up referencing a single immutable shape
+     * instead of allocating one each.
+     */
+    class NU_API ShapeCache
+    {
+    public:
+        Core::Result<JPH::RefConst<JPH::Shape>, PhysicsError> GetOrCreate(const ShapeDesc& desc);
+
+        void Clear();
+
+        [[nodiscard]] size_t GetSize() const;
+
+    private:
+        struct ShapeKey
+        {
+            ShapeType Type;
+            std::array<uint32_t, 3> Params;  // Bit patterns of the floats that define the shape
+
+            bool operator==(const ShapeKey& other) const noexcept = default;
+        };
+
+        struct ShapeKeyHash
+        {
+            size_t operator()(const ShapeKey& key) const noexcept;
+        };
+
+        static ShapeKey MakeKey(const ShapeDesc& desc) noexcept;
+
+        std::unordered_map<ShapeKey, JPH::RefConst<JPH::Shape>, ShapeKeyHash> m_Shapes;
+        mutable std::mutex m_Mutex;
+    };
+}
@@ -0,0 +1,220 @@
+#include <Physics/Core/PhysicsEngine.hpp>
+#include <Physics/Core/PhysicsUtils.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <Jolt/Physics/Body/BodyFilter.h>
+#include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+
+#include <algorithm>
+
+namespace NuEngine::Physics
+{
+	namespace
+	{
+		// Queries are cheap individually; below this many per range the scheduling costs more than it saves.
+		constexpr size_t k_MinQueriesPerJob = 256;
+
+		void WriteMiss(const CastHitsSoA& out, size_t i) noexcept
+		{
+			out.Distances[i] = -1.0f;
+			out.Bodies[i] = k_InvalidBodyHandle;
+		}
+
+		void WriteHit(const CastHitsSoA& out, size_t i, JPH::RVec3Arg point, JPH::Vec3Arg normal, float distance, JPH::BodyID body) noexcept
+		{
+			out.Positions.X()[i] = static_cast<float>(point.GetX());
+			out.Positions.Y()[i] = static_cast<float>(point.GetY());
+			out.Positions.Z()[i] = static_cast<float>(point.GetZ());
+			out.Normals.X()[i] = normal.GetX();
+			out.Normals.Y()[i] = normal.GetY();
+			out.Normals.Z()[i] = normal.GetZ();
+			out.Distances[i] = distance;
+			out.Bodies[i] = body.GetIndexAndSequenceNumber();
+		}
+	}
+
+	Core::Result<void, PhysicsError> PhysicsEngine::CastRays(
+		std::span<const NuMath::Ray> rays,
+		float maxDistance,
+		const CastHitsSoA& outHits,
+		std::span<const uint32_t> ignoreBodies) noexcept
+	{
+		if (!IsInitialized())
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "CastRays called before PhysicsEngine::Initialize"));
+		}
+
+		// No-op inside the CompleteStep/BeginStep window, where Scene runs its scripts
+		WaitForStep();
+
+		if (!ignoreBodies.empty() && ignoreBodies.size() != rays.size())
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::InvalidParameter, "ignoreBodies must be empty or match rays"));
+		}
+
+		const JPH::PhysicsSystem& system = GetSystem();
+		const JPH::NarrowPhaseQuery& query = system.GetNarrowPhaseQuery();
+		const JPH::BodyLockInterface& lockInterface = system.GetBodyLockInterface();
+
+		Core::JobSystem::Get().ParallelFor(rays.size(), [&](size_t start, size_t end)
+		{
+			for (size_t i = start; i < end; ++i)
+			{
+				const JPH::RRayCast ray(JPH::RVec3(ToJolt(rays[i].Origin)), ToJolt(rays[i].Direction) * maxDistance);
+
+				// Closest-hit overload: no collector state at all for the common case
+				JPH::RayCastResult hit;
+				bool hadHit;
+				if (ignoreBodies.empty())
+				{
+					hadHit = query.CastRay(ray, hit);
+				}
+				else
+				{
+					const JPH::IgnoreSingleBodyFilter bodyFilter{ JPH::BodyID(ignoreBodies[i]) };
+					hadHit = query.CastRay(ray, hit, {}, {}, bodyFilter);
+				}
+
+				if (!hadHit)
+				{
+					WriteMiss(outHits, i);
+					continue;
+				}
+
+				const JPH::RVec3 point = ray.GetPointOnRay(hit.mFraction);
+				JPH::Vec3 normal = JPH::Vec3::sZero();
+				{
+					JPH::BodyLockRead lock(lockInterface, hit.mBodyID);
+					if (lock.Succeeded())
+					{
+						normal = lock.GetBody().GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, point);
+					}
+				}
+
+				WriteHit(outHits, i, point, normal, hit.mFraction * maxDistance, hit.mBodyID);
+			}
+		}, k_MinQueriesPerJob);
+
+		return Core::Ok();
+	}
+
+	Core::Result<void, PhysicsError> PhysicsEngine::CastShapes(
+		const ShapeDesc& shape,
+		std::span<const NuMath::Ray> sweeps,
+		float maxDistance,
+		const CastHitsSoA& outHits) noexcept
+	{
+		if (!IsInitialized())
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "CastShapes called before PhysicsEngine::Initialize"));
+		}
+
+		WaitForStep();
+
+		auto shapeResult = GetShapeCache().GetOrCreate(shape);
+		if (shapeResult.IsError())
+		{
+			return Core::Err(shapeResult.UnwrapError());
+		}
+
+		const JPH::RefConst<JPH::Shape> joltShape = shapeResult.Unwrap();
+		const JPH::NarrowPhaseQuery& query = GetSystem().GetNarrowPhaseQuery();
+
+		Core::JobSystem::Get().ParallelFor(sweeps.size(), [&](size_t start, size_t end)
+		{
+			thread_local JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+			const JPH::ShapeCastSettings settings;
+
+			for (size_t i = start; i < end; ++i)
+			{
+				const JPH::RShapeCast cast = JPH::RShapeCast::sFromWorldTransform(
+					joltShape.GetPtr(),
+					JPH::Vec3::sReplicate(1.0f),
+					JPH::RMat44::sTranslation(JPH::RVec3(ToJolt(sweeps[i].Origin))),
+					ToJolt(sweeps[i].Direction) * maxDistance);
+
+				collector.Reset();
+				query.CastShape(cast, settings, JPH::RVec3::sZero(), collector);
+
+				if (!collector.HadHit())
+				{
+					WriteMiss(outHits, i);
+					continue;
+				}
+
+				const JPH::ShapeCastResult& hit = collector.mHit;
+				const float axisLength = hit.mPenetrationAxis.Length();
+				const JPH::Vec3 normal = axisLength > 0.0f ? -hit.mPenetrationAxis / axisLength : JPH::Vec3::sZero();
+
+				WriteHit(outHits, i, JPH::RVec3(hit.mContactPointOn2), normal, hit.mFraction * maxDistance, hit.mBodyID2);
+			}
+		}, k_MinQueriesPerJob);
+
+		return Core::Ok();
+	}
+
+	Core::Result<void, PhysicsError> PhysicsEngine::Overlap(
+		const ShapeDesc& shape,
+		std::span<const NuMath::Vector3> positions,
+		const OverlapHitsSoA& outHits) noexcept
+	{
+		if (!IsInitialized())
+		{
+			return Core::Err(PhysicsError(PhysicsErrorCode::SystemInitFailed, "Overlap called before PhysicsEngine::Initialize"));
+		}
+
+		WaitForStep();
+
+		auto shapeResult = GetShapeCache().GetOrCreate(shape);
+		if (shapeResult.IsError())
+		{
+			return Core::Err(shapeResult.UnwrapError());
+		}
+
+		const JPH::RefConst<JPH::Shape> joltShape = shapeResult.Unwrap();
+		const JPH::NarrowPhaseQuery& query = GetSystem().GetNarrowPhaseQuery();
+		const uint32_t maxHits = outHits.MaxHitsPerQuery;
+
+		Core::JobSystem::Get().ParallelFor(positions.size(), [&](size_t start, size_t end)
+		{
+			// Keeps its hit array capacity across batches, so steady-state queries do not allocate
+			thread_local JPH::AllHitCollisionCollector<JPH::CollideShapeCollector> collector;
+			const JPH::CollideShapeSettings settings;
+
+			for (size_t i = start; i < end; ++i)
+			{
+				collector.Reset();
+				query.CollideShape(
+					joltShape.GetPtr(),
+					JPH::Vec3::sReplicate(1.0f),
+					JPH::RMat44::sTranslation(JPH::RVec3(ToJolt(positions[i]))),
+					settings,
+					JPH::RVec3::sZero(),
+					collector);
+
+				uint32_t* bodies = outHits.Bodies + i * maxHits;
+				uint32_t count = 0;
+
+				// One body can report several sub-shape hits; keep each body once
+				for (const JPH::CollideShapeResult& hit : collector.mHits)
+				{
+					const uint32_t handle = hit.mBodyID2.GetIndexAndSequenceNumber();
+					if (count < maxHits && std::find(bodies, bodies + count, handle) == bodies + count)
+					{
+						bodies[count++] = handle;
+					}
+				}
+
+				outHits.Counts[i] = count;
+			}
+		}, k_MinQueriesPerJob);
+
+		return Core::Ok();
+	}
+}
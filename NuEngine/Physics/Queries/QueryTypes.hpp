@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/Memory/AlignedAllocator.hpp>
+
+#include <NuMath/Core/StorageTypes.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace NuEngine::Physics
+{
+    inline constexpr uint32_t k_InvalidBodyHandle = 0xFFFFFFFF;
+
+    /**
+     * @brief Caller-owned SoA output of a batched ray or shape cast, one entry per query.
+     *
+     * On a miss Distances[i] is negative, Bodies[i] is k_InvalidBodyHandle and the
+     * position/normal entries are left untouched.
+     */
+    struct CastHitsSoA
+    {
+        NuMath::SoAVec3 Positions;
+        NuMath::SoAVec3 Normals;
+        float* Distances = nullptr;
+        uint32_t* Bodies = nullptr;
+    };
+
+    /**
+     * @brief Caller-owned output of a batched overlap query.
+     *
+     * Query i writes up to MaxHitsPerQuery bodies to Bodies[i * MaxHitsPerQuery ...] and the
+     * number written to Counts[i].
+     */
+    struct OverlapHitsSoA
+    {
+        uint32_t* Bodies = nullptr;
+        uint32_t* Counts = nullptr;
+        uint32_t MaxHitsPerQuery = 0;
+    };
+
+    /**
+     * @brief Storage backing a CastHitsSoA; keep one around and Resize() it per frame.
+     */
+    class CastHitsBuffer
+    {
+    public:
+        void Resize(size_t count)
+        {
+            m_Count = count;
+            m_Floats.resize(count * 7);
+            m_Bodies.resize(count);
+        }
+
+        [[nodiscard]] CastHitsSoA View() noexcept
+        {
+            float* base = m_Floats.data();
+            CastHitsSoA view;
+            view.Positions = { base, base + m_Count, base + m_Count * 2 };
+            view.Normals = { base + m_Count * 3, base + m_Count * 4, base + m_Count * 5 };
+            view.Distances = base + m_Count * 6;
+            view.Bodies = m_Bodies.data();
+            return view;
+        }
+
+        [[nodiscard]] size_t GetCount() const noexcept { return m_Count; }
+
+    private:
+        AlignedVector<float, 32> m_Floats;
+        std::vector<uint32_t> m_Bodies;
+        size_t m_Count = 0;
+    };
+}
@@ -0,0 +1,93 @@
+#include <Renderer/Batching/InstanceBatchBuilder.hpp>
+#include <Renderer/Mesh.hpp>
+
+#include <algorithm>
+
+namespace NuEngine::Renderer
+{
+	InstanceBatchBuilder::InstanceBatchBuilder(uint32_t maxInstancesPerBatch)
+		: m_MaxInstancesPerBatch(std::max<uint32_t>(maxInstancesPerBatch, 1))
+	{
+	}
+
+	void InstanceBatchBuilder::Submit(const Mesh* mesh, const Material* material, std::span<const NuMath::Matrix4x4> transforms)
+	{
+		if (!mesh || !material || transforms.empty())
+		{
+			return;
+		}
+
+		const GroupKey key{ mesh, material };
+		auto [it, inserted] = m_GroupLookup.try_emplace(key, static_cast<uint32_t>(m_Groups.size()));
+		if (inserted)
+		{
+			m_Groups.push_back(key);
+		}
+
+		m_Submissions.push_back({ it->second, static_cast<uint32_t>(m_Staging.size()), static_cast<uint32_t>(transforms.size()) });
+		if (mesh->IsQuantized)
+		{
+			for (const NuMath::Matrix4x4& transform : transforms)
+			{
+				m_Staging.push_back(GetDrawTransform(*mesh, transform));
+			}
+		}
+		else
+		{
+			m_Staging.insert(m_Staging.end(), transforms.begin(), transforms.end());
+		}
+	}
+
+	void InstanceBatchBuilder::Build()
+	{
+		m_Batches.clear();
+		m_InstanceData.resize(m_Staging.size());
+
+		// Counting sort of the submissions by group: sizes, then prefix sums, then scatter
+		m_GroupOffsets.assign(m_Groups.size() + 1, 0);
+		for (const Submission& submission : m_Submissions)
+		{
+			m_GroupOffsets[submission.Group + 1] += submission.Count;
+		}
+		for (size_t i = 1; i < m_GroupOffsets.size(); ++i)
+		{
+			m_GroupOffsets[i] += m_GroupOffsets[i - 1];
+		}
+
+		for (const Submission& submission : m_Submissions)
+		{
+			uint32_t& cursor = m_GroupOffsets[submission.Group];
+			std::copy_n(m_Staging.begin() + submission.Offset, submission.Count, m_InstanceData.begin() + cursor);
+			cursor += submission.Count;
+		}
+
+		// After the scatter each offset points at the end of its group, i.e. the start of the next one
+		uint32_t groupStart = 0;
+		for (size_t group = 0; group < m_Groups.size(); ++group)
+		{
+			const uint32_t groupEnd = m_GroupOffsets[group];
+			for (uint32_t first = groupStart; first < groupEnd;)
+			{
+				InstanceBatch batch;
+				batch.Mesh = m_Groups[group].MeshPtr;
+				batch.Material = m_Groups[group].MaterialPtr;
+				batch.FirstInstance = first;
+				batch.InstanceCount = std::min(m_MaxInstancesPerBatch, groupEnd - first);
+				m_Batches.push_back(batch);
+
+				first += batch.InstanceCount;
+			}
+			groupStart = groupEnd;
+		}
+	}
+
+	void InstanceBatchBuilder::Clear() noexcept
+	{
+		m_GroupLookup.clear();
+		m_Groups.clear();
+		m_Submissions.clear();
+		m_Staging.clear();
+		m_InstanceData.clear();
+		m_Batches.clear();
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	struct Mesh;
+	struct Material;
+
+	/*
+	* @brief One instanced draw: InstanceCount transforms starting at FirstInstance in the builder's instance data.
+	*/
+	struct InstanceBatch
+	{
+		const Renderer::Mesh* Mesh = nullptr;
+		const Renderer::Material* Material = nullptr;
+		uint32_t FirstInstance = 0;
+		uint32_t InstanceCount = 0;
+	};
+
+	/*
+	* @brief Groups per-frame instance submissions by (mesh, material) into contiguous batches.
+	*
+	* Pure CPU work with no device calls. Batches come out in the order their (mesh, material)
+	* pair was first submitted; instances keep their submission order inside a batch.
+	*/
+	class NU_API InstanceBatchBuilder
+	{
+	public:
+		/*
+		* @param maxInstancesPerBatch Larger groups are split into several batches (e.g. to fit a uniform or instance buffer).
+		*/
+		explicit InstanceBatchBuilder(uint32_t maxInstancesPerBatch = 0xFFFFFFFF);
+
+		void Submit(const Mesh* mesh, const Material* material, std::span<const NuMath::Matrix4x4> transforms);
+
+		/*
+		* @brief Groups everything submitted since Clear() into GetBatches()/GetInstanceData().
+		*/
+		void Build();
+
+		/*
+		* @brief Drops all submissions and batches. Keeps capacity, so steady-state frames do not allocate.
+		*/
+		void Clear() noexcept;
+
+		[[nodiscard]] std::span<const InstanceBatch> GetBatches() const noexcept { return m_Batches; }
+		[[nodiscard]] std::span<const NuMath::Matrix4x4> GetInstanceData() const noexcept { return m_InstanceData; }
+		[[nodiscard]] uint32_t GetInstanceCount() const noexcept { return static_cast<uint32_t>(m_Staging.size()); }
+
+	private:
+		struct GroupKey
+		{
+			const Mesh* MeshPtr;
+			const Material* MaterialPtr;
+
+			bool operator==(const GroupKey& other) const noexcept = default;
+		};
+
+		struct GroupKeyHash
+		{
+			size_t operator()(const GroupKey& key) const noexcept
+			{
+				const size_t a = reinterpret_cast<size_t>(key.MeshPtr);
+				const size_t b = reinterpret_cast<size_t>(key.MaterialPtr);
+				return a ^ (b + 0x9e3779b97f4a7c15ull + (a << 6) + (a >> 2));
+			}
+		};
+
+		struct Submission
+		{
+			uint32_t Group;
+			uint32_t Offset;
+			uint32_t Count;
+		};
+
+		uint32_t m_MaxInstancesPerBatch;
+
+		std::unordered_map<GroupKey, uint32_t, GroupKeyHash> m_GroupLookup;
+		std::vector<GroupKey> m_Groups;
+		std::vector<uint32_t> m_GroupOffsets;
+		std::vector<Submission> m_Submissions;
+		std::vector<NuMath::Matrix4x4> m_Staging;
+
+		std::vector<NuMath::Matrix4x4> m_InstanceData;
+		std::vector<InstanceBatch> m_Batches;
+	};
+}
@@ -33,6 +33,9 @@ namespace NuEngine::Renderer
 
 		[[nodiscard]] NuMath::Matrix4x4 GetViewProjectionMatrix() const;
 
+		[[nodiscard]] float GetNearClip() const { return m_Near; }
+		[[nodiscard]] float GetFarClip() const { return m_Far; }
+
 		void SetPerspective(float fovRadians, float aspectRatio, float nearClip, float farClip);
 		void SetViewportSize(uint32_t width, uint32_t height);
 
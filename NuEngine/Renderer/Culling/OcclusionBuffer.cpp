@@ -0,0 +1,402 @@
+#include <Renderer/Culling/OcclusionBuffer.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		// Vertices closer to the eye plane than this are treated as crossing the near plane
+		constexpr float k_MinClipW = 1.0e-5f;
+		constexpr float k_FarDepth = 1.0f;
+
+		alignas(32) constexpr float k_LaneCenters[8] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
+
+		constexpr std::array<uint32_t, 36> k_BoxIndices = {
+			0, 1, 3, 0, 3, 2,  // -X
+			4, 6, 7, 4, 7, 5,  // +X
+			0, 4, 5, 0, 5, 1,  // -Y
+			2, 3, 7, 2, 7, 6,  // +Y
+			0, 2, 6, 0, 6, 4,  // -Z
+			1, 5, 7, 1, 7, 3   // +Z
+		};
+
+		NuMath::Vector4 ToClip(const NuMath::Matrix4x4& matrix, const NuMath::Vector3& point)
+		{
+			return matrix * NuMath::Vector4(point.X(), point.Y(), point.Z(), 1.0f);
+		}
+	}
+
+	OcclusionBuffer::OcclusionBuffer()
+		: m_ViewProjection(NuMath::Matrix4x4::Identity())
+		, m_Depth(k_Width * k_Height, k_FarDepth)
+		, m_TileDepth(k_TilesX * k_TilesY, k_FarDepth)
+	{
+	}
+
+	void OcclusionBuffer::BeginFrame(const NuMath::Matrix4x4& viewProjection)
+	{
+		m_ViewProjection = viewProjection;
+		m_Triangles.clear();
+	}
+
+	void OcclusionBuffer::AddOccluder(std::span<const NuMath::Vector3> vertices, std::span<const uint32_t> indices, const NuMath::Matrix4x4& model)
+	{
+		const NuMath::Matrix4x4 modelViewProjection = m_ViewProjection * model;
+
+		m_ClipScratch.resize(vertices.size());
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			m_ClipScratch[i] = ToClip(modelViewProjection, vertices[i]);
+		}
+
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			AddTriangle(m_ClipScratch[indices[i]], m_ClipScratch[indices[i + 1]], m_ClipScratch[indices[i + 2]], false);
+		}
+	}
+
+	void OcclusionBuffer::AddOccluderBox(const NuMath::Matrix4x4& model, const NuMath::Vector3& halfExtents)
+	{
+		// Corner i has bit 2 set for +X, bit 1 for +Y and bit 0 for +Z
+		std::array<NuMath::Vector3, 8> corners;
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			corners[i] = NuMath::Vector3(
+				(i & 4) ? halfExtents.X() : -halfExtents.X(),
+				(i & 2) ? halfExtents.Y() : -halfExtents.Y(),
+				(i & 1) ? halfExtents.Z() : -halfExtents.Z());
+		}
+
+		// Back faces of a closed box always lie behind its front faces, so they are skipped
+		const NuMath::Matrix4x4 modelViewProjection = m_ViewProjection * model;
+		std::array<NuMath::Vector4, 8> clip;
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			clip[i] = ToClip(modelViewProjection, corners[i]);
+		}
+
+		for (size_t i = 0; i < k_BoxIndices.size(); i += 3)
+		{
+			AddTriangle(clip[k_BoxIndices[i]], clip[k_BoxIndices[i + 1]], clip[k_BoxIndices[i + 2]], true);
+		}
+	}
+
+	void OcclusionBuffer::AddTriangle(const NuMath::Vector4& c0, const NuMath::Vector4& c1, const NuMath::Vector4& c2, bool cullBackFace)
+	{
+		if (c0.W() < k_MinClipW || c1.W() < k_MinClipW || c2.W() < k_MinClipW)
+		{
+			return;
+		}
+
+		struct ScreenVertex
+		{
+			float X, Y, Z;
+		};
+
+		const auto toScreen = [](const NuMath::Vector4& clip)
+		{
+			const float invW = 1.0f / clip.W();
+			return ScreenVertex{
+				(clip.X() * invW * 0.5f + 0.5f) * static_cast<float>(k_Width),
+				(clip.Y() * invW * 0.5f + 0.5f) * static_cast<float>(k_Height),
+				clip.Z() * invW
+			};
+		};
+
+		ScreenVertex v[3] = { toScreen(c0), toScreen(c1), toScreen(c2) };
+
+		float area = (v[1].X - v[0].X) * (v[2].Y - v[0].Y) - (v[2].X - v[0].X) * (v[1].Y - v[0].Y);
+		if (std::abs(area) < 1.0e-6f)
+		{
+			return;
+		}
+		if (area < 0.0f)
+		{
+			if (cullBackFace)
+			{
+				return;
+			}
+
+			std::swap(v[1], v[2]);
+			area = -area;
+		}
+
+		ScreenTriangle triangle;
+		triangle.MinX = std::max(0, static_cast<int32_t>(std::floor(std::min({ v[0].X, v[1].X, v[2].X }))));
+		triangle.MaxX = std::min(static_cast<int32_t>(k_Width) - 1, static_cast<int32_t>(std::ceil(std::max({ v[0].X, v[1].X, v[2].X }))));
+		triangle.MinY = std::max(0, static_cast<int32_t>(std::floor(std::min({ v[0].Y, v[1].Y, v[2].Y }))));
+		triangle.MaxY = std::min(static_cast<int32_t>(k_Height) - 1, static_cast<int32_t>(std::ceil(std::max({ v[0].Y, v[1].Y, v[2].Y }))));
+		if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY)
+		{
+			return;
+		}
+
+		// Edge k runs between the two vertices other than k, so it is zero there and area at vertex k
+		const float invArea = 1.0f / area;
+		triangle.DepthA = triangle.DepthB = triangle.DepthC = 0.0f;
+		for (int k = 0; k < 3; ++k)
+		{
+			const ScreenVertex& a = v[(k + 1) % 3];
+			const ScreenVertex& b = v[(k + 2) % 3];
+
+			triangle.EdgeA[k] = a.Y - b.Y;
+			triangle.EdgeB[k] = b.X - a.X;
+			triangle.EdgeC[k] = a.X * b.Y - a.Y * b.X;
+
+			// Barycentric k is edge k / area, so the depth plane is their depth-weighted sum
+			triangle.DepthA += triangle.EdgeA[k] * invArea * v[k].Z;
+			triangle.DepthB += triangle.EdgeB[k] * invArea * v[k].Z;
+			triangle.DepthC += triangle.EdgeC[k] * invArea * v[k].Z;
+		}
+
+		m_Triangles.push_back(triangle);
+	}
+
+	void OcclusionBuffer::Rasterize()
+	{
+		Core::JobSystem::Get().ParallelFor(k_TilesY, [this](size_t start, size_t end)
+		{
+			for (size_t tileRow = start; tileRow < end; ++tileRow)
+			{
+				RasterizeBand(static_cast<uint32_t>(tileRow));
+			}
+		}, 1);
+	}
+
+	void OcclusionBuffer::RasterizeBand(uint32_t tileRow)
+	{
+		const int32_t rowBegin = static_cast<int32_t>(tileRow * k_TileHeight);
+		const int32_t rowEnd = rowBegin + static_cast<int32_t>(k_TileHeight);
+
+		std::fill(m_Depth.begin() + rowBegin * k_Width, m_Depth.begin() + rowEnd * k_Width, k_FarDepth);
+
+		for (const ScreenTriangle& triangle : m_Triangles)
+		{
+			if (triangle.MaxY < rowBegin || triangle.MinY >= rowEnd)
+			{
+				continue;
+			}
+
+			RasterizeTriangle(triangle, std::max(rowBegin, triangle.MinY), std::min(rowEnd, triangle.MaxY + 1));
+		}
+
+		UpdateTileDepth(tileRow);
+	}
+
+	void OcclusionBuffer::RasterizeTriangle(const ScreenTriangle& triangle, int32_t rowBegin, int32_t rowEnd)
+	{
+		using Register = Backend::Register;
+		constexpr int32_t Pack = Backend::Width;
+		constexpr int AllLanes = (1 << Pack) - 1;
+
+		const Register zero = Backend::SetZero();
+		const Register laneCenters = Backend::Load(k_LaneCenters);
+		const Register edgeA0 = Backend::SetAll(triangle.EdgeA[0]);
+		const Register edgeA1 = Backend::SetAll(triangle.EdgeA[1]);
+		const Register edgeA2 = Backend::SetAll(triangle.EdgeA[2]);
+		const Register depthA = Backend::SetAll(triangle.DepthA);
+
+		for (int32_t y = rowBegin; y < rowEnd; ++y)
+		{
+			const float centerY = static_cast<float>(y) + 0.5f;
+
+			// Narrow the bounding box to the row's span so long thin triangles skip their empty packs;
+			// one pixel of slack either side, the edge test below stays exact
+			float spanMin = static_cast<float>(triangle.MinX);
+			float spanMax = static_cast<float>(triangle.MaxX);
+			bool emptyRow = false;
+			for (int k = 0; k < 3; ++k)
+			{
+				const float edgeA = triangle.EdgeA[k];
+				const float rowValue = triangle.EdgeB[k] * centerY + triangle.EdgeC[k];
+				if (edgeA > 0.0f)
+				{
+					spanMin = std::max(spanMin, -rowValue / edgeA - 1.5f);
+				}
+				else if (edgeA < 0.0f)
+				{
+					spanMax = std::min(spanMax, -rowValue / edgeA + 0.5f);
+				}
+				else
+				{
+					emptyRow |= rowValue < 0.0f;
+				}
+			}
+
+			if (emptyRow || spanMin > spanMax)
+			{
+				continue;
+			}
+
+			const int32_t firstX = (static_cast<int32_t>(spanMin) / Pack) * Pack;
+			const int32_t lastX = static_cast<int32_t>(spanMax);
+			const Register rowEdge0 = Backend::SetAll(triangle.EdgeB[0] * centerY + triangle.EdgeC[0]);
+			const Register rowEdge1 = Backend::SetAll(triangle.EdgeB[1] * centerY + triangle.EdgeC[1]);
+			const Register rowEdge2 = Backend::SetAll(triangle.EdgeB[2] * centerY + triangle.EdgeC[2]);
+			const Register rowDepth = Backend::SetAll(triangle.DepthB * centerY + triangle.DepthC);
+
+			float* row = m_Depth.data() + static_cast<size_t>(y) * k_Width;
+
+			for (int32_t x = firstX; x <= lastX; x += Pack)
+			{
+				const Register centerX = Backend::Add(Backend::SetAll(static_cast<float>(x)), laneCenters);
+
+				const int outside = Backend::LessMask(Backend::Add(Backend::Mul(edgeA0, centerX), rowEdge0), zero)
+					| Backend::LessMask(Backend::Add(Backend::Mul(edgeA1, centerX), rowEdge1), zero)
+					| Backend::LessMask(Backend::Add(Backend::Mul(edgeA2, centerX), rowEdge2), zero);
+
+				int covered = ~outside & AllLanes;
+				if (covered == 0)
+				{
+					continue;
+				}
+
+				const Register depth = Backend::Add(Backend::Mul(depthA, centerX), rowDepth);
+				if (covered == AllLanes)
+				{
+					Backend::Store(row + x, Backend::Min(Backend::Load(row + x), depth));
+					continue;
+				}
+
+				// Triangle edge: only some lanes are covered
+				alignas(32) float lanes[Pack];
+				Backend::Store(lanes, depth);
+				while (covered)
+				{
+					const int lane = std::countr_zero(static_cast<unsigned>(covered));
+					covered &= covered - 1;
+					row[x + lane] = std::min(row[x + lane], lanes[lane]);
+				}
+			}
+		}
+	}
+
+	void OcclusionBuffer::UpdateTileDepth(uint32_t tileRow)
+	{
+		using Register = Backend::Register;
+		constexpr uint32_t Pack = Backend::Width;
+
+		for (uint32_t tileX = 0; tileX < k_TilesX; ++tileX)
+		{
+			const float* tile = m_Depth.data() + static_cast<size_t>(tileRow) * k_TileHeight * k_Width + tileX * k_TileWidth;
+
+			Register furthest = Backend::Load(tile);
+			for (uint32_t y = 0; y < k_TileHeight; ++y)
+			{
+				for (uint32_t x = 0; x < k_TileWidth; x += Pack)
+				{
+					furthest = Backend::Max(furthest, Backend::Load(tile + y * k_Width + x));
+				}
+			}
+
+			alignas(32) float lanes[Pack];
+			Backend::Store(lanes, furthest);
+			m_TileDepth[tileRow * k_TilesX + tileX] = *std::max_element(lanes, lanes + Pack);
+		}
+	}
+
+	bool OcclusionBuffer::IsVisible(const NuMath::AABB& bounds) const noexcept
+	{
+		if (m_Triangles.empty())
+		{
+			return true;
+		}
+
+		float minX = static_cast<float>(k_Width);
+		float minY = static_cast<float>(k_Height);
+		float maxX = 0.0f;
+		float maxY = 0.0f;
+		float nearestDepth = k_FarDepth;
+
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			const NuMath::Vector3 corner(
+				(i & 4) ? bounds.Max.X() : bounds.Min.X(),
+				(i & 2) ? bounds.Max.Y() : bounds.Min.Y(),
+				(i & 1) ? bounds.Max.Z() : bounds.Min.Z());
+
+			const NuMath::Vector4 clip = ToClip(m_ViewProjection, corner);
+			if (clip.W() < k_MinClipW)
+			{
+				return true;
+			}
+
+			const float invW = 1.0f / clip.W();
+			const float x = (clip.X() * invW * 0.5f + 0.5f) * static_cast<float>(k_Width);
+			const float y = (clip.Y() * invW * 0.5f + 0.5f) * static_cast<float>(k_Height);
+
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+			minY = std::min(minY, y);
+			maxY = std::max(maxY, y);
+			nearestDepth = std::min(nearestDepth, clip.Z() * invW);
+		}
+
+		// Off-screen rectangles are for the frustum test to decide
+		if (maxX < 0.0f || maxY < 0.0f || minX >= static_cast<float>(k_Width) || minY >= static_cast<float>(k_Height))
+		{
+			return true;
+		}
+
+		return IsRectVisible(
+			std::max(0, static_cast<int32_t>(std::floor(minX))),
+			std::max(0, static_cast<int32_t>(std::floor(minY))),
+			std::min(static_cast<int32_t>(k_Width) - 1, static_cast<int32_t>(std::floor(maxX))),
+			std::min(static_cast<int32_t>(k_Height) - 1, static_cast<int32_t>(std::floor(maxY))),
+			nearestDepth);
+	}
+
+	bool OcclusionBuffer::IsVisible(const NuMath::Sphere& bounds) const noexcept
+	{
+		return IsVisible(NuMath::AABB::FromCenterExtents(bounds.Center, NuMath::Vector3(bounds.Radius, bounds.Radius, bounds.Radius)));
+	}
+
+	bool OcclusionBuffer::IsRectVisible(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY, float nearestDepth) const noexcept
+	{
+		constexpr int32_t Pack = Backend::Width;
+		constexpr int AllLanes = (1 << Pack) - 1;
+
+		const Backend::Register nearest = Backend::SetAll(nearestDepth);
+
+		for (int32_t tileY = minY / static_cast<int32_t>(k_TileHeight); tileY <= maxY / static_cast<int32_t>(k_TileHeight); ++tileY)
+		{
+			for (int32_t tileX = minX / static_cast<int32_t>(k_TileWidth); tileX <= maxX / static_cast<int32_t>(k_TileWidth); ++tileX)
+			{
+				// Every occluder in this tile is in front of the box's nearest point
+				if (m_TileDepth[tileY * k_TilesX + tileX] < nearestDepth)
+				{
+					continue;
+				}
+
+				const int32_t rowBegin = std::max(minY, tileY * static_cast<int32_t>(k_TileHeight));
+				const int32_t rowEnd = std::min(maxY + 1, (tileY + 1) * static_cast<int32_t>(k_TileHeight));
+				const int32_t columnBegin = tileX * static_cast<int32_t>(k_TileWidth);
+
+				for (int32_t y = rowBegin; y < rowEnd; ++y)
+				{
+					const float* row = m_Depth.data() + static_cast<size_t>(y) * k_Width;
+					for (int32_t x = columnBegin; x < columnBegin + static_cast<int32_t>(k_TileWidth); x += Pack)
+					{
+						// Lanes inside [minX, maxX]
+						const int32_t first = std::clamp(minX - x, 0, Pack);
+						const int32_t last = std::clamp(maxX - x + 1, 0, Pack);
+						const int columns = AllLanes & ~((1 << first) - 1) & ((1 << last) - 1);
+
+						const int occluded = Backend::LessMask(Backend::Load(row + x), nearest);
+						if (~occluded & columns)
+						{
+							return true;
+						}
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+}
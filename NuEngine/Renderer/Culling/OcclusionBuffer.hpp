@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/Memory/AlignedAllocator.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Low-resolution CPU depth buffer for occlusion culling, with a max-depth tile level on top.
+	*
+	* Per frame: BeginFrame() with the camera, AddOccluder()/AddOccluderBox() for a few large,
+	* solid shapes (walls, buildings), Rasterize(), then IsVisible() for each candidate. Occluders
+	* should lie inside the geometry they stand for, since whatever they cover is dropped.
+	*
+	* Depth is NDC z (-1 near, 1 far) and the buffer starts at the far plane, so pixels without an
+	* occluder never hide anything. IsVisible() only reads, and may be called from any thread once
+	* Rasterize() has returned.
+	*/
+	class NU_API OcclusionBuffer
+	{
+	public:
+		static constexpr uint32_t k_Width = 256;
+		static constexpr uint32_t k_Height = 128;
+
+		// One max-depth value per tile; rows of a tile are rasterized by the same job
+		static constexpr uint32_t k_TileWidth = 8;
+		static constexpr uint32_t k_TileHeight = 8;
+		static constexpr uint32_t k_TilesX = k_Width / k_TileWidth;
+		static constexpr uint32_t k_TilesY = k_Height / k_TileHeight;
+
+		OcclusionBuffer();
+
+		/*
+		* @brief Drops last frame's occluders and captures the camera. The depth is cleared by Rasterize().
+		*/
+		void BeginFrame(const NuMath::Matrix4x4& viewProjection);
+
+		/*
+		* @brief Projects an indexed triangle mesh into screen space. Winding does not matter.
+		*
+		* Triangles crossing the near plane are dropped rather than clipped: losing part of an
+		* occluder only lets more through, never hides anything visible.
+		*/
+		void AddOccluder(std::span<const NuMath::Vector3> vertices, std::span<const uint32_t> indices, const NuMath::Matrix4x4& model);
+
+		/*
+		* @brief Adds a box of the given half size centred on the model's origin.
+		*
+		* Only its camera-facing sides are rasterized, so a camera inside the box sees nothing hidden.
+		*/
+		void AddOccluderBox(const NuMath::Matrix4x4& model, const NuMath::Vector3& halfExtents);
+
+		/*
+		* @brief Clears the depth and rasterizes every occluder, one band of tile rows per JobSystem range.
+		*
+		* Runs inline when the JobSystem has not been started. Safe to call from inside a job, so it
+		* can overlap with other frame work.
+		*/
+		void Rasterize();
+
+		/*
+		* @brief False if every pixel under the box's screen rectangle has an occluder in front of it.
+		*
+		* Boxes crossing the near plane or leaving the screen are reported visible.
+		*/
+		[[nodiscard]] bool IsVisible(const NuMath::AABB& bounds) const noexcept;
+
+		[[nodiscard]] bool IsVisible(const NuMath::Sphere& bounds) const noexcept;
+
+		[[nodiscard]] bool HasOccluders() const noexcept { return !m_Triangles.empty(); }
+		[[nodiscard]] size_t GetTriangleCount() const noexcept { return m_Triangles.size(); }
+
+		/*
+		* @brief Row-major k_Width x k_Height depth, bottom row first.
+		*/
+		[[nodiscard]] std::span<const float> GetDepth() const noexcept { return { m_Depth.data(), m_Depth.size() }; }
+
+		/*
+		* @brief Row-major k_TilesX x k_TilesY furthest depth of each tile.
+		*/
+		[[nodiscard]] std::span<const float> GetTileDepth() const noexcept { return { m_TileDepth.data(), m_TileDepth.size() }; }
+
+	private:
+		using Backend = NuMath::Simd::BatchBackend;
+
+		/*
+		* @brief Counter-clockwise screen-space triangle as three edge functions and a depth plane.
+		*
+		* Every value is of the form A * x + B * y + C at a pixel centre; a pixel is covered when
+		* all three edges are non-negative.
+		*/
+		struct ScreenTriangle
+		{
+			float EdgeA[3], EdgeB[3], EdgeC[3];
+			float DepthA, DepthB, DepthC;
+			int32_t MinX, MaxX, MinY, MaxY;
+		};
+
+		void AddTriangle(const NuMath::Vector4& c0, const NuMath::Vector4& c1, const NuMath::Vector4& c2, bool cullBackFace);
+		void RasterizeBand(uint32_t tileRow);
+		void RasterizeTriangle(const ScreenTriangle& triangle, int32_t rowBegin, int32_t rowEnd);
+		void UpdateTileDepth(uint32_t tileRow);
+
+		[[nodiscard]] bool IsRectVisible(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY, float nearestDepth) const noexcept;
+
+		NuMath::Matrix4x4 m_ViewProjection;
+		std::vector<ScreenTriangle> m_Triangles;
+		std::vector<NuMath::Vector4> m_ClipScratch;
+		AlignedVector<float, 32> m_Depth;
+		AlignedVector<float, 32> m_TileDepth;
+	};
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+
+#include <cstddef>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief CPU mirror of the std140 "Frame" uniform block shared by every shader:
+	*
+	*     layout(std140) uniform Frame
+	*     {
+	*         mat4 u_View;
+	*         mat4 u_Projection;
+	*         mat4 u_ViewProjection;
+	*         vec4 u_CameraPosition;   // w = 1
+	*     };
+	*
+	* Uploaded once per frame to UniformBlocks::k_FrameBinding. Members may only be added at the
+	* end, each starting on a 16-byte boundary, to keep the two layouts identical.
+	*/
+	struct FrameUniforms
+	{
+		NuMath::Matrix4x4 View;
+		NuMath::Matrix4x4 Projection;
+		NuMath::Matrix4x4 ViewProjection;
+		NuMath::Vector4 CameraPosition;
+	};
+
+	static_assert(sizeof(NuMath::Matrix4x4) == 64 && sizeof(NuMath::Vector4) == 16, "std140 mat4/vec4 sizes");
+	static_assert(offsetof(FrameUniforms, Projection) == 64);
+	static_assert(offsetof(FrameUniforms, ViewProjection) == 128);
+	static_assert(offsetof(FrameUniforms, CameraPosition) == 192);
+	static_assert(sizeof(FrameUniforms) == 208);
+}
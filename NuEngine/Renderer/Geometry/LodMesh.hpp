@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Geometry/MeshSimplifier.hpp>
+#include <Graphics/Abstractions/Core/IRenderDevice.hpp>
+#include <Graphics/Abstractions/Buffers/BufferLayout.hpp>
+
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief GPU side of a MeshLodChain: one Mesh per level, all sharing a single vertex buffer.
+	*/
+	struct LodMesh
+	{
+		std::vector<Mesh> Levels;
+		std::vector<MeshLodLevel> LevelInfo;
+		NuMath::Sphere Bounds;
+	};
+
+	/*
+	* @brief Uploads vertices once and one index buffer per level of chain.
+	*
+	* vertices must be laid out as described by layout, with the position in the first three floats.
+	*/
+	inline LodMesh CreateLodMesh(Graphics::IRenderDevice& device, std::span<const float> vertices, const Graphics::BufferLayout& layout, const MeshLodChain& chain)
+	{
+		LodMesh mesh;
+		mesh.LevelInfo = chain.Levels;
+		mesh.Bounds = chain.Bounds;
+
+		auto vertexBuffer = device.CreateVertexBuffer(const_cast<float*>(vertices.data()), static_cast<unsigned int>(vertices.size_bytes()));
+		vertexBuffer->SetLayout(layout);
+
+		const uint32_t vertexCount = layout.GetStride() > 0 ? static_cast<uint32_t>(vertices.size_bytes() / layout.GetStride()) : 0;
+		for (const MeshLodLevel& level : chain.Levels)
+		{
+			auto vertexArray = device.CreateVertexArray();
+			vertexArray->AddVertexBuffer(vertexBuffer);
+			vertexArray->SetIndexBuffer(device.CreateIndexBuffer(const_cast<uint32_t*>(chain.Indices.data() + level.FirstIndex), level.IndexCount));
+
+			mesh.Levels.push_back(Mesh{ vertexArray, vertexCount });
+		}
+
+		return mesh;
+	}
+}
@@ -0,0 +1,134 @@
+#include <Renderer/Geometry/LodSelector.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		// Distance below which an object counts as surrounding the camera; keeps the division finite
+		constexpr float k_MinDistance = 1.0e-4f;
+	}
+
+	LodSelector::LodSelector(float pixelError, float hysteresis)
+		: m_PixelError(pixelError)
+		, m_Hysteresis(hysteresis)
+		, m_CameraPosition(0.0f, 0.0f, 0.0f)
+	{
+	}
+
+	void LodSelector::SetView(const NuMath::Vector3& cameraPosition, float fovY, float viewportHeight) noexcept
+	{
+		m_CameraPosition = cameraPosition;
+		m_ProjectionScale = viewportHeight * 0.5f / std::tan(fovY * 0.5f);
+	}
+
+	void LodSelector::Clear() noexcept
+	{
+		m_CenterX.clear();
+		m_CenterY.clear();
+		m_CenterZ.clear();
+		m_Radius.clear();
+		m_Meshes.clear();
+		m_Levels.clear();
+	}
+
+	uint32_t LodSelector::Add(const NuMath::Sphere& worldBounds, const LodMesh& mesh, uint32_t previousLevel)
+	{
+		m_CenterX.push_back(worldBounds.Center.X());
+		m_CenterY.push_back(worldBounds.Center.Y());
+		m_CenterZ.push_back(worldBounds.Center.Z());
+		m_Radius.push_back(worldBounds.Radius);
+		m_Meshes.push_back(&mesh);
+		m_Levels.push_back(static_cast<uint8_t>(previousLevel));
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	void LodSelector::Select()
+	{
+		using Register = Backend::Register;
+		constexpr size_t Pack = Backend::Width;
+
+		const size_t count = m_Meshes.size();
+		const size_t padded = (count + Pack - 1) / Pack * Pack;
+
+		// Padding lanes have zero radius, so they come out as zero pixels
+		m_CenterX.resize(padded, 0.0f);
+		m_CenterY.resize(padded, 0.0f);
+		m_CenterZ.resize(padded, 0.0f);
+		m_Radius.resize(padded, 0.0f);
+		m_ScreenRadius.resize(padded);
+
+		const Register cameraX = Backend::SetAll(m_CameraPosition.X());
+		const Register cameraY = Backend::SetAll(m_CameraPosition.Y());
+		const Register cameraZ = Backend::SetAll(m_CameraPosition.Z());
+		const Register scale = Backend::SetAll(m_ProjectionScale);
+		const Register minDistance = Backend::SetAll(k_MinDistance);
+
+		for (size_t i = 0; i < padded; i += Pack)
+		{
+			const Register dx = Backend::Sub(Backend::Load(&m_CenterX[i]), cameraX);
+			const Register dy = Backend::Sub(Backend::Load(&m_CenterY[i]), cameraY);
+			const Register dz = Backend::Sub(Backend::Load(&m_CenterZ[i]), cameraZ);
+			const Register radius = Backend::Load(&m_Radius[i]);
+
+			// Distance to the nearest point of the sphere, so large objects refine before the camera reaches their centre
+			const Register length = Backend::Sqrt(Backend::Add(Backend::Add(Backend::Mul(dx, dx), Backend::Mul(dy, dy)), Backend::Mul(dz, dz)));
+			const Register distance = Backend::Max(Backend::Sub(length, radius), minDistance);
+
+			Backend::Store(&m_ScreenRadius[i], Backend::Div(Backend::Mul(radius, scale), distance));
+		}
+
+		m_CenterX.resize(count);
+		m_CenterY.resize(count);
+		m_CenterZ.resize(count);
+		m_Radius.resize(count);
+
+		m_Stats = LodSelectionStats{};
+		m_Stats.Objects = static_cast<uint32_t>(count);
+
+		const float coarsen = 1.0f - m_Hysteresis;
+		const float refine = 1.0f + m_Hysteresis;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const LodMesh& mesh = *m_Meshes[i];
+			const uint32_t levelCount = static_cast<uint32_t>(std::min(mesh.Levels.size(), mesh.LevelInfo.size()));
+			if (levelCount == 0)
+			{
+				continue;
+			}
+
+			// Level k may be drawn while the screen radius stays below PixelError / (Error_k / radius).
+			// Errors only grow along the chain, so the allowed levels are always 0 .. some k.
+			const float screenRadius = m_ScreenRadius[i];
+			const float meshRadius = std::max(mesh.Bounds.Radius, 1.0e-6f);
+			uint32_t surelyAllowed = 0;
+			uint32_t stillAllowed = 0;
+			for (uint32_t level = 1; level < levelCount; ++level)
+			{
+				const float relativeError = mesh.LevelInfo[level].Error / meshRadius;
+				const float switchRadius = relativeError > 0.0f ? m_PixelError / relativeError : 3.4e38f;
+				if (screenRadius > switchRadius * refine)
+				{
+					break;
+				}
+
+				stillAllowed = level;
+				if (screenRadius <= switchRadius * coarsen)
+				{
+					surelyAllowed = level;
+				}
+			}
+
+			const uint32_t previous = std::min<uint32_t>(m_Levels[i], levelCount - 1);
+			const uint32_t level = std::clamp(previous, surelyAllowed, stillAllowed);
+
+			m_Stats.Switches += level != m_Levels[i] ? 1 : 0;
+			m_Stats.IndicesSelected += mesh.LevelInfo[level].IndexCount;
+			m_Stats.IndicesFull += mesh.LevelInfo[0].IndexCount;
+			m_Levels[i] = static_cast<uint8_t>(level);
+		}
+	}
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Renderer/Geometry/LodMesh.hpp>
+#include <Core/Memory/AlignedAllocator.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief What the last LodSelector::Select() chose.
+	*/
+	struct LodSelectionStats
+	{
+		uint32_t Objects = 0;
+		uint32_t Switches = 0;              // Objects whose level differs from the previous frame's
+		uint64_t IndicesSelected = 0;
+		uint64_t IndicesFull = 0;           // What level 0 everywhere would have drawn
+	};
+
+	/*
+	* @brief Picks a LodMesh level per visible object from its projected screen size.
+	*
+	* Per frame: SetView(), Clear(), Add() each visible object with the level it was drawn with last
+	* frame, then Select(). The screen radius of every bounding sphere is computed in one SIMD pass;
+	* an object then takes the coarsest level whose simplification error projects to at most
+	* PixelError pixels. A level only changes once the size has moved Hysteresis past the switch
+	* point, so objects sitting on a boundary do not pop between levels every frame.
+	*/
+	class NU_API LodSelector
+	{
+	public:
+		/*
+		* @param pixelError Largest on-screen deviation from level 0 allowed, in pixels.
+		* @param hysteresis Fraction of the switch size an object must move past before its level changes.
+		*/
+		explicit LodSelector(float pixelError = 1.0f, float hysteresis = 0.15f);
+
+		void SetView(const NuMath::Vector3& cameraPosition, float fovY, float viewportHeight) noexcept;
+
+		void Clear() noexcept;
+
+		/*
+		* @brief Adds an object and returns its index into GetLevels().
+		*
+		* mesh must outlive Select(). previousLevel is 0 for objects that were not drawn last frame.
+		*/
+		uint32_t Add(const NuMath::Sphere& worldBounds, const LodMesh& mesh, uint32_t previousLevel = 0);
+
+		void Select();
+
+		[[nodiscard]] std::span<const uint8_t> GetLevels() const noexcept { return m_Levels; }
+
+		/*
+		* @brief Radius of each object's bounding sphere on screen, in pixels.
+		*/
+		[[nodiscard]] std::span<const float> GetScreenRadii() const noexcept { return { m_ScreenRadius.data(), m_Meshes.size() }; }
+
+		[[nodiscard]] const LodSelectionStats& GetStats() const noexcept { return m_Stats; }
+
+	private:
+		using Backend = NuMath::Simd::BatchBackend;
+
+		float m_PixelError;
+		float m_Hysteresis;
+
+		NuMath::Vector3 m_CameraPosition;
+		float m_ProjectionScale = 1.0f;     // Pixels per unit at distance 1
+
+		// Bounding spheres, structure of arrays and padded to a whole SIMD pack by Select()
+		AlignedVector<float, 32> m_CenterX, m_CenterY, m_CenterZ, m_Radius;
+		AlignedVector<float, 32> m_ScreenRadius;
+
+		std::vector<const LodMesh*> m_Meshes;
+		std::vector<uint8_t> m_Levels;
+		LodSelectionStats m_Stats;
+	};
+}
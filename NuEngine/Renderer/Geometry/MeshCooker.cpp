@@ -0,0 +1,226 @@
+#include <Renderer/Geometry/MeshCooker.hpp>
+#include <Renderer/Geometry/MeshOptimizer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace NuEngine::Renderer
+{
+	using Graphics::GraphicsError;
+	using Graphics::GraphicsErrorCode;
+
+	namespace
+	{
+		template<typename T>
+		void Append(std::vector<std::byte>& out, const T& value)
+		{
+			const size_t size = out.size();
+			out.resize(size + sizeof(T));
+			std::memcpy(out.data() + size, &value, sizeof(T));
+		}
+
+		void AppendDirection(std::vector<std::byte>& out, const float* direction, float w)
+		{
+			const float length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+			const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+			Append(out, NuMesh::QuantizeSnorm8(direction[0] * scale));
+			Append(out, NuMesh::QuantizeSnorm8(direction[1] * scale));
+			Append(out, NuMesh::QuantizeSnorm8(direction[2] * scale));
+			Append(out, NuMesh::QuantizeSnorm8(w));
+		}
+	}
+
+	CookedMesh MeshCooker::Cook(std::span<const float> vertices, std::span<const uint32_t> indices, const MeshCookOptions& options)
+	{
+		const MeshSourceLayout& layout = options.Layout;
+		const uint32_t stride = layout.Stride;
+		const uint32_t sourceVertexCount = stride >= 3 ? static_cast<uint32_t>(vertices.size() / stride) : 0;
+
+		CookedMesh cooked;
+		if (sourceVertexCount == 0 || indices.size() < 3)
+		{
+			return cooked;
+		}
+
+		MeshLodChain chain;
+		if (options.GenerateLods)
+		{
+			chain = MeshSimplifier::BuildLodChain(vertices, stride, indices, options.Lod);
+		}
+		else
+		{
+			const size_t indexCount = indices.size() / 3 * 3;
+			chain.Indices.assign(indices.begin(), indices.begin() + indexCount);
+			chain.Levels.push_back(MeshLodLevel{ 0, static_cast<uint32_t>(indexCount), 0.0f });
+			chain.Bounds = MeshSimplifier::ComputeBounds(vertices, stride);
+		}
+
+		for (const MeshLodLevel& level : chain.Levels)
+		{
+			const std::span<uint32_t> levelIndices(chain.Indices.data() + level.FirstIndex, level.IndexCount);
+			MeshOptimizer::OptimizeVertexCache(levelIndices, sourceVertexCount);
+			MeshOptimizer::OptimizeOverdraw(levelIndices, vertices, stride, options.OverdrawThreshold);
+		}
+
+		// Every level indexes a subset of level 0's vertices, so ordering by first use over the
+		// concatenated buffers follows level 0 and keeps the vertices the coarse levels share with it
+		const std::vector<uint32_t> order = MeshOptimizer::OptimizeVertexFetch(chain.Indices, sourceVertexCount);
+		const std::vector<float> ordered = MeshOptimizer::RemapVertices(vertices, stride, order);
+		const uint32_t vertexCount = static_cast<uint32_t>(order.size());
+
+		float minimum[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		float maximum[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				minimum[axis] = std::min(minimum[axis], ordered[v * stride + axis]);
+				maximum[axis] = std::max(maximum[axis], ordered[v * stride + axis]);
+			}
+		}
+
+		float offset[3];
+		float scale[3];
+		float inverseScale[3];
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			offset[axis] = (minimum[axis] + maximum[axis]) * 0.5f;
+			scale[axis] = (maximum[axis] - minimum[axis]) * 0.5f;
+			// A flat axis has nothing to quantize: every vertex sits on the offset
+			inverseScale[axis] = scale[axis] > 0.0f ? 1.0f / scale[axis] : 0.0f;
+		}
+
+		cooked.Flags = (layout.TexCoordOffset >= 0 ? NuMesh::k_FlagTexCoords : 0)
+			| (layout.NormalOffset >= 0 ? NuMesh::k_FlagNormals : 0)
+			| (layout.TangentOffset >= 0 ? NuMesh::k_FlagTangents : 0);
+		cooked.VertexCount = vertexCount;
+		cooked.VertexStride = NuMesh::GetVertexStride(cooked.Flags);
+		cooked.PositionOffset = NuMath::Vector3(offset[0], offset[1], offset[2]);
+		cooked.PositionScale = NuMath::Vector3(scale[0], scale[1], scale[2]);
+		cooked.Bounds = chain.Bounds;
+		cooked.Levels = chain.Levels;
+
+		cooked.Vertices.reserve(static_cast<size_t>(vertexCount) * cooked.VertexStride);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			const float* vertex = ordered.data() + static_cast<size_t>(v) * stride;
+
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				Append(cooked.Vertices, NuMesh::QuantizeSnorm16((vertex[axis] - offset[axis]) * inverseScale[axis]));
+			}
+			Append(cooked.Vertices, int16_t{ 32767 });
+
+			if (layout.TexCoordOffset >= 0)
+			{
+				Append(cooked.Vertices, NuMesh::FloatToHalf(vertex[layout.TexCoordOffset]));
+				Append(cooked.Vertices, NuMesh::FloatToHalf(vertex[layout.TexCoordOffset + 1]));
+			}
+			if (layout.NormalOffset >= 0)
+			{
+				AppendDirection(cooked.Vertices, vertex + layout.NormalOffset, 0.0f);
+			}
+			if (layout.TangentOffset >= 0)
+			{
+				AppendDirection(cooked.Vertices, vertex + layout.TangentOffset, vertex[layout.TangentOffset + 3] < 0.0f ? -1.0f : 1.0f);
+			}
+		}
+
+		// 16-bit indices address up to 65536 vertices and halve the index fetch
+		cooked.IndexFormat = vertexCount <= 65536 ? Graphics::IndexFormat::UInt16 : Graphics::IndexFormat::UInt32;
+		cooked.Indices.reserve(chain.Indices.size() * Graphics::IndexFormatSize(cooked.IndexFormat));
+		for (const uint32_t index : chain.Indices)
+		{
+			if (cooked.IndexFormat == Graphics::IndexFormat::UInt16)
+			{
+				Append(cooked.Indices, static_cast<uint16_t>(index));
+			}
+			else
+			{
+				Append(cooked.Indices, index);
+			}
+		}
+
+		return cooked;
+	}
+
+	Core::Result<void, GraphicsError> MeshCooker::Save(const CookedMesh& mesh, const std::filesystem::path& destination)
+	{
+		const uint32_t levelCount = static_cast<uint32_t>(mesh.Levels.size());
+		if (levelCount == 0 || mesh.VertexCount == 0 || mesh.Indices.empty())
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::InvalidParameter, "Nothing to save to " + destination.string()));
+		}
+
+		const auto align = [](uint64_t offset) { return (offset + NuMesh::k_DataAlignment - 1) & ~uint64_t{ NuMesh::k_DataAlignment - 1 }; };
+
+		NuMesh::Header header{};
+		header.Magic = NuMesh::k_Magic;
+		header.Version = NuMesh::k_Version;
+		header.Flags = mesh.Flags;
+		header.IndexFormat = mesh.IndexFormat;
+		header.VertexCount = mesh.VertexCount;
+		header.VertexStride = mesh.VertexStride;
+		header.IndexCount = static_cast<uint32_t>(mesh.Indices.size() / Graphics::IndexFormatSize(mesh.IndexFormat));
+		header.LevelCount = levelCount;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			header.PositionOffset[axis] = mesh.PositionOffset[axis];
+			header.PositionScale[axis] = mesh.PositionScale[axis];
+			header.BoundsCenter[axis] = mesh.Bounds.Center[axis];
+		}
+		header.BoundsRadius = mesh.Bounds.Radius;
+		header.VertexDataOffset = align(sizeof(NuMesh::Header) + sizeof(NuMesh::Level) * levelCount);
+		header.IndexDataOffset = align(header.VertexDataOffset + mesh.Vertices.size());
+
+		std::vector<NuMesh::Level> levels(levelCount);
+		for (uint32_t i = 0; i < levelCount; ++i)
+		{
+			levels[i] = NuMesh::Level{ mesh.Levels[i].FirstIndex, mesh.Levels[i].IndexCount, mesh.Levels[i].Error, 0 };
+		}
+
+		std::error_code error;
+		if (destination.has_parent_path())
+		{
+			std::filesystem::create_directories(destination.parent_path(), error);
+		}
+
+		// Written beside the target and renamed, so a crash never leaves a half-written .numesh behind
+		std::filesystem::path temporary = destination;
+		temporary += ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+			if (!file)
+			{
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Cannot write " + temporary.string()));
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(levels.data()), static_cast<std::streamsize>(sizeof(NuMesh::Level) * levelCount));
+
+			const char zeros[NuMesh::k_DataAlignment] = {};
+			file.write(zeros, static_cast<std::streamsize>(header.VertexDataOffset - static_cast<uint64_t>(file.tellp())));
+			file.write(reinterpret_cast<const char*>(mesh.Vertices.data()), static_cast<std::streamsize>(mesh.Vertices.size()));
+			file.write(zeros, static_cast<std::streamsize>(header.IndexDataOffset - static_cast<uint64_t>(file.tellp())));
+			file.write(reinterpret_cast<const char*>(mesh.Indices.data()), static_cast<std::streamsize>(mesh.Indices.size()));
+
+			if (!file)
+			{
+				file.close();
+				std::filesystem::remove(temporary, error);
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Failed writing " + temporary.string()));
+			}
+		}
+
+		std::filesystem::rename(temporary, destination, error);
+		if (error)
+		{
+			std::filesystem::remove(temporary, error);
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceCreationFailed, "Cannot replace " + destination.string()));
+		}
+		return Core::Ok();
+	}
+}
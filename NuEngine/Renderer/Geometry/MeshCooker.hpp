@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Renderer/Geometry/NuMeshFile.hpp>
+#include <Renderer/Geometry/MeshSimplifier.hpp>
+#include <Core/Types/Result.hpp>
+#include <Graphics/Abstractions/Buffers/IIndexBuffer.hpp>
+#include <Graphics/Errors/GraphicsError.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Where the attributes sit in the interleaved float vertices handed to MeshCooker::Cook().
+	*
+	* Offsets are in floats; -1 marks an attribute the source does not have.
+	*/
+	struct MeshSourceLayout
+	{
+		uint32_t Stride = 3;            // Floats per vertex, the position in the first three
+		int32_t TexCoordOffset = -1;
+		int32_t NormalOffset = -1;
+		int32_t TangentOffset = -1;     // xyz and the bitangent sign in w
+	};
+
+	struct MeshCookOptions
+	{
+		MeshSourceLayout Layout;
+		bool GenerateLods = true;
+		LodChainOptions Lod;
+		float OverdrawThreshold = 1.05f;    // Cache efficiency the overdraw reorder may give up, see MeshOptimizer
+	};
+
+	/*
+	* @brief Output of MeshCooker::Cook(), already in the .numesh encoding.
+	*/
+	struct CookedMesh
+	{
+		uint32_t Flags = 0;
+		uint32_t VertexCount = 0;
+		uint32_t VertexStride = 0;
+		Graphics::IndexFormat IndexFormat = Graphics::IndexFormat::UInt32;
+		std::vector<std::byte> Vertices;
+		std::vector<std::byte> Indices;
+		std::vector<MeshLodLevel> Levels;
+		NuMath::Vector3 PositionOffset;
+		NuMath::Vector3 PositionScale;
+		NuMath::Sphere Bounds;
+	};
+
+	/*
+	* @brief Offline conversion of indexed meshes into .numesh files.
+	*
+	* Builds the LOD chain on the full-precision vertices, orders each level's triangles for the
+	* vertex cache and then for overdraw, stores the vertices in the order level 0 first uses them
+	* (dropping any no level references) and finally quantizes: positions to snorm16 within the
+	* bounding box, normals and tangents to snorm8, UVs to halves. Indices are 16-bit whenever the
+	* vertex count allows.
+	*/
+	class NU_API MeshCooker
+	{
+	public:
+		[[nodiscard]] static CookedMesh Cook(std::span<const float> vertices, std::span<const uint32_t> indices, const MeshCookOptions& options);
+
+		[[nodiscard]] static Core::Result<void, Graphics::GraphicsError> Save(const CookedMesh& mesh, const std::filesystem::path& destination);
+	};
+}
@@ -0,0 +1,415 @@
+#include <Renderer/Geometry/MeshOptimizer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		// Forsyth's constants, tuned against real hardware caches of 16 to 32 entries
+		constexpr uint32_t k_ScoreCacheSize = 32;
+		constexpr float k_CacheDecayPower = 1.5f;
+		constexpr float k_LastTriangleScore = 0.75f;
+		constexpr float k_ValenceBoostScale = 2.0f;
+		constexpr float k_ValenceBoostPower = 0.5f;
+		constexpr uint32_t k_ValenceTableSize = 32;
+
+		// FIFO cache used to measure an order, the model of older and mobile GPUs
+		constexpr uint32_t k_SimulatedCacheSize = 16;
+
+		struct ScoreTables
+		{
+			std::array<float, k_ScoreCacheSize + 1> Cache{};        // Indexed by position + 1, so -1 (not cached) is entry 0
+			std::array<float, k_ValenceTableSize> Valence{};
+
+			ScoreTables()
+			{
+				for (uint32_t position = 0; position < k_ScoreCacheSize; ++position)
+				{
+					// The three vertices of the triangle just emitted share a fixed score, so the
+					// next triangle is not biased towards one particular edge of the last one
+					Cache[position + 1] = position < 3
+						? k_LastTriangleScore
+						: std::pow(1.0f - static_cast<float>(position - 3) / (k_ScoreCacheSize - 3), k_CacheDecayPower);
+				}
+				for (uint32_t valence = 1; valence < k_ValenceTableSize; ++valence)
+				{
+					Valence[valence] = k_ValenceBoostScale * std::pow(static_cast<float>(valence), -k_ValenceBoostPower);
+				}
+			}
+		};
+
+		float VertexScore(const ScoreTables& tables, int32_t cachePosition, uint32_t remaining) noexcept
+		{
+			if (remaining == 0)
+			{
+				return -1.0f;
+			}
+
+			const float valence = remaining < k_ValenceTableSize
+				? tables.Valence[remaining]
+				: k_ValenceBoostScale * std::pow(static_cast<float>(remaining), -k_ValenceBoostPower);
+			return tables.Cache[cachePosition + 1] + valence;
+		}
+
+		/*
+		* @brief FIFO post-transform cache simulated with timestamps: a vertex is cached while
+		* fewer than Size misses have happened since it was loaded.
+		*/
+		class FifoCache
+		{
+		public:
+			FifoCache(uint32_t vertexCount, uint32_t size)
+				: m_Size(size), m_Time(size + 1), m_Stamps(vertexCount, 0)
+			{
+			}
+
+			// Returns 1 on a miss
+			uint32_t Touch(uint32_t vertex) noexcept
+			{
+				if (m_Time - m_Stamps[vertex] > m_Size)
+				{
+					m_Stamps[vertex] = m_Time++;
+					return 1;
+				}
+				return 0;
+			}
+
+			// Everything loaded so far counts as evicted
+			void Reset() noexcept { m_Time += m_Size + 1; }
+
+		private:
+			uint32_t m_Size;
+			uint32_t m_Time;
+			std::vector<uint32_t> m_Stamps;
+		};
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(std::span<uint32_t> indices, uint32_t vertexCount)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		static const ScoreTables tables;
+
+		// Triangles of each vertex; the first Remaining[v] entries are the ones not emitted yet
+		std::vector<uint32_t> remaining(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+		{
+			remaining[indices[i]]++;
+		}
+
+		std::vector<uint32_t> offsets(vertexCount + 1, 0);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			offsets[v + 1] = offsets[v] + remaining[v];
+		}
+
+		std::vector<uint32_t> vertexTriangles(triangleCount * 3);
+		{
+			std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+			for (size_t i = 0; i < triangleCount * 3; ++i)
+			{
+				vertexTriangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+
+		std::vector<int32_t> cachePosition(vertexCount, -1);
+		std::vector<float> vertexScore(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			vertexScore[v] = VertexScore(tables, -1, remaining[v]);
+		}
+
+		std::vector<float> triangleScore(triangleCount);
+		for (size_t t = 0; t < triangleCount; ++t)
+		{
+			triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+		}
+
+		std::vector<uint8_t> emitted(triangleCount, 0);
+		std::vector<uint32_t> output(triangleCount * 3);
+
+		// One buffer for the cache before and after each step: the emitted triangle's vertices go
+		// in front and the old entries follow, so up to three fall off the end
+		std::array<uint32_t, k_ScoreCacheSize + 3> cache{};
+		std::array<uint32_t, k_ScoreCacheSize + 3> nextCache{};
+		uint32_t cacheCount = 0;
+
+		size_t best = std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin();
+		size_t scanCursor = 0;
+
+		for (size_t written = 0; written < triangleCount; ++written)
+		{
+			if (best == triangleCount)
+			{
+				// Nothing in the cache has work left: continue with the next triangle in input order
+				while (emitted[scanCursor])
+				{
+					++scanCursor;
+				}
+				best = scanCursor;
+			}
+
+			const uint32_t* triangle = &indices[best * 3];
+			emitted[best] = 1;
+			std::copy(triangle, triangle + 3, &output[written * 3]);
+
+			uint32_t nextCount = 0;
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = triangle[k];
+
+				const uint32_t begin = offsets[v];
+				const uint32_t end = begin + remaining[v];
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					if (vertexTriangles[i] == best)
+					{
+						std::swap(vertexTriangles[i], vertexTriangles[end - 1]);
+						break;
+					}
+				}
+				remaining[v]--;
+
+				// Degenerate triangles name a vertex twice; it still takes one cache entry
+				if (std::find(nextCache.begin(), nextCache.begin() + nextCount, v) == nextCache.begin() + nextCount)
+				{
+					nextCache[nextCount++] = v;
+				}
+			}
+
+			for (uint32_t i = 0; i < cacheCount; ++i)
+			{
+				const uint32_t v = cache[i];
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+				{
+					nextCache[nextCount++] = v;
+				}
+			}
+
+			// Rescore everything whose position changed, including what just fell out
+			for (uint32_t i = 0; i < nextCount; ++i)
+			{
+				const uint32_t v = nextCache[i];
+				cachePosition[v] = i < k_ScoreCacheSize ? static_cast<int32_t>(i) : -1;
+
+				const float score = VertexScore(tables, cachePosition[v], remaining[v]);
+				const float delta = score - vertexScore[v];
+				vertexScore[v] = score;
+
+				for (uint32_t j = offsets[v]; j < offsets[v] + remaining[v]; ++j)
+				{
+					triangleScore[vertexTriangles[j]] += delta;
+				}
+			}
+
+			cacheCount = std::min(nextCount, k_ScoreCacheSize);
+			std::copy(nextCache.begin(), nextCache.begin() + cacheCount, cache.begin());
+
+			// Only triangles touching the cache can have gained, so the next one is picked from those
+			best = triangleCount;
+			float bestScore = -1.0f;
+			for (uint32_t i = 0; i < cacheCount; ++i)
+			{
+				const uint32_t v = cache[i];
+				for (uint32_t j = offsets[v]; j < offsets[v] + remaining[v]; ++j)
+				{
+					const uint32_t t = vertexTriangles[j];
+					if (triangleScore[t] > bestScore)
+					{
+						bestScore = triangleScore[t];
+						best = t;
+					}
+				}
+			}
+		}
+
+		std::copy(output.begin(), output.end(), indices.begin());
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(std::span<uint32_t> indices, std::span<const float> vertices, uint32_t stride, float threshold)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		const uint32_t vertexCount = stride > 0 ? static_cast<uint32_t>(vertices.size() / stride) : 0;
+		if (triangleCount < 2 || vertexCount == 0)
+		{
+			return;
+		}
+
+		// Hard boundaries: triangles the cache order starts from scratch, with all three vertices missing
+		std::vector<uint32_t> hardBoundaries;
+		{
+			FifoCache cache(vertexCount, k_SimulatedCacheSize);
+			for (size_t t = 0; t < triangleCount; ++t)
+			{
+				const uint32_t misses = cache.Touch(indices[t * 3]) + cache.Touch(indices[t * 3 + 1]) + cache.Touch(indices[t * 3 + 2]);
+				if (misses == 3 || t == 0)
+				{
+					hardBoundaries.push_back(static_cast<uint32_t>(t));
+				}
+			}
+			hardBoundaries.push_back(static_cast<uint32_t>(triangleCount));
+		}
+
+		// Soft boundaries: within each hard cluster, cut as soon as the part so far is nearly as cache
+		// efficient as the whole cluster, restarting the cache as drawing it elsewhere would
+		std::vector<uint32_t> clusters;
+		for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h)
+		{
+			const uint32_t begin = hardBoundaries[h];
+			const uint32_t end = hardBoundaries[h + 1];
+
+			FifoCache cache(vertexCount, k_SimulatedCacheSize);
+			uint32_t clusterMisses = 0;
+			for (uint32_t t = begin; t < end; ++t)
+			{
+				clusterMisses += cache.Touch(indices[t * 3]) + cache.Touch(indices[t * 3 + 1]) + cache.Touch(indices[t * 3 + 2]);
+			}
+			const float clusterACMR = static_cast<float>(clusterMisses) / (end - begin);
+
+			cache.Reset();
+			clusters.push_back(begin);
+			uint32_t misses = 0;
+			for (uint32_t t = begin; t < end; ++t)
+			{
+				misses += cache.Touch(indices[t * 3]) + cache.Touch(indices[t * 3 + 1]) + cache.Touch(indices[t * 3 + 2]);
+
+				const uint32_t start = clusters.back();
+				if (t + 1 < end && static_cast<float>(misses) / (t + 1 - start) <= threshold * clusterACMR)
+				{
+					clusters.push_back(t + 1);
+					misses = 0;
+					cache.Reset();
+				}
+			}
+		}
+		clusters.push_back(static_cast<uint32_t>(triangleCount));
+
+		const auto position = [&](uint32_t v)
+		{
+			const float* p = vertices.data() + static_cast<size_t>(v) * stride;
+			return std::array<double, 3>{ p[0], p[1], p[2] };
+		};
+
+		// Area-weighted centroid and summed (area-scaled) normal of every cluster
+		const size_t clusterCount = clusters.size() - 1;
+		std::vector<std::array<double, 3>> centroids(clusterCount, { 0.0, 0.0, 0.0 });
+		std::vector<std::array<double, 3>> normals(clusterCount, { 0.0, 0.0, 0.0 });
+		std::array<double, 3> meshCentroid{ 0.0, 0.0, 0.0 };
+		double meshArea = 0.0;
+
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			double clusterArea = 0.0;
+			for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t)
+			{
+				const auto a = position(indices[t * 3]);
+				const auto b = position(indices[t * 3 + 1]);
+				const auto d = position(indices[t * 3 + 2]);
+
+				const double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+				const double e2[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+				const double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				const double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					centroids[c][axis] += (a[axis] + b[axis] + d[axis]) * area;
+					normals[c][axis] += n[axis];
+					meshCentroid[axis] += (a[axis] + b[axis] + d[axis]) * area;
+				}
+				clusterArea += area;
+			}
+
+			meshArea += clusterArea;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				centroids[c][axis] = clusterArea > 0.0 ? centroids[c][axis] / (clusterArea * 3.0) : 0.0;
+			}
+		}
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			meshCentroid[axis] = meshArea > 0.0 ? meshCentroid[axis] / (meshArea * 3.0) : 0.0;
+		}
+
+		std::vector<float> keys(clusterCount);
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			const auto& n = normals[c];
+			const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			double dot = 0.0;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				dot += (centroids[c][axis] - meshCentroid[axis]) * n[axis];
+			}
+			keys[c] = length > 0.0 ? static_cast<float>(dot / length) : 0.0f;
+		}
+
+		std::vector<uint32_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), 0u);
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+		std::vector<uint32_t> output;
+		output.reserve(triangleCount * 3);
+		for (const uint32_t c : order)
+		{
+			output.insert(output.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+		}
+		std::copy(output.begin(), output.end(), indices.begin());
+	}
+
+	std::vector<uint32_t> MeshOptimizer::OptimizeVertexFetch(std::span<uint32_t> indices, uint32_t vertexCount)
+	{
+		constexpr uint32_t k_Unused = ~0u;
+
+		std::vector<uint32_t> remap(vertexCount, k_Unused);
+		std::vector<uint32_t> order;
+		order.reserve(vertexCount);
+
+		for (uint32_t& index : indices)
+		{
+			if (remap[index] == k_Unused)
+			{
+				remap[index] = static_cast<uint32_t>(order.size());
+				order.push_back(index);
+			}
+			index = remap[index];
+		}
+
+		return order;
+	}
+
+	std::vector<float> MeshOptimizer::RemapVertices(std::span<const float> vertices, uint32_t stride, std::span<const uint32_t> order)
+	{
+		std::vector<float> result(order.size() * stride);
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			std::copy_n(vertices.data() + static_cast<size_t>(order[i]) * stride, stride, result.data() + i * stride);
+		}
+		return result;
+	}
+
+	float MeshOptimizer::ComputeACMR(std::span<const uint32_t> indices, uint32_t vertexCount, uint32_t cacheSize)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return 0.0f;
+		}
+
+		FifoCache cache(vertexCount, cacheSize);
+		uint64_t misses = 0;
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+		{
+			misses += cache.Touch(indices[i]);
+		}
+		return static_cast<float>(misses) / static_cast<float>(triangleCount);
+	}
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Offline reordering of indexed triangle lists for the GPU's vertex pipeline.
+	*
+	* The usual order is OptimizeVertexCache(), then OptimizeOverdraw() on the result, then
+	* OptimizeVertexFetch() once over every index buffer that shares the vertices. None of them
+	* changes what is drawn, only the order in which triangles and vertices are stored.
+	*/
+	class NU_API MeshOptimizer
+	{
+	public:
+		/*
+		* @brief Reorders triangles for the post-transform vertex cache (Tom Forsyth's linear-speed algorithm).
+		*
+		* Greedily emits the triangle whose vertices score best, where a vertex scores for being
+		* recent in a simulated LRU cache and for having few triangles left, so fans are finished
+		* before the cache moves on.
+		*/
+		static void OptimizeVertexCache(std::span<uint32_t> indices, uint32_t vertexCount);
+
+		/*
+		* @brief Reorders clusters of cache-ordered triangles so outward-facing ones are drawn first.
+		*
+		* The cache order is cut into clusters wherever the simulated cache starts over, and further
+		* wherever a cluster's miss rate stays within threshold times the mesh's, so the reorder costs
+		* at most that much cache efficiency. Clusters are then sorted by how far they face away from
+		* the mesh's centre; those tend to occlude the rest from most views and let early depth
+		* testing reject it.
+		* @param vertices Interleaved floats with the position in the first three.
+		*/
+		static void OptimizeOverdraw(std::span<uint32_t> indices, std::span<const float> vertices, uint32_t stride, float threshold = 1.05f);
+
+		/*
+		* @brief Stores vertices in the order indices first use them and drops the unused ones.
+		*
+		* Rewrites indices in place and returns the old index of every vertex that was kept, in its
+		* new order; apply it to each attribute stream with RemapVertices().
+		*/
+		[[nodiscard]] static std::vector<uint32_t> OptimizeVertexFetch(std::span<uint32_t> indices, uint32_t vertexCount);
+
+		/*
+		* @brief Gathers vertices of stride floats into the order returned by OptimizeVertexFetch().
+		*/
+		[[nodiscard]] static std::vector<float> RemapVertices(std::span<const float> vertices, uint32_t stride, std::span<const uint32_t> order);
+
+		/*
+		* @brief Average cache misses per triangle through a FIFO cache of cacheSize entries.
+		*
+		* 3 means no reuse at all; a regular grid can get close to 0.5.
+		*/
+		[[nodiscard]] static float ComputeACMR(std::span<const uint32_t> indices, uint32_t vertexCount, uint32_t cacheSize = 16);
+	};
+}
@@ -0,0 +1,360 @@
+#include <Renderer/Geometry/MeshSimplifier.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		struct Position
+		{
+			double X, Y, Z;
+		};
+
+		/*
+		* @brief Sum of squared distances to a set of area-weighted planes, as a symmetric 4x4 matrix.
+		*/
+		struct Quadric
+		{
+			double XX = 0.0, XY = 0.0, XZ = 0.0, YY = 0.0, YZ = 0.0, ZZ = 0.0;
+			double DX = 0.0, DY = 0.0, DZ = 0.0, DD = 0.0;
+			double Weight = 0.0;
+
+			void AddPlane(double nx, double ny, double nz, double d, double weight)
+			{
+				XX += weight * nx * nx; XY += weight * nx * ny; XZ += weight * nx * nz;
+				YY += weight * ny * ny; YZ += weight * ny * nz; ZZ += weight * nz * nz;
+				DX += weight * nx * d; DY += weight * ny * d; DZ += weight * nz * d;
+				DD += weight * d * d;
+				Weight += weight;
+			}
+
+			Quadric& operator+=(const Quadric& other)
+			{
+				XX += other.XX; XY += other.XY; XZ += other.XZ;
+				YY += other.YY; YZ += other.YZ; ZZ += other.ZZ;
+				DX += other.DX; DY += other.DY; DZ += other.DZ;
+				DD += other.DD;
+				Weight += other.Weight;
+				return *this;
+			}
+
+			[[nodiscard]] double Evaluate(const Position& p) const
+			{
+				return XX * p.X * p.X + YY * p.Y * p.Y + ZZ * p.Z * p.Z
+					+ 2.0 * (XY * p.X * p.Y + XZ * p.X * p.Z + YZ * p.Y * p.Z)
+					+ 2.0 * (DX * p.X + DY * p.Y + DZ * p.Z)
+					+ DD;
+			}
+		};
+
+		struct Collapse
+		{
+			uint32_t From;
+			uint32_t To;
+			double Error;       // Mean squared distance to the planes of both vertices
+		};
+
+		Position Normal(const Position& a, const Position& b, const Position& c)
+		{
+			const double ux = b.X - a.X, uy = b.Y - a.Y, uz = b.Z - a.Z;
+			const double vx = c.X - a.X, vy = c.Y - a.Y, vz = c.Z - a.Z;
+			return { uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx };
+		}
+
+		double Dot(const Position& a, const Position& b)
+		{
+			return a.X * b.X + a.Y * b.Y + a.Z * b.Z;
+		}
+
+		double CollapseError(const Quadric& from, const Quadric& to, const Position& target)
+		{
+			Quadric combined = from;
+			combined += to;
+			const double weight = combined.Weight > 0.0 ? combined.Weight : 1.0;
+			return std::max(0.0, combined.Evaluate(target)) / weight;
+		}
+
+		uint64_t EdgeKey(uint32_t a, uint32_t b)
+		{
+			return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+		}
+	}
+
+	std::vector<uint32_t> MeshSimplifier::Simplify(std::span<const float> vertices, uint32_t stride,
+		std::span<const uint32_t> indices, size_t targetIndexCount, float maxError, float* resultError)
+	{
+		const size_t vertexCount = stride >= 3 ? vertices.size() / stride : 0;
+		std::vector<uint32_t> result(indices.begin(), indices.begin() + (indices.size() / 3) * 3);
+		if (resultError)
+		{
+			*resultError = 0.0f;
+		}
+		if (vertexCount == 0 || result.size() <= targetIndexCount)
+		{
+			return result;
+		}
+
+		std::vector<Position> positions(vertexCount);
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			const float* p = vertices.data() + i * stride;
+			positions[i] = { p[0], p[1], p[2] };
+		}
+
+		// Edges not shared by exactly two triangles are borders, seams or non-manifold: pin their vertices
+		std::unordered_map<uint64_t, uint32_t> edgeUses;
+		edgeUses.reserve(result.size());
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			for (size_t e = 0; e < 3; ++e)
+			{
+				++edgeUses[EdgeKey(result[i + e], result[i + (e + 1) % 3])];
+			}
+		}
+
+		std::vector<uint8_t> locked(vertexCount, 0);
+		for (const auto& [key, uses] : edgeUses)
+		{
+			if (uses != 2)
+			{
+				locked[static_cast<uint32_t>(key >> 32)] = 1;
+				locked[static_cast<uint32_t>(key)] = 1;
+			}
+		}
+
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			const Position& p0 = positions[result[i]];
+			const Position normal = Normal(p0, positions[result[i + 1]], positions[result[i + 2]]);
+			const double length = std::sqrt(Dot(normal, normal));
+			if (length <= 0.0)
+			{
+				continue;
+			}
+
+			const double nx = normal.X / length, ny = normal.Y / length, nz = normal.Z / length;
+			const double d = -(nx * p0.X + ny * p0.Y + nz * p0.Z);
+			for (size_t k = 0; k < 3; ++k)
+			{
+				quadrics[result[i + k]].AddPlane(nx, ny, nz, d, length * 0.5);
+			}
+		}
+
+		const double maxErrorSquared = static_cast<double>(maxError) * maxError;
+		const size_t targetTriangles = targetIndexCount / 3;
+		double appliedError = 0.0;
+
+		std::vector<uint32_t> remap(vertexCount);
+		std::vector<uint8_t> touched(vertexCount);
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+		std::vector<uint32_t> adjacency;
+		std::vector<Collapse> collapses;
+
+		// Each pass applies the cheapest collapses that do not share a neighbourhood, then rebuilds
+		while (result.size() / 3 > targetTriangles)
+		{
+			const size_t triangleCount = result.size() / 3;
+
+			std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0u);
+			for (const uint32_t index : result)
+			{
+				++adjacencyOffsets[index + 1];
+			}
+			for (size_t v = 0; v < vertexCount; ++v)
+			{
+				adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+			}
+			adjacency.resize(result.size());
+			{
+				std::vector<uint32_t> cursors(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+				for (size_t i = 0; i < result.size(); ++i)
+				{
+					adjacency[cursors[result[i]]++] = static_cast<uint32_t>(i / 3);
+				}
+			}
+
+			collapses.clear();
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (size_t e = 0; e < 3; ++e)
+				{
+					const uint32_t a = result[i + e];
+					const uint32_t b = result[i + (e + 1) % 3];
+					if (!locked[a])
+					{
+						collapses.push_back({ a, b, CollapseError(quadrics[a], quadrics[b], positions[b]) });
+					}
+					if (!locked[b])
+					{
+						collapses.push_back({ b, a, CollapseError(quadrics[b], quadrics[a], positions[a]) });
+					}
+				}
+			}
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.Error < b.Error; });
+
+			for (size_t v = 0; v < vertexCount; ++v)
+			{
+				remap[v] = static_cast<uint32_t>(v);
+			}
+			std::fill(touched.begin(), touched.end(), 0);
+
+			const size_t trianglesToRemove = triangleCount - targetTriangles;
+			size_t removed = 0;
+			size_t applied = 0;
+
+			for (const Collapse& collapse : collapses)
+			{
+				if (collapse.Error > maxErrorSquared || removed >= trianglesToRemove)
+				{
+					break;
+				}
+				if (touched[collapse.From] || touched[collapse.To])
+				{
+					continue;
+				}
+
+				// Triangles on the edge disappear; the others must not flip or collapse to a line
+				bool valid = true;
+				size_t removes = 0;
+				for (uint32_t a = adjacencyOffsets[collapse.From]; a < adjacencyOffsets[collapse.From + 1] && valid; ++a)
+				{
+					const uint32_t* triangle = &result[adjacency[a] * 3];
+					if (triangle[0] == collapse.To || triangle[1] == collapse.To || triangle[2] == collapse.To)
+					{
+						++removes;
+						continue;
+					}
+
+					Position moved[3];
+					for (size_t k = 0; k < 3; ++k)
+					{
+						moved[k] = positions[triangle[k] == collapse.From ? collapse.To : triangle[k]];
+					}
+
+					const Position before = Normal(positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]);
+					const Position after = Normal(moved[0], moved[1], moved[2]);
+					valid = Dot(before, after) > 0.0;
+				}
+
+				if (!valid || removes == 0)
+				{
+					continue;
+				}
+
+				remap[collapse.From] = collapse.To;
+				quadrics[collapse.To] += quadrics[collapse.From];
+
+				touched[collapse.To] = 1;
+				for (uint32_t a = adjacencyOffsets[collapse.From]; a < adjacencyOffsets[collapse.From + 1]; ++a)
+				{
+					const uint32_t* triangle = &result[adjacency[a] * 3];
+					touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = 1;
+				}
+
+				removed += removes;
+				appliedError = std::max(appliedError, collapse.Error);
+				++applied;
+			}
+
+			if (applied == 0)
+			{
+				break;
+			}
+
+			size_t write = 0;
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				const uint32_t a = remap[result[i]];
+				const uint32_t b = remap[result[i + 1]];
+				const uint32_t c = remap[result[i + 2]];
+				if (a != b && b != c && a != c)
+				{
+					result[write++] = a;
+					result[write++] = b;
+					result[write++] = c;
+				}
+			}
+			result.resize(write);
+		}
+
+		if (resultError)
+		{
+			*resultError = static_cast<float>(std::sqrt(appliedError));
+		}
+		return result;
+	}
+
+	MeshLodChain MeshSimplifier::BuildLodChain(std::span<const float> vertices, uint32_t stride,
+		std::span<const uint32_t> indices, const LodChainOptions& options)
+	{
+		MeshLodChain chain;
+		chain.Bounds = ComputeBounds(vertices, stride);
+		chain.Indices.assign(indices.begin(), indices.begin() + (indices.size() / 3) * 3);
+		chain.Levels.push_back({ 0, static_cast<uint32_t>(chain.Indices.size()), 0.0f });
+
+		const float maxError = options.MaxError * std::max(chain.Bounds.Radius, 1.0e-6f);
+		std::vector<uint32_t> current = chain.Indices;
+		float error = 0.0f;
+
+		for (uint32_t level = 1; level < options.MaxLevels; ++level)
+		{
+			const size_t target = static_cast<size_t>(static_cast<float>(current.size()) * options.Reduction) / 3 * 3;
+
+			float levelError = 0.0f;
+			std::vector<uint32_t> next = Simplify(vertices, stride, current, target, maxError, &levelError);
+			if (next.empty() || next.size() * 10 > current.size() * 9)
+			{
+				break;
+			}
+
+			// Each level is simplified from the last, so their errors add up
+			error += levelError;
+			chain.Levels.push_back({ static_cast<uint32_t>(chain.Indices.size()), static_cast<uint32_t>(next.size()), error });
+			chain.Indices.insert(chain.Indices.end(), next.begin(), next.end());
+			current = std::move(next);
+		}
+
+		return chain;
+	}
+
+	NuMath::Sphere MeshSimplifier::ComputeBounds(std::span<const float> vertices, uint32_t stride)
+	{
+		const size_t vertexCount = stride >= 3 ? vertices.size() / stride : 0;
+		if (vertexCount == 0)
+		{
+			return NuMath::Sphere();
+		}
+
+		float minimum[3] = { vertices[0], vertices[1], vertices[2] };
+		float maximum[3] = { vertices[0], vertices[1], vertices[2] };
+		for (size_t i = 1; i < vertexCount; ++i)
+		{
+			for (size_t k = 0; k < 3; ++k)
+			{
+				minimum[k] = std::min(minimum[k], vertices[i * stride + k]);
+				maximum[k] = std::max(maximum[k], vertices[i * stride + k]);
+			}
+		}
+
+		const float center[3] = {
+			(minimum[0] + maximum[0]) * 0.5f,
+			(minimum[1] + maximum[1]) * 0.5f,
+			(minimum[2] + maximum[2]) * 0.5f
+		};
+
+		float radiusSquared = 0.0f;
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			const float dx = vertices[i * stride] - center[0];
+			const float dy = vertices[i * stride + 1] - center[1];
+			const float dz = vertices[i * stride + 2] - center[2];
+			radiusSquared = std::max(radiusSquared, dx * dx + dy * dy + dz * dz);
+		}
+
+		return NuMath::Sphere(NuMath::Vector3(center[0], center[1], center[2]), std::sqrt(radiusSquared));
+	}
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief One level of a LOD chain: Indices[FirstIndex .. FirstIndex + IndexCount) of MeshLodChain::Indices.
+	*/
+	struct MeshLodLevel
+	{
+		uint32_t FirstIndex = 0;
+		uint32_t IndexCount = 0;
+		float Error = 0.0f;         // Deviation from level 0 in mesh units, 0 for level 0
+	};
+
+	/*
+	* @brief Index buffers for every level, all indexing the mesh's one vertex buffer.
+	*/
+	struct MeshLodChain
+	{
+		std::vector<uint32_t> Indices;
+		std::vector<MeshLodLevel> Levels;
+		NuMath::Sphere Bounds;
+	};
+
+	struct LodChainOptions
+	{
+		uint32_t MaxLevels = 5;
+		float Reduction = 0.5f;         // Target index count of each level relative to the one before
+		float MaxError = 0.05f;         // Largest error a level may add, relative to the bounding radius
+	};
+
+	/*
+	* @brief Offline quadric error metric (Garland-Heckbert) simplification of indexed triangle meshes.
+	*
+	* Vertices are interleaved floats with the position in the first three. Edges collapse onto one
+	* of their own vertices, never onto a new point, so every level keeps indexing the original
+	* vertex buffer and only the index buffer changes. Vertices on open edges, which includes UV
+	* and normal seams where a position is split into several vertices, never move, so borders and
+	* seams stay intact.
+	*/
+	class NU_API MeshSimplifier
+	{
+	public:
+		/*
+		* @brief Collapses the cheapest edges until at most targetIndexCount indices remain.
+		*
+		* Stops early when the next collapse would move the surface further than maxError.
+		* @param resultError Receives the largest error of a collapse that was applied.
+		*/
+		[[nodiscard]] static std::vector<uint32_t> Simplify(std::span<const float> vertices, uint32_t stride,
+			std::span<const uint32_t> indices, size_t targetIndexCount, float maxError, float* resultError = nullptr);
+
+		/*
+		* @brief Builds level 0 from indices and each further level from the one before it.
+		*
+		* Stops when a level would not remove at least a tenth of its predecessor's triangles.
+		*/
+		[[nodiscard]] static MeshLodChain BuildLodChain(std::span<const float> vertices, uint32_t stride,
+			std::span<const uint32_t> indices, const LodChainOptions& options = {});
+
+		/*
+		* @brief Sphere around the centre of the positions' bounding box.
+		*/
+		[[nodiscard]] static NuMath::Sphere ComputeBounds(std::span<const float> vertices, uint32_t stride);
+	};
+}
@@ -0,0 +1,153 @@
+#include <Renderer/Geometry/NuMeshFile.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace NuEngine::Renderer
+{
+	using Graphics::GraphicsError;
+	using Graphics::GraphicsErrorCode;
+
+	Core::Result<NuMeshFile, GraphicsError> NuMeshFile::Open(const std::filesystem::path& path)
+	{
+		auto mapped = Core::MappedFile::Open(path);
+		if (mapped.IsError())
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Failed to map mesh: " + path.string()));
+		}
+
+		NuMeshFile file;
+		file.m_File = std::move(mapped).Unwrap();
+
+		const std::span<const std::byte> bytes = file.m_File.GetBytes();
+		if (bytes.size() < sizeof(NuMesh::Header))
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Truncated .numesh header: " + path.string()));
+		}
+
+		NuMesh::Header& header = file.m_Header;
+		std::memcpy(&header, bytes.data(), sizeof(header));
+
+		if (header.Magic != NuMesh::k_Magic || header.Version != NuMesh::k_Version)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Not a version " + std::to_string(NuMesh::k_Version) + " .numesh file: " + path.string()));
+		}
+
+		const bool validIndexFormat = header.IndexFormat == Graphics::IndexFormat::UInt16 || header.IndexFormat == Graphics::IndexFormat::UInt32;
+		if (!validIndexFormat || header.VertexCount == 0 || header.IndexCount == 0 || header.LevelCount == 0 || header.LevelCount > 255
+			|| header.VertexStride != NuMesh::GetVertexStride(header.Flags)
+			|| (header.IndexFormat == Graphics::IndexFormat::UInt16 && header.VertexCount > 65536))
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Invalid .numesh header: " + path.string()));
+		}
+
+		const size_t tableEnd = sizeof(NuMesh::Header) + sizeof(NuMesh::Level) * header.LevelCount;
+		if (bytes.size() < tableEnd)
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Truncated .numesh level table: " + path.string()));
+		}
+
+		// The header is 88 bytes and the mapping page aligned, so the table can be used in place
+		file.m_Levels = { reinterpret_cast<const NuMesh::Level*>(bytes.data() + sizeof(NuMesh::Header)), header.LevelCount };
+
+		const uint64_t vertexBytes = static_cast<uint64_t>(header.VertexCount) * header.VertexStride;
+		const uint64_t indexBytes = static_cast<uint64_t>(header.IndexCount) * Graphics::IndexFormatSize(header.IndexFormat);
+		const auto inside = [&](uint64_t offset, uint64_t size)
+		{
+			return offset >= tableEnd && offset % NuMesh::k_DataAlignment == 0 && offset <= bytes.size() && size <= bytes.size() - offset;
+		};
+		if (!inside(header.VertexDataOffset, vertexBytes) || !inside(header.IndexDataOffset, indexBytes))
+		{
+			return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Corrupt .numesh data ranges: " + path.string()));
+		}
+
+		for (uint32_t i = 0; i < header.LevelCount; ++i)
+		{
+			const NuMesh::Level& level = file.m_Levels[i];
+			if (level.IndexCount == 0 || level.IndexCount % 3 != 0 || level.FirstIndex > header.IndexCount
+				|| level.IndexCount > header.IndexCount - level.FirstIndex)
+			{
+				return Core::Err(GraphicsError(GraphicsErrorCode::ResourceLoadFailed, "Corrupt .numesh level " + std::to_string(i) + ": " + path.string()));
+			}
+		}
+
+		return Core::Ok(std::move(file));
+	}
+
+	std::span<const std::byte> NuMeshFile::GetVertexData() const noexcept
+	{
+		return { m_File.GetData() + m_Header.VertexDataOffset, static_cast<size_t>(m_Header.VertexCount) * m_Header.VertexStride };
+	}
+
+	std::span<const std::byte> NuMeshFile::GetIndexData() const noexcept
+	{
+		return { m_File.GetData() + m_Header.IndexDataOffset, static_cast<size_t>(m_Header.IndexCount) * Graphics::IndexFormatSize(m_Header.IndexFormat) };
+	}
+
+	NuMath::Sphere NuMeshFile::GetBounds() const noexcept
+	{
+		return NuMath::Sphere(NuMath::Vector3(m_Header.BoundsCenter[0], m_Header.BoundsCenter[1], m_Header.BoundsCenter[2]), m_Header.BoundsRadius);
+	}
+
+	Graphics::BufferLayout NuMeshFile::GetLayout() const
+	{
+		using Graphics::ShaderDataType;
+
+		const Graphics::BufferElement position(ShaderDataType::Short4, "aPos", true);
+		const Graphics::BufferElement texCoord(ShaderDataType::Half2, "aTexCoord");
+		const Graphics::BufferElement normal(ShaderDataType::Byte4, "aNormal", true);
+		const Graphics::BufferElement tangent(ShaderDataType::Byte4, "aTangent", true);
+
+		const uint32_t flags = m_Header.Flags;
+		const bool hasTexCoords = (flags & NuMesh::k_FlagTexCoords) != 0;
+		const bool hasNormals = (flags & NuMesh::k_FlagNormals) != 0;
+		const bool hasTangents = (flags & NuMesh::k_FlagTangents) != 0;
+
+		// BufferLayout only takes its elements at construction, so spell out each combination the flags allow
+		if (hasTexCoords && hasNormals && hasTangents) return { position, texCoord, normal, tangent };
+		if (hasTexCoords && hasNormals) return { position, texCoord, normal };
+		if (hasTexCoords && hasTangents) return { position, texCoord, tangent };
+		if (hasNormals && hasTangents) return { position, normal, tangent };
+		if (hasTexCoords) return { position, texCoord };
+		if (hasNormals) return { position, normal };
+		if (hasTangents) return { position, tangent };
+		return { position };
+	}
+
+	NuMath::Matrix4x4 NuMeshFile::GetDequantizeTransform() const noexcept
+	{
+		const float* offset = m_Header.PositionOffset;
+		const float* scale = m_Header.PositionScale;
+		return NuMath::Matrix4x4(
+			scale[0], 0.0f, 0.0f, offset[0],
+			0.0f, scale[1], 0.0f, offset[1],
+			0.0f, 0.0f, scale[2], offset[2],
+			0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	LodMesh NuMeshFile::CreateLodMesh(Graphics::IRenderDevice& device) const
+	{
+		LodMesh mesh;
+		mesh.Bounds = GetBounds();
+
+		// The mapping is read only but the device copies, so nothing writes through the cast
+		const std::span<const std::byte> vertices = GetVertexData();
+		auto vertexBuffer = device.CreateVertexBuffer(const_cast<float*>(reinterpret_cast<const float*>(vertices.data())), static_cast<unsigned int>(vertices.size()));
+		vertexBuffer->SetLayout(GetLayout());
+
+		const std::byte* indices = GetIndexData().data();
+		const uint32_t indexSize = Graphics::IndexFormatSize(m_Header.IndexFormat);
+		const NuMath::Matrix4x4 dequantize = GetDequantizeTransform();
+		for (const NuMesh::Level& level : m_Levels)
+		{
+			auto vertexArray = device.CreateVertexArray();
+			vertexArray->AddVertexBuffer(vertexBuffer);
+			vertexArray->SetIndexBuffer(device.CreateIndexBuffer(indices + static_cast<size_t>(level.FirstIndex) * indexSize, level.IndexCount, m_Header.IndexFormat));
+
+			mesh.Levels.push_back(Mesh{ vertexArray, m_Header.VertexCount, dequantize, true });
+			mesh.LevelInfo.push_back(MeshLodLevel{ level.FirstIndex, level.IndexCount, level.Error });
+		}
+
+		return mesh;
+	}
+}
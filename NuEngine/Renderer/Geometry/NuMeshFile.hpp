@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Renderer/Geometry/LodMesh.hpp>
+#include <Core/IO/MappedFile.hpp>
+#include <Core/Types/Result.hpp>
+#include <Graphics/Abstractions/Buffers/IIndexBuffer.hpp>
+#include <Graphics/Errors/GraphicsError.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief On-disk layout of a .numesh file, all little endian.
+	*
+	* NuMesh::Header, then LevelCount NuMesh::Level entries (finest first), then the vertex data
+	* and the index data of every level back to back, each starting on a k_DataAlignment boundary
+	* so both go to the driver straight from the mapping.
+	*
+	* A vertex is VertexStride bytes: the position as four snorm16 (w = 1) relative to the
+	* bounding box, then whichever of the UV (two halves), normal (four snorm8, w unused) and
+	* tangent (four snorm8, w the bitangent sign) the flags announce, in that order.
+	*/
+	namespace NuMesh
+	{
+		inline constexpr uint32_t k_Magic = 0x534D554E;   // "NUMS"
+		inline constexpr uint32_t k_Version = 1;
+		inline constexpr uint32_t k_DataAlignment = 16;
+
+		inline constexpr uint32_t k_FlagTexCoords = 1u << 0;
+		inline constexpr uint32_t k_FlagNormals = 1u << 1;
+		inline constexpr uint32_t k_FlagTangents = 1u << 2;
+
+		inline constexpr uint32_t k_PositionSize = 8;
+		inline constexpr uint32_t k_TexCoordSize = 4;
+		inline constexpr uint32_t k_NormalSize = 4;
+		inline constexpr uint32_t k_TangentSize = 4;
+
+		struct Header
+		{
+			uint32_t Magic;
+			uint32_t Version;
+			uint32_t Flags;
+			Graphics::IndexFormat IndexFormat;
+			uint32_t VertexCount;
+			uint32_t VertexStride;
+			uint32_t IndexCount;        // All levels together
+			uint32_t LevelCount;
+			float PositionOffset[3];    // position = offset + snorm * scale
+			float PositionScale[3];
+			float BoundsCenter[3];
+			float BoundsRadius;
+			uint64_t VertexDataOffset;
+			uint64_t IndexDataOffset;
+		};
+
+		struct Level
+		{
+			uint32_t FirstIndex;
+			uint32_t IndexCount;
+			float Error;
+			uint32_t Reserved;
+		};
+
+		static_assert(sizeof(Header) == 88);
+		static_assert(sizeof(Level) == 16);
+
+		[[nodiscard]] constexpr uint32_t GetVertexStride(uint32_t flags) noexcept
+		{
+			return k_PositionSize
+				+ ((flags & k_FlagTexCoords) ? k_TexCoordSize : 0)
+				+ ((flags & k_FlagNormals) ? k_NormalSize : 0)
+				+ ((flags & k_FlagTangents) ? k_TangentSize : 0);
+		}
+
+		[[nodiscard]] inline int16_t QuantizeSnorm16(float value) noexcept
+		{
+			return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+		}
+
+		[[nodiscard]] inline int8_t QuantizeSnorm8(float value) noexcept
+		{
+			return static_cast<int8_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 127.0f));
+		}
+
+		/*
+		* @brief IEEE half, rounded to nearest. Values below the smallest normal half flush to zero.
+		*/
+		[[nodiscard]] inline uint16_t FloatToHalf(float value) noexcept
+		{
+			const uint32_t bits = std::bit_cast<uint32_t>(value);
+			const uint32_t sign = (bits >> 16) & 0x8000u;
+			const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+			if (magnitude >= 0x7F800000u)
+			{
+				return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+			}
+			if (magnitude < 0x38800000u)
+			{
+				return static_cast<uint16_t>(sign);
+			}
+
+			// Rebias the exponent and round the 13 dropped mantissa bits; a carry correctly bumps the exponent
+			const uint32_t rounded = magnitude - 0x38000000u + 0x0FFFu + ((magnitude >> 13) & 1u);
+			return static_cast<uint16_t>(sign | std::min(rounded >> 13, 0x7C00u));
+		}
+
+		[[nodiscard]] inline float HalfToFloat(uint16_t half) noexcept
+		{
+			const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+			const uint32_t exponent = (half >> 10) & 0x1Fu;
+			const uint32_t mantissa = half & 0x3FFu;
+
+			if (exponent == 0)
+			{
+				const float value = std::ldexp(static_cast<float>(mantissa), -24);
+				return sign ? -value : value;
+			}
+			if (exponent == 0x1F)
+			{
+				return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+			}
+			return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+		}
+	}
+
+	/*
+	* @brief Memory-mapped .numesh file. Open() validates the header, the level table and every
+	* data range, so the accessors never read outside the mapping.
+	*/
+	class NU_API NuMeshFile
+	{
+	public:
+		[[nodiscard]] static Core::Result<NuMeshFile, Graphics::GraphicsError> Open(const std::filesystem::path& path);
+
+		[[nodiscard]] uint32_t GetFlags() const noexcept { return m_Header.Flags; }
+		[[nodiscard]] Graphics::IndexFormat GetIndexFormat() const noexcept { return m_Header.IndexFormat; }
+		[[nodiscard]] uint32_t GetVertexCount() const noexcept { return m_Header.VertexCount; }
+		[[nodiscard]] uint32_t GetVertexStride() const noexcept { return m_Header.VertexStride; }
+		[[nodiscard]] uint32_t GetIndexCount() const noexcept { return m_Header.IndexCount; }
+
+		[[nodiscard]] std::span<const NuMesh::Level> GetLevels() const noexcept { return m_Levels; }
+		[[nodiscard]] std::span<const std::byte> GetVertexData() const noexcept;
+		[[nodiscard]] std::span<const std::byte> GetIndexData() const noexcept;
+
+		[[nodiscard]] NuMath::Sphere GetBounds() const noexcept;
+
+		/*
+		* @brief Attribute layout of the stored vertices: aPos, then aTexCoord, aNormal and aTangent when present.
+		*/
+		[[nodiscard]] Graphics::BufferLayout GetLayout() const;
+
+		/*
+		* @brief Maps the normalized positions the shader reads back to mesh units. CreateLodMesh stores it on
+		* every level, and RenderQueue/InstanceBatchBuilder multiply it into the model matrix at submit.
+		*/
+		[[nodiscard]] NuMath::Matrix4x4 GetDequantizeTransform() const noexcept;
+
+		/*
+		* @brief Uploads the mapped vertex and index data as they are, one index buffer per level, each
+		* level carrying GetDequantizeTransform().
+		*/
+		[[nodiscard]] LodMesh CreateLodMesh(Graphics::IRenderDevice& device) const;
+
+	private:
+		Core::MappedFile m_File;
+		NuMesh::Header m_Header{};
+		std::span<const NuMesh::Level> m_Levels;
+	};
+}
@@ -0,0 +1,310 @@
+#include <Renderer/Lighting/ClusteredLightCuller.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		// Spot cones wider than this are bounded by a sphere on the cone's cap, narrower ones by the
+		// sphere through the apex and the cap rim
+		constexpr float k_WideSpotAngle = 0.785398f;
+
+		// Marks a point light in GpuLight::DirectionSpotCos.w: no cosine is below it
+		constexpr float k_PointLightCos = -2.0f;
+
+		/*
+		* @brief View-space point at depth 1 that a perspective projection maps to NDC (x, y).
+		*
+		* Solved from the projection's own terms, so off-centre frusta work as well.
+		*/
+		NuMath::Vector3 Unproject(const NuMath::Matrix4x4& projection, float x, float y)
+		{
+			return NuMath::Vector3(
+				(x + projection(0, 2)) / projection(0, 0),
+				(y + projection(1, 2)) / projection(1, 1),
+				-1.0f);
+		}
+	}
+
+	ClusteredLightCuller::ClusteredLightCuller()
+		: m_MinX(k_ClusterCount), m_MinY(k_ClusterCount), m_MinZ(k_ClusterCount)
+		, m_MaxX(k_ClusterCount), m_MaxY(k_ClusterCount), m_MaxZ(k_ClusterCount)
+		, m_SliceLightOffsets(k_ClustersZ + 1, 0)
+		, m_ClusterLists(k_ClusterCount)
+		, m_Clusters(k_ClusterCount, LightCluster{ 0, 0 })
+	{
+		SetProjection(NuMath::Matrix4x4::CreatePerspective(1.0471976f, 16.0f / 9.0f, m_Near, m_Far), m_Near, m_Far);
+	}
+
+	void ClusteredLightCuller::SetProjection(const NuMath::Matrix4x4& projection, float nearClip, float farClip)
+	{
+		m_Near = nearClip;
+		m_Far = farClip;
+
+		// slice = log(depth / near) / log(far / near) * k_ClustersZ
+		const float logRatio = std::log(farClip / nearClip);
+		m_SliceScale = static_cast<float>(k_ClustersZ) / logRatio;
+		m_SliceBias = -static_cast<float>(k_ClustersZ) * std::log(nearClip) / logRatio;
+
+		for (uint32_t y = 0; y < k_ClustersY; ++y)
+		{
+			for (uint32_t x = 0; x < k_ClustersX; ++x)
+			{
+				const float left = -1.0f + 2.0f * static_cast<float>(x) / k_ClustersX;
+				const float right = -1.0f + 2.0f * static_cast<float>(x + 1) / k_ClustersX;
+				const float bottom = -1.0f + 2.0f * static_cast<float>(y) / k_ClustersY;
+				const float top = -1.0f + 2.0f * static_cast<float>(y + 1) / k_ClustersY;
+
+				// Tile corner rays, scaled to each slice's near and far depth
+				const NuMath::Vector3 corners[4] = {
+					Unproject(projection, left, bottom),
+					Unproject(projection, right, bottom),
+					Unproject(projection, left, top),
+					Unproject(projection, right, top)
+				};
+
+				for (uint32_t z = 0; z < k_ClustersZ; ++z)
+				{
+					const float depths[2] = {
+						nearClip * std::pow(farClip / nearClip, static_cast<float>(z) / k_ClustersZ),
+						nearClip * std::pow(farClip / nearClip, static_cast<float>(z + 1) / k_ClustersZ)
+					};
+
+					NuMath::Vector3 minimum(1.0e30f, 1.0e30f, 1.0e30f);
+					NuMath::Vector3 maximum(-1.0e30f, -1.0e30f, -1.0e30f);
+					for (const float depth : depths)
+					{
+						for (const NuMath::Vector3& corner : corners)
+						{
+							const NuMath::Vector3 point = corner * depth;
+							minimum = minimum.Min(point);
+							maximum = maximum.Max(point);
+						}
+					}
+
+					const uint32_t cluster = GetClusterIndex(x, y, z);
+					m_MinX[cluster] = minimum.X();
+					m_MinY[cluster] = minimum.Y();
+					m_MinZ[cluster] = minimum.Z();
+					m_MaxX[cluster] = maximum.X();
+					m_MaxY[cluster] = maximum.Y();
+					m_MaxZ[cluster] = maximum.Z();
+				}
+			}
+		}
+	}
+
+	uint32_t ClusteredLightCuller::GetDepthSlice(float viewDepth) const noexcept
+	{
+		if (viewDepth <= m_Near)
+		{
+			return 0;
+		}
+
+		const float slice = std::floor(std::log(viewDepth) * m_SliceScale + m_SliceBias);
+		return static_cast<uint32_t>(std::clamp(slice, 0.0f, static_cast<float>(k_ClustersZ - 1)));
+	}
+
+	NuMath::AABB ClusteredLightCuller::GetClusterBounds(uint32_t cluster) const noexcept
+	{
+		return NuMath::AABB(
+			NuMath::Vector3(m_MinX[cluster], m_MinY[cluster], m_MinZ[cluster]),
+			NuMath::Vector3(m_MaxX[cluster], m_MaxY[cluster], m_MaxZ[cluster]));
+	}
+
+	void ClusteredLightCuller::Assign(std::span<const Light> lights, const NuMath::Matrix4x4& view)
+	{
+		m_GpuLights.resize(lights.size());
+		m_ViewLights.resize(lights.size());
+
+		for (size_t i = 0; i < lights.size(); ++i)
+		{
+			const Light& light = lights[i];
+			const bool spot = light.Type == LightType::Spot;
+			const float spotCos = std::cos(light.SpotAngle);
+
+			m_GpuLights[i] = GpuLight{
+				NuMath::Vector4(light.Position.X(), light.Position.Y(), light.Position.Z(), light.Range),
+				NuMath::Vector4(light.Color.X(), light.Color.Y(), light.Color.Z(), light.Intensity),
+				NuMath::Vector4(light.Direction.X(), light.Direction.Y(), light.Direction.Z(), spot ? spotCos : k_PointLightCos)
+			};
+
+			NuMath::Vector3 center = light.Position;
+			float radius = light.Range;
+			if (spot)
+			{
+				if (light.SpotAngle > k_WideSpotAngle)
+				{
+					center = light.Position + light.Direction * (spotCos * light.Range);
+					radius = std::sin(light.SpotAngle) * light.Range;
+				}
+				else
+				{
+					radius = light.Range / (2.0f * spotCos);
+					center = light.Position + light.Direction * radius;
+				}
+			}
+
+			const NuMath::Vector4 viewCenter = view * NuMath::Vector4(center.X(), center.Y(), center.Z(), 1.0f);
+			const float depth = -viewCenter.Z();
+
+			ViewLight& viewLight = m_ViewLights[i];
+			viewLight.X = viewCenter.X();
+			viewLight.Y = viewCenter.Y();
+			viewLight.Z = viewCenter.Z();
+			viewLight.Radius = radius;
+
+			if (radius <= 0.0f || depth + radius < m_Near || depth - radius > m_Far)
+			{
+				// Empty range, skipped by every slice
+				viewLight.FirstSlice = 1;
+				viewLight.LastSlice = 0;
+				continue;
+			}
+
+			viewLight.FirstSlice = GetDepthSlice(depth - radius);
+			viewLight.LastSlice = GetDepthSlice(depth + radius);
+		}
+
+		// Bucket the lights by slice (counting sort) so a slice job only visits the lights reaching it
+		std::fill(m_SliceLightOffsets.begin(), m_SliceLightOffsets.end(), 0u);
+		for (const ViewLight& viewLight : m_ViewLights)
+		{
+			for (uint32_t slice = viewLight.FirstSlice; slice <= viewLight.LastSlice; ++slice)
+			{
+				++m_SliceLightOffsets[slice + 1];
+			}
+		}
+		for (uint32_t slice = 0; slice < k_ClustersZ; ++slice)
+		{
+			m_SliceLightOffsets[slice + 1] += m_SliceLightOffsets[slice];
+		}
+
+		m_SliceLights.resize(m_SliceLightOffsets[k_ClustersZ]);
+		std::array<uint32_t, k_ClustersZ> cursors;
+		std::copy(m_SliceLightOffsets.begin(), m_SliceLightOffsets.end() - 1, cursors.begin());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_ViewLights.size()); ++i)
+		{
+			for (uint32_t slice = m_ViewLights[i].FirstSlice; slice <= m_ViewLights[i].LastSlice; ++slice)
+			{
+				m_SliceLights[cursors[slice]++] = i;
+			}
+		}
+
+		Core::JobSystem& jobs = Core::JobSystem::Get();
+		jobs.ParallelFor(k_ClustersZ, [this](size_t start, size_t end)
+		{
+			for (size_t slice = start; slice < end; ++slice)
+			{
+				AssignSlice(static_cast<uint32_t>(slice));
+			}
+		}, 1);
+
+		// Clusters are stored slice by slice, so each slice's lists land in one contiguous run
+		uint32_t offset = 0;
+		m_Stats = ClusteredLightStats{};
+		for (uint32_t slice = 0; slice < k_ClustersZ; ++slice)
+		{
+			for (uint32_t cluster = slice * k_ClustersPerSlice; cluster < (slice + 1) * k_ClustersPerSlice; ++cluster)
+			{
+				const uint32_t count = static_cast<uint32_t>(m_ClusterLists[cluster].size());
+				m_Clusters[cluster] = LightCluster{ offset, count };
+				offset += count;
+
+				m_Stats.OccupiedClusters += count > 0 ? 1 : 0;
+				m_Stats.MaxLightsPerCluster = std::max(m_Stats.MaxLightsPerCluster, count);
+			}
+		}
+
+		m_LightIndices.resize(offset);
+		jobs.ParallelFor(k_ClustersZ, [this](size_t start, size_t end)
+		{
+			for (size_t slice = start; slice < end; ++slice)
+			{
+				for (size_t cluster = slice * k_ClustersPerSlice; cluster < (slice + 1) * k_ClustersPerSlice; ++cluster)
+				{
+					const std::vector<uint32_t>& list = m_ClusterLists[cluster];
+					std::copy(list.begin(), list.end(), m_LightIndices.begin() + m_Clusters[cluster].Offset);
+				}
+			}
+		}, 1);
+
+		m_Stats.Lights = static_cast<uint32_t>(lights.size());
+		m_Stats.Assignments = offset;
+
+		m_LightSeen.assign(lights.size(), 0);
+		for (const uint32_t index : m_LightIndices)
+		{
+			m_Stats.VisibleLights += m_LightSeen[index] ? 0 : 1;
+			m_LightSeen[index] = 1;
+		}
+	}
+
+	void ClusteredLightCuller::AssignSlice(uint32_t slice)
+	{
+		using Register = Backend::Register;
+		constexpr uint32_t Pack = Backend::Width;
+		static_assert(k_ClustersX % Pack == 0, "A row of clusters must be a whole number of SIMD packs");
+
+		const uint32_t first = slice * k_ClustersPerSlice;
+		for (uint32_t cluster = first; cluster < first + k_ClustersPerSlice; ++cluster)
+		{
+			m_ClusterLists[cluster].clear();
+		}
+
+		const Register zero = Backend::SetZero();
+
+		for (uint32_t entry = m_SliceLightOffsets[slice]; entry < m_SliceLightOffsets[slice + 1]; ++entry)
+		{
+			const uint32_t lightIndex = m_SliceLights[entry];
+			const ViewLight& light = m_ViewLights[lightIndex];
+
+			// A box's X extent depends only on its column and its Y extent only on its row, and both
+			// grow along the grid, so the columns and rows the sphere's bounds reach are one run each
+			uint32_t xBegin = 0, xEnd = k_ClustersX;
+			while (xBegin < xEnd && m_MaxX[first + xBegin] < light.X - light.Radius) ++xBegin;
+			while (xEnd > xBegin && m_MinX[first + xEnd - 1] > light.X + light.Radius) --xEnd;
+
+			uint32_t yBegin = 0, yEnd = k_ClustersY;
+			while (yBegin < yEnd && m_MaxY[first + yBegin * k_ClustersX] < light.Y - light.Radius) ++yBegin;
+			while (yEnd > yBegin && m_MinY[first + (yEnd - 1) * k_ClustersX] > light.Y + light.Radius) --yEnd;
+
+			if (xBegin == xEnd || yBegin == yEnd)
+			{
+				continue;
+			}
+
+			const Register centerX = Backend::SetAll(light.X);
+			const Register centerY = Backend::SetAll(light.Y);
+			const Register centerZ = Backend::SetAll(light.Z);
+			const Register radiusSquared = Backend::SetAll(light.Radius * light.Radius);
+
+			const uint32_t packBegin = xBegin & ~(Pack - 1);
+			for (uint32_t y = yBegin; y < yEnd; ++y)
+			{
+				const uint32_t row = first + y * k_ClustersX;
+				for (uint32_t cluster = row + packBegin; cluster < row + xEnd; cluster += Pack)
+				{
+					// Distance from the centre to the box: per axis, how far the centre lies outside it
+					const Register dx = Backend::Max(Backend::Max(Backend::Sub(Backend::Load(&m_MinX[cluster]), centerX), Backend::Sub(centerX, Backend::Load(&m_MaxX[cluster]))), zero);
+					const Register dy = Backend::Max(Backend::Max(Backend::Sub(Backend::Load(&m_MinY[cluster]), centerY), Backend::Sub(centerY, Backend::Load(&m_MaxY[cluster]))), zero);
+					const Register dz = Backend::Max(Backend::Max(Backend::Sub(Backend::Load(&m_MinZ[cluster]), centerZ), Backend::Sub(centerZ, Backend::Load(&m_MaxZ[cluster]))), zero);
+					const Register distanceSquared = Backend::Add(Backend::Add(Backend::Mul(dx, dx), Backend::Mul(dy, dy)), Backend::Mul(dz, dz));
+
+					unsigned int hits = static_cast<unsigned int>(Backend::LessMask(distanceSquared, radiusSquared));
+					while (hits != 0)
+					{
+						const int lane = std::countr_zero(hits);
+						m_ClusterLists[cluster + lane].push_back(lightIndex);
+						hits &= hits - 1;
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Renderer/Lighting/Light.hpp>
+#include <Core/Memory/AlignedAllocator.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Lights of one cluster: LightIndices[Offset .. Offset + Count). std430 uvec2.
+	*/
+	struct LightCluster
+	{
+		uint32_t Offset;
+		uint32_t Count;
+	};
+
+	struct ClusteredLightStats
+	{
+		uint32_t Lights = 0;
+		uint32_t VisibleLights = 0;         // Overlapping at least one cluster
+		uint32_t Assignments = 0;           // Total entries in the index list
+		uint32_t OccupiedClusters = 0;
+		uint32_t MaxLightsPerCluster = 0;
+	};
+
+	/*
+	* @brief Bins lights into a froxel grid so shading only loops over the lights near each pixel.
+	*
+	* The view frustum is split into k_ClustersX x k_ClustersY screen tiles and k_ClustersZ depth
+	* slices, exponentially spaced between the near and far planes. Each frame Assign() tests every
+	* light's bounding sphere against the view-space boxes of the clusters in the slices it reaches,
+	* a SIMD pack of clusters at a time, one depth slice per JobSystem range.
+	*
+	* The result is three tightly packed arrays ready to upload as storage buffers: GetGpuLights(),
+	* GetClusters() (indexed by GetClusterIndex()) and GetLightIndices(). A shader finds its slice
+	* with floor(log(viewDepth) * GetDepthSliceScale() + GetDepthSliceBias()).
+	*/
+	class NU_API ClusteredLightCuller
+	{
+	public:
+		static constexpr uint32_t k_ClustersX = 16;
+		static constexpr uint32_t k_ClustersY = 9;
+		static constexpr uint32_t k_ClustersZ = 24;
+		static constexpr uint32_t k_ClustersPerSlice = k_ClustersX * k_ClustersY;
+		static constexpr uint32_t k_ClusterCount = k_ClustersPerSlice * k_ClustersZ;
+
+		ClusteredLightCuller();
+
+		/*
+		* @brief Rebuilds the cluster boxes. Only needed when the projection changes, not every frame.
+		*/
+		void SetProjection(const NuMath::Matrix4x4& projection, float nearClip, float farClip);
+
+		/*
+		* @brief Rebuilds the cluster light lists for lights seen from view.
+		*
+		* Runs inline when the JobSystem has not been started. Safe to call from inside a job.
+		*/
+		void Assign(std::span<const Light> lights, const NuMath::Matrix4x4& view);
+
+		[[nodiscard]] static constexpr uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) noexcept
+		{
+			return (z * k_ClustersY + y) * k_ClustersX + x;
+		}
+
+		/*
+		* @brief Slice holding a point viewDepth units in front of the camera, clamped to the grid.
+		*/
+		[[nodiscard]] uint32_t GetDepthSlice(float viewDepth) const noexcept;
+
+		[[nodiscard]] float GetDepthSliceScale() const noexcept { return m_SliceScale; }
+		[[nodiscard]] float GetDepthSliceBias() const noexcept { return m_SliceBias; }
+
+		[[nodiscard]] std::span<const GpuLight> GetGpuLights() const noexcept { return m_GpuLights; }
+		[[nodiscard]] std::span<const LightCluster> GetClusters() const noexcept { return m_Clusters; }
+		[[nodiscard]] std::span<const uint32_t> GetLightIndices() const noexcept { return m_LightIndices; }
+
+		/*
+		* @brief Lights of one cluster, as indices into the span passed to Assign().
+		*/
+		[[nodiscard]] std::span<const uint32_t> GetClusterLights(uint32_t cluster) const noexcept
+		{
+			return std::span<const uint32_t>(m_LightIndices).subspan(m_Clusters[cluster].Offset, m_Clusters[cluster].Count);
+		}
+
+		/*
+		* @brief View-space box of a cluster, as used by Assign().
+		*/
+		[[nodiscard]] NuMath::AABB GetClusterBounds(uint32_t cluster) const noexcept;
+
+		[[nodiscard]] const ClusteredLightStats& GetStats() const noexcept { return m_Stats; }
+
+	private:
+		using Backend = NuMath::Simd::BatchBackend;
+
+		/*
+		* @brief View-space bounding sphere of a light and the depth slices it touches.
+		*/
+		struct ViewLight
+		{
+			float X, Y, Z, Radius;
+			uint32_t FirstSlice, LastSlice;
+		};
+
+		void AssignSlice(uint32_t slice);
+
+		float m_Near = 0.1f;
+		float m_Far = 100.0f;
+		float m_SliceScale = 0.0f;
+		float m_SliceBias = 0.0f;
+
+		// Cluster boxes, structure of arrays so one load covers a pack of clusters
+		AlignedVector<float, 32> m_MinX, m_MinY, m_MinZ;
+		AlignedVector<float, 32> m_MaxX, m_MaxY, m_MaxZ;
+
+		std::vector<ViewLight> m_ViewLights;
+		std::vector<uint32_t> m_SliceLights;           // Lights reaching each slice, grouped by slice
+		std::vector<uint32_t> m_SliceLightOffsets;     // k_ClustersZ + 1 bounds into m_SliceLights
+		std::vector<std::vector<uint32_t>> m_ClusterLists;   // Per cluster, written only by its slice's job
+
+		std::vector<GpuLight> m_GpuLights;
+		std::vector<LightCluster> m_Clusters;
+		std::vector<uint32_t> m_LightIndices;
+		std::vector<uint8_t> m_LightSeen;
+		ClusteredLightStats m_Stats;
+	};
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuMath/NuMath.hpp>
+
+#include <cstdint>
+
+namespace NuEngine::Renderer
+{
+	enum class LightType : uint32_t
+	{
+		Point = 0,
+		Spot = 1
+	};
+
+	/*
+	* @brief Punctual light in world space. Its influence ends at Range.
+	*/
+	struct Light
+	{
+		NuMath::Vector3 Position;
+		NuMath::Vector3 Direction = NuMath::Vector3(0.0f, 0.0f, -1.0f);    // Spot only, normalized
+		NuMath::Vector3 Color = NuMath::Vector3(1.0f, 1.0f, 1.0f);
+		float Intensity = 1.0f;
+		float Range = 10.0f;
+		float SpotAngle = 0.785398f;    // Spot only, half-angle of the outer cone in radians
+		LightType Type = LightType::Point;
+	};
+
+	/*
+	* @brief std430 layout of one light as the shaders read it (48 bytes).
+	*
+	* xyz = world position / colour / direction; w = range / intensity / cos of the spot angle,
+	* or -2 for point lights so every cosine passes the spot test.
+	*/
+	struct GpuLight
+	{
+		NuMath::Vector4 PositionRange;
+		NuMath::Vector4 ColorIntensity;
+		NuMath::Vector4 DirectionSpotCos;
+	};
+
+	static_assert(sizeof(GpuLight) == 48, "GpuLight must match the std430 light struct");
+}
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Core/PipelineState.hpp>
+#include <Graphics/Abstractions/Shaders/IShader.hpp>
+#include <Graphics/Abstractions/Textures/ITexture.hpp>
+
+#include <memory>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Shader plus the resources and fixed-function state bound with it. A null Texture draws
+	* untextured; a null Pipeline draws with PipelineState::Default().
+	*
+	* Pipeline states are immutable and meant to be shared, so materials drawn alike hold the same one.
+	*/
+	struct Material
+	{
+		std::shared_ptr<Graphics::IShader> Shader;
+		std::shared_ptr<Graphics::ITexture> Texture;
+		std::shared_ptr<const Graphics::PipelineState> Pipeline;
+
+		[[nodiscard]] const Graphics::PipelineState& GetPipeline() const noexcept
+		{
+			return Pipeline ? *Pipeline : Graphics::PipelineState::Default();
+		}
+	};
+}
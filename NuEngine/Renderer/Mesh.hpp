@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Graphics/Abstractions/Buffers/IVertexArray.hpp>
+#include <NuMath/NuMath.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief GPU geometry. Drawn indexed when the vertex array has an index buffer, otherwise as VertexCount vertices.
+	*
+	* Quantized meshes store normalized positions; Dequantize maps them back to mesh units and is
+	* applied to every transform as it is submitted, so callers pass plain model matrices.
+	*/
+	struct Mesh
+	{
+		std::shared_ptr<Graphics::IVertexArray> VertexArray;
+		uint32_t VertexCount = 0;
+
+		NuMath::Matrix4x4 Dequantize = NuMath::Matrix4x4::Identity();
+		bool IsQuantized = false;
+	};
+
+	/*
+	* @brief The matrix the shader needs for a mesh placed at model: model itself, times Dequantize for quantized meshes.
+	*/
+	[[nodiscard]] inline NuMath::Matrix4x4 GetDrawTransform(const Mesh& mesh, const NuMath::Matrix4x4& model) noexcept
+	{
+		return mesh.IsQuantized ? model * mesh.Dequantize : model;
+	}
+
+	/*
+	* @brief Appends the per-instance attributes of instanceBuffer to the mesh's vertex array, once.
+	*/
+	inline void AttachInstanceBuffer(const Mesh& mesh, const std::shared_ptr<Graphics::IVertexBuffer>& instanceBuffer)
+	{
+		const auto& buffers = mesh.VertexArray->GetVertexBuffer();
+		if (std::find(buffers.begin(), buffers.end(), instanceBuffer) == buffers.end())
+		{
+			mesh.VertexArray->AddVertexBuffer(instanceBuffer);
+		}
+	}
+}
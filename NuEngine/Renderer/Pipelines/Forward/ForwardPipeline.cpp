@@ -3,8 +3,9 @@
 #include <Core/Logging/Logger.hpp>
 #include <Core/IO/FileSystem.hpp>
 #include <Core/Timer/Time.hpp>
-#include <glad/glad.h>
+#include <algorithm>
 #include <cmath> // Для константи PI, якщо треба
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846f
@@ -12,6 +13,9 @@
 
 namespace NuEngine::Renderer
 {
+    // Instances one region holds; a frame that uploads more waits for its own earlier draws
+    static constexpr uint32_t k_MaxInstancesPerFrame = 16384;
+
     ForwardPipeline::ForwardPipeline(Graphics::IRenderDevice* device)
         : m_Device(device), m_Width(1280), m_Height(720)
     {
@@ -26,6 +30,8 @@ namespace NuEngine::Renderer
             return;
         }
 
+        m_FrameUniforms = m_Device->CreateUniformBuffer(sizeof(FrameUniforms), Graphics::UniformBlocks::k_FrameBinding);
+
         Core::FileSystem fs(".");
 
         std::string vertexSrc;
@@ -38,11 +44,25 @@ namespace NuEngine::Renderer
         if (fragRes.IsOk()) fragmentSrc = fragRes.Unwrap();
         else { LOG_ERROR("Failed to load Fragment Shader! Error: {}", fragRes.UnwrapError().ToString()); return; }
 
-        auto shaderRes = m_Device->CreateShader(vertexSrc, fragmentSrc);
-        if (shaderRes.IsOk()) m_Shader = shaderRes.Unwrap();
-        else LOG_ERROR("Critical: Failed to create shader! Reason: {}", shaderRes.UnwrapError().ToString());
+        std::string instancedVertexSrc;
+        auto instancedRes = fs.ReadTextFile("Resources/Shaders/ForwardInstanced.vert");
+        if (instancedRes.IsOk()) instancedVertexSrc = instancedRes.Unwrap();
+        else LOG_ERROR("Failed to load instanced Vertex Shader! Error: {}", instancedRes.UnwrapError().ToString());
+
+        // Both variants in one batch, so the device can compile them side by side or load them from its cache
+        std::vector<Graphics::ShaderSource> sources = { { vertexSrc, fragmentSrc } };
+        if (!instancedVertexSrc.empty()) sources.push_back({ instancedVertexSrc, fragmentSrc });
+
+        auto shaders = m_Device->CreateShaders(sources);
+
+        if (shaders[0].IsOk()) m_Shader = shaders[0].Unwrap();
+        else LOG_ERROR("Critical: Failed to create shader! Reason: {}", shaders[0].UnwrapError().ToString());
 
-        glEnable(GL_DEPTH_TEST);
+        if (shaders.size() > 1)
+        {
+            if (shaders[1].IsOk()) m_DefaultMaterial.Shader = shaders[1].Unwrap();
+            else LOG_ERROR("Failed to create instanced shader! Reason: {}", shaders[1].UnwrapError().ToString());
+        }
 
         float aspectRatio = (float)m_Width / (float)m_Height;
 
@@ -51,63 +71,45 @@ namespace NuEngine::Renderer
 
         m_Camera->SetPosition(NuMath::Vector3(0.0f, 0.0f, 3.0f));
 
+        // Unique corners of the cube, indexed below; faces that meet with matching UVs share vertices
         float vertices[] = {
                 -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
                  0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
                  0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-                 0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
                 -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-                -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
-
                 -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
                  0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
                  0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
-                 0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
                 -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,
-                -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-
                 -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
                 -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
                 -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-                -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-                -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-                -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
                  0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-                 0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-                 0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
                  0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
                  0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-                 0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
-                -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
                  0.5f, -0.5f, -0.5f,  1.0f, 1.0f,
-                 0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-                 0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-                -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-                -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+                -0.5f,  0.5f,  0.5f,  0.0f, 0.0f
+        };
 
-                -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-                 0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-                 0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-                 0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-                -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
-                -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
+        const uint16_t indices[] = {
+                 0,  1,  2,   2,  3,  0,
+                 4,  5,  6,   6,  7,  4,
+                 8,  9, 10,  10,  4,  8,
+                11,  2, 12,  12, 13, 11,
+                10, 14,  5,   5,  4, 10,
+                 3,  2, 11,  11, 15,  3
         };
 
+        // Draws with a placeholder until the streamer has decoded and uploaded the file
         auto texPath = Core::FileSystem::GetPath("Resources/Textures/wall.jpg");
-        auto texture = m_Device->CreateTexture(texPath.generic_string());
+        m_Texture = m_Device->CreateTextureAsync(texPath.generic_string());
 
-        if (texture)
-        {
-            m_Texture = texture;
-            m_Shader->Bind();
-            m_Shader->SetInt("u_Texture", 0);
-            m_Shader->Unbind();
-        }
-        else
+        m_Shader->SetInt(Graphics::Uniforms::Texture, 0);
+
+        m_DefaultMaterial.Texture = m_Texture;
+        if (m_DefaultMaterial.Shader)
         {
-            LOG_ERROR("Failed to load texture. Tried path: {}", texPath.string());
+            m_DefaultMaterial.Shader->SetInt(Graphics::Uniforms::Texture, 0);
         }
 
         m_QuadVAO = m_Device->CreateVertexArray();
@@ -118,36 +120,128 @@ namespace NuEngine::Renderer
         };
         vbo->SetLayout(layout);
         m_QuadVAO->AddVertexBuffer(vbo);
+        m_QuadVAO->SetIndexBuffer(m_Device->CreateIndexBuffer(indices, 36, Graphics::IndexFormat::UInt16));
+
+        m_CubeMesh.VertexArray = m_QuadVAO;
+        m_CubeMesh.VertexCount = 36;
+
+        m_InstanceBuffer = m_Device->CreateStreamingBuffer(k_MaxInstancesPerFrame * sizeof(NuMath::Matrix4x4));
+        Graphics::BufferLayout instanceLayout = {
+            { Graphics::ShaderDataType::Mat4, "aModel", false, true }
+        };
+        m_InstanceBuffer->SetLayout(instanceLayout);
     }
 
     void ForwardPipeline::RenderCube(const NuMath::Transform& transform, bool withTexture) noexcept
     {
         if (!m_Shader || !m_Camera || !m_QuadVAO) return;
 
-        m_Shader->Bind();
+        m_Device->BindPipelineState(Graphics::PipelineState::Default());
+        m_Device->BindShader(m_Shader.get());
 
-        NuMath::Matrix4x4 model = transform.GetMatrix();
-        NuMath::Matrix4x4 view = m_Camera->GetViewMatrix();
-        NuMath::Matrix4x4 projection = m_Camera->GetProjectionMatrix();
+        m_Shader->SetMat4x4(Graphics::Uniforms::Model, transform.GetMatrix());
 
-        GLint modelLoc = glGetUniformLocation(m_Shader->GetID(), "model");
-        GLint viewLoc = glGetUniformLocation(m_Shader->GetID(), "view");
-        GLint projLoc = glGetUniformLocation(m_Shader->GetID(), "projection");
+        m_Device->BindTexture(withTexture ? m_Texture.get() : nullptr, 0);
+        m_Device->DrawInstanced(m_QuadVAO, 36, 1).Ignore();
+    }
 
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, model.Data());
-        glUniformMatrix4fv(viewLoc, 1, GL_FALSE, view.Data());
-        glUniformMatrix4fv(projLoc, 1, GL_FALSE, projection.Data());
+    void ForwardPipeline::SubmitInstances(const Mesh& mesh, const Material& material, std::span<const NuMath::Matrix4x4> transforms)
+    {
+        if (!mesh.VertexArray || !material.Shader || !m_InstanceBuffer)
+        {
+            return;
+        }
+
+        AttachInstanceBuffer(mesh, m_InstanceBuffer);
+
+        m_InstanceBatches.Submit(&mesh, &material, transforms);
+    }
 
-        if (withTexture && m_Texture)
-            m_Texture->Bind(0);
-        else
-            m_Texture->Unbind();
+    void ForwardPipeline::Submit(const Mesh& mesh, const Material& material, const NuMath::Matrix4x4& transform, RenderPass pass)
+    {
+        if (!mesh.VertexArray || !material.Shader || !m_Camera)
+        {
+            return;
+        }
 
-        m_QuadVAO->Bind();
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-        m_QuadVAO->Unbind();
+        const NuMath::Vector4 worldPosition(transform(0, 3), transform(1, 3), transform(2, 3), 1.0f);
+        const NuMath::Vector4 viewPosition = m_FrameView * worldPosition;
+        const float depth = -viewPosition.Z() / m_Camera->GetFarClip();
 
-        m_Shader->Unbind();
+        m_RenderQueue.Submit(RenderQueue::MakeKey(pass, material, depth), mesh, material, transform);
+    }
+
+    Core::Result<void, Graphics::GraphicsError> ForwardPipeline::Flush() noexcept
+    {
+        if (!m_Device) return Core::Err(Graphics::GraphicsError(
+            Graphics::GraphicsErrorCode::InvalidContext));
+
+        if (m_Camera && m_RenderQueue.GetSize() > 0)
+        {
+            m_RenderQueue.Sort();
+            auto queueResult = m_RenderQueue.Execute(*m_Device, m_InstanceBuffer);
+            m_RenderQueue.Reset();
+            if (queueResult.IsError())
+            {
+                m_InstanceBatches.Clear();
+                return queueResult;
+            }
+        }
+
+        m_InstanceBatches.Build();
+
+        const auto batches = m_InstanceBatches.GetBatches();
+        if (batches.empty() || !m_Camera)
+        {
+            m_InstanceBatches.Clear();
+            return Core::Ok();
+        }
+
+        const auto instances = m_InstanceBatches.GetInstanceData();
+        constexpr uint32_t k_Stride = static_cast<uint32_t>(sizeof(NuMath::Matrix4x4));
+        const uint32_t instanceTotal = static_cast<uint32_t>(instances.size());
+        const uint32_t chunkCapacity = std::max(m_InstanceBuffer->GetMaxDataSize() / k_Stride, 1u);
+
+        // Instances [chunkFirst, chunkEnd) are in the buffer at chunkBase; more than a region goes up in parts
+        uint32_t chunkFirst = 0;
+        uint32_t chunkEnd = 0;
+        uint32_t chunkBase = 0;
+
+        // Batches sort by material, and the device skips binds of what is already bound
+        for (const InstanceBatch& batch : batches)
+        {
+            m_Device->BindPipelineState(batch.Material->GetPipeline());
+            m_Device->BindShader(batch.Material->Shader.get());
+            m_Device->BindTexture(batch.Material->Texture.get(), 0);
+
+            const uint32_t batchEnd = batch.FirstInstance + batch.InstanceCount;
+            for (uint32_t part = batch.FirstInstance; part < batchEnd;)
+            {
+                if (part < chunkFirst || part >= chunkEnd)
+                {
+                    chunkFirst = part;
+                    chunkEnd = part + std::min(chunkCapacity, instanceTotal - part);
+                    if (!m_InstanceBuffer->SetData(&instances[chunkFirst], (chunkEnd - chunkFirst) * k_Stride))
+                    {
+                        m_InstanceBatches.Clear();
+                        return Core::Err(Graphics::GraphicsError(Graphics::GraphicsErrorCode::OutOfMemory));
+                    }
+                    chunkBase = m_InstanceBuffer->GetDataOffset() / k_Stride;
+                }
+
+                const uint32_t partCount = std::min(batchEnd, chunkEnd) - part;
+                auto drawResult = m_Device->DrawInstanced(batch.Mesh->VertexArray, batch.Mesh->VertexCount, partCount, chunkBase + (part - chunkFirst));
+                if (drawResult.IsError())
+                {
+                    m_InstanceBatches.Clear();
+                    return drawResult;
+                }
+                part += partCount;
+            }
+        }
+
+        m_InstanceBatches.Clear();
+        return Core::Ok();
     }
 
     Core::Result<void, Graphics::GraphicsError> ForwardPipeline::Render(bool present) noexcept
@@ -155,13 +249,40 @@ namespace NuEngine::Renderer
         if (!m_Device) return Core::Err(Graphics::GraphicsError(
             Graphics::GraphicsErrorCode::InvalidContext));
 
-        glClearColor(m_ClearColor.R(), m_ClearColor.G(), m_ClearColor.B(), m_ClearColor.A());
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // Last frame's draws are all issued by now, so its instance region can be fenced
+        if (m_InstanceBuffer) m_InstanceBuffer->NextFrame();
+
+        // Textures whose decode finished get their next slice of rows
+        m_Device->GetTextureStreamer().Update();
+
+        if (m_Camera)
+        {
+            m_FrameView = m_Camera->GetViewMatrix();
+            UploadFrameUniforms();
+        }
+
+        auto clearResult = m_Device->Clear(m_ClearColor);
+        if (clearResult.IsError()) return clearResult;
 
         if (present) return m_Device->Present();
         return Core::Ok();
     }
 
+    void ForwardPipeline::UploadFrameUniforms() noexcept
+    {
+        if (!m_FrameUniforms) return;
+
+        const NuMath::Vector3 position = m_Camera->GetPosition();
+
+        FrameUniforms frame;
+        frame.View = m_FrameView;
+        frame.Projection = m_Camera->GetProjectionMatrix();
+        frame.ViewProjection = frame.Projection * frame.View;
+        frame.CameraPosition = NuMath::Vector4(position.X(), position.Y(), position.Z(), 1.0f);
+
+        m_FrameUniforms->SetData(&frame, sizeof(frame));
+    }
+
     void ForwardPipeline::SetViewport(int x, int y, int width, int height) noexcept
     {
         if (m_Device)
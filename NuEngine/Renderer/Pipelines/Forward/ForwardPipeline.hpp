@@ -10,8 +10,15 @@
 #include <Core/Types/Result.hpp>
 #include <Graphics/Errors/GraphicsError.hpp>
 #include <Renderer/Camera.hpp>
+#include <Renderer/FrameUniforms.hpp>
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Material.hpp>
+#include <Renderer/Batching/InstanceBatchBuilder.hpp>
+#include <Renderer/Queue/RenderQueue.hpp>
 #include <NuEngine/Core/API.hpp>
 
+#include <span>
+
 namespace NuEngine::Renderer
 {
 	/*
@@ -28,7 +35,7 @@ namespace NuEngine::Renderer
 		void Initialize();
 
 		/*
-		* 
+		* @brief Starts a frame: captures the camera, uploads the Frame uniform block and clears the target.
 		*/
 		Core::Result<void, Graphics::GraphicsError> Render(bool present = true) noexcept;
 
@@ -42,13 +49,50 @@ namespace NuEngine::Renderer
 
 		void RenderCube(const NuMath::Transform& transform, bool withTexture = false) noexcept;
 
+		/*
+		* @brief Queues one instanced draw per transform. Drawn by Flush().
+		*
+		* The material shader receives the model matrix as a per-instance mat4 attribute
+		* placed right after the mesh's vertex attributes (see ForwardInstanced.vert).
+		* mesh and material must stay alive until the flush.
+		*/
+		void SubmitInstances(const Mesh& mesh, const Material& material, std::span<const NuMath::Matrix4x4> transforms);
+
+		/*
+		* @brief Records one draw into the render queue, keyed by pass, material state and view depth.
+		*/
+		void Submit(const Mesh& mesh, const Material& material, const NuMath::Matrix4x4& transform, RenderPass pass = RenderPass::Opaque);
+
+		/*
+		* @brief Sorts and replays the render queue, then draws the instance batches.
+		*
+		* Each path uploads its transforms in one buffer update and issues one draw per (mesh, material) run.
+		*/
+		Core::Result<void, Graphics::GraphicsError> Flush() noexcept;
+
+		RenderQueue& GetRenderQueue() { return m_RenderQueue; }
+
+		const Mesh& GetCubeMesh() const { return m_CubeMesh; }
+		const Material& GetDefaultMaterial() const { return m_DefaultMaterial; }
+
 	private:
+		void UploadFrameUniforms() noexcept;
+
 		Graphics::IRenderDevice* m_Device;
 
 		std::shared_ptr<Graphics::IShader> m_Shader;
 		std::shared_ptr<Graphics::IVertexArray> m_QuadVAO;
 		std::shared_ptr<Graphics::ITexture> m_Texture;
 		std::shared_ptr<Camera> m_Camera;
+
+		Mesh m_CubeMesh;
+		Material m_DefaultMaterial;
+		std::shared_ptr<Graphics::IStreamingBuffer> m_InstanceBuffer;
+		std::shared_ptr<Graphics::IUniformBuffer> m_FrameUniforms;
+		InstanceBatchBuilder m_InstanceBatches;
+		RenderQueue m_RenderQueue;
+		NuMath::Matrix4x4 m_FrameView;
+
 		NuMath::Color m_ClearColor = NuMath::Colors::Linear::White;
 		NuMath::Transform m_ModelTransform;
 
@@ -0,0 +1,68 @@
+#include <Renderer/Queue/ParallelRenderRecorder.hpp>
+
+#include <algorithm>
+
+namespace NuEngine::Renderer
+{
+	void ParallelRenderRecorder::BeginFrame(const NuMath::Matrix4x4& view, const NuMath::Matrix4x4& projection, float farClip)
+	{
+		const size_t threadCount = std::max<size_t>(Core::JobSystem::Get().GetNumThreads(), 1);
+		while (m_Queues.size() < threadCount)
+		{
+			m_Queues.push_back(std::make_unique<RenderQueue>());
+		}
+
+		for (const auto& queue : m_Queues)
+		{
+			queue->Reset();
+		}
+
+		while (m_Scratch.size() < threadCount)
+		{
+			m_Scratch.push_back(std::make_unique<CullScratch>());
+		}
+
+		m_View = view;
+		m_InvFarClip = farClip > 0.0f ? 1.0f / farClip : 1.0f;
+		m_Frustum = NuMath::Frustum::FromViewProjection(projection * view);
+	}
+
+	void ParallelRenderRecorder::Submit(RenderQueue& queue, const Mesh& mesh, const Material& material, RenderPass pass,
+		const NuMath::Matrix4x4& model) const
+	{
+		// View-space z is negative in front of the camera
+		const float viewZ = m_View(2, 0) * model(0, 3) + m_View(2, 1) * model(1, 3) + m_View(2, 2) * model(2, 3) + m_View(2, 3);
+		queue.Submit(RenderQueue::MakeKey(pass, material, -viewZ * m_InvFarClip), mesh, material, model);
+	}
+
+	bool ParallelRenderRecorder::SubmitCulled(RenderQueue& queue, const Mesh& mesh, const Material& material, RenderPass pass,
+		const NuMath::Matrix4x4& model, float radius) const
+	{
+		const NuMath::Sphere bounds(NuMath::Vector3(model(0, 3), model(1, 3), model(2, 3)), radius);
+		if (!NuMath::Intersects(m_Frustum, bounds))
+		{
+			return false;
+		}
+
+		Submit(queue, mesh, material, pass, model);
+		return true;
+	}
+
+	void ParallelRenderRecorder::MergeInto(RenderQueue& target) const
+	{
+		for (const auto& queue : m_Queues)
+		{
+			target.Append(*queue);
+		}
+	}
+
+	size_t ParallelRenderRecorder::GetRecordedCount() const noexcept
+	{
+		size_t count = 0;
+		for (const auto& queue : m_Queues)
+		{
+			count += queue->GetSize();
+		}
+		return count;
+	}
+}
@@ -0,0 +1,182 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/Threading/JobSystem.hpp>
+#include <Core/Memory/AlignedAllocator.hpp>
+#include <Renderer/Queue/RenderQueue.hpp>
+#include <Renderer/Culling/OcclusionBuffer.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Geometry/CullingBatchSoA.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Records one RenderQueue per JobSystem thread and merges them for submission on the GL thread.
+	*
+	* Per frame: BeginFrame() with the camera, Record() to cull and key renderables on every worker,
+	* then MergeInto() the pipeline's queue. Only the main thread may call these three; the callback
+	* given to Record() runs on workers and must only touch the queue it is handed.
+	*/
+	class NU_API ParallelRenderRecorder
+	{
+	public:
+		// Below this many renderables per range the scheduling costs more than the recording
+		static constexpr size_t k_MinRenderablesPerJob = 512;
+
+		/*
+		* @brief Resets every thread queue and captures the camera used for culling and depth keys.
+		*
+		* Entries merged in the previous frame point into these queues, so the target queue must be
+		* executed or reset before this is called again.
+		*/
+		void BeginFrame(const NuMath::Matrix4x4& view, const NuMath::Matrix4x4& projection, float farClip);
+
+		/*
+		* @brief Calls record(start, end, queue) over [0, count), split across the JobSystem.
+		*
+		* Runs inline when the JobSystem has not been started.
+		*/
+		template<typename RecordFn>
+		void Record(size_t count, RecordFn&& record, size_t minBatchSize = k_MinRenderablesPerJob)
+		{
+			Core::JobSystem& jobs = Core::JobSystem::Get();
+			if (!jobs.IsInitialized() || count < minBatchSize * 2)
+			{
+				record(size_t(0), count, *m_Queues[0]);
+				return;
+			}
+
+			jobs.ParallelFor(count, [this, &record](size_t start, size_t end)
+			{
+				record(start, end, *m_Queues[Core::JobSystem::GetThreadIndex()]);
+			}, minBatchSize);
+		}
+
+		/*
+		* @brief Like Record(), but culls before calling submit(index, queue) for each visible element.
+		*
+		* bounds(index, sphere) fills in the element's world-space bounding sphere, or returns false
+		* to skip it. Each range gathers its spheres into SoA scratch and tests them with
+		* NuMath::Batch::SoA::CullSpheres, so the per-object cost before the test is just the gather.
+		* Spheres that pass are then tested against the occlusion buffer, if one is set.
+		* Both callbacks run on workers under the same rules as Record().
+		*/
+		template<typename BoundsFn, typename SubmitFn>
+		void RecordVisible(size_t count, BoundsFn&& bounds, SubmitFn&& submit, size_t minBatchSize = k_MinRenderablesPerJob)
+		{
+			Record(count, [this, &bounds, &submit](size_t start, size_t end, RenderQueue& queue)
+			{
+				CullScratch& scratch = *m_Scratch[Core::JobSystem::GetThreadIndex()];
+				scratch.Reserve(end - start);
+
+				size_t gathered = 0;
+				NuMath::Sphere sphere;
+				for (size_t i = start; i < end; ++i)
+				{
+					if (!bounds(i, sphere))
+					{
+						continue;
+					}
+
+					scratch.X[gathered] = sphere.Center.X();
+					scratch.Y[gathered] = sphere.Center.Y();
+					scratch.Z[gathered] = sphere.Center.Z();
+					scratch.Radius[gathered] = sphere.Radius;
+					scratch.Index[gathered] = static_cast<uint32_t>(i);
+					++gathered;
+				}
+
+				const NuMath::SoAVec3Const centers = { scratch.X.data(), scratch.Y.data(), scratch.Z.data() };
+				const size_t visible = NuMath::Batch::SoA::CullSpheres(m_Frustum, centers, scratch.Radius.data(), gathered, scratch.Visible.data());
+
+				for (size_t v = 0; v < visible; ++v)
+				{
+					const uint32_t slot = scratch.Visible[v];
+					if (m_Occlusion && !m_Occlusion->IsVisible(NuMath::Sphere(
+						NuMath::Vector3(scratch.X[slot], scratch.Y[slot], scratch.Z[slot]), scratch.Radius[slot])))
+					{
+						continue;
+					}
+
+					submit(static_cast<size_t>(scratch.Index[slot]), queue);
+				}
+			}, minBatchSize);
+		}
+
+		/*
+		* @brief Occlusion buffer RecordVisible() tests against after the frustum, or null to skip the test.
+		*
+		* Not owned. It must be rasterized for the same camera and left untouched while recording.
+		*/
+		void SetOcclusionBuffer(const OcclusionBuffer* occlusion) noexcept { m_Occlusion = occlusion; }
+
+		/*
+		* @brief Records the draw with its key, without culling.
+		*/
+		void Submit(RenderQueue& queue, const Mesh& mesh, const Material& material, RenderPass pass, const NuMath::Matrix4x4& model) const;
+
+		/*
+		* @brief Culls the bounding sphere against the frame's frustum and, if visible, records the draw with its key.
+		*
+		* @param radius World-space radius of a sphere centred on the model's translation.
+		* @return False if the draw was culled.
+		*/
+		bool SubmitCulled(RenderQueue& queue, const Mesh& mesh, const Material& material, RenderPass pass,
+			const NuMath::Matrix4x4& model, float radius) const;
+
+		/*
+		* @brief Appends every thread's entries to target. Sorting is left to the target.
+		*/
+		void MergeInto(RenderQueue& target) const;
+
+		/*
+		* @brief Draws recorded since BeginFrame() across all threads.
+		*/
+		[[nodiscard]] size_t GetRecordedCount() const noexcept;
+
+		/*
+		* @brief World-space frustum captured by BeginFrame().
+		*/
+		[[nodiscard]] const NuMath::Frustum& GetFrustum() const noexcept { return m_Frustum; }
+
+	private:
+		/*
+		* @brief Per-thread SoA staging for RecordVisible(). Grows to the largest range and is never shrunk.
+		*/
+		struct CullScratch
+		{
+			AlignedVector<float, 32> X, Y, Z, Radius;
+			std::vector<uint32_t> Index;
+			std::vector<uint32_t> Visible;
+
+			void Reserve(size_t count)
+			{
+				if (Index.size() >= count)
+				{
+					return;
+				}
+
+				X.resize(count);
+				Y.resize(count);
+				Z.resize(count);
+				Radius.resize(count);
+				Index.resize(count);
+				Visible.resize(count);
+			}
+		};
+
+		std::vector<std::unique_ptr<RenderQueue>> m_Queues;
+		std::vector<std::unique_ptr<CullScratch>> m_Scratch;
+		NuMath::Frustum m_Frustum;
+		const OcclusionBuffer* m_Occlusion = nullptr;
+		NuMath::Matrix4x4 m_View;
+		float m_InvFarClip = 1.0f;
+	};
+}
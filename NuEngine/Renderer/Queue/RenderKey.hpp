@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief Coarse draw order; every command of a lower pass is drawn before any of a higher one.
+	*/
+	enum class RenderPass : uint8_t
+	{
+		Opaque = 0,
+		Transparent = 1,
+		Overlay = 2
+	};
+
+	/*
+	* @brief Packs draw state into a 64-bit key whose ascending order is the submission order.
+	*
+	* Opaque/Overlay: [pass:4][shader:12][material:16][texture:12][depth:20], front to back inside a state group.
+	* Transparent:    [pass:4][inverted depth:20][shader:12][material:16][texture:12], back to front first.
+	*
+	* Fields are truncated to their widths. Two different states can share a value; that only costs a
+	* state change during replay, which compares the actual objects.
+	*/
+	namespace RenderKey
+	{
+		inline constexpr uint32_t k_ShaderBits = 12;
+		inline constexpr uint32_t k_MaterialBits = 16;
+		inline constexpr uint32_t k_TextureBits = 12;
+		inline constexpr uint32_t k_DepthBits = 20;
+
+		[[nodiscard]] constexpr uint64_t Mask(uint32_t bits) noexcept
+		{
+			return (uint64_t(1) << bits) - 1;
+		}
+
+		/*
+		* @param depth Normalized view depth in [0, 1]; values outside are clamped.
+		*/
+		[[nodiscard]] constexpr uint32_t QuantizeDepth(float depth) noexcept
+		{
+			const float clamped = std::clamp(depth, 0.0f, 1.0f);
+			return static_cast<uint32_t>(clamped * static_cast<float>(Mask(k_DepthBits)));
+		}
+
+		[[nodiscard]] constexpr uint64_t Make(RenderPass pass, uint32_t shader, uint32_t material, uint32_t texture, float depth) noexcept
+		{
+			const uint64_t state =
+				((uint64_t(shader) & Mask(k_ShaderBits)) << (k_MaterialBits + k_TextureBits)) |
+				((uint64_t(material) & Mask(k_MaterialBits)) << k_TextureBits) |
+				(uint64_t(texture) & Mask(k_TextureBits));
+
+			constexpr uint32_t stateBits = k_ShaderBits + k_MaterialBits + k_TextureBits;
+			const uint64_t passBits = uint64_t(static_cast<uint8_t>(pass) & 0xF) << 60;
+			const uint64_t quantized = QuantizeDepth(depth);
+
+			if (pass == RenderPass::Transparent)
+			{
+				return passBits | ((Mask(k_DepthBits) - quantized) << stateBits) | state;
+			}
+
+			return passBits | (state << k_DepthBits) | quantized;
+		}
+
+		[[nodiscard]] constexpr RenderPass GetPass(uint64_t key) noexcept
+		{
+			return static_cast<RenderPass>(key >> 60);
+		}
+	}
+}
@@ -0,0 +1,253 @@
+#include <Renderer/Queue/RenderQueue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+
+namespace NuEngine::Renderer
+{
+	namespace
+	{
+		/*
+		* @brief LSD radix sort on the 64-bit key, 8 bits per pass. Passes where every key has the same digit are skipped.
+		*/
+		void RadixSort(std::vector<RenderQueueEntry>& entries, std::vector<RenderQueueEntry>& scratch)
+		{
+			constexpr size_t k_Passes = 8;
+			constexpr size_t k_Buckets = 256;
+
+			const size_t count = entries.size();
+			if (count < 2)
+			{
+				return;
+			}
+
+			std::array<std::array<uint32_t, k_Buckets>, k_Passes> histograms{};
+			for (const RenderQueueEntry& entry : entries)
+			{
+				for (size_t pass = 0; pass < k_Passes; ++pass)
+				{
+					histograms[pass][(entry.Key >> (pass * 8)) & 0xFF]++;
+				}
+			}
+
+			scratch.resize(count);
+			RenderQueueEntry* source = entries.data();
+			RenderQueueEntry* destination = scratch.data();
+
+			for (size_t pass = 0; pass < k_Passes; ++pass)
+			{
+				std::array<uint32_t, k_Buckets>& histogram = histograms[pass];
+
+				const uint8_t firstDigit = static_cast<uint8_t>((source[0].Key >> (pass * 8)) & 0xFF);
+				if (histogram[firstDigit] == count)
+				{
+					continue;
+				}
+
+				uint32_t offset = 0;
+				for (uint32_t& bucket : histogram)
+				{
+					const uint32_t size = bucket;
+					bucket = offset;
+					offset += size;
+				}
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const uint8_t digit = static_cast<uint8_t>((source[i].Key >> (pass * 8)) & 0xFF);
+					destination[histogram[digit]++] = source[i];
+				}
+
+				std::swap(source, destination);
+			}
+
+			if (source != entries.data())
+			{
+				std::memcpy(entries.data(), source, count * sizeof(RenderQueueEntry));
+			}
+		}
+
+		uint32_t MaterialSortId(const Material& material) noexcept
+		{
+			// Only has to group equal materials; a collision costs a bind check, not correctness
+			const uintptr_t address = reinterpret_cast<uintptr_t>(&material);
+			return static_cast<uint32_t>((address >> 4) ^ (address >> 20));
+		}
+	}
+
+	RenderQueue::RenderQueue(size_t arenaBytes)
+		: m_Arena(arenaBytes)
+	{
+	}
+
+	uint64_t RenderQueue::MakeKey(RenderPass pass, const Material& material, float depth) noexcept
+	{
+		const uint32_t shader = material.Shader ? material.Shader->GetID() : 0;
+		const uint32_t texture = material.Texture ? material.Texture->GetID() : 0;
+		return RenderKey::Make(pass, shader, MaterialSortId(material), texture, depth);
+	}
+
+	void RenderQueue::Submit(uint64_t key, const Mesh& mesh, const Material& material, const NuMath::Matrix4x4& transform)
+	{
+		Submit(key, mesh, material, std::span<const NuMath::Matrix4x4>(&transform, 1));
+	}
+
+	void RenderQueue::Submit(uint64_t key, const Mesh& mesh, const Material& material, std::span<const NuMath::Matrix4x4> transforms)
+	{
+		if (transforms.empty())
+		{
+			return;
+		}
+
+		NuMath::Matrix4x4* copy = m_Arena.AllocateArray<NuMath::Matrix4x4>(transforms.size());
+		if (mesh.IsQuantized)
+		{
+			for (size_t i = 0; i < transforms.size(); ++i)
+			{
+				new (&copy[i]) NuMath::Matrix4x4(GetDrawTransform(mesh, transforms[i]));
+			}
+		}
+		else
+		{
+			std::memcpy(static_cast<void*>(copy), transforms.data(), transforms.size_bytes());
+		}
+
+		DrawCommand* command = m_Arena.New<DrawCommand>();
+		command->Mesh = &mesh;
+		command->Material = &material;
+		command->Transforms = copy;
+		command->InstanceCount = static_cast<uint32_t>(transforms.size());
+
+		m_Entries.push_back({ key, command });
+	}
+
+	void RenderQueue::Append(const RenderQueue& other)
+	{
+		m_Entries.insert(m_Entries.end(), other.m_Entries.begin(), other.m_Entries.end());
+	}
+
+	void RenderQueue::Sort()
+	{
+		RadixSort(m_Entries, m_SortScratch);
+	}
+
+	Core::Result<void, Graphics::GraphicsError> RenderQueue::Execute(
+		Graphics::IRenderDevice& device,
+		const std::shared_ptr<Graphics::IVertexBuffer>& instanceBuffer) noexcept
+	{
+		m_Stats = RenderQueueStats{};
+		m_Stats.Commands = static_cast<uint32_t>(m_Entries.size());
+
+		if (m_Entries.empty() || !instanceBuffer)
+		{
+			return Core::Ok();
+		}
+
+		// All transforms in draw order, so each upload feeds every draw in it through its base instance
+		m_InstanceData.clear();
+		for (const RenderQueueEntry& entry : m_Entries)
+		{
+			const DrawCommand& command = *entry.Command;
+			m_InstanceData.insert(m_InstanceData.end(), command.Transforms, command.Transforms + command.InstanceCount);
+		}
+
+		constexpr uint32_t k_Stride = static_cast<uint32_t>(sizeof(NuMath::Matrix4x4));
+		const uint32_t instanceTotal = static_cast<uint32_t>(m_InstanceData.size());
+		const uint32_t chunkCapacity = std::max(instanceBuffer->GetMaxDataSize() / k_Stride, 1u);
+
+		// Instances [chunkFirst, chunkEnd) are uploaded; streaming buffers put them at chunkBase
+		uint32_t chunkFirst = 0;
+		uint32_t chunkEnd = 0;
+		uint32_t chunkBase = 0;
+
+		Graphics::IShader* boundShader = nullptr;
+		Graphics::ITexture* boundTexture = nullptr;
+		const Graphics::PipelineState* boundPipeline = nullptr;
+		bool textureBound = false;
+
+		uint32_t instance = 0;
+		size_t i = 0;
+		while (i < m_Entries.size())
+		{
+			const DrawCommand& first = *m_Entries[i].Command;
+
+			// Neighbours with the same mesh and material become one instanced draw
+			uint32_t instanceCount = 0;
+			size_t end = i;
+			while (end < m_Entries.size()
+				&& m_Entries[end].Command->Mesh == first.Mesh
+				&& m_Entries[end].Command->Material == first.Material)
+			{
+				instanceCount += m_Entries[end].Command->InstanceCount;
+				++end;
+			}
+
+			const Material& material = *first.Material;
+			if (material.Shader && first.Mesh->VertexArray)
+			{
+				const Graphics::PipelineState& pipeline = material.GetPipeline();
+				if (&pipeline != boundPipeline)
+				{
+					boundPipeline = &pipeline;
+					device.BindPipelineState(pipeline);
+				}
+
+				if (material.Shader.get() != boundShader)
+				{
+					boundShader = material.Shader.get();
+					device.BindShader(boundShader);
+					m_Stats.ShaderBinds++;
+				}
+
+				if (!textureBound || material.Texture.get() != boundTexture)
+				{
+					boundTexture = material.Texture.get();
+					textureBound = true;
+					device.BindTexture(boundTexture, 0);
+					m_Stats.TextureBinds++;
+				}
+
+				AttachInstanceBuffer(*first.Mesh, instanceBuffer);
+
+				// A draw crossing the end of an upload is split; the next upload may wait for the part already issued
+				const uint32_t drawEnd = instance + instanceCount;
+				for (uint32_t part = instance; part < drawEnd;)
+				{
+					if (part < chunkFirst || part >= chunkEnd)
+					{
+						chunkFirst = part;
+						chunkEnd = part + std::min(chunkCapacity, instanceTotal - part);
+						if (!instanceBuffer->SetData(&m_InstanceData[chunkFirst], (chunkEnd - chunkFirst) * k_Stride))
+						{
+							return Core::Err(Graphics::GraphicsError(Graphics::GraphicsErrorCode::OutOfMemory));
+						}
+						chunkBase = instanceBuffer->GetDataOffset() / k_Stride;
+					}
+
+					const uint32_t partCount = std::min(drawEnd, chunkEnd) - part;
+					auto drawResult = device.DrawInstanced(first.Mesh->VertexArray, first.Mesh->VertexCount, partCount, chunkBase + (part - chunkFirst));
+					if (drawResult.IsError())
+					{
+						return drawResult;
+					}
+					m_Stats.DrawCalls++;
+					part += partCount;
+				}
+			}
+
+			instance += instanceCount;
+			i = end;
+		}
+
+		// Nothing is unbound: the device skips whatever the next queue binds again
+		return Core::Ok();
+	}
+
+	void RenderQueue::Reset() noexcept
+	{
+		m_Entries.clear();
+		m_Arena.Reset();
+	}
+}
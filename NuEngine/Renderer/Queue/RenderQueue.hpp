@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <Core/Memory/LinearAllocator.hpp>
+#include <Core/Types/Result.hpp>
+#include <Graphics/Abstractions/Core/IRenderDevice.hpp>
+#include <Graphics/Errors/GraphicsError.hpp>
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Material.hpp>
+#include <Renderer/Queue/RenderKey.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuEngine/Core/API.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Renderer
+{
+	/*
+	* @brief One recorded draw. Lives in the queue's frame arena until Reset().
+	*/
+	struct DrawCommand
+	{
+		const Renderer::Mesh* Mesh = nullptr;
+		const Renderer::Material* Material = nullptr;
+		const NuMath::Matrix4x4* Transforms = nullptr;
+		uint32_t InstanceCount = 0;
+	};
+
+	struct RenderQueueEntry
+	{
+		uint64_t Key;
+		const DrawCommand* Command;
+	};
+
+	/*
+	* @brief What the last Execute() sent to the device.
+	*/
+	struct RenderQueueStats
+	{
+		uint32_t Commands = 0;
+		uint32_t DrawCalls = 0;
+		uint32_t ShaderBinds = 0;
+		uint32_t TextureBinds = 0;
+	};
+
+	/*
+	* @brief Records draws into a frame arena, radix-sorts them by RenderKey and replays them.
+	*
+	* Recording and sorting never touch the device, so they run headless. Execute() merges
+	* neighbouring commands with the same mesh and material into one instanced draw and only
+	* rebinds shaders/textures when they change. Not thread-safe; record one queue per thread
+	* and combine them with Append().
+	*/
+	class NU_API RenderQueue
+	{
+	public:
+		explicit RenderQueue(size_t arenaBytes = 1024 * 1024);
+
+		/*
+		* @brief Key for a draw of material at normalized view depth, built from the material's shader/texture IDs.
+		*/
+		[[nodiscard]] static uint64_t MakeKey(RenderPass pass, const Material& material, float depth) noexcept;
+
+		void Submit(uint64_t key, const Mesh& mesh, const Material& material, const NuMath::Matrix4x4& transform);
+		void Submit(uint64_t key, const Mesh& mesh, const Material& material, std::span<const NuMath::Matrix4x4> transforms);
+
+		/*
+		* @brief Adds another queue's entries. other must not be Reset() before this queue is executed.
+		*/
+		void Append(const RenderQueue& other);
+
+		/*
+		* @brief Orders the entries by key. Stable: equal keys keep their submission order.
+		*/
+		void Sort();
+
+		/*
+		* @brief Draws the sorted entries. Transforms reach the shader as per-instance attributes from instanceBuffer.
+		*
+		* Camera matrices come from the Frame uniform block, which the caller uploads once per frame.
+		* Transforms go up in parts of at most GetMaxDataSize(), splitting draws that cross a part;
+		* an upload that fails returns OutOfMemory rather than drawing from stale data.
+		*/
+		Core::Result<void, Graphics::GraphicsError> Execute(
+			Graphics::IRenderDevice& device,
+			const std::shared_ptr<Graphics::IVertexBuffer>& instanceBuffer) noexcept;
+
+		/*
+		* @brief Drops all entries and recycles the arena.
+		*/
+		void Reset() noexcept;
+
+		[[nodiscard]] std::span<const RenderQueueEntry> GetEntries() const noexcept { return m_Entries; }
+		[[nodiscard]] size_t GetSize() const noexcept { return m_Entries.size(); }
+		[[nodiscard]] const RenderQueueStats& GetStats() const noexcept { return m_Stats; }
+
+	private:
+		Core::LinearAllocator m_Arena;
+		std::vector<RenderQueueEntry> m_Entries;
+		std::vector<RenderQueueEntry> m_SortScratch;
+		std::vector<NuMath::Matrix4x4> m_InstanceData;
+		RenderQueueStats m_Stats;
+	};
+}
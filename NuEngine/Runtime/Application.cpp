@@ -8,6 +8,7 @@
 #include <Renderer/Camera.hpp>
 #include <Core/Timer/Time.hpp>
 #include <Core/Input/Input.hpp>
+#include <Core/Threading/JobSystem.hpp>
 #include <Physics/Core/PhysicsEngine.hpp>
 
 #include <iostream>
@@ -70,7 +71,8 @@ namespace NuEngine::Runtime
 
 	Core::Result<std::unique_ptr<Graphics::IRenderDevice>, EngineError> Application::CreateRenderDevice(Platform::IWindow* window) noexcept
 	{
-		NU_UNWRAP(device, Graphics::GraphicsFactory::CreateDevice(Graphics::GraphicsAPI::OpenGL, window));
+		const Graphics::GraphicsAPI api = m_specification.Headless ? Graphics::GraphicsAPI::Null : Graphics::GraphicsAPI::OpenGL;
+		NU_UNWRAP(device, Graphics::GraphicsFactory::CreateDevice(api, window));
 		return Core::Ok(std::move(device));
 	}
 
@@ -83,7 +85,14 @@ namespace NuEngine::Runtime
 
 		LOG_INFO("Initializing Subsystems...");
 
-		if (m_specification.Windowed)
+		if (m_specification.Headless)
+		{
+			LOG_INFO("Running headless on a null render device.");
+
+			NU_UNWRAP(device, CreateRenderDevice(nullptr));
+			m_renderDevice = std::move(device);
+		}
+		else if (m_specification.Windowed)
 		{
 			NU_UNWRAP(window, CreateAppWindow());
 			m_window = std::move(window);
@@ -102,11 +111,12 @@ namespace NuEngine::Runtime
 		}
 
 		Core::Time::Initialize();
+		Core::JobSystem::Get().Initialize();
 
-		auto physRes = Physics::PhysicsEngine::Initialize();
+		auto physRes = Physics::PhysicsEngine::Initialize(m_specification.PhysicsSettings);
 		if (physRes.IsError())
 		{
-			LOG_ERROR("Failed to initialize Physics Engine!");
+			LOG_ERROR("Failed to initialize Physics Engine: {}", physRes.UnwrapError().ToString());
 		}
 
 		m_isRunning = true;
@@ -125,7 +135,7 @@ namespace NuEngine::Runtime
 
 		LOG_INFO("Entering main loop...");
 
-		if (!m_specification.Windowed)
+		if (!m_specification.Windowed && !m_specification.Headless)
 		{
 			return Core::Ok();
 		}
@@ -139,6 +149,11 @@ namespace NuEngine::Runtime
 				m_isRunning = false;
 				return loopResult;
 			}
+
+			if (m_specification.MaxFrames != 0 && m_totalFrames >= m_specification.MaxFrames)
+			{
+				m_isRunning = false;
+			}
 		}
 
 		return Core::Ok();
@@ -153,6 +168,7 @@ namespace NuEngine::Runtime
 
 		m_state = AppState::ShuttingDown;
 		Physics::PhysicsEngine::Shutdown();
+		Core::JobSystem::Get().Shutdown();
 		m_pipeline.reset();
 		m_renderDevice.reset();
 		m_window.reset();
@@ -319,6 +335,11 @@ namespace NuEngine::Runtime
 
 		OnRender();
 
+		if (m_pipeline)
+		{
+			NU_CHECK(m_pipeline->Flush());
+		}
+
 		if (m_renderDevice)
 		{
 			auto presentResult = m_renderDevice->Present();
@@ -329,6 +350,7 @@ namespace NuEngine::Runtime
 			}
 		}
 
+		m_totalFrames++;
 		return Core::Ok();
 	}
 
@@ -341,6 +363,11 @@ namespace NuEngine::Runtime
 		
 		OnRender();
 
+		if (m_pipeline)
+		{
+			m_pipeline->Flush().Ignore();
+		}
+
 		if (m_renderDevice) m_renderDevice->Present();
 	}
 
@@ -370,11 +397,12 @@ namespace NuEngine::Runtime
 		}
 
 		Core::Time::Initialize();
+		Core::JobSystem::Get().Initialize();
 
-		auto physRes = Physics::PhysicsEngine::Initialize();
+		auto physRes = Physics::PhysicsEngine::Initialize(m_specification.PhysicsSettings);
 		if (physRes.IsError())
 		{
-			LOG_ERROR("Failed to initialize Physics Engine!");
+			LOG_ERROR("Failed to initialize Physics Engine: {}", physRes.UnwrapError().ToString());
 		}
 
 		m_state = AppState::Running;
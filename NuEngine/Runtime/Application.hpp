@@ -11,6 +11,7 @@
 #include <Renderer/Pipelines/Forward/ForwardPipeline.hpp>
 #include <Graphics/Abstractions/Core/IRenderDevice.hpp>
 #include <Platform/IWindow.hpp>
+#include <Physics/Core/PhysicsSettings.hpp>
 #include <NuEngine/Core/API.hpp>
 
 #include <NuMath/NuMath.hpp>
@@ -24,6 +25,16 @@ namespace NuEngine::Runtime
     {
         std::string Name = "NuEngine App";
         bool Windowed = true;
+
+        /**
+         * @brief Run the full frame loop without a window on a Graphics::GraphicsAPI::Null device.
+         *
+         * Nothing waits on vsync or a swap chain, so frames run as fast as update and render prep allow.
+         * Takes precedence over Windowed.
+         */
+        bool Headless = false;
+        uint64_t MaxFrames = 0;  // Stop Run() after this many frames; 0 runs until Close()
+        Physics::PhysicsSettings PhysicsSettings;
     };
 
     /**
@@ -97,6 +108,18 @@ namespace NuEngine::Runtime
          */
         Platform::IWindow* GetWindow() const { return m_window.get(); }
 
+        /**
+         * @brief Render device in use; a Graphics::Null::NullRenderDevice in headless mode.
+         */
+        Graphics::IRenderDevice* GetRenderDevice() const { return m_renderDevice.get(); }
+
+        /**
+         * @brief Leaves the main loop after the current frame.
+         */
+        void Close() noexcept { m_isRunning = false; }
+
+        uint64_t GetFrameCount() const noexcept { return m_totalFrames; }
+
         /**
          * @brief
          */
@@ -201,6 +224,7 @@ namespace NuEngine::Runtime
         float m_fpsTimer = 0.0f;
         uint32_t m_frameCount = 0;
         uint32_t m_lastFPS = 0;
+        uint64_t m_totalFrames = 0;
     };
 
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include <NuEngine/Weave/WeaveScriptSystem.hpp>
 #include <NuEngine/Weave/WeaveComponent.hpp>
 #include <NuEngine/Weave/WeaveChunkSystem.hpp> // <-- ДОДАНО ДЛЯ DoD
+#include <NuEngine/Renderer/Pipelines/Forward/ForwardPipeline.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace NuEngine::Runtime
 {
@@ -14,6 +19,10 @@ namespace NuEngine::Runtime
 
     void Scene::OnUpdate(float deltaTime)
     {
+        // 0. Завершення попереднього кроку фізики: скрипти та запити бачать останній завершений стан без очікування
+        Physics::PhysicsEngine::CompleteStep();
+        DispatchCollisions();
+
         // 1. Оновлення масових SoA систем (DoD)
         for (auto& [asset, manager] : m_MassWeaveSystems)
         {
@@ -31,7 +40,7 @@ namespace NuEngine::Runtime
         }
 
         // 3. Фізика
-        Physics::PhysicsEngine::Update(deltaTime);
+        Physics::PhysicsEngine::BeginStep(deltaTime);
 
         // 4. Синхронізація
         auto view = m_Registry.view<ECS::TransformComponent, ECS::RigidBodyComponent>();
@@ -46,5 +55,255 @@ namespace NuEngine::Runtime
                 transform.Rotation = physics.Body.GetRotation();
             }
         }
+
+        // 5. Просторовий індекс
+        UpdateSpatialIndex();
+    }
+
+    void Scene::SubmitRenderables(Renderer::ForwardPipeline& pipeline)
+    {
+        const auto camera = pipeline.GetCamera();
+        if (!camera)
+        {
+            return;
+        }
+
+        m_RenderRecorder.BeginFrame(camera->GetViewMatrix(), camera->GetProjectionMatrix(), camera->GetFarClip());
+
+        // Occluders are rasterized before recording, so RecordVisible can drop what they hide
+        m_Occlusion.BeginFrame(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+        auto occluders = m_Registry.view<ECS::OccluderComponent, ECS::TransformComponent>();
+        for (auto entity : occluders)
+        {
+            const ECS::TransformComponent& transform = occluders.get<ECS::TransformComponent>(entity);
+            const NuMath::Matrix4x4 model = NuMath::Transform(transform.Position, transform.Rotation, transform.Scale).GetMatrix();
+            m_Occlusion.AddOccluderBox(model, occluders.get<ECS::OccluderComponent>(entity).HalfExtents);
+        }
+
+        if (m_Occlusion.HasOccluders())
+        {
+            m_Occlusion.Rasterize();
+            m_RenderRecorder.SetOcclusionBuffer(&m_Occlusion);
+        }
+        else
+        {
+            m_RenderRecorder.SetOcclusionBuffer(nullptr);
+        }
+
+        // Fetched up front: workers only read from the pools, so the registry is never modified concurrently
+        const auto& renderers = m_Registry.storage<ECS::MeshRendererComponent>();
+        const auto& transforms = m_Registry.storage<ECS::TransformComponent>();
+
+        // Bounds first so the model matrix is only composed for entities that survive the frustum test
+        m_RenderRecorder.RecordVisible(renderers.size(),
+            [&](size_t i, NuMath::Sphere& bounds)
+            {
+                const entt::entity entity = renderers[i];
+                const ECS::MeshRendererComponent& renderer = renderers.get(entity);
+                if (!renderer.Mesh || !renderer.Material || !transforms.contains(entity))
+                {
+                    return false;
+                }
+
+                const ECS::TransformComponent& transform = transforms.get(entity);
+                const float scale = std::max({ std::abs(transform.Scale.X()), std::abs(transform.Scale.Y()), std::abs(transform.Scale.Z()) });
+                bounds = NuMath::Sphere(transform.Position, renderer.BoundingRadius * scale);
+                return true;
+            },
+            [&](size_t i, Renderer::RenderQueue& queue)
+            {
+                const entt::entity entity = renderers[i];
+                const ECS::MeshRendererComponent& renderer = renderers.get(entity);
+                const ECS::TransformComponent& transform = transforms.get(entity);
+                const NuMath::Matrix4x4 model = NuMath::Transform(transform.Position, transform.Rotation, transform.Scale).GetMatrix();
+
+                m_RenderRecorder.Submit(queue, *renderer.Mesh, *renderer.Material, renderer.Pass, model);
+            });
+
+        m_RenderRecorder.MergeInto(pipeline.GetRenderQueue());
+    }
+
+    void Scene::UpdateSpatialIndex()
+    {
+        const auto& renderers = m_Registry.storage<ECS::MeshRendererComponent>();
+        const auto& transforms = m_Registry.storage<ECS::TransformComponent>();
+
+        m_SpatialScratch.clear();
+        m_SpatialBounds.clear();
+        for (size_t i = 0; i < renderers.size(); ++i)
+        {
+            const entt::entity entity = renderers[i];
+            if (!transforms.contains(entity))
+            {
+                continue;
+            }
+
+            const ECS::TransformComponent& transform = transforms.get(entity);
+            const float scale = std::max({ std::abs(transform.Scale.X()), std::abs(transform.Scale.Y()), std::abs(transform.Scale.Z()) });
+            const float radius = renderers.get(entity).BoundingRadius * scale;
+
+            m_SpatialScratch.push_back(entity);
+            m_SpatialBounds.push_back(NuMath::AABB::FromCenterExtents(transform.Position, NuMath::Vector3(radius, radius, radius)));
+        }
+
+        if (m_SpatialScratch == m_SpatialEntities && !m_SpatialIndex.IsEmpty())
+        {
+            m_SpatialIndex.Refit(m_SpatialBounds);
+            return;
+        }
+
+        m_SpatialEntities.swap(m_SpatialScratch);
+        m_SpatialIndex.Build(m_SpatialBounds);
+    }
+
+    entt::entity Scene::Raycast(const NuMath::Ray& ray, float maxDistance) const
+    {
+        const BVHRayHit hit = m_SpatialIndex.Raycast(ray, maxDistance);
+        return hit.IsHit() ? m_SpatialEntities[hit.Index] : entt::null;
+    }
+
+    void Scene::FindBodyEntities(std::span<const uint32_t> bodies, std::span<entt::entity> outEntities) const
+    {
+        std::fill(outEntities.begin(), outEntities.end(), entt::null);
+
+        std::vector<ContactBodyRef> sorted;
+        sorted.reserve(bodies.size());
+        for (uint32_t i = 0; i < bodies.size(); ++i)
+        {
+            if (bodies[i] != Physics::k_InvalidBodyHandle)
+            {
+                sorted.push_back({ bodies[i], i });
+            }
+        }
+
+        if (sorted.empty())
+        {
+            return;
+        }
+
+        std::sort(sorted.begin(), sorted.end(),
+            [](const ContactBodyRef& a, const ContactBodyRef& b) { return a.Body < b.Body; });
+
+        auto view = m_Registry.view<const ECS::RigidBodyComponent>();
+        for (auto entity : view)
+        {
+            const uint32_t handle = view.get<const ECS::RigidBodyComponent>(entity).Body.GetHandle();
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), handle,
+                [](const ContactBodyRef& ref, uint32_t body) { return ref.Body < body; });
+
+            for (; it != sorted.end() && it->Body == handle; ++it)
+            {
+                outEntities[it->Slot] = entity;
+            }
+        }
+    }
+
+    void Scene::DispatchCollisions()
+    {
+        const std::span<const Physics::ContactEvent> events = Physics::PhysicsEngine::GetContactEvents();
+        if (events.empty())
+        {
+            return;
+        }
+
+        m_ContactBodies.clear();
+        m_ContactBodies.reserve(events.size() * 2);
+        for (uint32_t i = 0; i < events.size(); ++i)
+        {
+            m_ContactBodies.push_back({ events[i].Body1, i * 2 });
+            m_ContactBodies.push_back({ events[i].Body2, i * 2 + 1 });
+        }
+        std::sort(m_ContactBodies.begin(), m_ContactBodies.end(),
+            [](const ContactBodyRef& a, const ContactBodyRef& b) { return a.Body < b.Body; });
+
+        // Resolve body -> entity for both sides of every event with one lookup per physics entity
+        m_ContactEntities.assign(events.size() * 2, entt::null);
+        auto bodies = m_Registry.view<ECS::RigidBodyComponent>();
+        for (auto entity : bodies)
+        {
+            const uint32_t handle = bodies.get<ECS::RigidBodyComponent>(entity).Body.GetHandle();
+            auto it = std::lower_bound(m_ContactBodies.begin(), m_ContactBodies.end(), handle,
+                [](const ContactBodyRef& ref, uint32_t body) { return ref.Body < body; });
+
+            for (; it != m_ContactBodies.end() && it->Body == handle; ++it)
+            {
+                m_ContactEntities[it->Slot] = entity;
+            }
+        }
+
+        for (uint32_t slot = 0; slot < m_ContactEntities.size(); ++slot)
+        {
+            const entt::entity entity = m_ContactEntities[slot];
+            if (entity == entt::null)
+            {
+                continue;
+            }
+
+            auto* weaveComp = m_Registry.try_get<Weave::WeaveComponent>(entity);
+            if (!weaveComp || !weaveComp->Asset || !weaveComp->Asset->HasOnCollide())
+            {
+                continue;
+            }
+
+            // Scripts see the contact from their own side: Body1 is self, the normal points at the other body
+            Physics::ContactEvent contact = events[slot / 2];
+            if (slot & 1)
+            {
+                std::swap(contact.Body1, contact.Body2);
+                contact.Normal = -contact.Normal;
+            }
+
+            const entt::entity other = m_ContactEntities[slot ^ 1];
+            Weave::WeaveScriptSystem::DispatchCollision(
+                *weaveComp,
+                static_cast<uint32_t>(entity),
+                static_cast<uint32_t>(other),
+                contact,
+                this);
+        }
+    }
+
+    Core::Result<void, Physics::PhysicsError> Scene::SaveSnapshot(SceneSnapshot& outSnapshot, Physics::PhysicsSaveMode mode, Physics::PhysicsDeltaBaseline* baseline)
+    {
+        auto result = Physics::PhysicsEngine::SaveState(outSnapshot.Physics, mode, baseline);
+        if (result.IsError())
+        {
+            return result;
+        }
+
+        auto view = m_Registry.view<ECS::TransformComponent>();
+
+        outSnapshot.Entities.clear();
+        outSnapshot.Transforms.clear();
+        outSnapshot.Entities.reserve(view.size());
+        outSnapshot.Transforms.reserve(view.size());
+
+        for (auto entity : view)
+        {
+            outSnapshot.Entities.push_back(entity);
+            outSnapshot.Transforms.push_back(view.get<ECS::TransformComponent>(entity));
+        }
+
+        return Core::Ok();
+    }
+
+    Core::Result<void, Physics::PhysicsError> Scene::RestoreSnapshot(const SceneSnapshot& snapshot, Physics::PhysicsDeltaBaseline* baseline)
+    {
+        auto result = Physics::PhysicsEngine::RestoreState(snapshot.Physics, baseline);
+        if (result.IsError())
+        {
+            return result;
+        }
+
+        for (size_t i = 0; i < snapshot.Entities.size(); ++i)
+        {
+            const entt::entity entity = snapshot.Entities[i];
+            if (m_Registry.valid(entity) && m_Registry.all_of<ECS::TransformComponent>(entity))
+            {
+                m_Registry.get<ECS::TransformComponent>(entity) = snapshot.Transforms[i];
+            }
+        }
+
+        return Core::Ok();
     }
-}
\ No newline at end of file
+}
@@ -7,11 +7,21 @@
 #include <NuEngine/ECS/Entity.hpp>
 #include <NuEngine/ECS/Components.hpp>
 #include <NuEngine/Core/API.hpp>
+#include <NuEngine/Runtime/Scene/SceneSnapshot.hpp>
+#include <NuEngine/Renderer/Queue/ParallelRenderRecorder.hpp>
+#include <NuEngine/Runtime/Spatial/BVH.hpp>
 
 #include <entt/entt.hpp>
+#include <span>
 #include <unordered_map>
+#include <vector>
 #include <NuEngine/Weave/WeaveChunk.hpp> 
 
+namespace NuEngine::Renderer
+{
+    class ForwardPipeline;
+}
+
 namespace NuEngine::Runtime
 {
     class NU_API Scene
@@ -25,6 +35,58 @@ namespace NuEngine::Runtime
 
         entt::registry& GetRegistry() { return m_Registry; }
 
+        /**
+         * @brief Culls and records every MeshRendererComponent into the pipeline's render queue.
+         *
+         * Matrix composition, culling and key generation run on the JobSystem, one RenderQueue per
+         * thread; the merged queue is sorted and drawn by ForwardPipeline::Flush on the calling thread.
+         * Call once per frame between ForwardPipeline::Render and Flush.
+         */
+        void SubmitRenderables(Renderer::ForwardPipeline& pipeline);
+
+        /**
+         * @brief Brings the BVH over every MeshRendererComponent's bounding sphere up to date.
+         *
+         * Refits while the set of renderables is unchanged and rebuilds when it changes.
+         * OnUpdate calls this after transforms are synced from physics.
+         */
+        void UpdateSpatialIndex();
+
+        /**
+         * @brief BVH queries report indices; GetSpatialEntity maps them back to entities.
+         */
+        [[nodiscard]] const BVH& GetSpatialIndex() const { return m_SpatialIndex; }
+        [[nodiscard]] entt::entity GetSpatialEntity(uint32_t index) const { return m_SpatialEntities[index]; }
+
+        /**
+         * @brief Closest renderable whose bounds the ray hits within maxDistance, or entt::null.
+         */
+        [[nodiscard]] entt::entity Raycast(const NuMath::Ray& ray, float maxDistance) const;
+
+        /**
+         * @brief Maps physics body handles to the entities whose RigidBodyComponent owns them.
+         *
+         * One pass over the rigid bodies for the whole batch; unknown handles map to entt::null.
+         */
+        void FindBodyEntities(std::span<const uint32_t> bodies, std::span<entt::entity> outEntities) const;
+
+        /**
+         * @brief Captures the physics world and every TransformComponent into outSnapshot.
+         *
+         * Reuses the snapshot's buffers, so saving into the same object each frame does not allocate.
+         * A Delta save diffs against baseline; see PhysicsEngine::SaveState.
+         */
+        Core::Result<void, Physics::PhysicsError> SaveSnapshot(SceneSnapshot& outSnapshot, Physics::PhysicsSaveMode mode = Physics::PhysicsSaveMode::Full,
+            Physics::PhysicsDeltaBaseline* baseline = nullptr);
+
+        /**
+         * @brief Puts the physics world and transforms back to the snapshot. Much cheaper than rebuilding the scene.
+         *
+         * A Delta snapshot must be applied on top of the state it was saved after; SceneSnapshotRing handles that.
+         * Entities destroyed since the save are skipped.
+         */
+        Core::Result<void, Physics::PhysicsError> RestoreSnapshot(const SceneSnapshot& snapshot, Physics::PhysicsDeltaBaseline* baseline = nullptr);
+
         void AddMassScript(ECS::Entity entity, const Weave::WeaveGraphAsset* asset)
         {
             if (!asset) return;
@@ -41,8 +103,31 @@ namespace NuEngine::Runtime
         }
 
     private:
+        /**
+         * @brief Runs the OnCollide entry point of every scripted entity in the last completed step's contact events.
+         */
+        void DispatchCollisions();
+
+        struct ContactBodyRef
+        {
+            uint32_t Body;
+            uint32_t Slot;  // Event index * 2 + side, or query index in FindBodyEntities
+        };
+
         entt::registry m_Registry;
 
+        // Reused every frame by DispatchCollisions
+        std::vector<ContactBodyRef> m_ContactBodies;
+        std::vector<entt::entity> m_ContactEntities;
+
+        Renderer::ParallelRenderRecorder m_RenderRecorder;
+        Renderer::OcclusionBuffer m_Occlusion;
+
+        BVH m_SpatialIndex;
+        std::vector<entt::entity> m_SpatialEntities;
+        std::vector<NuMath::AABB> m_SpatialBounds;
+        std::vector<entt::entity> m_SpatialScratch;
+
         std::unordered_map<const Weave::WeaveGraphAsset*, Weave::WeavePoolManager> m_MassWeaveSystems;
 
         friend class ECS::Entity;
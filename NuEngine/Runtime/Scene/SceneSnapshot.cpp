@@ -0,0 +1,119 @@
+#include <Runtime/Scene/SceneSnapshot.hpp>
+#include <Runtime/Scene/Scene.hpp>
+#include <NuEngine/Physics/Core/PhysicsEngine.hpp>
+
+#include <algorithm>
+
+namespace NuEngine::Runtime
+{
+    SceneSnapshotRing::SceneSnapshotRing(size_t capacity, uint32_t keyframeInterval)
+        : m_Slots(std::max<size_t>(capacity, 1))
+        , m_KeyframeInterval(std::max<uint32_t>(keyframeInterval, 1))
+    {
+    }
+
+    size_t SceneSnapshotRing::SlotAt(size_t age) const noexcept
+    {
+        return (m_Head + age) % m_Slots.size();
+    }
+
+    Core::Result<void, Physics::PhysicsError> SceneSnapshotRing::Record(Scene& scene, uint64_t frame)
+    {
+        const bool keyframe = m_Count == 0 || m_FramesSinceKeyframe + 1 >= m_KeyframeInterval;
+
+        size_t slot;
+        if (m_Count < m_Slots.size())
+        {
+            slot = SlotAt(m_Count);
+            ++m_Count;
+        }
+        else
+        {
+            // Overwrite the oldest entry; its buffers keep their capacity
+            slot = m_Head;
+            m_Head = (m_Head + 1) % m_Slots.size();
+        }
+
+        SceneSnapshot& snapshot = m_Slots[slot];
+        snapshot.Frame = frame;
+
+        auto result = scene.SaveSnapshot(snapshot, keyframe ? Physics::PhysicsSaveMode::Full : Physics::PhysicsSaveMode::Delta, &m_Baseline);
+        if (result.IsError())
+        {
+            Clear();
+            return result;
+        }
+
+        m_FramesSinceKeyframe = snapshot.Physics.Mode == Physics::PhysicsSaveMode::Full ? 0 : m_FramesSinceKeyframe + 1;
+        return Core::Ok();
+    }
+
+    bool SceneSnapshotRing::FindFrame(uint64_t frame, size_t& outAge, size_t& outKeyAge) const noexcept
+    {
+        for (size_t age = 0; age < m_Count; ++age)
+        {
+            if (m_Slots[SlotAt(age)].Frame != frame)
+            {
+                continue;
+            }
+
+            for (size_t keyAge = age + 1; keyAge-- > 0;)
+            {
+                if (m_Slots[SlotAt(keyAge)].Physics.Mode == Physics::PhysicsSaveMode::Full)
+                {
+                    outAge = age;
+                    outKeyAge = keyAge;
+                    return true;
+                }
+            }
+            return false;
+        }
+        return false;
+    }
+
+    bool SceneSnapshotRing::CanRestore(uint64_t frame) const noexcept
+    {
+        size_t age, keyAge;
+        return FindFrame(frame, age, keyAge);
+    }
+
+    Core::Result<void, Physics::PhysicsError> SceneSnapshotRing::Restore(Scene& scene, uint64_t frame)
+    {
+        size_t age, keyAge;
+        if (!FindFrame(frame, age, keyAge))
+        {
+            return Core::Err(Physics::PhysicsError(Physics::PhysicsErrorCode::InvalidParameter,
+                std::format("Frame {} (or its keyframe) is no longer in the snapshot ring", frame)));
+        }
+
+        // Keyframe first, then each delta up to (not including) the target, which Scene restores along with ECS
+        for (size_t i = keyAge; i < age; ++i)
+        {
+            auto result = Physics::PhysicsEngine::RestoreState(m_Slots[SlotAt(i)].Physics);
+            if (result.IsError())
+            {
+                return result;
+            }
+        }
+
+        auto result = scene.RestoreSnapshot(m_Slots[SlotAt(age)], &m_Baseline);
+        if (result.IsError())
+        {
+            return result;
+        }
+
+        // Newer frames describe a future that no longer happened
+        m_Count = age + 1;
+        m_FramesSinceKeyframe = static_cast<uint32_t>(age - keyAge);
+
+        return Core::Ok();
+    }
+
+    void SceneSnapshotRing::Clear() noexcept
+    {
+        m_Head = 0;
+        m_Count = 0;
+        m_FramesSinceKeyframe = 0;
+        m_Baseline = {};
+    }
+}
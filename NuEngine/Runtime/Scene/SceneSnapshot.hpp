@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuEngine/ECS/Components.hpp>
+#include <NuEngine/Core/API.hpp>
+#include <Core/Types/Result.hpp>
+#include <Physics/Core/PhysicsState.hpp>
+#include <Physics/Errors/PhysicsError.hpp>
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace NuEngine::Runtime
+{
+    class Scene;
+
+    /**
+     * @brief Physics world state plus the ECS components the simulation writes to.
+     */
+    struct SceneSnapshot
+    {
+        uint64_t Frame = 0;
+        Physics::PhysicsSnapshot Physics;
+        std::vector<entt::entity> Entities;
+        std::vector<ECS::TransformComponent> Transforms;
+    };
+
+    /**
+     * @brief Ring of the last N scene snapshots for rollback.
+     *
+     * Every KeyframeInterval-th frame stores the full physics state; frames in between store
+     * deltas. Restoring a frame replays its keyframe and the deltas after it, then drops
+     * every newer frame so recording can continue from there. The ring keeps its own delta
+     * baseline, so other SaveState calls do not break its chain.
+     */
+    class NU_API SceneSnapshotRing
+    {
+    public:
+        explicit SceneSnapshotRing(size_t capacity = 64, uint32_t keyframeInterval = 16);
+
+        Core::Result<void, Physics::PhysicsError> Record(Scene& scene, uint64_t frame);
+        Core::Result<void, Physics::PhysicsError> Restore(Scene& scene, uint64_t frame);
+
+        /**
+         * @brief True if the frame and the keyframe it depends on are still in the ring.
+         */
+        [[nodiscard]] bool CanRestore(uint64_t frame) const noexcept;
+
+        void Clear() noexcept;
+
+        [[nodiscard]] size_t GetCount() const noexcept { return m_Count; }
+        [[nodiscard]] size_t GetCapacity() const noexcept { return m_Slots.size(); }
+
+    private:
+        [[nodiscard]] size_t SlotAt(size_t age) const noexcept;  // age 0 = oldest
+        [[nodiscard]] bool FindFrame(uint64_t frame, size_t& outAge, size_t& outKeyAge) const noexcept;
+
+        std::vector<SceneSnapshot> m_Slots;
+        size_t m_Head = 0;   // Slot of the oldest entry
+        size_t m_Count = 0;
+        uint32_t m_KeyframeInterval;
+        uint32_t m_FramesSinceKeyframe = 0;
+        Physics::PhysicsDeltaBaseline m_Baseline;   // State the next delta is diffed against: the newest entry
+    };
+}
@@ -0,0 +1,472 @@
+#include <Runtime/Spatial/BVH.hpp>
+
+#include <algorithm>
+
+namespace NuEngine::Runtime
+{
+    namespace
+    {
+        constexpr uint32_t k_BinCount = 12;
+        constexpr float k_Infinity = std::numeric_limits<float>::infinity();
+
+        NuMath::AABB EmptyBounds()
+        {
+            return NuMath::AABB(NuMath::Vector3(k_Infinity, k_Infinity, k_Infinity), NuMath::Vector3(-k_Infinity, -k_Infinity, -k_Infinity));
+        }
+
+        NuMath::AABB Grow(const NuMath::AABB& box, const NuMath::AABB& other)
+        {
+            return NuMath::AABB(box.Min.Min(other.Min), box.Max.Max(other.Max));
+        }
+
+        // Half the surface area; the SAH only compares ratios
+        float HalfArea(const NuMath::AABB& box)
+        {
+            const NuMath::Vector3 size = box.Max - box.Min;
+            if (size.X() < 0.0f)
+            {
+                return 0.0f;
+            }
+            return size.X() * size.Y() + size.Y() * size.Z() + size.Z() * size.X();
+        }
+
+        float Axis(const NuMath::Vector3& v, int axis)
+        {
+            return axis == 0 ? v.X() : (axis == 1 ? v.Y() : v.Z());
+        }
+    }
+
+    void BVH::Build(std::span<const NuMath::AABB> bounds)
+    {
+        Clear();
+        if (bounds.empty())
+        {
+            return;
+        }
+
+        const uint32_t count = static_cast<uint32_t>(bounds.size());
+        m_BuildItems.resize(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_BuildItems[i] = { bounds[i], bounds[i].GetCenter(), i };
+        }
+
+        m_LeafNodes.resize(count);
+        m_Nodes.reserve(count / 2 + 1);
+        m_Parents.reserve(count / 2 + 1);
+
+        BuildNode(0, count, 0);
+
+        m_LeafBounds.resize(count);
+        m_LeafIndices.resize(count);
+        m_PrimitiveSlots.resize(count);
+        for (uint32_t slot = 0; slot < count; ++slot)
+        {
+            const BuildItem& item = m_BuildItems[slot];
+            m_LeafBounds[slot] = item.Bounds;
+            m_LeafIndices[slot] = item.Index;
+            m_PrimitiveSlots[item.Index] = slot;
+        }
+    }
+
+    void BVH::Refit(std::span<const NuMath::AABB> bounds)
+    {
+        if (bounds.size() != m_LeafIndices.size())
+        {
+            Build(bounds);
+            return;
+        }
+
+        for (size_t slot = 0; slot < m_LeafIndices.size(); ++slot)
+        {
+            m_LeafBounds[slot] = bounds[m_LeafIndices[slot]];
+        }
+
+        // Children are always stored after their parent, so a reverse sweep sees them first
+        for (size_t node = m_Nodes.size(); node-- > 0;)
+        {
+            RefitNode(static_cast<uint32_t>(node));
+        }
+    }
+
+    void BVH::Refit(std::span<const NuMath::AABB> bounds, std::span<const uint32_t> moved)
+    {
+        if (bounds.size() != m_LeafIndices.size())
+        {
+            Build(bounds);
+            return;
+        }
+
+        m_Dirty.assign(m_Nodes.size(), 0);
+        for (const uint32_t index : moved)
+        {
+            const uint32_t slot = m_PrimitiveSlots[index];
+            m_LeafBounds[slot] = bounds[index];
+
+            for (uint32_t node = m_LeafNodes[slot]; node != BVHNode::k_EmptyChild && !m_Dirty[node]; node = m_Parents[node])
+            {
+                m_Dirty[node] = 1;
+            }
+        }
+
+        for (size_t node = m_Nodes.size(); node-- > 0;)
+        {
+            if (m_Dirty[node])
+            {
+                RefitNode(static_cast<uint32_t>(node));
+            }
+        }
+    }
+
+    void BVH::Clear() noexcept
+    {
+        m_Nodes.clear();
+        m_Parents.clear();
+        m_LeafBounds.clear();
+        m_LeafIndices.clear();
+        m_LeafNodes.clear();
+        m_PrimitiveSlots.clear();
+    }
+
+    BVHRayHit BVH::Raycast(const NuMath::Ray& ray, float maxDistance) const
+    {
+        const RayData data = MakeRayData(ray);
+        return Raycast(ray, maxDistance, [this, &data](uint32_t index, float currentMax)
+        {
+            return RayBoxDistance(data, m_LeafBounds[m_PrimitiveSlots[index]], currentMax);
+        });
+    }
+
+    uint32_t BVH::BuildNode(uint32_t begin, uint32_t end, uint32_t depth)
+    {
+        const uint32_t nodeIndex = static_cast<uint32_t>(m_Nodes.size());
+        m_Nodes.emplace_back();
+        m_Parents.push_back(BVHNode::k_EmptyChild);
+
+        for (int slot = 0; slot < 4; ++slot)
+        {
+            StoreChild(m_Nodes[nodeIndex], slot, EmptyBounds(), BVHNode::k_EmptyChild, 0);
+        }
+
+        // Split the range in two, then keep opening the largest part until there are four
+        Range ranges[4] = { { begin, end } };
+        int rangeCount = 1;
+        while (rangeCount < 4)
+        {
+            int largest = -1;
+            uint32_t largestCount = k_MaxLeafSize;
+            for (int r = 0; r < rangeCount; ++r)
+            {
+                const uint32_t rangeSize = ranges[r].End - ranges[r].Begin;
+                if (rangeSize > largestCount)
+                {
+                    largest = r;
+                    largestCount = rangeSize;
+                }
+            }
+
+            if (largest < 0)
+            {
+                break;
+            }
+
+            const uint32_t mid = SplitRange(ranges[largest], depth);
+            ranges[rangeCount++] = { mid, ranges[largest].End };
+            ranges[largest].End = mid;
+        }
+
+        for (int slot = 0; slot < rangeCount; ++slot)
+        {
+            const Range range = ranges[slot];
+            const NuMath::AABB bounds = RangeBounds(range);
+            const uint32_t count = range.End - range.Begin;
+
+            if (count <= k_MaxLeafSize)
+            {
+                for (uint32_t i = range.Begin; i < range.End; ++i)
+                {
+                    m_LeafNodes[i] = nodeIndex;
+                }
+                StoreChild(m_Nodes[nodeIndex], slot, bounds, range.Begin, count);
+                continue;
+            }
+
+            // m_Nodes may reallocate while the child is built, so the parent is indexed again afterwards
+            const uint32_t child = BuildNode(range.Begin, range.End, depth + 1);
+            m_Parents[child] = nodeIndex;
+            StoreChild(m_Nodes[nodeIndex], slot, bounds, child, 0);
+        }
+
+        return nodeIndex;
+    }
+
+    uint32_t BVH::SplitRange(Range range, uint32_t depth)
+    {
+        const auto first = m_BuildItems.begin() + range.Begin;
+        const auto last = m_BuildItems.begin() + range.End;
+
+        NuMath::Vector3 centroidMin(k_Infinity, k_Infinity, k_Infinity);
+        NuMath::Vector3 centroidMax(-k_Infinity, -k_Infinity, -k_Infinity);
+        for (auto it = first; it != last; ++it)
+        {
+            centroidMin = centroidMin.Min(it->Centroid);
+            centroidMax = centroidMax.Max(it->Centroid);
+        }
+
+        if (depth < k_MaxSAHDepth)
+        {
+            struct Bin
+            {
+                NuMath::AABB Bounds = EmptyBounds();
+                uint32_t Count = 0;
+            };
+
+            float bestCost = k_Infinity;
+            int bestAxis = -1;
+            uint32_t bestSplit = 0;
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float minCentroid = Axis(centroidMin, axis);
+                const float extent = Axis(centroidMax, axis) - minCentroid;
+                if (extent <= 0.0f)
+                {
+                    continue;
+                }
+
+                Bin bins[k_BinCount];
+                const float scale = static_cast<float>(k_BinCount) / extent;
+                for (auto it = first; it != last; ++it)
+                {
+                    const uint32_t bin = std::min(static_cast<uint32_t>((Axis(it->Centroid, axis) - minCentroid) * scale), k_BinCount - 1);
+                    bins[bin].Bounds = Grow(bins[bin].Bounds, it->Bounds);
+                    ++bins[bin].Count;
+                }
+
+                // Right-to-left sweep stores the cost of everything after each split plane
+                float rightCost[k_BinCount];
+                NuMath::AABB rightBounds = EmptyBounds();
+                uint32_t rightCount = 0;
+                for (uint32_t bin = k_BinCount - 1; bin > 0; --bin)
+                {
+                    rightBounds = Grow(rightBounds, bins[bin].Bounds);
+                    rightCount += bins[bin].Count;
+                    rightCost[bin - 1] = HalfArea(rightBounds) * static_cast<float>(rightCount);
+                }
+
+                NuMath::AABB leftBounds = EmptyBounds();
+                uint32_t leftCount = 0;
+                for (uint32_t split = 0; split < k_BinCount - 1; ++split)
+                {
+                    leftBounds = Grow(leftBounds, bins[split].Bounds);
+                    leftCount += bins[split].Count;
+
+                    const float cost = HalfArea(leftBounds) * static_cast<float>(leftCount) + rightCost[split];
+                    if (leftCount > 0 && leftCount < range.End - range.Begin && cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = split;
+                    }
+                }
+            }
+
+            if (bestAxis >= 0)
+            {
+                const float minCentroid = Axis(centroidMin, bestAxis);
+                const float scale = static_cast<float>(k_BinCount) / (Axis(centroidMax, bestAxis) - minCentroid);
+                const auto middle = std::partition(first, last, [&](const BuildItem& item)
+                {
+                    const uint32_t bin = std::min(static_cast<uint32_t>((Axis(item.Centroid, bestAxis) - minCentroid) * scale), k_BinCount - 1);
+                    return bin <= bestSplit;
+                });
+
+                if (middle != first && middle != last)
+                {
+                    return static_cast<uint32_t>(middle - m_BuildItems.begin());
+                }
+            }
+        }
+
+        // Coincident centroids, or too deep: split by count along the widest axis
+        const NuMath::Vector3 extent = centroidMax - centroidMin;
+        const int axis = (extent.X() >= extent.Y() && extent.X() >= extent.Z()) ? 0 : (extent.Y() >= extent.Z() ? 1 : 2);
+        const auto middle = first + (range.End - range.Begin) / 2;
+        std::nth_element(first, middle, last, [axis](const BuildItem& a, const BuildItem& b)
+        {
+            return Axis(a.Centroid, axis) < Axis(b.Centroid, axis);
+        });
+
+        return static_cast<uint32_t>(middle - m_BuildItems.begin());
+    }
+
+    void BVH::StoreChild(BVHNode& node, int slot, const NuMath::AABB& bounds, uint32_t child, uint32_t count)
+    {
+        node.MinX[slot] = bounds.Min.X();
+        node.MinY[slot] = bounds.Min.Y();
+        node.MinZ[slot] = bounds.Min.Z();
+        node.MaxX[slot] = bounds.Max.X();
+        node.MaxY[slot] = bounds.Max.Y();
+        node.MaxZ[slot] = bounds.Max.Z();
+        node.Children[slot] = child;
+        node.Counts[slot] = count;
+    }
+
+    NuMath::AABB BVH::RangeBounds(Range range) const
+    {
+        NuMath::AABB bounds = EmptyBounds();
+        for (uint32_t i = range.Begin; i < range.End; ++i)
+        {
+            bounds = Grow(bounds, m_BuildItems[i].Bounds);
+        }
+        return bounds;
+    }
+
+    void BVH::RefitNode(uint32_t nodeIndex)
+    {
+        BVHNode& node = m_Nodes[nodeIndex];
+        for (int slot = 0; slot < 4; ++slot)
+        {
+            const uint32_t child = node.Children[slot];
+            if (child == BVHNode::k_EmptyChild)
+            {
+                continue;
+            }
+
+            NuMath::AABB bounds = EmptyBounds();
+            if (node.Counts[slot] > 0)
+            {
+                for (uint32_t i = child; i < child + node.Counts[slot]; ++i)
+                {
+                    bounds = Grow(bounds, m_LeafBounds[i]);
+                }
+            }
+            else
+            {
+                const BVHNode& inner = m_Nodes[child];
+                for (int innerSlot = 0; innerSlot < 4; ++innerSlot)
+                {
+                    if (inner.Children[innerSlot] != BVHNode::k_EmptyChild)
+                    {
+                        bounds = Grow(bounds, NuMath::AABB(
+                            NuMath::Vector3(inner.MinX[innerSlot], inner.MinY[innerSlot], inner.MinZ[innerSlot]),
+                            NuMath::Vector3(inner.MaxX[innerSlot], inner.MaxY[innerSlot], inner.MaxZ[innerSlot])));
+                    }
+                }
+            }
+
+            StoreChild(node, slot, bounds, child, node.Counts[slot]);
+        }
+    }
+
+    BVH::RayData BVH::MakeRayData(const NuMath::Ray& ray) noexcept
+    {
+        // A zero direction component gives an infinite reciprocal, which the slab test handles
+        return {
+            ray.Origin.X(), ray.Origin.Y(), ray.Origin.Z(),
+            1.0f / ray.Direction.X(), 1.0f / ray.Direction.Y(), 1.0f / ray.Direction.Z() };
+    }
+
+    float BVH::RayBoxDistance(const RayData& ray, const NuMath::AABB& box, float maxDistance) noexcept
+    {
+        const float t1x = (box.Min.X() - ray.OriginX) * ray.InvDirX;
+        const float t2x = (box.Max.X() - ray.OriginX) * ray.InvDirX;
+        const float t1y = (box.Min.Y() - ray.OriginY) * ray.InvDirY;
+        const float t2y = (box.Max.Y() - ray.OriginY) * ray.InvDirY;
+        const float t1z = (box.Min.Z() - ray.OriginZ) * ray.InvDirZ;
+        const float t2z = (box.Max.Z() - ray.OriginZ) * ray.InvDirZ;
+
+        const float tNear = std::max({ std::min(t1x, t2x), std::min(t1y, t2y), std::min(t1z, t2z), 0.0f });
+        const float tFar = std::min({ std::max(t1x, t2x), std::max(t1y, t2y), std::max(t1z, t2z), maxDistance });
+
+        return tNear <= tFar ? tNear : k_Infinity;
+    }
+
+    int BVH::TestFrustum(const BVHNode& node, const NuMath::Frustum& frustum) noexcept
+    {
+        using Register = Backend::Register;
+        const Register zero = Backend::SetZero();
+
+        int culled = 0;
+        for (const NuMath::Plane& plane : frustum.Planes)
+        {
+            // Corner of each child box furthest along the plane normal
+            const float* x = plane.Normal.X() >= 0.0f ? node.MaxX : node.MinX;
+            const float* y = plane.Normal.Y() >= 0.0f ? node.MaxY : node.MinY;
+            const float* z = plane.Normal.Z() >= 0.0f ? node.MaxZ : node.MinZ;
+
+            const Register distance = Backend::Add(
+                Backend::Add(Backend::Mul(Backend::SetAll(plane.Normal.X()), Backend::Load(x)), Backend::Mul(Backend::SetAll(plane.Normal.Y()), Backend::Load(y))),
+                Backend::Add(Backend::Mul(Backend::SetAll(plane.Normal.Z()), Backend::Load(z)), Backend::SetAll(plane.Distance)));
+
+            culled |= Backend::LessMask(distance, zero);
+        }
+
+        return ~culled & 0xF;
+    }
+
+    int BVH::TestAABB(const BVHNode& node, const NuMath::AABB& box) noexcept
+    {
+        const int separated =
+            Backend::LessMask(Backend::Load(node.MaxX), Backend::SetAll(box.Min.X())) |
+            Backend::LessMask(Backend::Load(node.MaxY), Backend::SetAll(box.Min.Y())) |
+            Backend::LessMask(Backend::Load(node.MaxZ), Backend::SetAll(box.Min.Z())) |
+            Backend::LessMask(Backend::SetAll(box.Max.X()), Backend::Load(node.MinX)) |
+            Backend::LessMask(Backend::SetAll(box.Max.Y()), Backend::Load(node.MinY)) |
+            Backend::LessMask(Backend::SetAll(box.Max.Z()), Backend::Load(node.MinZ));
+
+        return ~separated & 0xF;
+    }
+
+    int BVH::TestSphere(const BVHNode& node, const NuMath::Sphere& sphere) noexcept
+    {
+        using Register = Backend::Register;
+        const Register zero = Backend::SetZero();
+
+        // Per axis, how far the centre is outside the box (zero inside)
+        const auto outside = [&zero](const float* min, const float* max, float center)
+        {
+            const Register c = Backend::SetAll(center);
+            return Backend::Max(Backend::Max(Backend::Sub(Backend::Load(min), c), Backend::Sub(c, Backend::Load(max))), zero);
+        };
+
+        const Register dx = outside(node.MinX, node.MaxX, sphere.Center.X());
+        const Register dy = outside(node.MinY, node.MaxY, sphere.Center.Y());
+        const Register dz = outside(node.MinZ, node.MaxZ, sphere.Center.Z());
+        const Register distanceSq = Backend::Add(Backend::Add(Backend::Mul(dx, dx), Backend::Mul(dy, dy)), Backend::Mul(dz, dz));
+
+        return ~Backend::LessMask(Backend::SetAll(sphere.Radius * sphere.Radius), distanceSq) & 0xF;
+    }
+
+    int BVH::TestRay(const BVHNode& node, const RayData& ray, float maxDistance, float* outEntry) noexcept
+    {
+        using Register = Backend::Register;
+
+        const auto slab = [](const float* min, const float* max, float origin, float invDir, Register& outNear, Register& outFar)
+        {
+            const Register o = Backend::SetAll(origin);
+            const Register inv = Backend::SetAll(invDir);
+            const Register t1 = Backend::Mul(Backend::Sub(Backend::Load(min), o), inv);
+            const Register t2 = Backend::Mul(Backend::Sub(Backend::Load(max), o), inv);
+            outNear = Backend::Min(t1, t2);
+            outFar = Backend::Max(t1, t2);
+        };
+
+        Register nearX, farX, nearY, farY, nearZ, farZ;
+        slab(node.MinX, node.MaxX, ray.OriginX, ray.InvDirX, nearX, farX);
+        slab(node.MinY, node.MaxY, ray.OriginY, ray.InvDirY, nearY, farY);
+        slab(node.MinZ, node.MaxZ, ray.OriginZ, ray.InvDirZ, nearZ, farZ);
+
+        const Register tNear = Backend::Max(Backend::Max(nearX, nearY), Backend::Max(nearZ, Backend::SetZero()));
+        const Register tFar = Backend::Min(Backend::Min(farX, farY), Backend::Min(farZ, Backend::SetAll(maxDistance)));
+
+        NuMath::NuVecStorage4 entry;
+        Backend::Store(entry, tNear);
+        outEntry[0] = entry.x;
+        outEntry[1] = entry.y;
+        outEntry[2] = entry.z;
+        outEntry[3] = entry.w;
+
+        return ~Backend::LessMask(tFar, tNear) & 0xF;
+    }
+}
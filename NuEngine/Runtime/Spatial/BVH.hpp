@@ -0,0 +1,312 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <NuEngine/Core/API.hpp>
+#include <NuEngine/Core/Memory/AlignedAllocator.hpp>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Detail/SIMD/SimdBackend.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace NuEngine::Runtime
+{
+    /**
+     * @brief One 4-wide BVH node: the boxes of up to four children, stored per component.
+     *
+     * 128 bytes, two cache lines. Each child slot is an inner node (Counts == 0), a leaf of
+     * Counts primitives starting at Children in the BVH's leaf order, or empty (k_EmptyChild).
+     */
+    struct alignas(64) BVHNode
+    {
+        static constexpr uint32_t k_EmptyChild = 0xFFFFFFFFu;
+
+        float MinX[4], MinY[4], MinZ[4];
+        float MaxX[4], MaxY[4], MaxZ[4];
+        uint32_t Children[4];
+        uint32_t Counts[4];
+    };
+
+    struct BVHRayHit
+    {
+        static constexpr uint32_t k_NoHit = 0xFFFFFFFFu;
+
+        uint32_t Index = k_NoHit;
+        float Distance = std::numeric_limits<float>::infinity();
+
+        [[nodiscard]] bool IsHit() const noexcept { return Index != k_NoHit; }
+    };
+
+    /**
+     * @brief SAH-built bounding volume hierarchy over caller-owned AABBs, with 4-wide SIMD traversal.
+     *
+     * Primitives are identified by their position in the span given to Build(); queries report
+     * those indices. Moving objects are handled by Refit(), which keeps the topology and only
+     * recomputes boxes, so query cost creeps up as objects drift away from where they were
+     * built. Rebuild when objects are added or removed, or after large rearrangements.
+     *
+     * Not tied to the physics broadphase: it only knows boxes.
+     */
+    class NU_API BVH
+    {
+    public:
+        // Leaves stop splitting at this many primitives
+        static constexpr uint32_t k_MaxLeafSize = 4;
+
+        /**
+         * @brief Rebuilds the tree over bounds. Reuses the existing storage.
+         */
+        void Build(std::span<const NuMath::AABB> bounds);
+
+        /**
+         * @brief Recomputes every box bottom-up from new bounds, in the same order as Build().
+         */
+        void Refit(std::span<const NuMath::AABB> bounds);
+
+        /**
+         * @brief Refits only the leaves holding moved and their ancestors.
+         *
+         * Cheaper than a full Refit() when a small fraction of objects moved this frame.
+         */
+        void Refit(std::span<const NuMath::AABB> bounds, std::span<const uint32_t> moved);
+
+        void Clear() noexcept;
+
+        [[nodiscard]] bool IsEmpty() const noexcept { return m_Nodes.empty(); }
+        [[nodiscard]] size_t GetPrimitiveCount() const noexcept { return m_LeafIndices.size(); }
+        [[nodiscard]] size_t GetNodeCount() const noexcept { return m_Nodes.size(); }
+        [[nodiscard]] std::span<const BVHNode> GetNodes() const noexcept { return m_Nodes; }
+
+        /**
+         * @brief Calls visit(index) for every primitive whose box is not fully behind a frustum plane.
+         */
+        template<typename VisitFn>
+        void QueryFrustum(const NuMath::Frustum& frustum, VisitFn&& visit) const
+        {
+            Traverse(
+                [&frustum](const BVHNode& node) { return TestFrustum(node, frustum); },
+                [&frustum](const NuMath::AABB& box) { return NuMath::Intersects(frustum, box); },
+                visit);
+        }
+
+        /**
+         * @brief Calls visit(index) for every primitive whose box overlaps box.
+         */
+        template<typename VisitFn>
+        void QueryAABB(const NuMath::AABB& box, VisitFn&& visit) const
+        {
+            Traverse(
+                [&box](const BVHNode& node) { return TestAABB(node, box); },
+                [&box](const NuMath::AABB& other) { return NuMath::Intersects(box, other); },
+                visit);
+        }
+
+        /**
+         * @brief Calls visit(index) for every primitive whose box touches sphere.
+         */
+        template<typename VisitFn>
+        void QuerySphere(const NuMath::Sphere& sphere, VisitFn&& visit) const
+        {
+            Traverse(
+                [&sphere](const BVHNode& node) { return TestSphere(node, sphere); },
+                [&sphere](const NuMath::AABB& box) { return NuMath::Intersects(box, sphere); },
+                visit);
+        }
+
+        /**
+         * @brief Closest primitive along the ray, front to back.
+         *
+         * hit(index, maxDistance) returns the distance at which the ray hits the primitive itself,
+         * or anything >= maxDistance for a miss; boxes further than the best hit are skipped.
+         */
+        template<typename HitFn>
+        [[nodiscard]] BVHRayHit Raycast(const NuMath::Ray& ray, float maxDistance, HitFn&& hit) const
+        {
+            BVHRayHit best;
+            best.Distance = maxDistance;
+            if (m_Nodes.empty())
+            {
+                return best;
+            }
+
+            const RayData data = MakeRayData(ray);
+
+            struct Entry
+            {
+                uint32_t Node;
+                float Distance;
+            };
+            Entry stack[k_MaxStackSize];
+            size_t top = 0;
+            stack[top++] = { 0, 0.0f };
+
+            while (top > 0)
+            {
+                const Entry entry = stack[--top];
+                if (entry.Distance >= best.Distance)
+                {
+                    continue;
+                }
+
+                const BVHNode& node = m_Nodes[entry.Node];
+                float entryDistance[4];
+                int mask = TestRay(node, data, best.Distance, entryDistance);
+
+                // Push far children first so the nearest one is popped next
+                Entry children[4];
+                size_t childCount = 0;
+                while (mask)
+                {
+                    const int slot = std::countr_zero(static_cast<unsigned>(mask));
+                    mask &= mask - 1;
+
+                    if (node.Children[slot] == BVHNode::k_EmptyChild)
+                    {
+                        continue;
+                    }
+
+                    if (node.Counts[slot] > 0)
+                    {
+                        const uint32_t first = node.Children[slot];
+                        for (uint32_t i = first; i < first + node.Counts[slot]; ++i)
+                        {
+                            const float distance = hit(m_LeafIndices[i], best.Distance);
+                            if (distance >= 0.0f && distance < best.Distance)
+                            {
+                                best.Distance = distance;
+                                best.Index = m_LeafIndices[i];
+                            }
+                        }
+                        continue;
+                    }
+
+                    size_t at = childCount++;
+                    for (; at > 0 && children[at - 1].Distance < entryDistance[slot]; --at)
+                    {
+                        children[at] = children[at - 1];
+                    }
+                    children[at] = { node.Children[slot], entryDistance[slot] };
+                }
+
+                for (size_t i = 0; i < childCount; ++i)
+                {
+                    stack[top++] = children[i];
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Closest primitive box along the ray.
+         */
+        [[nodiscard]] BVHRayHit Raycast(const NuMath::Ray& ray, float maxDistance) const;
+
+    private:
+        using Backend = NuMath::Simd::MathBackend;
+
+        // Build falls back to object-median splits past this depth, which bounds the traversal stack
+        static constexpr uint32_t k_MaxSAHDepth = 48;
+        static constexpr size_t k_MaxStackSize = 256;
+
+        struct RayData
+        {
+            float OriginX, OriginY, OriginZ;
+            float InvDirX, InvDirY, InvDirZ;
+        };
+
+        struct BuildItem
+        {
+            NuMath::AABB Bounds;
+            NuMath::Vector3 Centroid;
+            uint32_t Index;
+        };
+
+        struct Range
+        {
+            uint32_t Begin;
+            uint32_t End;
+        };
+
+        uint32_t BuildNode(uint32_t begin, uint32_t end, uint32_t depth);
+        [[nodiscard]] uint32_t SplitRange(Range range, uint32_t depth);
+        void StoreChild(BVHNode& node, int slot, const NuMath::AABB& bounds, uint32_t child, uint32_t count);
+        [[nodiscard]] NuMath::AABB RangeBounds(Range range) const;
+        void RefitNode(uint32_t nodeIndex);
+
+        static RayData MakeRayData(const NuMath::Ray& ray) noexcept;
+        static float RayBoxDistance(const RayData& ray, const NuMath::AABB& box, float maxDistance) noexcept;
+
+        static int TestFrustum(const BVHNode& node, const NuMath::Frustum& frustum) noexcept;
+        static int TestAABB(const BVHNode& node, const NuMath::AABB& box) noexcept;
+        static int TestSphere(const BVHNode& node, const NuMath::Sphere& sphere) noexcept;
+        static int TestRay(const BVHNode& node, const RayData& ray, float maxDistance, float* outEntry) noexcept;
+
+        /**
+         * @brief Depth-first walk: nodeTest gives the mask of child slots to enter, leafTest filters primitives.
+         */
+        template<typename NodeTest, typename LeafTest, typename VisitFn>
+        void Traverse(NodeTest&& nodeTest, LeafTest&& leafTest, VisitFn& visit) const
+        {
+            if (m_Nodes.empty())
+            {
+                return;
+            }
+
+            uint32_t stack[k_MaxStackSize];
+            size_t top = 0;
+            stack[top++] = 0;
+
+            while (top > 0)
+            {
+                const BVHNode& node = m_Nodes[stack[--top]];
+                int mask = nodeTest(node);
+
+                while (mask)
+                {
+                    const int slot = std::countr_zero(static_cast<unsigned>(mask));
+                    mask &= mask - 1;
+
+                    if (node.Children[slot] == BVHNode::k_EmptyChild)
+                    {
+                        continue;
+                    }
+
+                    if (node.Counts[slot] == 0)
+                    {
+                        stack[top++] = node.Children[slot];
+                        continue;
+                    }
+
+                    const uint32_t first = node.Children[slot];
+                    for (uint32_t i = first; i < first + node.Counts[slot]; ++i)
+                    {
+                        if (leafTest(m_LeafBounds[i]))
+                        {
+                            visit(m_LeafIndices[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        AlignedVector<BVHNode, 64> m_Nodes;
+        std::vector<uint32_t> m_Parents;       // Per node; the root's parent is k_EmptyChild
+
+        // Primitives in leaf order: each leaf owns a contiguous run
+        std::vector<NuMath::AABB> m_LeafBounds;
+        std::vector<uint32_t> m_LeafIndices;   // Leaf slot -> primitive index
+        std::vector<uint32_t> m_LeafNodes;     // Leaf slot -> node holding it
+        std::vector<uint32_t> m_PrimitiveSlots; // Primitive index -> leaf slot
+
+        std::vector<BuildItem> m_BuildItems;
+        std::vector<uint8_t> m_Dirty;
+    };
+}
@@ -1,9 +1,62 @@
 #include <Weave/NativeRegistry.hpp>
 #include <Runtime/Scene/Scene.hpp>
 #include <ECS/Components.hpp>
+#include <Physics/Core/PhysicsEngine.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace NuEngine::Weave
 {
+    namespace
+    {
+        /**
+         * @brief Builds the Raycast native's ray for one entity: origin offset and direction come from the args.
+         *
+         * The origin is relative to the entity's transform, so an unwired origin casts from the entity itself.
+         *
+         * @return False if the entity has no transform or the direction is zero.
+         */
+        bool MakeEntityRay(const NativeCallContext& ctx, uint32_t entityId, NuMath::Ray& outRay, uint32_t& outIgnoreBody)
+        {
+            if (!ctx.CurrentScene)
+            {
+                return false;
+            }
+
+            auto& registry = ctx.CurrentScene->GetRegistry();
+            entt::entity ent = static_cast<entt::entity>(entityId);
+
+            const auto* transform = registry.try_get<NuEngine::ECS::TransformComponent>(ent);
+            if (!transform)
+            {
+                return false;
+            }
+
+            const NuMath::Vector3 offset(
+                ctx.GetFloat(ctx.ArgRegs[0]),
+                ctx.GetFloat(ctx.ArgRegs[1]),
+                ctx.GetFloat(ctx.ArgRegs[2]));
+
+            const float dx = ctx.GetFloat(ctx.ArgRegs[3]);
+            const float dy = ctx.GetFloat(ctx.ArgRegs[4]);
+            const float dz = ctx.GetFloat(ctx.ArgRegs[5]);
+            const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (length <= 0.0f)
+            {
+                return false;
+            }
+
+            outRay = NuMath::Ray(transform->Position + offset, NuMath::Vector3(dx / length, dy / length, dz / length));
+
+            const auto* physics = registry.try_get<NuEngine::ECS::RigidBodyComponent>(ent);
+            outIgnoreBody = physics ? physics->Body.GetHandle() : Physics::k_InvalidBodyHandle;
+            return true;
+        }
+
+        constexpr uint8_t k_RaycastArgs = 7;
+    }
+
     void NativeRegistry::Initialize()
     {
         using namespace NativeFuncId;
@@ -36,6 +89,139 @@ namespace NuEngine::Weave
             }
             };
 
+        // Raycast(originX, originY, originZ, dirX, dirY, dirZ, maxDistance) -> hit distance or -1, hit entity
+        Functions[Raycast] = [](NativeCallContext& ctx) {
+            NuMath::Ray ray;
+            uint32_t ignoreBody = Physics::k_InvalidBodyHandle;
+            float distance = -1.0f;
+            uint32_t body = Physics::k_InvalidBodyHandle;
+
+            if (ctx.ArgCount >= k_RaycastArgs && MakeEntityRay(ctx, ctx.EntityId, ray, ignoreBody))
+            {
+                float px, py, pz, nx, ny, nz;
+                Physics::CastHitsSoA hits;
+                hits.Positions = { &px, &py, &pz };
+                hits.Normals = { &nx, &ny, &nz };
+                hits.Distances = &distance;
+                hits.Bodies = &body;
+
+                Physics::PhysicsEngine::CastRays({ &ray, 1 }, ctx.GetFloat(ctx.ArgRegs[6]), hits, { &ignoreBody, 1 }).Ignore();
+            }
+
+            entt::entity hitEntity = entt::null;
+            if (ctx.CurrentScene)
+            {
+                ctx.CurrentScene->FindBodyEntities({ &body, 1 }, { &hitEntity, 1 });
+            }
+
+            ctx.SetFloat(ctx.ReturnReg, distance);
+            ctx.SetUInt(ctx.SecondReturnReg, static_cast<uint32_t>(hitEntity));
+            };
+
+        // Chunk variant: gathers every lane's ray and issues them as one batch
+        ChunkFunctions[Raycast] = [](NativeCallContext& ctx) {
+            constexpr int k_Lanes = 64;
+
+            NuMath::Ray rays[k_Lanes];
+            uint32_t ignoreBodies[k_Lanes];
+            int lanes[k_Lanes];
+            int rayCount = 0;
+
+            // Results are staged locally: the return registers may alias argument registers
+            float results[k_Lanes];
+            uint32_t hitBodies[k_Lanes];
+            for (int i = 0; i < ctx.ChunkCount; ++i)
+            {
+                results[i] = -1.0f;
+                hitBodies[i] = Physics::k_InvalidBodyHandle;
+
+                ctx.ChunkIndex = i;
+                if (ctx.ArgCount >= k_RaycastArgs && MakeEntityRay(ctx, ctx.EntityIds[i], rays[rayCount], ignoreBodies[rayCount]))
+                {
+                    lanes[rayCount++] = i;
+                }
+            }
+
+            // Cast with the longest lane distance; shorter lanes reject hits past their own limit below
+            float maxDistance = 0.0f;
+            for (int r = 0; r < rayCount; ++r)
+            {
+                maxDistance = std::max(maxDistance, ctx.Regs_F[ctx.ArgRegs[6]][lanes[r]]);
+            }
+
+            alignas(32) float positions[3][k_Lanes];
+            alignas(32) float normals[3][k_Lanes];
+            alignas(32) float distances[k_Lanes];
+            uint32_t bodies[k_Lanes];
+
+            Physics::CastHitsSoA hits;
+            hits.Positions = { positions[0], positions[1], positions[2] };
+            hits.Normals = { normals[0], normals[1], normals[2] };
+            hits.Distances = distances;
+            hits.Bodies = bodies;
+
+            if (rayCount > 0 && Physics::PhysicsEngine::CastRays(
+                { rays, static_cast<size_t>(rayCount) }, maxDistance, hits, { ignoreBodies, static_cast<size_t>(rayCount) }).IsOk())
+            {
+                for (int r = 0; r < rayCount; ++r)
+                {
+                    const int lane = lanes[r];
+                    const float laneMax = ctx.Regs_F[ctx.ArgRegs[6]][lane];
+                    if (distances[r] >= 0.0f && distances[r] <= laneMax)
+                    {
+                        results[lane] = distances[r];
+                        hitBodies[lane] = bodies[r];
+                    }
+                }
+            }
+
+            entt::entity hitEntities[k_Lanes];
+            if (ctx.CurrentScene)
+            {
+                ctx.CurrentScene->FindBodyEntities(
+                    { hitBodies, static_cast<size_t>(ctx.ChunkCount) }, { hitEntities, static_cast<size_t>(ctx.ChunkCount) });
+            }
+            else
+            {
+                std::fill(hitEntities, hitEntities + ctx.ChunkCount, entt::null);
+            }
+
+            std::copy(results, results + ctx.ChunkCount, ctx.Regs_F[ctx.ReturnReg]);
+            for (int i = 0; i < ctx.ChunkCount; ++i)
+            {
+                ctx.Regs_I[ctx.SecondReturnReg][i] = static_cast<int32_t>(static_cast<uint32_t>(hitEntities[i]));
+            }
+            };
+
+        // OnCollide natives: the contact seen from the running entity, normal pointing toward the other body
+        Functions[GetOtherEntity] = [](NativeCallContext& ctx) {
+            ctx.SetUInt(ctx.ReturnReg, ctx.Contact ? ctx.OtherEntityId : 0u);
+            };
+
+        Functions[GetContactPointX] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Point.X() : 0.0f);
+            };
+
+        Functions[GetContactPointY] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Point.Y() : 0.0f);
+            };
+
+        Functions[GetContactPointZ] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Point.Z() : 0.0f);
+            };
+
+        Functions[GetContactNormalX] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Normal.X() : 0.0f);
+            };
+
+        Functions[GetContactNormalY] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Normal.Y() : 0.0f);
+            };
+
+        Functions[GetContactNormalZ] = [](NativeCallContext& ctx) {
+            ctx.SetFloat(ctx.ReturnReg, ctx.Contact ? ctx.Contact->Normal.Z() : 0.0f);
+            };
+
         IsInitialized = true;
     }
 }
\ No newline at end of file
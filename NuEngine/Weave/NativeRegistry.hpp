@@ -5,6 +5,7 @@
 #include <NuEngine/Core/API.hpp>
 
 namespace NuEngine::Runtime { class Scene; }
+namespace NuEngine::Physics { struct ContactEvent; }
 
 namespace NuEngine::Weave
 {
@@ -19,12 +20,21 @@ namespace NuEngine::Weave
         int32_t(*Regs_I)[64] = nullptr;
         int ChunkIndex = 0;
 
-        uint8_t   ArgRegs[4];
+        // Set for chunk natives, which handle all lanes in one call
+        const uint32_t* EntityIds = nullptr;
+        int ChunkCount = 0;
+
+        uint8_t   ArgRegs[k_MaxNativeArgs];
         uint8_t   ReturnReg;
+        uint8_t   SecondReturnReg;  // Only for natives with NativeFuncId::ReturnCount == 2
         uint8_t   ArgCount;
 
         NuEngine::Runtime::Scene* CurrentScene = nullptr;
 
+        // Set while running an OnCollide entry point
+        const NuEngine::Physics::ContactEvent* Contact = nullptr;
+        uint32_t OtherEntityId = 0;
+
         float GetFloat(uint8_t reg) const
         {
             return Regs_F ? Regs_F[reg][ChunkIndex] : Registers[reg].f;
@@ -66,6 +76,11 @@ namespace NuEngine::Weave
     {
     public:
         static inline NativeFuncSignature Functions[256] = { nullptr };
+
+        /**
+         * @brief Optional whole-chunk variants, called once per WeaveChunk instead of once per lane.
+         */
+        static inline NativeFuncSignature ChunkFunctions[256] = { nullptr };
         static inline bool IsInitialized = false;
 
         static void Initialize();
@@ -76,5 +91,29 @@ namespace NuEngine::Weave
                 Functions[funcId](ctx);
             }
         }
+
+        static void CallChunk(uint32_t funcId, NativeCallContext& ctx)
+        {
+            if (funcId >= 256)
+            {
+                return;
+            }
+
+            if (ChunkFunctions[funcId])
+            {
+                ChunkFunctions[funcId](ctx);
+                return;
+            }
+
+            if (Functions[funcId])
+            {
+                for (int i = 0; i < ctx.ChunkCount; ++i)
+                {
+                    ctx.ChunkIndex = i;
+                    ctx.EntityId = ctx.EntityIds[i];
+                    Functions[funcId](ctx);
+                }
+            }
+        }
     };
 }
\ No newline at end of file
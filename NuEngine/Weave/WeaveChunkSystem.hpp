@@ -41,6 +41,10 @@ namespace NuEngine::Weave
                     float v; std::memcpy(&v, &code[ip], 4); ip += 4; return v; 
                     };
 
+                auto readU32 = [&]() { 
+                    uint32_t v; std::memcpy(&v, &code[ip], 4); ip += 4; return v; 
+                    };
+
                 while (ip < size)
                 {
                     OpCode op = static_cast<OpCode>(readByte());
@@ -98,6 +102,33 @@ namespace NuEngine::Weave
                         break;
                     }
 
+                    case OpCode::CALL_EXTERNAL:
+                    {
+                        uint32_t funcId = readU32();
+                        uint8_t argCount = readByte();
+
+                        NativeCallContext ctx{};
+                        ctx.DeltaTime = dt;
+                        ctx.Regs_F = chunk.Regs_F;
+                        ctx.Regs_I = chunk.Regs_I;
+                        ctx.EntityIds = chunk.EntityIds;
+                        ctx.ChunkCount = chunk.Count;
+                        ctx.ArgCount = argCount;
+                        ctx.CurrentScene = scene;
+
+                        for (uint8_t a = 0; a < argCount && a < k_MaxNativeArgs; ++a)
+                            ctx.ArgRegs[a] = readByte();
+
+                        const uint8_t returnCount = NativeFuncId::ReturnCount(funcId);
+                        if (returnCount > 0)
+                            ctx.ReturnReg = readByte();
+                        if (returnCount > 1)
+                            ctx.SecondReturnReg = readByte();
+
+                        NativeRegistry::CallChunk(funcId, ctx);
+                        break;
+                    }
+
                     default: break;
                     }
                 }
@@ -12,7 +12,11 @@ namespace NuEngine::Weave
         std::vector<uint8_t> ByteCode;
         uint32_t Checksum = 0;
 
+        // Bytecode offset of the Event_OnCollide block; OnUpdate always starts at 0
+        uint16_t OnCollideEntry = k_NoEntryPoint;
+
         bool IsValid() const { return !ByteCode.empty(); }
+        bool HasOnCollide() const { return OnCollideEntry < ByteCode.size(); }
     };
 
     struct WeaveComponent
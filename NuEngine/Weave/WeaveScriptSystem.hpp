@@ -26,8 +26,23 @@ namespace NuEngine::Weave
             }
         }
 
+        /**
+         * @brief Runs the asset's OnCollide entry point for one contact. Natives see it via NativeCallContext::Contact.
+         */
+        static void DispatchCollision(WeaveComponent& comp, uint32_t entityId, uint32_t otherEntityId, const NuEngine::Physics::ContactEvent& contact, NuEngine::Runtime::Scene* scene)
+        {
+            assert(NativeRegistry::IsInitialized && "Call NativeRegistry::Initialize() first!");
+
+            if (!comp.IsEnabled() || !comp.Asset || !comp.Asset->HasOnCollide()) return;
+
+            comp.WakeUp();
+            comp.IP = comp.Asset->OnCollideEntry;
+            ExecuteScript(comp, entityId, 0.0f, scene, &contact, otherEntityId);
+        }
+
     private:
-        static void ExecuteScript(WeaveComponent& comp, uint32_t entityId, float dt, NuEngine::Runtime::Scene* scene)
+        static void ExecuteScript(WeaveComponent& comp, uint32_t entityId, float dt, NuEngine::Runtime::Scene* scene,
+            const NuEngine::Physics::ContactEvent* contact = nullptr, uint32_t otherEntityId = 0)
         {
             const uint8_t* code = comp.Asset->ByteCode.data();
             const size_t codeSize = comp.Asset->ByteCode.size();
@@ -74,12 +89,17 @@ namespace NuEngine::Weave
                     ctx.Registers = reg;
                     ctx.ArgCount = argCount;
                     ctx.CurrentScene = scene;
+                    ctx.Contact = contact;
+                    ctx.OtherEntityId = otherEntityId;
 
-                    for (uint8_t a = 0; a < argCount && a < 4; ++a)
+                    for (uint8_t a = 0; a < argCount && a < k_MaxNativeArgs; ++a)
                         ctx.ArgRegs[a] = READ_BYTE();
 
-                    if (argCount > 0 || funcId == NativeFuncId::GetDeltaTime)
+                    const uint8_t returnCount = NativeFuncId::ReturnCount(funcId);
+                    if (returnCount > 0)
                         ctx.ReturnReg = READ_BYTE();
+                    if (returnCount > 1)
+                        ctx.SecondReturnReg = READ_BYTE();
 
                     NativeRegistry::Call(funcId, ctx);
                     break;
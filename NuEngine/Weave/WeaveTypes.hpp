@@ -4,7 +4,7 @@
 
 namespace NuEngine::Weave
 {
-	inline constexpr uint16_t k_BytecodeVersion = 1;
+	inline constexpr uint16_t k_BytecodeVersion = 2;
 
 	inline constexpr uint32_t k_Magic = 0x57454156; // 'W','E','A','V'
 
@@ -77,12 +77,15 @@ namespace NuEngine::Weave
 
 	inline constexpr uint8_t k_RegisterCount = 16;
 
+	// Entry offset of a graph without that event; OnUpdate always starts at 0
+	inline constexpr uint16_t k_NoEntryPoint = 0xFFFF;
+
 	#pragma pack(push, 1)
 	struct WbcFileHeader
 	{
 		uint32_t Magic;
 		uint16_t Version;
-		uint16_t Reserved;
+		uint16_t OnCollideEntry;  // k_NoEntryPoint if the graph has no Event_OnCollide
 		uint32_t BytecodeSize;
 		uint32_t Checksum;
 	};
@@ -102,12 +105,41 @@ namespace NuEngine::Weave
 		inline constexpr uint32_t FindPlayer = 7;
 		inline constexpr uint32_t DistanceTo = 8;
 		inline constexpr uint32_t SpawnEffect = 9;
-
-
-
-		inline constexpr uint32_t k_Count = 10;
+		inline constexpr uint32_t Raycast = 10;
+
+		// Only meaningful inside an OnCollide entry point; 0 elsewhere
+		inline constexpr uint32_t GetOtherEntity = 11;
+		inline constexpr uint32_t GetContactPointX = 12;
+		inline constexpr uint32_t GetContactPointY = 13;
+		inline constexpr uint32_t GetContactPointZ = 14;
+		inline constexpr uint32_t GetContactNormalX = 15;
+		inline constexpr uint32_t GetContactNormalY = 16;
+		inline constexpr uint32_t GetContactNormalZ = 17;
+
+		inline constexpr uint32_t k_Count = 18;
+
+		/**
+		 * @brief Result registers a CALL_EXTERNAL to funcId encodes after its arguments.
+		 */
+		constexpr uint8_t ReturnCount(uint32_t funcId) noexcept
+		{
+			switch (funcId)
+			{
+			case SetVelocityX:
+			case SetVelocityY:
+			case SetVelocityZ:
+			case SpawnEffect:
+				return 0;
+			case Raycast:
+				return 2;
+			default:
+				return 1;
+			}
+		}
 	}
 
+	inline constexpr uint8_t k_MaxNativeArgs = 8;
+
 	enum class NodeKind : uint8_t
 	{
 		Unknown = 0,
@@ -141,5 +173,8 @@ namespace NuEngine::Weave
 		Native_SetVelZ = 56,
 		Native_FindPlayer = 57,
 		Native_DistanceTo = 58,
+		Native_Raycast = 59,
+		Native_GetContactPoint = 60,
+		Native_GetContactNormal = 61,
 	};
 } // namespace NuEngine::Weave
\ No newline at end of file
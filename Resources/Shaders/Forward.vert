@@ -4,12 +4,18 @@ layout (location = 1) in vec2 aTexCoord;
 
 out vec2 TexCoord;
 
+layout (std140) uniform Frame
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    vec4 u_CameraPosition;
+};
+
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    gl_Position = u_ViewProjection * model * vec4(aPos, 1.0);
     TexCoord = aTexCoord;
 }
\ No newline at end of file
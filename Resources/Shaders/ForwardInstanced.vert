@@ -0,0 +1,20 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in mat4 aModel;
+
+out vec2 TexCoord;
+
+layout (std140) uniform Frame
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    vec4 u_CameraPosition;
+};
+
+void main()
+{
+    gl_Position = u_ViewProjection * aModel * vec4(aPos, 1.0);
+    TexCoord = aTexCoord;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+namespace NuEngine::Benchmarks
+{
+    /**
+     * @brief Ray vs. triangle, box and sphere: SoA packet and stream kernels vs. scalar NuMath loops.
+     */
+    void RegisterRayBenchmarks();
+}
@@ -0,0 +1,15 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+namespace NuEngine::Benchmarks
+{
+    /**
+     * @brief Clustered light assignment for 1k-16k point and spot lights, serial and on the job system.
+     */
+    void RegisterClusteredLightBenchmarks();
+}
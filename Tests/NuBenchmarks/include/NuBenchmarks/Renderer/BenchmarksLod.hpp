@@ -0,0 +1,15 @@
+// Copyright (c) 2025 Vladyslav Hordiychuk
+// All rights reserved.
+// Unauthorized copying or use of this file is strictly prohibited.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+namespace NuEngine::Benchmarks
+{
+    /**
+     * @brief Per-frame LOD selection over a field of objects, and the indices it saves against level 0.
+     */
+    void RegisterLodBenchmarks();
+}
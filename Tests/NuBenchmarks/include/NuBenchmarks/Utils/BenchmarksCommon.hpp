@@ -8,6 +8,7 @@
 #include <NuEngine/Core/Memory/AlignedAllocator.hpp>
 #include <NuMath/Algebra/Vector/VectorAPI.hpp>
 #include <NuMath/Core/StorageTypes.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
 
 #include <random>
 
@@ -71,6 +72,7 @@ namespace NuEngine::Benchmarks
             benchmark::ClobberMemory();
         }
         ReportThroughput(state, count, 16 * 3);
+        state.SetLabel(NuMath::Simd::ToString(NuMath::Simd::GetBatchLevel()));
     }
 
     template <typename SoAFunc>
@@ -96,6 +98,7 @@ namespace NuEngine::Benchmarks
             benchmark::ClobberMemory();
         }
         ReportThroughput(state, count, 36);
+        state.SetLabel(NuMath::Simd::ToString(NuMath::Simd::GetBatchLevel()));
     }
 
     // =========================================================================
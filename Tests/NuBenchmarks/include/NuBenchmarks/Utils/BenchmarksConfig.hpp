@@ -26,6 +26,18 @@
     #define ENABLE_SINGLE_BENCHMARKS 1
 #endif
 
+#ifndef ENABLE_PHYSICS_BENCHMARKS
+    #define ENABLE_PHYSICS_BENCHMARKS 1
+#endif
+
+#ifndef ENABLE_RENDERER_BENCHMARKS
+    #define ENABLE_RENDERER_BENCHMARKS 1
+#endif
+
+#ifndef ENABLE_GEOMETRY_BENCHMARKS
+    #define ENABLE_GEOMETRY_BENCHMARKS 1
+#endif
+
 #define IN_TIME_STR "1.0s"
 
 #define BENCH_START 1024
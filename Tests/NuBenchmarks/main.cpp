@@ -1,22 +1,32 @@
 #include <benchmark/benchmark.h>
 #include <windows.h>
 
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
+
 #include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
 #include <NuBenchmarks/NuMath/Algebra/Vector/BenchmarksVector2.hpp>
 #include <NuBenchmarks/NuMath/Algebra/Vector/BenchmarksVector3.hpp>
 #include <NuBenchmarks/NuMath/Algebra/Vector/BenchmarksVector4.hpp>
 #include <NuBenchmarks/NuMath/Algebra/Matrix/BenchmarksMatrix4x4.hpp>
+#include <NuBenchmarks/NuMath/Geometry/BenchmarksFrustum.hpp>
+#include <NuBenchmarks/NuMath/Geometry/BenchmarksRay.hpp>
 #include <NuBenchmarks/External/Algebra/Vector/GLMBenchmarksVector2.hpp>
 #include <NuBenchmarks/External/Algebra/Vector/GLMBenchmarksVector3.hpp>
 #include <NuBenchmarks/External/Algebra/Vector/GLMBenchmarksVector4.hpp>
 #include <NuBenchmarks/External/Algebra/Matrix/GLMBenchmarksMatrix4x4.hpp>
 #include <NuBenchmarks/External/Algebra/Vector/DirectXBenchmarksVector4.hpp>
 #include <NuBenchmarks/External/Algebra/Matrix/DirectXBenchmarksMatrix4x4.hpp>
+#include <NuBenchmarks/Physics/BenchmarksPhysics.hpp>
+#include <NuBenchmarks/Renderer/BenchmarksRenderer.hpp>
+#include <NuBenchmarks/Renderer/BenchmarksOcclusion.hpp>
+#include <NuBenchmarks/Renderer/BenchmarksClusteredLights.hpp>
+#include <NuBenchmarks/Renderer/BenchmarksLod.hpp>
 
+// Pins only the benchmark thread: job system workers must keep the full process mask.
 void PinToCore(size_t coreId = 0)
 {
     DWORD_PTR mask = (1ull << coreId);
-    SetProcessAffinityMask(GetCurrentProcess(), mask);
+    SetThreadAffinityMask(GetCurrentThread(), mask);
 }
 
 void WarmupCPU()
@@ -45,10 +55,18 @@ int main(int argc, char** argv)
     NuEngine::Benchmarks::RegisterVector3Benchmarks();
     NuEngine::Benchmarks::RegisterVector4Benchmarks();
     NuEngine::Benchmarks::RegisterMatrix4x4Benchmarks();
+    NuEngine::Benchmarks::RegisterFrustumBenchmarks();
+    NuEngine::Benchmarks::RegisterRayBenchmarks();
 
     NuEngine::Benchmarks::RegisterVector4Benchmarks_DirectX();
     NuEngine::Benchmarks::RegisterMatrix4x4Benchmarks_DirectX();
 
+    NuEngine::Benchmarks::RegisterPhysicsBenchmarks();
+    NuEngine::Benchmarks::RegisterRendererBenchmarks();
+    NuEngine::Benchmarks::RegisterOcclusionBenchmarks();
+    NuEngine::Benchmarks::RegisterClusteredLightBenchmarks();
+    NuEngine::Benchmarks::RegisterLodBenchmarks();
+
     int fake_argc = 3;
     const char* fake_argv[] =
     {
@@ -58,6 +76,10 @@ int main(int argc, char** argv)
     };
 
     ::benchmark::Initialize(&fake_argc, const_cast<char**>(fake_argv));
+
+    // Batch results depend on the kernel table CPUID picked, so every report names it
+    ::benchmark::AddCustomContext("NuMath batch kernels", NuMath::Simd::ToString(NuMath::Simd::GetBatchLevel()));
+    ::benchmark::AddCustomContext("NuMath best supported", NuMath::Simd::ToString(NuMath::Simd::DetectSimdLevel()));
     ::benchmark::RunSpecifiedBenchmarks();
 
     return 0;
@@ -0,0 +1,243 @@
+#include <NuBenchmarks/NuMath/Geometry/BenchmarksFrustum.hpp>
+#include <NuBenchmarks/External/Algebra/Matrix/GLMBenchmarksMatrix4x4.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Geometry/CullingBatchSoA.hpp>
+#include <NuMath/Detail/SIMD/SimdDispatch.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr float k_Fov = 1.0f;
+        constexpr float k_Aspect = 16.0f / 9.0f;
+        constexpr float k_Near = 0.1f;
+        constexpr float k_Far = 500.0f;
+
+        /**
+         * @brief Random bounds around a camera at the origin; about a tenth end up visible.
+         *
+         * Kept both as SoA streams for the batch kernels and as AoS objects for the scalar loops.
+         */
+        struct CullingScene
+        {
+            AlignedVector<float, 32> X, Y, Z, Radius, ExtentX, ExtentY, ExtentZ;
+            std::vector<NuMath::Sphere> Spheres;
+            std::vector<NuMath::AABB> Boxes;
+            std::vector<glm::vec4> GlmSpheres;
+            std::vector<uint32_t> Visible;
+
+            explicit CullingScene(size_t count)
+                : X(count), Y(count), Z(count), Radius(count), ExtentX(count), ExtentY(count), ExtentZ(count), Visible(count)
+            {
+                FastRNG rng;
+                Spheres.reserve(count);
+                Boxes.reserve(count);
+                GlmSpheres.reserve(count);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    X[i] = rng.NextFloat() * 400.0f - 200.0f;
+                    Y[i] = rng.NextFloat() * 400.0f - 200.0f;
+                    Z[i] = rng.NextFloat() * 400.0f - 200.0f;
+                    Radius[i] = 0.5f + rng.NextFloat() * 2.0f;
+                    ExtentX[i] = 0.5f + rng.NextFloat();
+                    ExtentY[i] = 0.5f + rng.NextFloat();
+                    ExtentZ[i] = 0.5f + rng.NextFloat();
+
+                    const NuMath::Vector3 center(X[i], Y[i], Z[i]);
+                    Spheres.emplace_back(center, Radius[i]);
+                    Boxes.push_back(NuMath::AABB::FromCenterExtents(center, NuMath::Vector3(ExtentX[i], ExtentY[i], ExtentZ[i])));
+                    GlmSpheres.emplace_back(X[i], Y[i], Z[i], Radius[i]);
+                }
+            }
+
+            NuMath::SoAVec3Const Centers() const { return { X.data(), Y.data(), Z.data() }; }
+            NuMath::SoAVec3Const Extents() const { return { ExtentX.data(), ExtentY.data(), ExtentZ.data() }; }
+        };
+
+        NuMath::Frustum MakeFrustum()
+        {
+            return NuMath::Frustum::FromViewProjection(NuMath::Matrix4x4::CreatePerspective(k_Fov, k_Aspect, k_Near, k_Far));
+        }
+
+        void ReportVisible(benchmark::State& state, size_t count, size_t visible)
+        {
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["Visible"] = static_cast<double>(visible);
+        }
+
+        /**
+         * @brief Runs the batch kernels at one SIMD level for the benchmark's lifetime.
+         */
+        struct ScopedBatchLevel
+        {
+            NuMath::Simd::SimdLevel Previous;
+
+            ScopedBatchLevel(benchmark::State& state, NuMath::Simd::SimdLevel level)
+                : Previous(NuMath::Simd::GetBatchLevel())
+            {
+                state.SetLabel(NuMath::Simd::ToString(NuMath::Simd::SetBatchLevel(level)));
+            }
+
+            ~ScopedBatchLevel() { NuMath::Simd::SetBatchLevel(Previous); }
+        };
+
+        void BM_CullSpheres_SoA(benchmark::State& state, NuMath::Simd::SimdLevel level)
+        {
+            const ScopedBatchLevel scopedLevel(state, level);
+            const size_t count = static_cast<size_t>(state.range(0));
+            CullingScene scene(count);
+            const NuMath::Frustum frustum = MakeFrustum();
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = NuMath::Batch::SoA::CullSpheres(frustum, scene.Centers(), scene.Radius.data(), count, scene.Visible.data());
+                benchmark::DoNotOptimize(visible);
+                benchmark::ClobberMemory();
+            }
+            ReportVisible(state, count, visible);
+        }
+
+        void BM_CullSpheres_Scalar(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            CullingScene scene(count);
+            const NuMath::Frustum frustum = MakeFrustum();
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (NuMath::Intersects(frustum, scene.Spheres[i]))
+                    {
+                        scene.Visible[visible++] = static_cast<uint32_t>(i);
+                    }
+                }
+                benchmark::DoNotOptimize(visible);
+                benchmark::ClobberMemory();
+            }
+            ReportVisible(state, count, visible);
+        }
+
+        void BM_CullSpheres_GLM(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            CullingScene scene(count);
+
+            // Gribb-Hartmann on GLM's column-major matrix: row r is (m[0][r], m[1][r], m[2][r], m[3][r])
+            const glm::mat4 viewProjection = glm::perspective(k_Fov, k_Aspect, k_Near, k_Far);
+            const glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+            const glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+            const glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+            const glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+            glm::vec4 planes[6] = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+            for (glm::vec4& plane : planes)
+            {
+                plane /= glm::length(glm::vec3(plane));
+            }
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const glm::vec4& sphere = scene.GlmSpheres[i];
+                    const glm::vec3 center(sphere);
+
+                    bool inside = true;
+                    for (const glm::vec4& plane : planes)
+                    {
+                        if (glm::dot(glm::vec3(plane), center) + plane.w < -sphere.w)
+                        {
+                            inside = false;
+                            break;
+                        }
+                    }
+
+                    if (inside)
+                    {
+                        scene.Visible[visible++] = static_cast<uint32_t>(i);
+                    }
+                }
+                benchmark::DoNotOptimize(visible);
+                benchmark::ClobberMemory();
+            }
+            ReportVisible(state, count, visible);
+        }
+
+        void BM_CullAABBs_SoA(benchmark::State& state, NuMath::Simd::SimdLevel level)
+        {
+            const ScopedBatchLevel scopedLevel(state, level);
+            const size_t count = static_cast<size_t>(state.range(0));
+            CullingScene scene(count);
+            const NuMath::Frustum frustum = MakeFrustum();
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = NuMath::Batch::SoA::CullAABBs(frustum, scene.Centers(), scene.Extents(), count, scene.Visible.data());
+                benchmark::DoNotOptimize(visible);
+                benchmark::ClobberMemory();
+            }
+            ReportVisible(state, count, visible);
+        }
+
+        void BM_CullAABBs_Scalar(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            CullingScene scene(count);
+            const NuMath::Frustum frustum = MakeFrustum();
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (NuMath::Intersects(frustum, scene.Boxes[i]))
+                    {
+                        scene.Visible[visible++] = static_cast<uint32_t>(i);
+                    }
+                }
+                benchmark::DoNotOptimize(visible);
+                benchmark::ClobberMemory();
+            }
+            ReportVisible(state, count, visible);
+        }
+    }
+
+    void RegisterFrustumBenchmarks()
+    {
+#if ENABLE_GEOMETRY_BENCHMARKS
+        // One SoA run per kernel table this CPU can execute, so the dispatch gain is visible side by side
+        for (uint8_t i = 0; i <= uint8_t(NuMath::Simd::DetectSimdLevel()); ++i)
+        {
+            const auto level = NuMath::Simd::SimdLevel(i);
+            const std::string suffix = std::string("/") + NuMath::Simd::ToString(level);
+
+            benchmark::RegisterBenchmark(("Nu_SoA_CullSpheres" + suffix).c_str(),
+                [level](benchmark::State& state) { BM_CullSpheres_SoA(state, level); })->Range(BENCH_START, 1 << 20);
+            benchmark::RegisterBenchmark(("Nu_SoA_CullAABBs" + suffix).c_str(),
+                [level](benchmark::State& state) { BM_CullAABBs_SoA(state, level); })->Range(BENCH_START, 1 << 20);
+        }
+
+        benchmark::RegisterBenchmark("Nu_Array_CullSpheres", BM_CullSpheres_Scalar)->Range(BENCH_START, 1 << 20);
+        benchmark::RegisterBenchmark("glm_Array_CullSpheres", BM_CullSpheres_GLM)->Range(BENCH_START, 1 << 20);
+        benchmark::RegisterBenchmark("Nu_Array_CullAABBs", BM_CullAABBs_Scalar)->Range(BENCH_START, 1 << 20);
+#endif
+    }
+}
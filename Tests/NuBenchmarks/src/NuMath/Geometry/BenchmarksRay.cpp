@@ -0,0 +1,275 @@
+#include <NuBenchmarks/NuMath/Geometry/BenchmarksRay.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Geometry/RayBatchSoA.hpp>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        // Primitives each packet benchmark tests its rays against
+        constexpr uint32_t k_PacketPrimitives = 16;
+
+        float RandomRange(FastRNG& rng, float min, float max)
+        {
+            return min + rng.NextFloat() * (max - min);
+        }
+
+        /**
+         * @brief Rays shot from z = 40 into a 40-unit cube of small primitives; roughly one in
+         *        five rays hits something.
+         *
+         * Kept both as SoA streams for the batch kernels and as AoS objects for the scalar loops.
+         */
+        struct RayScene
+        {
+            AlignedVector<float, 32> OriginX, OriginY, OriginZ, DirX, DirY, DirZ, InvDirX, InvDirY, InvDirZ;
+            std::vector<NuMath::Ray> Rays;
+
+            AlignedVector<float, 32> V0X, V0Y, V0Z, E1X, E1Y, E1Z, E2X, E2Y, E2Z;
+            AlignedVector<float, 32> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+            AlignedVector<float, 32> CenterX, CenterY, CenterZ, Radius;
+            std::vector<NuMath::Triangle> Triangles;
+            std::vector<NuMath::AABB> Boxes;
+            std::vector<NuMath::Sphere> Spheres;
+
+            AlignedVector<float, 32> HitDistance, HitU, HitV;
+            std::vector<uint32_t> HitPrimitive;
+
+            RayScene(size_t rayCount, size_t primitiveCount)
+                : HitDistance(rayCount), HitU(rayCount), HitV(rayCount), HitPrimitive(rayCount)
+            {
+                FastRNG rng;
+                for (size_t i = 0; i < rayCount; ++i)
+                {
+                    const NuMath::Vector3 origin(RandomRange(rng, -20.0f, 20.0f), RandomRange(rng, -20.0f, 20.0f), 40.0f);
+                    const NuMath::Vector3 target(RandomRange(rng, -20.0f, 20.0f), RandomRange(rng, -20.0f, 20.0f), RandomRange(rng, -20.0f, 20.0f));
+                    const NuMath::Vector3 direction = (target - origin).Normalize();
+
+                    Rays.emplace_back(origin, direction);
+                    OriginX.push_back(origin.X());
+                    OriginY.push_back(origin.Y());
+                    OriginZ.push_back(origin.Z());
+                    DirX.push_back(direction.X());
+                    DirY.push_back(direction.Y());
+                    DirZ.push_back(direction.Z());
+                    InvDirX.push_back(1.0f / direction.X());
+                    InvDirY.push_back(1.0f / direction.Y());
+                    InvDirZ.push_back(1.0f / direction.Z());
+                }
+
+                for (size_t i = 0; i < primitiveCount; ++i)
+                {
+                    const NuMath::Vector3 center(RandomRange(rng, -20.0f, 20.0f), RandomRange(rng, -20.0f, 20.0f), RandomRange(rng, -20.0f, 20.0f));
+                    const NuMath::Vector3 size(RandomRange(rng, 0.2f, 1.0f), RandomRange(rng, 0.2f, 1.0f), RandomRange(rng, 0.2f, 1.0f));
+
+                    const NuMath::Triangle triangle(center, center + NuMath::Vector3(size.X(), 0.0f, size.Z()), center + NuMath::Vector3(0.0f, size.Y(), -size.Z()));
+                    Triangles.push_back(triangle);
+                    V0X.push_back(triangle.V0.X());
+                    V0Y.push_back(triangle.V0.Y());
+                    V0Z.push_back(triangle.V0.Z());
+                    E1X.push_back(triangle.GetEdge1().X());
+                    E1Y.push_back(triangle.GetEdge1().Y());
+                    E1Z.push_back(triangle.GetEdge1().Z());
+                    E2X.push_back(triangle.GetEdge2().X());
+                    E2Y.push_back(triangle.GetEdge2().Y());
+                    E2Z.push_back(triangle.GetEdge2().Z());
+
+                    const NuMath::AABB box = NuMath::AABB::FromCenterExtents(center, size * 0.5f);
+                    Boxes.push_back(box);
+                    MinX.push_back(box.Min.X());
+                    MinY.push_back(box.Min.Y());
+                    MinZ.push_back(box.Min.Z());
+                    MaxX.push_back(box.Max.X());
+                    MaxY.push_back(box.Max.Y());
+                    MaxZ.push_back(box.Max.Z());
+
+                    Spheres.emplace_back(center, size.X() * 0.5f);
+                    CenterX.push_back(center.X());
+                    CenterY.push_back(center.Y());
+                    CenterZ.push_back(center.Z());
+                    Radius.push_back(size.X() * 0.5f);
+                }
+            }
+
+            NuMath::SoAVec3Const Origins() const { return { OriginX.data(), OriginY.data(), OriginZ.data() }; }
+            NuMath::SoAVec3Const Directions() const { return { DirX.data(), DirY.data(), DirZ.data() }; }
+            NuMath::SoAVec3Const InvDirections() const { return { InvDirX.data(), InvDirY.data(), InvDirZ.data() }; }
+            NuMath::SoAVec3Const V0() const { return { V0X.data(), V0Y.data(), V0Z.data() }; }
+            NuMath::SoAVec3Const Edge1() const { return { E1X.data(), E1Y.data(), E1Z.data() }; }
+            NuMath::SoAVec3Const Edge2() const { return { E2X.data(), E2Y.data(), E2Z.data() }; }
+            NuMath::SoAVec3Const Mins() const { return { MinX.data(), MinY.data(), MinZ.data() }; }
+            NuMath::SoAVec3Const Maxs() const { return { MaxX.data(), MaxY.data(), MaxZ.data() }; }
+            NuMath::SoAVec3Const Centers() const { return { CenterX.data(), CenterY.data(), CenterZ.data() }; }
+
+            NuMath::Batch::SoA::RayHitsSoA Hits() { return { HitDistance.data(), HitU.data(), HitV.data(), HitPrimitive.data() }; }
+        };
+
+        enum class Shape
+        {
+            Triangle,
+            Box,
+            Sphere
+        };
+
+        bool ScalarHit(const RayScene& scene, Shape shape, const NuMath::Ray& ray, size_t primitive, float& distance)
+        {
+            float u = 0.0f;
+            float v = 0.0f;
+            switch (shape)
+            {
+            case Shape::Triangle: return NuMath::Intersects(ray, scene.Triangles[primitive], distance, u, v);
+            case Shape::Box:      return NuMath::Intersects(ray, scene.Boxes[primitive], distance);
+            case Shape::Sphere:   return NuMath::Intersects(ray, scene.Spheres[primitive], distance);
+            }
+            return false;
+        }
+
+        void ReportRays(benchmark::State& state, size_t tests, int width)
+        {
+            state.SetItemsProcessed(state.iterations() * tests);
+            state.counters["Width"] = static_cast<double>(width);
+        }
+
+        /**
+         * @brief Packet: range(0) rays against k_PacketPrimitives primitives, Width rays per test.
+         */
+        template <typename B>
+        void BM_RayPacket_SoA(benchmark::State& state, Shape shape)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RayScene scene(count, k_PacketPrimitives);
+
+            for (auto _ : state)
+            {
+                NuMath::Batch::SoA::ResetHits(scene.Hits(), count);
+                for (uint32_t p = 0; p < k_PacketPrimitives; ++p)
+                {
+                    switch (shape)
+                    {
+                    case Shape::Triangle: NuMath::Batch::SoA::IntersectRays<B>(scene.Origins(), scene.Directions(), count, scene.Triangles[p], p, scene.Hits()); break;
+                    case Shape::Box:      NuMath::Batch::SoA::IntersectRays<B>(scene.Origins(), scene.InvDirections(), count, scene.Boxes[p], p, scene.Hits()); break;
+                    case Shape::Sphere:   NuMath::Batch::SoA::IntersectRays<B>(scene.Origins(), scene.Directions(), count, scene.Spheres[p], p, scene.Hits()); break;
+                    }
+                }
+                benchmark::DoNotOptimize(scene.HitPrimitive.data());
+                benchmark::ClobberMemory();
+            }
+            ReportRays(state, count * k_PacketPrimitives, B::Width);
+        }
+
+        void BM_RayPacket_Scalar(benchmark::State& state, Shape shape)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RayScene scene(count, k_PacketPrimitives);
+
+            for (auto _ : state)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float best = std::numeric_limits<float>::infinity();
+                    uint32_t bestPrimitive = NuMath::RayHit::k_NoPrimitive;
+                    for (uint32_t p = 0; p < k_PacketPrimitives; ++p)
+                    {
+                        float distance = 0.0f;
+                        if (ScalarHit(scene, shape, scene.Rays[i], p, distance) && distance < best)
+                        {
+                            best = distance;
+                            bestPrimitive = p;
+                        }
+                    }
+                    scene.HitDistance[i] = best;
+                    scene.HitPrimitive[i] = bestPrimitive;
+                }
+                benchmark::DoNotOptimize(scene.HitPrimitive.data());
+                benchmark::ClobberMemory();
+            }
+            ReportRays(state, count * k_PacketPrimitives, 1);
+        }
+
+        /**
+         * @brief Stream: one ray against range(0) primitives, Width primitives per test.
+         */
+        template <typename B>
+        void BM_RayStream_SoA(benchmark::State& state, Shape shape)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RayScene scene(1, count);
+            const NuMath::Ray& ray = scene.Rays[0];
+
+            NuMath::RayHit hit;
+            for (auto _ : state)
+            {
+                switch (shape)
+                {
+                case Shape::Triangle: hit = NuMath::Batch::SoA::IntersectTriangles<B>(ray, scene.V0(), scene.Edge1(), scene.Edge2(), count); break;
+                case Shape::Box:      hit = NuMath::Batch::SoA::IntersectAABBs<B>(ray, scene.Mins(), scene.Maxs(), count); break;
+                case Shape::Sphere:   hit = NuMath::Batch::SoA::IntersectSpheres<B>(ray, scene.Centers(), scene.Radius.data(), count); break;
+                }
+                benchmark::DoNotOptimize(hit);
+            }
+            ReportRays(state, count, B::Width);
+        }
+
+        void BM_RayStream_Scalar(benchmark::State& state, Shape shape)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RayScene scene(1, count);
+            const NuMath::Ray& ray = scene.Rays[0];
+
+            NuMath::RayHit hit;
+            for (auto _ : state)
+            {
+                hit = NuMath::RayHit();
+                for (size_t p = 0; p < count; ++p)
+                {
+                    float distance = 0.0f;
+                    if (ScalarHit(scene, shape, ray, p, distance) && distance < hit.Distance)
+                    {
+                        hit.Distance = distance;
+                        hit.Primitive = static_cast<uint32_t>(p);
+                    }
+                }
+                benchmark::DoNotOptimize(hit);
+            }
+            ReportRays(state, count, 1);
+        }
+
+        template <typename B>
+        void RegisterSoA(const char* backend, const char* name, Shape shape)
+        {
+            benchmark::RegisterBenchmark((std::string("Nu_SoA_") + backend + "_RayPacket" + name).c_str(),
+                [shape](benchmark::State& state) { BM_RayPacket_SoA<B>(state, shape); })->Range(BENCH_START, 1 << 16);
+            benchmark::RegisterBenchmark((std::string("Nu_SoA_") + backend + "_RayStream" + name).c_str(),
+                [shape](benchmark::State& state) { BM_RayStream_SoA<B>(state, shape); })->Range(BENCH_START, 1 << 20);
+        }
+    }
+
+    void RegisterRayBenchmarks()
+    {
+#if ENABLE_GEOMETRY_BENCHMARKS
+        const std::pair<const char*, Shape> shapes[] = { { "Triangle", Shape::Triangle }, { "AABB", Shape::Box }, { "Sphere", Shape::Sphere } };
+
+        for (const auto& [name, shape] : shapes)
+        {
+#if defined(__SSE__) || defined(_M_X64)
+            RegisterSoA<NuMath::Detail::SSE_Traits>("SSE", name, shape);
+#endif
+#if defined(__AVX__)
+            RegisterSoA<NuMath::Detail::AVX_Traits>("AVX", name, shape);
+#endif
+            benchmark::RegisterBenchmark((std::string("Nu_Array_RayPacket") + name).c_str(),
+                [shape](benchmark::State& state) { BM_RayPacket_Scalar(state, shape); })->Range(BENCH_START, 1 << 16);
+            benchmark::RegisterBenchmark((std::string("Nu_Array_RayStream") + name).c_str(),
+                [shape](benchmark::State& state) { BM_RayStream_Scalar(state, shape); })->Range(BENCH_START, 1 << 20);
+        }
+#endif
+    }
+}
@@ -0,0 +1,305 @@
+#include <NuBenchmarks/Physics/BenchmarksPhysics.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <Physics/Core/PhysicsEngine.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr float k_StepDelta = 1.0f / 60.0f;
+        constexpr int k_SettleSteps = 60;
+
+        std::vector<Physics::BodyDesc> MakeBoxPile(size_t count)
+        {
+            std::vector<Physics::BodyDesc> descs;
+            descs.reserve(count + 1);
+
+            Physics::BodyDesc floor;
+            floor.Shape = Physics::ShapeDesc::Box(NuMath::Vector3(200.0f, 1.0f, 200.0f));
+            floor.Position = NuMath::Vector3(0.0f, -1.0f, 0.0f);
+            floor.Type = Physics::BodyType::Static;
+            descs.push_back(floor);
+
+            const size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(count) / 8.0f)));
+            for (size_t i = 0; i < count; ++i)
+            {
+                const size_t layer = i / (side * side);
+                const size_t x = (i % (side * side)) % side;
+                const size_t z = (i % (side * side)) / side;
+
+                Physics::BodyDesc box;
+                box.Shape = Physics::ShapeDesc::Box(NuMath::Vector3(0.5f, 0.5f, 0.5f));
+                box.Position = NuMath::Vector3(
+                    static_cast<float>(x) * 1.1f - static_cast<float>(side) * 0.55f,
+                    1.0f + static_cast<float>(layer) * 1.1f,
+                    static_cast<float>(z) * 1.1f - static_cast<float>(side) * 0.55f);
+                descs.push_back(box);
+            }
+            return descs;
+        }
+
+        Physics::PhysicsSettings MakeSettings(size_t bodyCount, Physics::PhysicsJobBackend backend)
+        {
+            Physics::PhysicsSettings settings;
+            settings.MaxBodies = static_cast<uint32_t>(bodyCount) + 1;
+            settings.MaxBodyPairs = static_cast<uint32_t>(bodyCount) * 8;
+            settings.MaxContactConstraints = static_cast<uint32_t>(bodyCount) * 8;
+            settings.TempAllocatorSize = 64 * 1024 * 1024;
+            settings.JobBackend = backend;
+            return settings;
+        }
+
+        void BM_PhysicsStep(benchmark::State& state, Physics::PhysicsJobBackend backend)
+        {
+            const size_t bodyCount = static_cast<size_t>(state.range(0));
+
+            Core::JobSystem::Get().Initialize();
+            if (Physics::PhysicsEngine::Initialize(MakeSettings(bodyCount, backend)).IsError())
+            {
+                state.SkipWithError("PhysicsEngine::Initialize failed");
+                return;
+            }
+
+            const auto descs = MakeBoxPile(bodyCount);
+            if (Physics::PhysicsEngine::CreateBodies(descs).IsError())
+            {
+                state.SkipWithError("PhysicsEngine::CreateBodies failed");
+                Physics::PhysicsEngine::Shutdown();
+                return;
+            }
+            Physics::PhysicsEngine::GetSystem().OptimizeBroadPhase();
+
+            // Let the pile collapse so the measured steps have real contacts.
+            for (int i = 0; i < k_SettleSteps; ++i)
+            {
+                Physics::PhysicsEngine::Update(k_StepDelta);
+            }
+
+            for (auto _ : state)
+            {
+                Physics::PhysicsEngine::Update(k_StepDelta);
+            }
+
+            state.SetItemsProcessed(state.iterations() * bodyCount);
+
+            const Physics::PhysicsStats& stats = Physics::PhysicsEngine::GetStats();
+            state.counters["Threads"] = static_cast<double>(Core::JobSystem::Get().GetNumThreads());
+            state.counters["ActiveBodies"] = static_cast<double>(stats.NumActiveBodies);
+            state.counters["Contacts"] = static_cast<double>(stats.NumContactConstraints);
+            state.counters["TempPeakKB"] = static_cast<double>(stats.TempAllocatorPeak) / 1024.0;
+
+            Physics::PhysicsEngine::Shutdown();
+        }
+
+        void BM_PhysicsCreate(benchmark::State& state, bool bulk)
+        {
+            const size_t bodyCount = static_cast<size_t>(state.range(0));
+            const auto descs = MakeBoxPile(bodyCount);
+
+            Core::JobSystem::Get().Initialize();
+
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+                Physics::PhysicsEngine::Initialize(MakeSettings(bodyCount, Physics::PhysicsJobBackend::EngineJobSystem)).Ignore();
+                state.ResumeTiming();
+
+                if (bulk)
+                {
+                    benchmark::DoNotOptimize(Physics::PhysicsEngine::CreateBodies(descs));
+                }
+                else
+                {
+                    for (const Physics::BodyDesc& desc : descs)
+                    {
+                        benchmark::DoNotOptimize(Physics::PhysicsEngine::CreateBox(desc.Shape.HalfExtents, desc.Position, desc.Type));
+                    }
+                }
+
+                state.PauseTiming();
+                Physics::PhysicsEngine::Shutdown();
+                state.ResumeTiming();
+            }
+
+            state.SetItemsProcessed(state.iterations() * descs.size());
+        }
+    }
+
+    namespace
+    {
+        void BM_PhysicsCastRays(benchmark::State& state)
+        {
+            constexpr size_t k_BodyCount = 4096;
+            const size_t rayCount = static_cast<size_t>(state.range(0));
+
+            Core::JobSystem::Get().Initialize();
+            if (Physics::PhysicsEngine::Initialize(MakeSettings(k_BodyCount, Physics::PhysicsJobBackend::EngineJobSystem)).IsError()
+                || Physics::PhysicsEngine::CreateBodies(MakeBoxPile(k_BodyCount)).IsError())
+            {
+                state.SkipWithError("Physics scene setup failed");
+                Physics::PhysicsEngine::Shutdown();
+                return;
+            }
+            Physics::PhysicsEngine::GetSystem().OptimizeBroadPhase();
+
+            FastRNG rng;
+            std::vector<NuMath::Ray> rays(rayCount);
+            for (auto& ray : rays)
+            {
+                const float x = rng.NextFloat() * 80.0f - 40.0f;
+                const float z = rng.NextFloat() * 80.0f - 40.0f;
+                ray = NuMath::Ray(NuMath::Vector3(x, 30.0f, z), NuMath::Vector3(0.0f, -1.0f, 0.0f));
+            }
+
+            Physics::CastHitsBuffer hits;
+            hits.Resize(rayCount);
+
+            for (auto _ : state)
+            {
+                Physics::PhysicsEngine::CastRays(rays, 100.0f, hits.View()).Ignore();
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * rayCount);
+            Physics::PhysicsEngine::Shutdown();
+        }
+    }
+
+    namespace
+    {
+        // Compare against Physics_Create_CreateBodies: the rebuild a scene reset would otherwise need
+        void BM_PhysicsRestoreState(benchmark::State& state, Physics::PhysicsSaveMode mode)
+        {
+            const size_t bodyCount = static_cast<size_t>(state.range(0));
+
+            Core::JobSystem::Get().Initialize();
+            if (Physics::PhysicsEngine::Initialize(MakeSettings(bodyCount, Physics::PhysicsJobBackend::EngineJobSystem)).IsError()
+                || Physics::PhysicsEngine::CreateBodies(MakeBoxPile(bodyCount)).IsError())
+            {
+                state.SkipWithError("Physics scene setup failed");
+                Physics::PhysicsEngine::Shutdown();
+                return;
+            }
+
+            Physics::PhysicsSnapshot keyframe;
+            Physics::PhysicsSnapshot delta;
+            Physics::PhysicsDeltaBaseline baseline;
+            Physics::PhysicsEngine::SaveState(keyframe, Physics::PhysicsSaveMode::Full, &baseline).Ignore();
+            Physics::PhysicsEngine::Update(k_StepDelta);
+            Physics::PhysicsEngine::SaveState(delta, mode, &baseline).Ignore();
+
+            for (auto _ : state)
+            {
+                Physics::PhysicsEngine::RestoreState(keyframe).Ignore();
+                if (mode == Physics::PhysicsSaveMode::Delta)
+                {
+                    Physics::PhysicsEngine::RestoreState(delta).Ignore();
+                }
+            }
+
+            state.counters["SnapshotKB"] = static_cast<double>(keyframe.Data.size()) / 1024.0;
+            state.counters["DeltaKB"] = static_cast<double>(delta.Data.size()) / 1024.0;
+            state.SetItemsProcessed(state.iterations() * bodyCount);
+            Physics::PhysicsEngine::Shutdown();
+        }
+    }
+
+    namespace
+    {
+        // One frame = physics Update + a fixed slice of single-threaded "gameplay" that reads body poses.
+        // In async mode the step overlaps the gameplay slice, so the frame costs max(step, gameplay).
+        void BM_PhysicsFrame(benchmark::State& state, bool async)
+        {
+            const size_t bodyCount = static_cast<size_t>(state.range(0));
+
+            Physics::PhysicsSettings settings = MakeSettings(bodyCount, Physics::PhysicsJobBackend::EngineJobSystem);
+            settings.AsyncStep = async;
+
+            Core::JobSystem::Get().Initialize();
+            if (Physics::PhysicsEngine::Initialize(settings).IsError())
+            {
+                state.SkipWithError("PhysicsEngine::Initialize failed");
+                return;
+            }
+
+            auto bodies = Physics::PhysicsEngine::CreateBodies(MakeBoxPile(bodyCount));
+            if (bodies.IsError())
+            {
+                state.SkipWithError("PhysicsEngine::CreateBodies failed");
+                Physics::PhysicsEngine::Shutdown();
+                return;
+            }
+            const std::vector<Physics::RigidBody> handles = bodies.Unwrap();
+
+            for (int i = 0; i < k_SettleSteps; ++i)
+            {
+                Physics::PhysicsEngine::Update(k_StepDelta);
+            }
+
+            for (auto _ : state)
+            {
+                Physics::PhysicsEngine::Update(k_StepDelta);
+
+                float sum = 0.0f;
+                for (int pass = 0; pass < 4; ++pass)
+                {
+                    for (const Physics::RigidBody& body : handles)
+                    {
+                        sum += body.GetPosition().Y();
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+
+            Physics::PhysicsEngine::WaitForStep();
+            state.SetItemsProcessed(state.iterations() * bodyCount);
+            Physics::PhysicsEngine::Shutdown();
+        }
+    }
+
+    void RegisterPhysicsBenchmarks()
+    {
+#if ENABLE_PHYSICS_BENCHMARKS
+        benchmark::RegisterBenchmark("Physics_Step_EngineJobSystem",
+            [](benchmark::State& state) { BM_PhysicsStep(state, Physics::PhysicsJobBackend::EngineJobSystem); })
+            ->RangeMultiplier(4)->Range(256, 16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Physics_Step_JoltThreadPool",
+            [](benchmark::State& state) { BM_PhysicsStep(state, Physics::PhysicsJobBackend::JoltThreadPool); })
+            ->RangeMultiplier(4)->Range(256, 16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Physics_Create_CreateBoxLoop",
+            [](benchmark::State& state) { BM_PhysicsCreate(state, false); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMillisecond);
+
+        benchmark::RegisterBenchmark("Physics_Create_CreateBodies",
+            [](benchmark::State& state) { BM_PhysicsCreate(state, true); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMillisecond);
+
+        benchmark::RegisterBenchmark("Physics_RestoreState_Full",
+            [](benchmark::State& state) { BM_PhysicsRestoreState(state, Physics::PhysicsSaveMode::Full); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMicrosecond);
+
+        benchmark::RegisterBenchmark("Physics_RestoreState_KeyframePlusDelta",
+            [](benchmark::State& state) { BM_PhysicsRestoreState(state, Physics::PhysicsSaveMode::Delta); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMicrosecond);
+
+        benchmark::RegisterBenchmark("Physics_Frame_SyncStep",
+            [](benchmark::State& state) { BM_PhysicsFrame(state, false); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Physics_Frame_AsyncStep",
+            [](benchmark::State& state) { BM_PhysicsFrame(state, true); })
+            ->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Physics_CastRays", BM_PhysicsCastRays)
+            ->RangeMultiplier(4)->Range(1024, 65536)->Unit(benchmark::kMicrosecond)->UseRealTime();
+#endif
+    }
+}
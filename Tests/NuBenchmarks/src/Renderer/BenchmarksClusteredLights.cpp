@@ -0,0 +1,89 @@
+#include <NuBenchmarks/Renderer/BenchmarksClusteredLights.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <Renderer/Lighting/ClusteredLightCuller.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr float k_NearClip = 0.1f;
+        constexpr float k_FarClip = 200.0f;
+
+        /**
+         * @brief Lights scattered through the camera's view volume, a quarter of them spots.
+         *
+         * Ranges are kept small, as with the many fill lights of a real scene, so most lights touch
+         * a handful of clusters rather than whole slices.
+         */
+        std::vector<Renderer::Light> MakeLights(size_t count)
+        {
+            FastRNG rng;
+            std::vector<Renderer::Light> lights(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Renderer::Light& light = lights[i];
+                light.Position = NuMath::Vector3(rng.NextFloat() * 200.0f - 100.0f, rng.NextFloat() * 20.0f - 5.0f, -rng.NextFloat() * 180.0f);
+                light.Range = 1.0f + rng.NextFloat() * 4.0f;
+                if (i % 4 == 0)
+                {
+                    light.Type = Renderer::LightType::Spot;
+                    light.Direction = NuMath::Vector3(0.0f, -1.0f, 0.0f);
+                    light.SpotAngle = 0.2f + rng.NextFloat();
+                }
+            }
+            return lights;
+        }
+
+        void BM_ClusteredLightAssign(benchmark::State& state, bool parallel)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            const std::vector<Renderer::Light> lights = MakeLights(count);
+            const NuMath::Matrix4x4 view = NuMath::Matrix4x4::CreateTranslation(NuMath::Vector3(0.0f, -2.0f, 0.0f));
+
+            Renderer::ClusteredLightCuller culler;
+            culler.SetProjection(NuMath::Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, k_NearClip, k_FarClip), k_NearClip, k_FarClip);
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Initialize();
+            }
+
+            for (auto _ : state)
+            {
+                culler.Assign(lights, view);
+                benchmark::DoNotOptimize(culler.GetLightIndices().data());
+                benchmark::ClobberMemory();
+            }
+
+            const Renderer::ClusteredLightStats& stats = culler.GetStats();
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["Visible"] = static_cast<double>(stats.VisibleLights);
+            state.counters["Assignments"] = static_cast<double>(stats.Assignments);
+            state.counters["MaxPerCluster"] = static_cast<double>(stats.MaxLightsPerCluster);
+            state.counters["Threads"] = parallel ? static_cast<double>(Core::JobSystem::Get().GetNumThreads()) : 1.0;
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Shutdown();
+            }
+        }
+    }
+
+    void RegisterClusteredLightBenchmarks()
+    {
+#if ENABLE_RENDERER_BENCHMARKS
+        benchmark::RegisterBenchmark("ClusteredLights_Assign_Serial",
+            [](benchmark::State& state) { BM_ClusteredLightAssign(state, false); })
+            ->Arg(1024)->Arg(4096)->Arg(16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("ClusteredLights_Assign_Parallel",
+            [](benchmark::State& state) { BM_ClusteredLightAssign(state, true); })
+            ->Arg(1024)->Arg(4096)->Arg(16384)->Unit(benchmark::kMicrosecond)->UseRealTime();
+#endif
+    }
+}
@@ -0,0 +1,85 @@
+#include <NuBenchmarks/Renderer/BenchmarksLod.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <Renderer/Geometry/LodSelector.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        /**
+         * @brief Five-level chain shaped like MeshSimplifier output for a 64k-triangle unit mesh.
+         *
+         * Selection only reads the level info, so no vertex arrays are needed.
+         */
+        Renderer::LodMesh MakeLodMesh()
+        {
+            Renderer::LodMesh mesh;
+            mesh.Bounds = NuMath::Sphere(NuMath::Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+
+            const float errors[] = { 0.0f, 0.002f, 0.0045f, 0.008f, 0.014f };
+            uint32_t first = 0;
+            uint32_t count = 65536 * 3;
+            for (const float error : errors)
+            {
+                mesh.Levels.push_back({});
+                mesh.LevelInfo.push_back({ first, count, error });
+                first += count;
+                count /= 2;
+            }
+            return mesh;
+        }
+
+        void BM_LodSelect(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            const Renderer::LodMesh mesh = MakeLodMesh();
+
+            // Objects scattered over a 1 km square around the camera
+            FastRNG rng;
+            std::vector<NuMath::Sphere> bounds;
+            bounds.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const NuMath::Vector3 center(rng.NextFloat() * 1000.0f - 500.0f, rng.NextFloat() * 10.0f, rng.NextFloat() * 1000.0f - 500.0f);
+                bounds.emplace_back(center, 0.5f + rng.NextFloat() * 2.0f);
+            }
+
+            Renderer::LodSelector selector;
+            selector.SetView(NuMath::Vector3(0.0f, 2.0f, 0.0f), 1.0f, 1080.0f);
+            std::vector<uint8_t> levels(count, 0);
+
+            for (auto _ : state)
+            {
+                selector.Clear();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    selector.Add(bounds[i], mesh, levels[i]);
+                }
+                selector.Select();
+
+                const auto selected = selector.GetLevels();
+                std::copy(selected.begin(), selected.end(), levels.begin());
+                benchmark::DoNotOptimize(levels.data());
+            }
+
+            const Renderer::LodSelectionStats& stats = selector.GetStats();
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["IndexRatio"] = static_cast<double>(stats.IndicesSelected) / static_cast<double>(stats.IndicesFull);
+            state.counters["Switches"] = static_cast<double>(stats.Switches);
+        }
+    }
+
+    void RegisterLodBenchmarks()
+    {
+#if ENABLE_RENDERER_BENCHMARKS
+        benchmark::RegisterBenchmark("Lod_Select",
+            [](benchmark::State& state) { BM_LodSelect(state); })
+            ->RangeMultiplier(4)->Range(BENCH_START, 1 << 16)->Unit(benchmark::kMicrosecond);
+#endif
+    }
+}
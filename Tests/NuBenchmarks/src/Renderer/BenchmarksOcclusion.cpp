@@ -0,0 +1,136 @@
+#include <NuBenchmarks/Renderer/BenchmarksOcclusion.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <Renderer/Culling/OcclusionBuffer.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr size_t k_DefaultOccluders = 64;
+
+        struct Occluder
+        {
+            NuMath::Matrix4x4 Model;
+            NuMath::Vector3 HalfExtents;
+        };
+
+        /**
+         * @brief Street-level camera in a grid of box buildings, with small props scattered between them.
+         *
+         * The camera looks down -Z from just above the ground, so the nearest buildings hide most of
+         * what lies behind them, as in a dense interior or city block.
+         */
+        struct OcclusionScene
+        {
+            NuMath::Matrix4x4 ViewProjection;
+            std::vector<Occluder> Occluders;
+            std::vector<NuMath::AABB> Candidates;
+
+            OcclusionScene(size_t occluderCount, size_t candidateCount)
+            {
+                const NuMath::Matrix4x4 view = NuMath::Matrix4x4::CreateTranslation(NuMath::Vector3(0.0f, -2.0f, 0.0f));
+                ViewProjection = NuMath::Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 500.0f) * view;
+
+                FastRNG rng;
+                const size_t columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(occluderCount))));
+                for (size_t i = 0; i < occluderCount; ++i)
+                {
+                    const float x = (static_cast<float>(i % columns) - static_cast<float>(columns) * 0.5f) * 12.0f;
+                    const float z = -8.0f - static_cast<float>(i / columns) * 12.0f;
+                    const NuMath::Vector3 halfExtents(3.0f + rng.NextFloat() * 2.0f, 4.0f + rng.NextFloat() * 8.0f, 3.0f + rng.NextFloat() * 2.0f);
+                    Occluders.push_back({ NuMath::Matrix4x4::CreateTranslation(NuMath::Vector3(x, halfExtents.Y(), z)), halfExtents });
+                }
+
+                Candidates.reserve(candidateCount);
+                for (size_t i = 0; i < candidateCount; ++i)
+                {
+                    const NuMath::Vector3 center(rng.NextFloat() * 200.0f - 100.0f, rng.NextFloat() * 3.0f, -5.0f - rng.NextFloat() * 200.0f);
+                    Candidates.push_back(NuMath::AABB::FromCenterExtents(center, NuMath::Vector3(0.5f, 0.5f, 0.5f)));
+                }
+            }
+
+            void Build(Renderer::OcclusionBuffer& occlusion) const
+            {
+                occlusion.BeginFrame(ViewProjection);
+                for (const Occluder& occluder : Occluders)
+                {
+                    occlusion.AddOccluderBox(occluder.Model, occluder.HalfExtents);
+                }
+                occlusion.Rasterize();
+            }
+        };
+
+        void BM_OcclusionRasterize(benchmark::State& state, bool parallel)
+        {
+            const size_t occluders = static_cast<size_t>(state.range(0));
+            const OcclusionScene scene(occluders, 0);
+            Renderer::OcclusionBuffer occlusion;
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Initialize();
+            }
+
+            for (auto _ : state)
+            {
+                scene.Build(occlusion);
+                benchmark::DoNotOptimize(occlusion.GetDepth().data());
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * occluders);
+            state.counters["Triangles"] = static_cast<double>(occlusion.GetTriangleCount());
+            state.counters["Threads"] = parallel ? static_cast<double>(Core::JobSystem::Get().GetNumThreads()) : 1.0;
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Shutdown();
+            }
+        }
+
+        void BM_OcclusionTest(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            const OcclusionScene scene(k_DefaultOccluders, count);
+            Renderer::OcclusionBuffer occlusion;
+            scene.Build(occlusion);
+
+            size_t visible = 0;
+            for (auto _ : state)
+            {
+                visible = 0;
+                for (const NuMath::AABB& bounds : scene.Candidates)
+                {
+                    visible += occlusion.IsVisible(bounds) ? 1 : 0;
+                }
+                benchmark::DoNotOptimize(visible);
+            }
+
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["Visible"] = static_cast<double>(visible);
+        }
+    }
+
+    void RegisterOcclusionBenchmarks()
+    {
+#if ENABLE_RENDERER_BENCHMARKS
+        benchmark::RegisterBenchmark("Occlusion_Rasterize_Serial",
+            [](benchmark::State& state) { BM_OcclusionRasterize(state, false); })
+            ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Occlusion_Rasterize_Parallel",
+            [](benchmark::State& state) { BM_OcclusionRasterize(state, true); })
+            ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Occlusion_Test",
+            [](benchmark::State& state) { BM_OcclusionTest(state); })
+            ->RangeMultiplier(4)->Range(BENCH_START, 1 << 16)->Unit(benchmark::kMicrosecond);
+#endif
+    }
+}
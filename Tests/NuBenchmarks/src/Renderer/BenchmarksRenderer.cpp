@@ -0,0 +1,157 @@
+#include <NuBenchmarks/Renderer/BenchmarksRenderer.hpp>
+#include <NuBenchmarks/Utils/BenchmarksConfig.hpp>
+#include <NuBenchmarks/Utils/BenchmarksCommon.hpp>
+
+#include <Renderer/Queue/ParallelRenderRecorder.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <vector>
+
+namespace NuEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr float k_FarClip = 500.0f;
+        constexpr size_t k_MaterialCount = 16;
+
+        struct Renderable
+        {
+            NuMath::Vector3 Position;
+            NuMath::Quaternion Rotation;
+            NuMath::Vector3 Scale;
+            uint32_t Material;
+        };
+
+        /*
+        * @brief Null-device scene: one cube mesh, a few materials and count renderables spread around the camera.
+        */
+        struct RenderScene
+        {
+            Graphics::Null::NullRenderDevice Device;
+            Renderer::Mesh Cube;
+            std::vector<Renderer::Material> Materials;
+            std::shared_ptr<Graphics::IVertexBuffer> InstanceBuffer;
+            std::vector<Renderable> Renderables;
+            NuMath::Matrix4x4 View = NuMath::Matrix4x4::Identity();
+            NuMath::Matrix4x4 Projection = NuMath::Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, k_FarClip);
+
+            explicit RenderScene(size_t count)
+            {
+                float vertices[] = { 0.0f, 0.0f, 0.0f };
+                Cube.VertexArray = Device.CreateVertexArray();
+                Cube.VertexArray->AddVertexBuffer(Device.CreateVertexBuffer(vertices, sizeof(vertices)));
+                Cube.VertexCount = 36;
+
+                Materials.resize(k_MaterialCount);
+                for (Renderer::Material& material : Materials)
+                {
+                    material.Shader = Device.CreateShader("vs", "fs").Unwrap();
+                    material.Texture = Device.CreateTexture("bench.png");
+                }
+
+                InstanceBuffer = Device.CreateDynamicVertexBuffer(static_cast<unsigned int>(count * sizeof(NuMath::Matrix4x4)));
+
+                // Positions fill a cube around the camera, so only about a tenth survive the frustum
+                FastRNG rng;
+                Renderables.resize(count);
+                for (Renderable& renderable : Renderables)
+                {
+                    renderable.Position = NuMath::Vector3(
+                        rng.NextFloat() * 400.0f - 200.0f,
+                        rng.NextFloat() * 400.0f - 200.0f,
+                        rng.NextFloat() * 400.0f - 200.0f);
+                    renderable.Rotation = NuMath::Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+                    renderable.Scale = NuMath::Vector3(1.0f, 1.0f, 1.0f);
+                    renderable.Material = static_cast<uint32_t>(rng.NextFloat() * k_MaterialCount) % k_MaterialCount;
+                }
+            }
+
+            void Record(Renderer::ParallelRenderRecorder& recorder, size_t minBatchSize)
+            {
+                recorder.BeginFrame(View, Projection, k_FarClip);
+                recorder.Record(Renderables.size(), [this, &recorder](size_t start, size_t end, Renderer::RenderQueue& queue)
+                {
+                    for (size_t i = start; i < end; ++i)
+                    {
+                        const Renderable& renderable = Renderables[i];
+                        const NuMath::Matrix4x4 model = NuMath::Transform(renderable.Position, renderable.Rotation, renderable.Scale).GetMatrix();
+                        recorder.SubmitCulled(queue, Cube, Materials[renderable.Material], Renderer::RenderPass::Opaque, model, 0.87f);
+                    }
+                }, minBatchSize);
+            }
+        };
+
+        void BM_RenderRecord(benchmark::State& state, bool parallel)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RenderScene scene(count);
+            Renderer::ParallelRenderRecorder recorder;
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Initialize();
+            }
+
+            // A batch the size of the whole range keeps Record() on the calling thread
+            const size_t minBatchSize = parallel ? Renderer::ParallelRenderRecorder::k_MinRenderablesPerJob : count;
+
+            for (auto _ : state)
+            {
+                scene.Record(recorder, minBatchSize);
+                benchmark::DoNotOptimize(recorder.GetRecordedCount());
+            }
+
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["Threads"] = parallel ? static_cast<double>(Core::JobSystem::Get().GetNumThreads()) : 1.0;
+            state.counters["Visible"] = static_cast<double>(recorder.GetRecordedCount());
+
+            if (parallel)
+            {
+                Core::JobSystem::Get().Shutdown();
+            }
+        }
+
+        void BM_RenderFrame(benchmark::State& state)
+        {
+            const size_t count = static_cast<size_t>(state.range(0));
+            RenderScene scene(count);
+            Renderer::ParallelRenderRecorder recorder;
+            Renderer::RenderQueue queue;
+
+            Core::JobSystem::Get().Initialize();
+
+            for (auto _ : state)
+            {
+                scene.Record(recorder, Renderer::ParallelRenderRecorder::k_MinRenderablesPerJob);
+                recorder.MergeInto(queue);
+                queue.Sort();
+                queue.Execute(scene.Device, scene.InstanceBuffer).Ignore();
+                queue.Reset();
+            }
+
+            state.SetItemsProcessed(state.iterations() * count);
+            state.counters["DrawCalls"] = static_cast<double>(queue.GetStats().DrawCalls);
+            state.counters["Visible"] = static_cast<double>(queue.GetStats().Commands);
+
+            Core::JobSystem::Get().Shutdown();
+        }
+    }
+
+    void RegisterRendererBenchmarks()
+    {
+#if ENABLE_RENDERER_BENCHMARKS
+        benchmark::RegisterBenchmark("Render_Record_Serial",
+            [](benchmark::State& state) { BM_RenderRecord(state, false); })
+            ->RangeMultiplier(2)->Range(16384, 131072)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Render_Record_Parallel",
+            [](benchmark::State& state) { BM_RenderRecord(state, true); })
+            ->RangeMultiplier(2)->Range(16384, 131072)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+        benchmark::RegisterBenchmark("Render_Frame_NullDevice",
+            [](benchmark::State& state) { BM_RenderFrame(state); })
+            ->RangeMultiplier(2)->Range(16384, 131072)->Unit(benchmark::kMicrosecond)->UseRealTime();
+#endif
+    }
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <Weave/WeaveCompiler.hpp>
+#include <Weave/WeaveGraphScene.hpp>
+#include <NuEngine/Weave/WeaveScriptSystem.hpp>
+#include <NuEngine/Physics/Core/ContactEvent.hpp>
+
+#include <vector>
+
+namespace NuEditor::Weave::Tests
+{
+    namespace NW = NuEngine::Weave;
+
+    namespace
+    {
+        struct VelocityCall
+        {
+            uint32_t Entity;
+            NW::WeaveRegister Speed;
+        };
+
+        std::vector<VelocityCall> s_VelocityCalls;
+
+        // Stands in for SetVelocityZ so the test sees which block ran without a scene
+        void RecordSetVelocityZ(NW::NativeCallContext& ctx)
+        {
+            s_VelocityCalls.push_back({ ctx.EntityId, ctx.Registers[ctx.ArgRegs[0]] });
+        }
+
+        void Connect(WeaveGraphScene& scene, int fromNode, int fromPin, int toNode, int toPin)
+        {
+            ASSERT_TRUE(scene.AddConnection({ fromNode, fromPin, toNode, toPin }));
+        }
+    }
+
+    class WeaveCompilerTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            NW::NativeRegistry::Initialize();
+            m_SavedSetVelocityZ = NW::NativeRegistry::Functions[NW::NativeFuncId::SetVelocityZ];
+            NW::NativeRegistry::Functions[NW::NativeFuncId::SetVelocityZ] = RecordSetVelocityZ;
+            s_VelocityCalls.clear();
+        }
+
+        void TearDown() override
+        {
+            NW::NativeRegistry::Functions[NW::NativeFuncId::SetVelocityZ] = m_SavedSetVelocityZ;
+        }
+
+        NW::WeaveGraphAsset Compile(const WeaveGraphScene& scene)
+        {
+            WeaveCompiler compiler;
+            const CompileResult result = compiler.Compile(scene);
+            EXPECT_TRUE(result.Success);
+
+            NW::WeaveGraphAsset asset;
+            asset.ByteCode = result.Bytecode;
+            asset.OnCollideEntry = result.OnCollideEntry;
+            return asset;
+        }
+
+        NW::NativeFuncSignature m_SavedSetVelocityZ = nullptr;
+    };
+
+    TEST_F(WeaveCompilerTest, OnCollideRunsOnlyOnContact)
+    {
+        WeaveGraphScene scene;
+
+        // OnUpdate -> SetVelocityZ(5)
+        const int onUpdate = scene.SpawnNode(NodeKind::Event_OnUpdate);
+        const int updateVelocity = scene.SpawnNode(NodeKind::Native_SetVelZ);
+        scene.FindNode(updateVelocity)->PinDefaultValues[1] = "5.0";
+        Connect(scene, onUpdate, 0, updateVelocity, 0);
+
+        // OnCollide -> SetVelocityZ(ContactNormal.Y + 10)
+        const int onCollide = scene.SpawnNode(NodeKind::Event_OnCollide);
+        const int normal = scene.SpawnNode(NodeKind::Native_GetContactNormal);
+        const int add = scene.SpawnNode(NodeKind::Math_Add);
+        scene.FindNode(add)->PinDefaultValues[1] = "10.0";
+        const int collideVelocity = scene.SpawnNode(NodeKind::Native_SetVelZ);
+        Connect(scene, onCollide, 0, normal, 0);
+        Connect(scene, normal, 2, add, 0);
+        Connect(scene, add, 2, collideVelocity, 1);
+        Connect(scene, onCollide, 0, collideVelocity, 0);
+
+        const NW::WeaveGraphAsset asset = Compile(scene);
+        ASSERT_TRUE(asset.HasOnCollide());
+
+        NW::WeaveComponent comp;
+        comp.Asset = &asset;
+        comp.Enable();
+        const uint32_t entity = 7;
+
+        NW::WeaveScriptSystem::Update(&comp, &entity, 1, 1.0f / 60.0f, nullptr);
+        ASSERT_EQ(s_VelocityCalls.size(), 1u);
+        EXPECT_FLOAT_EQ(s_VelocityCalls[0].Speed.f, 5.0f);
+
+        s_VelocityCalls.clear();
+        NuEngine::Physics::ContactEvent contact{};
+        contact.Normal = NuMath::Vector3(0.0f, 1.0f, 0.0f);
+        NW::WeaveScriptSystem::DispatchCollision(comp, entity, 9, contact, nullptr);
+
+        ASSERT_EQ(s_VelocityCalls.size(), 1u);
+        EXPECT_EQ(s_VelocityCalls[0].Entity, entity);
+        EXPECT_FLOAT_EQ(s_VelocityCalls[0].Speed.f, 11.0f);
+
+        // The next frame runs the OnUpdate block alone again
+        s_VelocityCalls.clear();
+        NW::WeaveScriptSystem::Update(&comp, &entity, 1, 1.0f / 60.0f, nullptr);
+        ASSERT_EQ(s_VelocityCalls.size(), 1u);
+        EXPECT_FLOAT_EQ(s_VelocityCalls[0].Speed.f, 5.0f);
+    }
+
+    TEST_F(WeaveCompilerTest, OnCollideOtherPinIsTheOtherEntity)
+    {
+        WeaveGraphScene scene;
+
+        const int onCollide = scene.SpawnNode(NodeKind::Event_OnCollide);
+        const int velocity = scene.SpawnNode(NodeKind::Native_SetVelZ);
+        Connect(scene, onCollide, 0, velocity, 0);
+        Connect(scene, onCollide, 1, velocity, 1);
+
+        const NW::WeaveGraphAsset asset = Compile(scene);
+        ASSERT_TRUE(asset.HasOnCollide());
+
+        NW::WeaveComponent comp;
+        comp.Asset = &asset;
+        comp.Enable();
+        const uint32_t entity = 3;
+
+        NW::WeaveScriptSystem::Update(&comp, &entity, 1, 1.0f / 60.0f, nullptr);
+        EXPECT_TRUE(s_VelocityCalls.empty());
+
+        const NuEngine::Physics::ContactEvent contact{};
+        NW::WeaveScriptSystem::DispatchCollision(comp, entity, 42, contact, nullptr);
+        ASSERT_EQ(s_VelocityCalls.size(), 1u);
+        EXPECT_EQ(s_VelocityCalls[0].Speed.u, 42u);
+    }
+
+    TEST_F(WeaveCompilerTest, GraphWithoutOnCollideHasNoEntry)
+    {
+        WeaveGraphScene scene;
+        const int onUpdate = scene.SpawnNode(NodeKind::Event_OnUpdate);
+        const int velocity = scene.SpawnNode(NodeKind::Native_SetVelZ);
+        Connect(scene, onUpdate, 0, velocity, 0);
+
+        const NW::WeaveGraphAsset asset = Compile(scene);
+        EXPECT_EQ(asset.OnCollideEntry, NW::k_NoEntryPoint);
+        EXPECT_FALSE(asset.HasOnCollide());
+    }
+}
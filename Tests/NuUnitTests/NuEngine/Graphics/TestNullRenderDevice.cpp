@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/NullResources.hpp>
+#include <Graphics/Backends/Null/RecordingRenderDevice.hpp>
+#include <Renderer/Queue/RenderQueue.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace NuEngine::Graphics::Tests
+{
+    using namespace NuMath;
+    using Null::NullRenderDevice;
+    using Null::RecordedCommandType;
+    using Null::RecordingRenderDevice;
+
+    namespace
+    {
+        Renderer::Mesh MakeMesh(IRenderDevice& device)
+        {
+            float vertices[] = { 0.0f, 0.0f, 0.0f };
+            auto vertexBuffer = device.CreateVertexBuffer(vertices, sizeof(vertices));
+            vertexBuffer->SetLayout({ { ShaderDataType::Float3, "aPos" } });
+
+            Renderer::Mesh mesh;
+            mesh.VertexArray = device.CreateVertexArray();
+            mesh.VertexArray->AddVertexBuffer(vertexBuffer);
+            mesh.VertexCount = 36;
+            return mesh;
+        }
+
+        Renderer::Material MakeMaterial(IRenderDevice& device, const char* texture)
+        {
+            Renderer::Material material;
+            material.Shader = device.CreateShader("vs", "fs").Unwrap();
+            material.Texture = device.CreateTexture(texture);
+            return material;
+        }
+    }
+
+    TEST(NullRenderDeviceTest, CountsCallsWithoutAContext)
+    {
+        NullRenderDevice device;
+        auto mesh = MakeMesh(device);
+
+        EXPECT_TRUE(device.Clear(0.0f, 0.0f, 0.0f, 1.0f).IsOk());
+        EXPECT_TRUE(device.DrawInstanced(mesh.VertexArray, 36, 10, 0).IsOk());
+        EXPECT_TRUE(device.DrawInstanced(mesh.VertexArray, 36, 0, 0).IsOk());
+        EXPECT_TRUE(device.Present().IsOk());
+
+        const auto& stats = device.GetStats();
+        EXPECT_EQ(stats.Clears, 1u);
+        EXPECT_EQ(stats.DrawCalls, 1u);
+        EXPECT_EQ(stats.Instances, 10u);
+        EXPECT_EQ(stats.Presents, 1u);
+        EXPECT_EQ(stats.VertexArraysCreated, 1u);
+        EXPECT_EQ(stats.BuffersCreated, 1u);
+
+        device.ResetStats();
+        EXPECT_EQ(device.GetStats().DrawCalls, 0u);
+    }
+
+    TEST(NullRenderDeviceTest, StateChangesIgnoreRedundantBinds)
+    {
+        NullRenderDevice device;
+        auto first = MakeMaterial(device, "a.png");
+        auto second = MakeMaterial(device, "b.png");
+
+        device.BindShader(first.Shader.get());
+        device.BindShader(first.Shader.get());
+        device.BindShader(second.Shader.get());
+        device.BindTexture(first.Texture.get(), 0);
+        device.BindTexture(first.Texture.get(), 0);
+        device.BindTexture(first.Texture.get(), 1);
+
+        const auto& stats = device.GetStats();
+        EXPECT_EQ(stats.ShaderBinds, 3u);
+        EXPECT_EQ(stats.ShaderChanges, 2u);
+        EXPECT_EQ(stats.TextureBinds, 3u);
+        EXPECT_EQ(stats.TextureChanges, 2u);
+    }
+
+    TEST(NullRenderDeviceTest, EmptyShaderSourceFails)
+    {
+        NullRenderDevice device;
+        EXPECT_TRUE(device.CreateShader("", "fs").IsError());
+    }
+
+    TEST(RecordingRenderDeviceTest, RenderQueueMergesDrawsAndSkipsRedundantBinds)
+    {
+        RecordingRenderDevice device;
+        auto cube = MakeMesh(device);
+        auto wall = MakeMaterial(device, "wall.png");
+        auto floor = MakeMaterial(device, "floor.png");
+        auto instances = device.CreateDynamicVertexBuffer(1024);
+
+        Renderer::RenderQueue queue;
+        const uint64_t wallKey = Renderer::RenderQueue::MakeKey(Renderer::RenderPass::Opaque, wall, 0.5f);
+        const uint64_t floorKey = Renderer::RenderQueue::MakeKey(Renderer::RenderPass::Opaque, floor, 0.5f);
+        for (int i = 0; i < 4; ++i)
+        {
+            queue.Submit(wallKey, cube, wall, Matrix4x4::Identity());
+            queue.Submit(floorKey, cube, floor, Matrix4x4::Identity());
+        }
+
+        queue.Sort();
+        ASSERT_TRUE(queue.Execute(device, instances).IsOk());
+
+        const auto& stats = device.GetStats();
+        EXPECT_EQ(stats.DrawCalls, 2u);
+        EXPECT_EQ(stats.Instances, 8u);
+        EXPECT_EQ(stats.ShaderChanges, 2u);
+        EXPECT_EQ(stats.TextureChanges, 2u);
+        EXPECT_EQ(stats.PipelineChanges, 1u);       // Both materials draw with the default state
+        EXPECT_EQ(stats.VertexArrayChanges, 1u);
+
+        std::vector<RecordedCommandType> draws;
+        for (const auto& command : device.GetCommands())
+        {
+            if (command.Type == RecordedCommandType::DrawInstanced)
+            {
+                EXPECT_EQ(command.InstanceCount, 4u);
+                EXPECT_EQ(command.VertexArray, cube.VertexArray.get());
+                draws.push_back(command.Type);
+            }
+        }
+        EXPECT_EQ(draws.size(), 2u);
+        EXPECT_EQ(device.GetCommands().back().Type, RecordedCommandType::DrawInstanced);   // Nothing is unbound
+    }
+
+    TEST(NullRenderDeviceTest, PipelineStatesChangeOnlyWhenTheyDiffer)
+    {
+        NullRenderDevice device;
+        const PipelineState transparent(PipelineStateDesc{ true, false, DepthCompare::LessEqual, BlendMode::Alpha });
+        const PipelineState sameAsTransparent(transparent.GetDesc());
+
+        EXPECT_NE(transparent.GetKey(), PipelineState::Default().GetKey());
+        EXPECT_EQ(transparent.GetKey(), sameAsTransparent.GetKey());
+
+        device.BindPipelineState(PipelineState::Default());
+        device.BindPipelineState(transparent);
+        device.BindPipelineState(sameAsTransparent);
+        device.BindPipelineState(PipelineState::Default());
+
+        EXPECT_EQ(device.GetStats().PipelineBinds, 4u);
+        EXPECT_EQ(device.GetStats().PipelineChanges, 3u);
+    }
+
+    TEST(NullRenderDeviceTest, StateChangeStatsCoverTheLastPresentedFrame)
+    {
+        NullRenderDevice device;
+        auto mesh = MakeMesh(device);
+        auto material = MakeMaterial(device, "a.png");
+
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int draw = 0; draw < 3; ++draw)
+            {
+                device.BindPipelineState(PipelineState::Default());
+                device.BindShader(material.Shader.get());
+                device.BindTexture(material.Texture.get(), 0);
+                ASSERT_TRUE(device.DrawInstanced(mesh.VertexArray, 36, 1, 0).IsOk());
+            }
+            ASSERT_TRUE(device.Present().IsOk());
+
+            // The first frame sets everything once; the second finds it all still bound
+            const StateChangeStats& stats = device.GetStateChangeStats();
+            EXPECT_EQ(stats.GetTotalChanges(), frame == 0 ? 4u : 0u);
+            EXPECT_EQ(stats.RedundantBinds, frame == 0 ? 8u : 12u);
+        }
+    }
+
+    TEST(NullRenderDeviceTest, RecycledNamesAndAddressesAreStillBound)
+    {
+        NullRenderDevice device;
+
+        // GL hands a deleted texture's name to the next texture created
+        auto deleted = std::make_shared<Null::NullTexture>("a.png", 7);
+        device.BindTexture(deleted.get(), 0);
+        deleted.reset();
+
+        auto recycled = std::make_shared<Null::NullTexture>("b.png", 7);
+        device.BindTexture(recycled.get(), 0);
+        EXPECT_EQ(device.GetStats().TextureChanges, 2u);
+
+        // Same for a vertex array allocated where a freed one lived
+        std::optional<Null::NullVertexArray> storage;
+        const auto draw = [&]()
+        {
+            const std::shared_ptr<IVertexArray> vertexArray(&*storage, [](IVertexArray*) {});
+            ASSERT_TRUE(device.DrawInstanced(vertexArray, 3, 1, 0).IsOk());
+        };
+
+        storage.emplace();
+        draw();
+        storage.emplace();
+        draw();
+        EXPECT_EQ(device.GetStats().VertexArrayChanges, 2u);
+    }
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <Graphics/Backends/OpenGL/Shaders/OpenGLProgramCache.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace NuEngine::Graphics::Tests
+{
+    using OpenGL::GLenum;
+    using OpenGL::OpenGLProgramCache;
+
+    namespace
+    {
+        constexpr const char* k_Driver = "Vendor|Renderer|4.6.0 1.0";
+        constexpr const char* k_Vertex = "void main() { gl_Position = vec4(0.0); }";
+        constexpr const char* k_Fragment = "out vec4 c; void main() { c = vec4(1.0); }";
+
+        std::vector<std::byte> MakeBinary()
+        {
+            std::vector<std::byte> binary(37);
+            for (size_t i = 0; i < binary.size(); ++i) binary[i] = static_cast<std::byte>(i * 7);
+            return binary;
+        }
+    }
+
+    TEST(ProgramCacheTest, KeyCoversSourcesAndDriver)
+    {
+        const uint64_t key = OpenGLProgramCache::MakeKey(k_Driver, k_Vertex, k_Fragment);
+
+        EXPECT_EQ(key, OpenGLProgramCache::MakeKey(k_Driver, k_Vertex, k_Fragment));
+        EXPECT_NE(key, OpenGLProgramCache::MakeKey("Vendor|Renderer|4.6.0 1.1", k_Vertex, k_Fragment));
+        EXPECT_NE(key, OpenGLProgramCache::MakeKey(k_Driver, k_Fragment, k_Vertex));
+        EXPECT_NE(OpenGLProgramCache::MakeKey(k_Driver, "ab", "c"), OpenGLProgramCache::MakeKey(k_Driver, "a", "bc"));
+    }
+
+    TEST(ProgramCacheTest, EntryRoundTrips)
+    {
+        const uint64_t key = OpenGLProgramCache::MakeKey(k_Driver, k_Vertex, k_Fragment);
+        const std::vector<std::byte> binary = MakeBinary();
+        const std::vector<char> entry = OpenGLProgramCache::Encode(key, 0x8741, binary);
+
+        GLenum format = 0;
+        std::span<const std::byte> decoded;
+        ASSERT_TRUE(OpenGLProgramCache::Decode(entry, key, format, decoded));
+        EXPECT_EQ(format, 0x8741u);
+        ASSERT_EQ(decoded.size(), binary.size());
+        EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), binary.begin()));
+    }
+
+    TEST(ProgramCacheTest, MismatchedEntriesFallBackToCompiling)
+    {
+        const uint64_t key = OpenGLProgramCache::MakeKey(k_Driver, k_Vertex, k_Fragment);
+        const std::vector<char> entry = OpenGLProgramCache::Encode(key, 1, MakeBinary());
+
+        GLenum format = 0;
+        std::span<const std::byte> binary;
+
+        // Another shader or driver
+        EXPECT_FALSE(OpenGLProgramCache::Decode(entry, key + 1, format, binary));
+
+        // Truncated write
+        const std::vector<char> truncated(entry.begin(), entry.end() - 1);
+        EXPECT_FALSE(OpenGLProgramCache::Decode(truncated, key, format, binary));
+        EXPECT_FALSE(OpenGLProgramCache::Decode(std::span<const char>(entry.data(), 8), key, format, binary));
+
+        // Not a cache file, or an older layout
+        std::vector<char> corrupt = entry;
+        corrupt[0] ^= 0x20;
+        EXPECT_FALSE(OpenGLProgramCache::Decode(corrupt, key, format, binary));
+
+        std::vector<char> outdated = entry;
+        outdated[4] = static_cast<char>(OpenGLProgramCache::k_Version + 1);
+        EXPECT_FALSE(OpenGLProgramCache::Decode(outdated, key, format, binary));
+
+        EXPECT_FALSE(OpenGLProgramCache::Decode(OpenGLProgramCache::Encode(key, 1, {}), key, format, binary));
+    }
+}
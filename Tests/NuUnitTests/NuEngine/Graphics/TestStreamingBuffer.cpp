@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/NullResources.hpp>
+#include <Graphics/Backends/Null/RecordingRenderDevice.hpp>
+#include <Renderer/Queue/RenderQueue.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace NuEngine::Graphics::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        constexpr uint32_t k_RegionSize = 1024;
+    }
+
+    TEST(StreamingBufferTest, AllocationsAreAlignedAndStayInTheRegion)
+    {
+        Null::NullRenderDevice device;
+        auto buffer = device.CreateStreamingBuffer(k_RegionSize);
+        ASSERT_TRUE(buffer);
+        EXPECT_EQ(device.GetStats().BuffersCreated, 1u);
+
+        const StreamingAllocation first = buffer->Allocate(10, 16);
+        const StreamingAllocation second = buffer->Allocate(100, 64);
+        const StreamingAllocation third = buffer->Allocate(4, 4);
+        ASSERT_TRUE(first.IsValid() && second.IsValid() && third.IsValid());
+
+        EXPECT_EQ(first.Offset, 0u);
+        EXPECT_EQ(second.Offset, 64u);
+        EXPECT_EQ(third.Offset, 164u);
+        EXPECT_EQ(second.Data, first.Data + 64);
+
+        std::memset(second.Data, 0xAB, second.Size);
+        EXPECT_EQ(buffer->GetStats().Allocations, 3u);
+        EXPECT_EQ(buffer->GetStats().BytesAllocated, 114u);
+
+        EXPECT_FALSE(buffer->Allocate(k_RegionSize + 1).IsValid());
+        EXPECT_FALSE(buffer->Allocate(0).IsValid());
+        EXPECT_EQ(buffer->GetStats().FailedAllocations, 2u);
+    }
+
+    TEST(StreamingBufferTest, FramesRotateThroughFencedRegions)
+    {
+        Null::NullStreamingBuffer buffer(k_RegionSize);
+
+        for (uint32_t frame = 0; frame < 7; ++frame)
+        {
+            const uint32_t region = frame % IStreamingBuffer::k_RegionCount;
+            EXPECT_EQ(buffer.GetCurrentRegion(), region);
+
+            const StreamingAllocation allocation = buffer.Allocate(32);
+            ASSERT_TRUE(allocation.IsValid());
+            EXPECT_EQ(allocation.Offset, region * k_RegionSize);
+
+            buffer.NextFrame();
+        }
+
+        // Each frame fences its region; the first wait comes when frame 3 reuses region 0
+        EXPECT_EQ(buffer.GetFencesInserted(), 7u);
+        EXPECT_EQ(buffer.GetStats().FenceWaits, 7u - (IStreamingBuffer::k_RegionCount - 1));
+        EXPECT_EQ(buffer.GetStats().BlockingWaits, 0u);
+    }
+
+    TEST(StreamingBufferTest, FullRegionWaitsForItsOwnDrawsAndStartsOver)
+    {
+        Null::NullStreamingBuffer buffer(k_RegionSize);
+        buffer.NextFrame();
+
+        ASSERT_EQ(buffer.Allocate(768).Offset, k_RegionSize);
+        const StreamingAllocation wrapped = buffer.Allocate(512);
+        ASSERT_TRUE(wrapped.IsValid());
+
+        EXPECT_EQ(wrapped.Offset, k_RegionSize);
+        EXPECT_EQ(buffer.GetStats().Overflows, 1u);
+        EXPECT_EQ(buffer.GetStats().FenceWaits, 1u);
+        EXPECT_EQ(buffer.GetFencesInserted(), 2u);
+    }
+
+    TEST(StreamingBufferTest, SetDataReportsWhatDoesNotFit)
+    {
+        Null::NullStreamingBuffer buffer(1000);
+        buffer.SetLayout({ { ShaderDataType::Mat4, "aModel", false, true } });
+
+        // Regions 1 and 2 start off the 64 byte stride, so only 14 whole matrices are safe
+        EXPECT_EQ(buffer.GetMaxDataSize(), 14 * sizeof(Matrix4x4));
+
+        std::vector<std::byte> data(1001);
+        EXPECT_FALSE(buffer.SetData(data.data(), 1001));
+        EXPECT_TRUE(buffer.SetData(data.data(), buffer.GetMaxDataSize()));
+    }
+
+    TEST(StreamingBufferTest, RenderQueueSplitsUploadsLargerThanARegion)
+    {
+        Null::RecordingRenderDevice device;
+
+        float vertices[] = { 0.0f, 0.0f, 0.0f };
+        auto vertexBuffer = device.CreateVertexBuffer(vertices, sizeof(vertices));
+        vertexBuffer->SetLayout({ { ShaderDataType::Float3, "aPos" } });
+
+        Renderer::Mesh mesh;
+        mesh.VertexArray = device.CreateVertexArray();
+        mesh.VertexArray->AddVertexBuffer(vertexBuffer);
+        mesh.VertexCount = 3;
+
+        Renderer::Material material;
+        material.Shader = device.CreateShader("vs", "fs").Unwrap();
+
+        auto instances = device.CreateStreamingBuffer(4 * sizeof(Matrix4x4));
+        instances->SetLayout({ { ShaderDataType::Mat4, "aModel", false, true } });
+
+        std::vector<Matrix4x4> transforms(10, Matrix4x4::Identity());
+        Renderer::RenderQueue queue;
+        queue.Submit(Renderer::RenderQueue::MakeKey(Renderer::RenderPass::Opaque, material, 0.5f), mesh, material, transforms);
+        queue.Sort();
+        ASSERT_TRUE(queue.Execute(device, instances).IsOk());
+
+        std::vector<uint32_t> counts;
+        for (const auto& command : device.GetCommands())
+        {
+            if (command.Type == Null::RecordedCommandType::DrawInstanced)
+            {
+                // Every part restarts the region after the previous part was issued
+                EXPECT_EQ(command.BaseInstance, 0u);
+                counts.push_back(command.InstanceCount);
+            }
+        }
+        EXPECT_EQ(counts, (std::vector<uint32_t>{ 4, 4, 2 }));
+        EXPECT_EQ(queue.GetStats().DrawCalls, 3u);
+        EXPECT_EQ(instances->GetStats().Overflows, 2u);
+        EXPECT_EQ(instances->GetStats().FailedAllocations, 0u);
+    }
+
+    TEST(StreamingBufferTest, RenderQueueDrawsFromTheUploadOffset)
+    {
+        Null::RecordingRenderDevice device;
+
+        float vertices[] = { 0.0f, 0.0f, 0.0f };
+        auto vertexBuffer = device.CreateVertexBuffer(vertices, sizeof(vertices));
+        vertexBuffer->SetLayout({ { ShaderDataType::Float3, "aPos" } });
+
+        Renderer::Mesh mesh;
+        mesh.VertexArray = device.CreateVertexArray();
+        mesh.VertexArray->AddVertexBuffer(vertexBuffer);
+        mesh.VertexCount = 3;
+
+        Renderer::Material material;
+        material.Shader = device.CreateShader("vs", "fs").Unwrap();
+
+        auto instances = device.CreateStreamingBuffer(64 * sizeof(Matrix4x4));
+        instances->SetLayout({ { ShaderDataType::Mat4, "aModel", false, true } });
+
+        // An earlier upload this frame pushes the queue's data further into the region
+        const Matrix4x4 earlier[3] = { Matrix4x4::Identity(), Matrix4x4::Identity(), Matrix4x4::Identity() };
+        instances->SetData(earlier, sizeof(earlier));
+        EXPECT_EQ(instances->GetDataOffset(), 0u);
+
+        Renderer::RenderQueue queue;
+        const Matrix4x4 transform = Matrix4x4::CreateTranslation(Vector3(1.0f, 2.0f, 3.0f));
+        queue.Submit(Renderer::RenderQueue::MakeKey(Renderer::RenderPass::Opaque, material, 0.5f), mesh, material, transform);
+        queue.Sort();
+        ASSERT_TRUE(queue.Execute(device, instances).IsOk());
+
+        EXPECT_EQ(instances->GetDataOffset(), 3 * sizeof(Matrix4x4));
+
+        bool drawn = false;
+        for (const auto& command : device.GetCommands())
+        {
+            if (command.Type == Null::RecordedCommandType::DrawInstanced)
+            {
+                EXPECT_EQ(command.BaseInstance, 3u);
+                drawn = true;
+            }
+        }
+        EXPECT_TRUE(drawn);
+    }
+}
@@ -0,0 +1,312 @@
+#include <gtest/gtest.h>
+#include <Graphics/Abstractions/Textures/TextureCooker.hpp>
+#include <Graphics/Abstractions/Textures/NuTexFile.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Graphics::Tests
+{
+    namespace
+    {
+        std::vector<uint8_t> MakeImage(uint32_t width, uint32_t height, uint32_t seed)
+        {
+            // Smooth gradients plus a little noise, like a photo rather than random bytes
+            std::mt19937 rng(seed);
+            std::uniform_int_distribution<int> noise(-6, 6);
+            std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    uint8_t* p = pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+                    p[0] = static_cast<uint8_t>(std::clamp(static_cast<int>(x * 255 / width) + noise(rng), 0, 255));
+                    p[1] = static_cast<uint8_t>(std::clamp(static_cast<int>(y * 255 / height) + noise(rng), 0, 255));
+                    p[2] = static_cast<uint8_t>(std::clamp(128 + noise(rng), 0, 255));
+                    p[3] = static_cast<uint8_t>(std::clamp(255 - static_cast<int>(x * 128 / width) + noise(rng), 0, 255));
+                }
+            }
+            return pixels;
+        }
+
+        void DecodeBC1(const std::byte* block, uint8_t out[64])
+        {
+            const auto read16 = [&](int i) { return static_cast<uint32_t>(block[i]) | (static_cast<uint32_t>(block[i + 1]) << 8); };
+            const uint32_t c0 = read16(0), c1 = read16(2);
+            uint32_t indices = 0;
+            std::memcpy(&indices, block + 4, 4);
+
+            int palette[4][4];
+            for (int e = 0; e < 2; ++e)
+            {
+                const uint32_t c = e == 0 ? c0 : c1;
+                const int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+                palette[e][0] = (r << 3) | (r >> 2);
+                palette[e][1] = (g << 2) | (g >> 4);
+                palette[e][2] = (b << 3) | (b >> 2);
+                palette[e][3] = 255;
+            }
+            for (int ch = 0; ch < 3; ++ch)
+            {
+                palette[2][ch] = c0 > c1 ? (2 * palette[0][ch] + palette[1][ch]) / 3 : (palette[0][ch] + palette[1][ch]) / 2;
+                palette[3][ch] = c0 > c1 ? (palette[0][ch] + 2 * palette[1][ch]) / 3 : 0;
+            }
+            palette[2][3] = 255;
+            palette[3][3] = c0 > c1 ? 255 : 0;
+
+            for (int i = 0; i < 16; ++i)
+            {
+                for (int ch = 0; ch < 4; ++ch) out[i * 4 + ch] = static_cast<uint8_t>(palette[(indices >> (2 * i)) & 3][ch]);
+            }
+        }
+
+        // Mode 6 only, which is all the cooker writes
+        void DecodeBC7Mode6(const std::byte* block, uint8_t out[64])
+        {
+            uint32_t position = 0;
+            const auto read = [&](uint32_t bits)
+            {
+                uint32_t value = 0;
+                for (uint32_t i = 0; i < bits; ++i, ++position)
+                {
+                    value |= ((static_cast<uint32_t>(block[position / 8]) >> (position % 8)) & 1u) << i;
+                }
+                return value;
+            };
+
+            ASSERT_EQ(read(7), 1u << 6);
+            uint32_t endpoints[2][4];
+            for (int ch = 0; ch < 4; ++ch)
+            {
+                endpoints[0][ch] = read(7);
+                endpoints[1][ch] = read(7);
+            }
+            const uint32_t p0 = read(1), p1 = read(1);
+
+            static constexpr int weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+            for (int i = 0; i < 16; ++i)
+            {
+                const uint32_t index = read(i == 0 ? 3 : 4);
+                for (int ch = 0; ch < 4; ++ch)
+                {
+                    const int e0 = static_cast<int>((endpoints[0][ch] << 1) | p0);
+                    const int e1 = static_cast<int>((endpoints[1][ch] << 1) | p1);
+                    out[i * 4 + ch] = static_cast<uint8_t>(((64 - weights[index]) * e0 + weights[index] * e1 + 32) >> 6);
+                }
+            }
+        }
+
+        double MeanSquaredError(const uint8_t* a, const uint8_t* b, size_t count, size_t channels)
+        {
+            double sum = 0.0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (i % 4 >= channels) continue;
+                const double d = static_cast<double>(a[i]) - b[i];
+                sum += d * d;
+            }
+            return sum / (count / 4 * channels);
+        }
+
+        uint8_t Pixel(const CookedTexture& texture, uint32_t mip, uint32_t x, uint32_t y, uint32_t channel)
+        {
+            const uint32_t width = std::max(texture.Width >> mip, 1u);
+            return static_cast<uint8_t>(texture.Levels[mip][(static_cast<size_t>(y) * width + x) * 4 + channel]);
+        }
+    }
+
+    TEST(TextureCookerTest, BuildsTheFullMipChain)
+    {
+        const std::vector<uint8_t> image = MakeImage(40, 12, 1);
+        const CookedTexture cooked = TextureCooker::Cook(image.data(), 40, 12, {});
+
+        ASSERT_EQ(cooked.Levels.size(), 6u);   // 40x12, 20x6, 10x3, 5x1, 2x1, 1x1
+        for (uint32_t mip = 0; mip < cooked.Levels.size(); ++mip)
+        {
+            EXPECT_EQ(cooked.Levels[mip].size(), GetTextureLevelSize(TexturePixelFormat::RGBA8, std::max(40u >> mip, 1u), std::max(12u >> mip, 1u)));
+        }
+        EXPECT_EQ(std::memcmp(cooked.Levels[0].data(), image.data(), image.size()), 0);
+
+        TextureCookOptions single;
+        single.GenerateMips = false;
+        EXPECT_EQ(TextureCooker::Cook(image.data(), 40, 12, single).Levels.size(), 1u);
+    }
+
+    TEST(TextureCookerTest, MipsAreFilteredInLinearSpace)
+    {
+        // Black/white checkerboard: the average light is 50%, which is 188 in sRGB, not 128.
+        // Pixels away from the edges, where the Kaiser taps clamp
+        constexpr uint32_t size = 16;
+        std::vector<uint8_t> checker(size * size * 4);
+        for (uint32_t i = 0; i < size * size; ++i)
+        {
+            const uint8_t value = ((i % size) + (i / size)) % 2 ? 255 : 0;
+            std::memset(checker.data() + i * 4, value, 3);
+            checker[i * 4 + 3] = 255;
+        }
+
+        for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+        {
+            TextureCookOptions options;
+            options.Filter = filter;
+
+            const CookedTexture srgb = TextureCooker::Cook(checker.data(), size, size, options);
+            EXPECT_NEAR(Pixel(srgb, 1, 4, 4, 0), 188, 1);
+            EXPECT_NEAR(Pixel(srgb, 2, 2, 2, 1), 188, 1);
+            EXPECT_EQ(Pixel(srgb, 1, 3, 5, 3), 255);
+
+            options.SRGB = false;
+            const CookedTexture linear = TextureCooker::Cook(checker.data(), size, size, options);
+            EXPECT_NEAR(Pixel(linear, 1, 4, 4, 0), 128, 1);
+        }
+    }
+
+    TEST(TextureCookerTest, KaiserPreservesFlatColour)
+    {
+        std::vector<uint8_t> flat(16 * 16 * 4);
+        for (size_t i = 0; i < flat.size(); i += 4)
+        {
+            flat[i] = 200; flat[i + 1] = 30; flat[i + 2] = 90; flat[i + 3] = 255;
+        }
+
+        const CookedTexture cooked = TextureCooker::Cook(flat.data(), 16, 16, {});
+        for (uint32_t mip = 1; mip < cooked.Levels.size(); ++mip)
+        {
+            EXPECT_EQ(Pixel(cooked, mip, 0, 0, 0), 200);
+            EXPECT_EQ(Pixel(cooked, mip, 0, 0, 1), 30);
+            EXPECT_EQ(Pixel(cooked, mip, 0, 0, 2), 90);
+        }
+    }
+
+    TEST(TextureCookerTest, BlockCompressionStaysCloseToTheSource)
+    {
+        constexpr uint32_t size = 64;
+
+        for (TexturePixelFormat format : { TexturePixelFormat::BC1, TexturePixelFormat::BC7 })
+        {
+            // BC1 alpha is a cut-out, so give it an opaque image
+            std::vector<uint8_t> image = MakeImage(size, size, 7);
+            if (format == TexturePixelFormat::BC1)
+            {
+                for (size_t i = 3; i < image.size(); i += 4) image[i] = 255;
+            }
+
+            TextureCookOptions options;
+            options.Format = format;
+            options.GenerateMips = false;
+            const CookedTexture cooked = TextureCooker::Cook(image.data(), size, size, options);
+            ASSERT_EQ(cooked.Levels[0].size(), GetTextureLevelSize(format, size, size));
+
+            const size_t blockBytes = format == TexturePixelFormat::BC1 ? 8 : 16;
+            std::vector<uint8_t> decoded(image.size());
+            for (uint32_t block = 0; block < (size / 4) * (size / 4); ++block)
+            {
+                uint8_t pixels[64];
+                if (format == TexturePixelFormat::BC1) DecodeBC1(cooked.Levels[0].data() + block * blockBytes, pixels);
+                else DecodeBC7Mode6(cooked.Levels[0].data() + block * blockBytes, pixels);
+
+                const uint32_t bx = (block % (size / 4)) * 4, by = (block / (size / 4)) * 4;
+                for (uint32_t y = 0; y < 4; ++y)
+                {
+                    std::memcpy(decoded.data() + ((by + y) * size + bx) * 4, pixels + y * 16, 16);
+                }
+            }
+
+            // BC1 has 5:6:5 endpoints and four colours a block; BC7 mode 6 much finer steps and alpha
+            const double error = MeanSquaredError(image.data(), decoded.data(), image.size(), format == TexturePixelFormat::BC1 ? 3 : 4);
+            EXPECT_LT(error, format == TexturePixelFormat::BC1 ? 40.0 : 16.0) << "format " << static_cast<int>(format);
+        }
+    }
+
+    TEST(TextureCookerTest, BC1KeepsTransparentPixels)
+    {
+        uint8_t block[64];
+        for (int i = 0; i < 16; ++i)
+        {
+            block[i * 4 + 0] = 240; block[i * 4 + 1] = 120; block[i * 4 + 2] = 10;
+            block[i * 4 + 3] = (i % 3 == 0) ? 0 : 255;
+        }
+
+        std::byte encoded[8];
+        TextureCooker::EncodeBlock(TexturePixelFormat::BC1, block, encoded);
+
+        uint8_t decoded[64];
+        DecodeBC1(encoded, decoded);
+        for (int i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(decoded[i * 4 + 3], block[i * 4 + 3]) << "pixel " << i;
+            if (block[i * 4 + 3] == 255)
+            {
+                EXPECT_NEAR(decoded[i * 4 + 0], 240, 8);
+                EXPECT_NEAR(decoded[i * 4 + 1], 120, 4);
+            }
+        }
+    }
+
+    TEST(TextureCookerTest, SavedFileMapsBackLevelByLevel)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "NuEngineTests" / "cooked.nutex";
+        const std::vector<uint8_t> image = MakeImage(32, 8, 3);
+
+        TextureCookOptions options;
+        options.Format = TexturePixelFormat::BC3;
+        const CookedTexture cooked = TextureCooker::Cook(image.data(), 32, 8, options);
+        ASSERT_TRUE(TextureCooker::Save(cooked, path).IsOk());
+
+        {
+            auto opened = NuTexFile::Open(path);
+            ASSERT_TRUE(opened.IsOk());
+            const NuTexFile& file = opened.Unwrap();
+
+            EXPECT_EQ(file.GetFormat(), TexturePixelFormat::BC3);
+            EXPECT_TRUE(file.IsSRGB());
+            EXPECT_EQ(file.GetWidth(), 32u);
+            EXPECT_EQ(file.GetHeight(), 8u);
+            ASSERT_EQ(file.GetMipCount(), cooked.Levels.size());
+
+            for (uint32_t mip = 0; mip < file.GetMipCount(); ++mip)
+            {
+                const std::span<const std::byte> data = file.GetLevelData(mip);
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(data.data()) % NuTex::k_DataAlignment, 0u);
+                ASSERT_EQ(data.size(), cooked.Levels[mip].size());
+                EXPECT_EQ(std::memcmp(data.data(), cooked.Levels[mip].data(), data.size()), 0) << "mip " << mip;
+            }
+        }
+
+        std::filesystem::remove_all(path.parent_path());
+    }
+
+    TEST(TextureCookerTest, RejectsForeignAndTruncatedFiles)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "NuEngineTests";
+        std::filesystem::create_directories(directory);
+
+        const std::vector<uint8_t> image = MakeImage(8, 8, 5);
+        ASSERT_TRUE(TextureCooker::Save(TextureCooker::Cook(image.data(), 8, 8, {}), directory / "good.nutex").IsOk());
+
+        std::vector<char> bytes(std::filesystem::file_size(directory / "good.nutex"));
+        std::ifstream(directory / "good.nutex", std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+        const auto writeVariant = [&](const char* name, std::vector<char> contents)
+        {
+            std::ofstream(directory / name, std::ios::binary).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            return directory / name;
+        };
+
+        std::vector<char> wrongVersion = bytes;
+        wrongVersion[4] = 99;
+        std::vector<char> truncated(bytes.begin(), bytes.end() - 16);
+
+        EXPECT_TRUE(NuTexFile::Open(directory / "good.nutex").IsOk());
+        EXPECT_TRUE(NuTexFile::Open(writeVariant("version.nutex", wrongVersion)).IsError());
+        EXPECT_TRUE(NuTexFile::Open(writeVariant("truncated.nutex", truncated)).IsError());
+        EXPECT_TRUE(NuTexFile::Open(writeVariant("text.nutex", { 'h', 'e', 'l', 'l', 'o' })).IsError());
+        EXPECT_TRUE(NuTexFile::Open(directory / "missing.nutex").IsError());
+
+        std::filesystem::remove_all(directory);
+    }
+}
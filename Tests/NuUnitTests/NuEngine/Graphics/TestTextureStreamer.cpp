@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <Graphics/Abstractions/Textures/TextureStreamer.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/NullResources.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace NuEngine::Graphics::Tests
+{
+    namespace
+    {
+        constexpr uint32_t k_Size = 64;
+
+        // Solid k_Size x k_Size RGBA image for any path except "missing.png"
+        bool DecodeSynthetic(const std::string& path, Core::BufferPool& staging, DecodedImage& image)
+        {
+            if (path == "missing.png")
+            {
+                return false;
+            }
+
+            image.Width = k_Size;
+            image.Height = k_Size;
+            image.Channels = 4;
+            image.Pixels = staging.Acquire(static_cast<size_t>(k_Size) * k_Size * 4);
+            std::memset(image.Pixels.Data(), 0x7F, image.Pixels.Size());
+            return true;
+        }
+    }
+
+    TEST(TextureStreamerTest, PlaceholderIsSwappedOnceUploaded)
+    {
+        Null::NullTextureUploader uploader;
+        TextureStreamer streamer(uploader, DecodeSynthetic);
+
+        auto texture = streamer.Request("wall.png");
+        ASSERT_TRUE(texture);
+        auto* streamed = static_cast<StreamedTexture*>(texture.get());
+
+        EXPECT_FALSE(streamed->IsLoaded());
+        EXPECT_EQ(texture->GetID(), uploader.GetPlaceholder()->GetID());
+        EXPECT_EQ(texture->GetPath(), "wall.png");
+
+        streamer.WaitForDecodes();
+        streamer.Update();
+
+        EXPECT_TRUE(streamed->IsLoaded());
+        EXPECT_NE(texture->GetID(), uploader.GetPlaceholder()->GetID());
+        EXPECT_EQ(texture->GetWidth(), static_cast<int>(k_Size));
+        EXPECT_EQ(uploader.GetTexturesFinished(), 1u);
+        EXPECT_EQ(uploader.GetBytesUploaded(), static_cast<uint64_t>(k_Size) * k_Size * 4);
+
+        const TextureStreamingStats& stats = streamer.GetStats();
+        EXPECT_EQ(stats.Requested, 1u);
+        EXPECT_EQ(stats.Completed, 1u);
+        EXPECT_GE(stats.MaxLatencyMs, 0.0);
+        EXPECT_TRUE(streamer.IsIdle());
+    }
+
+    TEST(TextureStreamerTest, UploadBudgetSpreadsTexturesOverFrames)
+    {
+        Null::NullTextureUploader uploader;
+        TextureStreamer streamer(uploader, DecodeSynthetic);
+
+        auto texture = streamer.Request("wall.png");
+        streamer.WaitForDecodes();
+
+        // 16 KB of pixels at 4 KB per frame
+        constexpr uint32_t budget = 4096;
+        uint32_t frames = 0;
+        while (!static_cast<StreamedTexture*>(texture.get())->IsLoaded())
+        {
+            streamer.Update(budget);
+            EXPECT_LE(streamer.GetStats().BytesUploadedLastFrame, budget);
+            ASSERT_LT(++frames, 100u);
+        }
+
+        EXPECT_EQ(frames, 4u);
+        EXPECT_EQ(uploader.GetRowsUploaded(), k_Size);
+        EXPECT_EQ(streamer.GetStats().FramesAtBudget, 3u);
+    }
+
+    TEST(TextureStreamerTest, TinyBudgetStillMakesProgress)
+    {
+        Null::NullTextureUploader uploader;
+        TextureStreamer streamer(uploader, DecodeSynthetic);
+
+        (void)streamer.Request("wall.png");
+        streamer.WaitForDecodes();
+
+        streamer.Update(1);
+        EXPECT_EQ(uploader.GetRowsUploaded(), 1u);
+    }
+
+    TEST(TextureStreamerTest, FailedDecodeKeepsThePlaceholder)
+    {
+        Null::NullTextureUploader uploader;
+        TextureStreamer streamer(uploader, DecodeSynthetic);
+
+        auto texture = streamer.Request("missing.png");
+        streamer.WaitForDecodes();
+        streamer.Update();
+
+        auto* streamed = static_cast<StreamedTexture*>(texture.get());
+        EXPECT_TRUE(streamed->HasFailed());
+        EXPECT_FALSE(streamed->IsLoaded());
+        EXPECT_EQ(texture->GetID(), uploader.GetPlaceholder()->GetID());
+        EXPECT_EQ(streamer.GetStats().Failed, 1u);
+        EXPECT_EQ(uploader.GetTexturesCreated(), 0u);
+    }
+
+    TEST(TextureStreamerTest, RequestDoesNotWaitForTheDecode)
+    {
+        Core::JobSystem::Get().Initialize(2);
+        {
+            std::atomic<bool> started = false;
+            std::atomic<bool> release = false;
+
+            Null::NullTextureUploader uploader;
+            TextureStreamer streamer(uploader,
+                [&](const std::string& path, Core::BufferPool& staging, DecodedImage& image)
+                {
+                    started = true;
+                    while (!release) std::this_thread::yield();
+                    return DecodeSynthetic(path, staging, image);
+                });
+
+            auto texture = streamer.Request("slow.png");
+            while (!started) std::this_thread::yield();
+
+            // A worker is stuck in the decode while frames keep going
+            streamer.Update();
+            EXPECT_FALSE(static_cast<StreamedTexture*>(texture.get())->IsLoaded());
+            EXPECT_EQ(streamer.GetStats().PendingDecode, 1u);
+            EXPECT_FALSE(streamer.IsIdle());
+
+            release = true;
+            streamer.WaitForDecodes();
+            streamer.Update();
+            EXPECT_TRUE(static_cast<StreamedTexture*>(texture.get())->IsLoaded());
+        }
+        Core::JobSystem::Get().Shutdown();
+    }
+
+    TEST(TextureStreamerTest, StagingBuffersAreReused)
+    {
+        Core::JobSystem::Get().Initialize(2);
+        {
+            Null::NullTextureUploader uploader;
+            TextureStreamer streamer(uploader, DecodeSynthetic);
+
+            for (int round = 0; round < 2; ++round)
+            {
+                std::vector<std::shared_ptr<ITexture>> textures;
+                for (int i = 0; i < 8; ++i)
+                {
+                    textures.push_back(streamer.Request("texture" + std::to_string(i) + ".png"));
+                }
+
+                streamer.WaitForDecodes();
+                streamer.Update();
+
+                for (const auto& texture : textures)
+                {
+                    EXPECT_TRUE(static_cast<StreamedTexture*>(texture.get())->IsLoaded());
+                }
+            }
+
+            EXPECT_EQ(streamer.GetStats().Completed, 16u);
+            // Second round decodes into the buffers the first round released
+            EXPECT_GE(streamer.GetStagingPool().GetHits(), 8u);
+        }
+        Core::JobSystem::Get().Shutdown();
+    }
+
+    TEST(TextureStreamerTest, DeviceHandsOutPlaceholderImmediately)
+    {
+        Null::NullRenderDevice device;
+        auto texture = device.CreateTextureAsync("does/not/exist.png");
+        ASSERT_TRUE(texture);
+        EXPECT_EQ(texture->GetWidth(), 1);
+
+        device.GetTextureStreamer().WaitForDecodes();
+        device.GetTextureStreamer().Update();
+        EXPECT_TRUE(static_cast<StreamedTexture*>(texture.get())->HasFailed());
+    }
+}
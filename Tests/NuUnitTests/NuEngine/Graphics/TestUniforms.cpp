@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <Graphics/Abstractions/Shaders/UniformID.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+#include <Graphics/Backends/Null/NullResources.hpp>
+#include <Renderer/FrameUniforms.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace NuEngine::Graphics::Tests
+{
+    using namespace NuMath;
+
+    // Hashed by the compiler: a literal that did not fold would fail to compile here
+    static_assert(UniformID("").Value == 2166136261u);
+    static_assert(UniformID("a").Value == 0xe40c292cu);
+    static_assert(UniformID("foobar").Value == 0xbf9cf968u);
+    static_assert(Uniforms::Model == UniformID::FromName("model"));
+
+    TEST(UniformIDTest, RuntimeNamesMatchLiterals)
+    {
+        const std::string name = std::string("u_") + "Texture";
+        EXPECT_EQ(UniformID::FromName(name), Uniforms::Texture);
+        EXPECT_NE(UniformID::FromName("u_texture"), Uniforms::Texture);
+        EXPECT_NE(Uniforms::Model, Uniforms::Texture);
+    }
+
+    TEST(UniformBufferTest, NullBufferKeepsUploadedBlock)
+    {
+        Null::NullRenderDevice device;
+        auto buffer = device.CreateUniformBuffer(sizeof(Renderer::FrameUniforms), UniformBlocks::k_FrameBinding);
+        ASSERT_TRUE(buffer);
+        EXPECT_EQ(buffer->GetSize(), sizeof(Renderer::FrameUniforms));
+        EXPECT_EQ(buffer->GetBinding(), UniformBlocks::k_FrameBinding);
+        EXPECT_EQ(device.GetStats().BuffersCreated, 1u);
+
+        Renderer::FrameUniforms frame;
+        frame.View = Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -3.0f));
+        frame.Projection = Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        frame.ViewProjection = frame.Projection * frame.View;
+        frame.CameraPosition = Vector4(0.0f, 0.0f, 3.0f, 1.0f);
+        buffer->SetData(&frame, sizeof(frame));
+
+        // Out of range updates are dropped whole
+        buffer->SetData(&frame, sizeof(frame), 16);
+
+        const auto& null = static_cast<const Null::NullUniformBuffer&>(*buffer);
+        EXPECT_EQ(null.GetUpdateCount(), 1u);
+        EXPECT_EQ(std::memcmp(null.GetData().data(), &frame, sizeof(frame)), 0);
+
+        // std140: the camera position starts right after the three matrices
+        float position[4];
+        std::memcpy(position, null.GetData().data() + 192, sizeof(position));
+        EXPECT_EQ(position[2], 3.0f);
+        EXPECT_EQ(position[3], 1.0f);
+    }
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <Physics/Core/PhysicsEngine.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <vector>
+
+namespace NuEngine::Physics::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        constexpr float k_StepDelta = 1.0f / 60.0f;
+
+        BodyDesc MakeBox(const Vector3& position, BodyType type, const Vector3& halfExtents)
+        {
+            BodyDesc desc;
+            desc.Shape = ShapeDesc::Box(halfExtents);
+            desc.Position = position;
+            desc.Type = type;
+            return desc;
+        }
+    }
+
+    class PhysicsAsyncStepTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            // One worker: the step must not occupy it, or Jolt's jobs would have nowhere to run
+            Core::JobSystem::Get().Initialize(1);
+
+            PhysicsSettings settings;
+            settings.MaxBodies = 64;
+            settings.AsyncStep = true;
+            ASSERT_TRUE(PhysicsEngine::Initialize(settings).IsOk());
+
+            const BodyDesc descs[] = {
+                MakeBox(Vector3(0.0f, -1.0f, 0.0f), BodyType::Static, Vector3(20.0f, 1.0f, 20.0f)),
+                MakeBox(Vector3(0.0f, 3.0f, 0.0f), BodyType::Dynamic, Vector3(0.5f, 0.5f, 0.5f))
+            };
+
+            auto bodies = PhysicsEngine::CreateBodies(descs);
+            ASSERT_TRUE(bodies.IsOk());
+            m_Bodies = bodies.Unwrap();
+        }
+
+        void TearDown() override
+        {
+            PhysicsEngine::Shutdown();
+            Core::JobSystem::Get().Shutdown();
+        }
+
+        std::vector<RigidBody> m_Bodies;
+    };
+
+    TEST_F(PhysicsAsyncStepTest, StepsProgressWithASingleWorker)
+    {
+        for (int i = 0; i < 30; ++i)
+        {
+            PhysicsEngine::Update(k_StepDelta);
+        }
+        PhysicsEngine::CompleteStep();
+
+        EXPECT_FALSE(PhysicsEngine::IsStepInFlight());
+        EXPECT_LT(m_Bodies[1].GetPosition().Y(), 3.0f);
+    }
+
+    TEST_F(PhysicsAsyncStepTest, QueriesBetweenStepsSeeTheCompletedStep)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            PhysicsEngine::Update(k_StepDelta);
+        }
+
+        PhysicsEngine::CompleteStep();
+        ASSERT_FALSE(PhysicsEngine::IsStepInFlight());
+
+        const Vector3 published = m_Bodies[1].GetPosition();
+        const Ray ray(Vector3(0.0f, 10.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f));
+
+        CastHitsBuffer buffer;
+        buffer.Resize(1);
+        const CastHitsSoA hits = buffer.View();
+
+        ASSERT_TRUE(PhysicsEngine::CastRays({ &ray, 1 }, 20.0f, hits).IsOk());
+        EXPECT_FALSE(PhysicsEngine::IsStepInFlight());
+        EXPECT_EQ(hits.Bodies[0], m_Bodies[1].GetHandle());
+        EXPECT_NEAR(hits.Distances[0], 10.0f - (published.Y() + 0.5f), 1e-3f);
+
+        PhysicsEngine::BeginStep(k_StepDelta);
+        PhysicsEngine::CompleteStep();
+    }
+}
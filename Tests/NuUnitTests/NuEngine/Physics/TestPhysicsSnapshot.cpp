@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <Physics/Core/PhysicsEngine.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace NuEngine::Physics::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        constexpr float k_StepDelta = 1.0f / 60.0f;
+        constexpr float k_Tolerance = 1e-4f;
+
+        void ExpectNear(const Vector3& actual, const Vector3& expected)
+        {
+            EXPECT_NEAR(actual.X(), expected.X(), k_Tolerance);
+            EXPECT_NEAR(actual.Y(), expected.Y(), k_Tolerance);
+            EXPECT_NEAR(actual.Z(), expected.Z(), k_Tolerance);
+        }
+
+        BodyDesc MakeBox(const Vector3& position, BodyType type, const Vector3& halfExtents = Vector3(0.5f, 0.5f, 0.5f))
+        {
+            BodyDesc desc;
+            desc.Shape = ShapeDesc::Box(halfExtents);
+            desc.Position = position;
+            desc.Type = type;
+            return desc;
+        }
+    }
+
+    class PhysicsSnapshotTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            Core::JobSystem::Get().Initialize();
+
+            PhysicsSettings settings;
+            settings.MaxBodies = 64;
+            ASSERT_TRUE(PhysicsEngine::Initialize(settings).IsOk());
+
+            const BodyDesc descs[] = {
+                MakeBox(Vector3(0.0f, -1.0f, 0.0f), BodyType::Static, Vector3(20.0f, 1.0f, 20.0f)),
+                MakeBox(Vector3(0.0f, 3.0f, 0.0f), BodyType::Dynamic),
+                MakeBox(Vector3(5.0f, 0.5f, 0.0f), BodyType::Static)
+            };
+
+            auto bodies = PhysicsEngine::CreateBodies(descs);
+            ASSERT_TRUE(bodies.IsOk());
+            m_Bodies = bodies.Unwrap();
+        }
+
+        void TearDown() override
+        {
+            PhysicsEngine::Shutdown();
+            Core::JobSystem::Get().Shutdown();
+        }
+
+        void Step(int count)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                PhysicsEngine::Update(k_StepDelta);
+            }
+        }
+
+        RigidBody& Floor() { return m_Bodies[0]; }
+        RigidBody& Falling() { return m_Bodies[1]; }
+        RigidBody& Pillar() { return m_Bodies[2]; }
+
+        std::vector<RigidBody> m_Bodies;
+    };
+
+    TEST_F(PhysicsSnapshotTest, CreateBodiesKeepsDescOrder)
+    {
+        ASSERT_EQ(m_Bodies.size(), 3u);
+        ExpectNear(Floor().GetPosition(), Vector3(0.0f, -1.0f, 0.0f));
+        ExpectNear(Falling().GetPosition(), Vector3(0.0f, 3.0f, 0.0f));
+        ExpectNear(Pillar().GetPosition(), Vector3(5.0f, 0.5f, 0.0f));
+    }
+
+    TEST_F(PhysicsSnapshotTest, FullRestoreUndoesSimulationAndWrites)
+    {
+        PhysicsSnapshot snapshot;
+        ASSERT_TRUE(PhysicsEngine::SaveState(snapshot).IsOk());
+
+        Step(30);
+        Pillar().SetPosition(Vector3(-5.0f, 0.5f, 0.0f));
+        ASSERT_LT(Falling().GetPosition().Y(), 3.0f);
+
+        ASSERT_TRUE(PhysicsEngine::RestoreState(snapshot).IsOk());
+        ExpectNear(Falling().GetPosition(), Vector3(0.0f, 3.0f, 0.0f));
+        ExpectNear(Pillar().GetPosition(), Vector3(5.0f, 0.5f, 0.0f));
+    }
+
+    TEST_F(PhysicsSnapshotTest, DeltaIncludesStaticBodyMovedWithoutActivation)
+    {
+        PhysicsDeltaBaseline baseline;
+        PhysicsSnapshot keyframe;
+        PhysicsSnapshot delta;
+        ASSERT_TRUE(PhysicsEngine::SaveState(keyframe, PhysicsSaveMode::Full, &baseline).IsOk());
+
+        // Static bodies never become active, so only dirty tracking can put this move in the delta
+        Pillar().SetPosition(Vector3(-5.0f, 0.5f, 0.0f));
+        ASSERT_TRUE(PhysicsEngine::SaveState(delta, PhysicsSaveMode::Delta, &baseline).IsOk());
+        EXPECT_EQ(delta.Mode, PhysicsSaveMode::Delta);
+
+        Pillar().SetPosition(Vector3(9.0f, 0.5f, 0.0f));
+
+        ASSERT_TRUE(PhysicsEngine::RestoreState(keyframe).IsOk());
+        ASSERT_TRUE(PhysicsEngine::RestoreState(delta).IsOk());
+        ExpectNear(Pillar().GetPosition(), Vector3(-5.0f, 0.5f, 0.0f));
+    }
+
+    TEST_F(PhysicsSnapshotTest, OtherSavesDoNotBreakADeltaChain)
+    {
+        PhysicsDeltaBaseline chain;
+        PhysicsSnapshot keyframe;
+        PhysicsSnapshot delta;
+        ASSERT_TRUE(PhysicsEngine::SaveState(keyframe, PhysicsSaveMode::Full, &chain).IsOk());
+
+        Step(10);
+        Pillar().SetPosition(Vector3(-5.0f, 0.5f, 0.0f));
+
+        // An unrelated save in between must not move the chain's baseline
+        PhysicsDeltaBaseline other;
+        PhysicsSnapshot unrelated;
+        ASSERT_TRUE(PhysicsEngine::SaveState(unrelated, PhysicsSaveMode::Full, &other).IsOk());
+
+        ASSERT_TRUE(PhysicsEngine::SaveState(delta, PhysicsSaveMode::Delta, &chain).IsOk());
+        const Vector3 fallingAtDelta = Falling().GetPosition();
+
+        Step(10);
+        Pillar().SetPosition(Vector3(9.0f, 0.5f, 0.0f));
+
+        ASSERT_TRUE(PhysicsEngine::RestoreState(keyframe).IsOk());
+        ASSERT_TRUE(PhysicsEngine::RestoreState(delta).IsOk());
+        ExpectNear(Pillar().GetPosition(), Vector3(-5.0f, 0.5f, 0.0f));
+        ExpectNear(Falling().GetPosition(), fallingAtDelta);
+    }
+
+    TEST_F(PhysicsSnapshotTest, ContactEventsAreOnePerPair)
+    {
+        bool sawContact = false;
+        for (int i = 0; i < 120 && !sawContact; ++i)
+        {
+            Step(1);
+
+            std::set<std::pair<uint32_t, uint32_t>> pairs;
+            for (const ContactEvent& event : PhysicsEngine::GetContactEvents())
+            {
+                EXPECT_LT(event.Body1, event.Body2);
+                EXPECT_TRUE(pairs.emplace(event.Body1, event.Body2).second);
+                sawContact = true;
+            }
+        }
+
+        EXPECT_TRUE(sawContact);
+    }
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <Renderer/Lighting/ClusteredLightCuller.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+	using namespace NuMath;
+
+	namespace
+	{
+		constexpr float k_NearClip = 0.1f;
+		constexpr float k_FarClip = 100.0f;
+
+		void Configure(ClusteredLightCuller& culler)
+		{
+			culler.SetProjection(Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, k_NearClip, k_FarClip), k_NearClip, k_FarClip);
+		}
+
+		Light MakePointLight(const Vector3& position, float range)
+		{
+			Light light;
+			light.Position = position;
+			light.Range = range;
+			return light;
+		}
+
+		std::vector<Light> MakeRandomLights(uint32_t count)
+		{
+			std::mt19937 rng(7);
+			std::uniform_real_distribution<float> xy(-40.0f, 40.0f);
+			std::uniform_real_distribution<float> z(-90.0f, 10.0f);
+			std::uniform_real_distribution<float> range(0.5f, 6.0f);
+
+			std::vector<Light> lights;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Light light = MakePointLight(Vector3(xy(rng), xy(rng), z(rng)), range(rng));
+				if (i % 3 == 0)
+				{
+					light.Type = LightType::Spot;
+					light.Direction = Vector3(0.0f, -1.0f, 0.0f);
+					light.SpotAngle = (i % 2 == 0) ? 0.3f : 1.2f;
+				}
+				lights.push_back(light);
+			}
+			return lights;
+		}
+
+		bool SphereTouchesBox(const Vector3& center, float radius, const AABB& box)
+		{
+			const auto axis = [](float c, float lo, float hi) { return std::max({ lo - c, c - hi, 0.0f }); };
+			const float dx = axis(center.X(), box.Min.X(), box.Max.X());
+			const float dy = axis(center.Y(), box.Min.Y(), box.Max.Y());
+			const float dz = axis(center.Z(), box.Min.Z(), box.Max.Z());
+			return dx * dx + dy * dy + dz * dz < radius * radius;
+		}
+	}
+
+	TEST(ClusteredLightCullerTest, PointLightLandsInTheClusterHoldingIt)
+	{
+		ClusteredLightCuller culler;
+		Configure(culler);
+
+		const std::vector<Light> lights = { MakePointLight(Vector3(0.1f, 0.1f, -11.0f), 0.02f) };
+		culler.Assign(lights, Matrix4x4::Identity());
+
+		const uint32_t slice = culler.GetDepthSlice(11.0f);
+		const uint32_t cluster = ClusteredLightCuller::GetClusterIndex(ClusteredLightCuller::k_ClustersX / 2, ClusteredLightCuller::k_ClustersY / 2, slice);
+
+		ASSERT_EQ(culler.GetClusterLights(cluster).size(), 1u);
+		EXPECT_EQ(culler.GetClusterLights(cluster)[0], 0u);
+		EXPECT_EQ(culler.GetStats().VisibleLights, 1u);
+		EXPECT_TRUE(culler.GetClusterBounds(cluster).Contains(lights[0].Position));
+	}
+
+	TEST(ClusteredLightCullerTest, LightsBehindTheCameraOrPastFarAreDropped)
+	{
+		ClusteredLightCuller culler;
+		Configure(culler);
+
+		const std::vector<Light> lights = {
+			MakePointLight(Vector3(0.0f, 0.0f, 5.0f), 2.0f),
+			MakePointLight(Vector3(0.0f, 0.0f, -150.0f), 10.0f)
+		};
+		culler.Assign(lights, Matrix4x4::Identity());
+
+		EXPECT_EQ(culler.GetStats().Lights, 2u);
+		EXPECT_EQ(culler.GetStats().VisibleLights, 0u);
+		EXPECT_TRUE(culler.GetLightIndices().empty());
+	}
+
+	TEST(ClusteredLightCullerTest, DepthSlicesMatchTheShaderFormula)
+	{
+		ClusteredLightCuller culler;
+		Configure(culler);
+
+		EXPECT_EQ(culler.GetDepthSlice(k_NearClip), 0u);
+		EXPECT_EQ(culler.GetDepthSlice(k_FarClip * 2.0f), ClusteredLightCuller::k_ClustersZ - 1);
+
+		for (uint32_t z = 0; z < ClusteredLightCuller::k_ClustersZ; ++z)
+		{
+			const AABB bounds = culler.GetClusterBounds(ClusteredLightCuller::GetClusterIndex(0, 0, z));
+			const float middle = -(bounds.Min.Z() + bounds.Max.Z()) * 0.5f;
+			EXPECT_EQ(culler.GetDepthSlice(middle), z);
+			EXPECT_EQ(static_cast<uint32_t>(std::floor(std::log(middle) * culler.GetDepthSliceScale() + culler.GetDepthSliceBias())), z);
+		}
+	}
+
+	TEST(ClusteredLightCullerTest, MatchesBruteForceSphereTest)
+	{
+		ClusteredLightCuller culler;
+		Configure(culler);
+
+		const std::vector<Light> lights = MakeRandomLights(500);
+		const Matrix4x4 view = Matrix4x4::CreateTranslation(Vector3(1.5f, -2.0f, 3.0f));
+		culler.Assign(lights, view);
+
+		// Same bounding spheres, every light against every cluster
+		uint32_t expectedAssignments = 0;
+		for (uint32_t cluster = 0; cluster < ClusteredLightCuller::k_ClusterCount; ++cluster)
+		{
+			const AABB box = culler.GetClusterBounds(cluster);
+			std::vector<uint32_t> expected;
+			for (uint32_t i = 0; i < lights.size(); ++i)
+			{
+				const Light& light = lights[i];
+				Vector3 center = light.Position;
+				float radius = light.Range;
+				if (light.Type == LightType::Spot)
+				{
+					if (light.SpotAngle > 0.785398f)
+					{
+						center = light.Position + light.Direction * (std::cos(light.SpotAngle) * light.Range);
+						radius = std::sin(light.SpotAngle) * light.Range;
+					}
+					else
+					{
+						radius = light.Range / (2.0f * std::cos(light.SpotAngle));
+						center = light.Position + light.Direction * radius;
+					}
+				}
+
+				const Vector4 viewCenter = view * Vector4(center.X(), center.Y(), center.Z(), 1.0f);
+				if (SphereTouchesBox(Vector3(viewCenter.X(), viewCenter.Y(), viewCenter.Z()), radius, box))
+				{
+					expected.push_back(i);
+				}
+			}
+
+			const auto actual = culler.GetClusterLights(cluster);
+			ASSERT_EQ(std::vector<uint32_t>(actual.begin(), actual.end()), expected) << "cluster " << cluster;
+			expectedAssignments += static_cast<uint32_t>(expected.size());
+		}
+
+		EXPECT_EQ(culler.GetStats().Assignments, expectedAssignments);
+		EXPECT_GT(culler.GetStats().OccupiedClusters, 0u);
+	}
+
+	TEST(ClusteredLightCullerTest, ClusterRangesTileTheIndexList)
+	{
+		ClusteredLightCuller culler;
+		Configure(culler);
+
+		const std::vector<Light> lights = MakeRandomLights(300);
+		culler.Assign(lights, Matrix4x4::Identity());
+
+		uint32_t offset = 0;
+		for (const LightCluster& cluster : culler.GetClusters())
+		{
+			EXPECT_EQ(cluster.Offset, offset);
+			offset += cluster.Count;
+		}
+		EXPECT_EQ(offset, culler.GetLightIndices().size());
+		EXPECT_EQ(culler.GetGpuLights().size(), lights.size());
+		EXPECT_FLOAT_EQ(culler.GetGpuLights()[1].DirectionSpotCos.W(), -2.0f);
+		EXPECT_FLOAT_EQ(culler.GetGpuLights()[0].DirectionSpotCos.W(), std::cos(lights[0].SpotAngle));
+	}
+
+	TEST(ClusteredLightCullerTest, ParallelAssignmentMatchesSerial)
+	{
+		const std::vector<Light> lights = MakeRandomLights(2000);
+
+		ClusteredLightCuller serial;
+		Configure(serial);
+		serial.Assign(lights, Matrix4x4::Identity());
+
+		Core::JobSystem::Get().Initialize(4);
+		ClusteredLightCuller parallel;
+		Configure(parallel);
+		parallel.Assign(lights, Matrix4x4::Identity());
+		// Second frame reuses the per-cluster lists
+		parallel.Assign(lights, Matrix4x4::Identity());
+		Core::JobSystem::Get().Shutdown();
+
+		const auto serialIndices = serial.GetLightIndices();
+		const auto parallelIndices = parallel.GetLightIndices();
+		ASSERT_EQ(serialIndices.size(), parallelIndices.size());
+		EXPECT_TRUE(std::equal(serialIndices.begin(), serialIndices.end(), parallelIndices.begin()));
+		EXPECT_EQ(serial.GetStats().MaxLightsPerCluster, parallel.GetStats().MaxLightsPerCluster);
+		EXPECT_EQ(serial.GetStats().VisibleLights, parallel.GetStats().VisibleLights);
+	}
+}
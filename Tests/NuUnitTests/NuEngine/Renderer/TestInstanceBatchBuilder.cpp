@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <Renderer/Batching/InstanceBatchBuilder.hpp>
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Material.hpp>
+
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        std::vector<Matrix4x4> Translations(float first, int count)
+        {
+            std::vector<Matrix4x4> transforms;
+            for (int i = 0; i < count; ++i)
+            {
+                transforms.push_back(Matrix4x4::CreateTranslation(Vector3(first + static_cast<float>(i), 0.0f, 0.0f)));
+            }
+            return transforms;
+        }
+    }
+
+    TEST(InstanceBatchBuilderTest, EmptyBuildHasNoBatches)
+    {
+        InstanceBatchBuilder builder;
+        builder.Build();
+
+        EXPECT_TRUE(builder.GetBatches().empty());
+        EXPECT_TRUE(builder.GetInstanceData().empty());
+    }
+
+    TEST(InstanceBatchBuilderTest, MergesSubmissionsOfSameMeshAndMaterial)
+    {
+        Mesh cube;
+        Material wall;
+        InstanceBatchBuilder builder;
+
+        builder.Submit(&cube, &wall, Translations(0.0f, 3));
+        builder.Submit(&cube, &wall, Translations(3.0f, 2));
+        builder.Build();
+
+        ASSERT_EQ(builder.GetBatches().size(), 1u);
+        EXPECT_EQ(builder.GetBatches()[0].FirstInstance, 0u);
+        EXPECT_EQ(builder.GetBatches()[0].InstanceCount, 5u);
+        EXPECT_EQ(builder.GetInstanceData()[4], Matrix4x4::CreateTranslation(Vector3(4.0f, 0.0f, 0.0f)));
+    }
+
+    TEST(InstanceBatchBuilderTest, GroupsInterleavedSubmissionsInFirstSeenOrder)
+    {
+        Mesh cube;
+        Mesh sphere;
+        Material wall;
+        InstanceBatchBuilder builder;
+
+        builder.Submit(&sphere, &wall, Translations(0.0f, 1));
+        builder.Submit(&cube, &wall, Translations(10.0f, 2));
+        builder.Submit(&sphere, &wall, Translations(1.0f, 1));
+        builder.Build();
+
+        const auto batches = builder.GetBatches();
+        ASSERT_EQ(batches.size(), 2u);
+
+        EXPECT_EQ(batches[0].Mesh, &sphere);
+        EXPECT_EQ(batches[0].FirstInstance, 0u);
+        EXPECT_EQ(batches[0].InstanceCount, 2u);
+        EXPECT_EQ(builder.GetInstanceData()[1], Matrix4x4::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)));
+
+        EXPECT_EQ(batches[1].Mesh, &cube);
+        EXPECT_EQ(batches[1].FirstInstance, 2u);
+        EXPECT_EQ(batches[1].InstanceCount, 2u);
+    }
+
+    TEST(InstanceBatchBuilderTest, DifferentMaterialsSplitBatches)
+    {
+        Mesh cube;
+        Material wall;
+        Material floor;
+        InstanceBatchBuilder builder;
+
+        builder.Submit(&cube, &wall, Translations(0.0f, 2));
+        builder.Submit(&cube, &floor, Translations(0.0f, 2));
+        builder.Build();
+
+        ASSERT_EQ(builder.GetBatches().size(), 2u);
+        EXPECT_EQ(builder.GetBatches()[1].Material, &floor);
+    }
+
+    TEST(InstanceBatchBuilderTest, SplitsGroupsAboveBatchLimit)
+    {
+        Mesh cube;
+        Material wall;
+        InstanceBatchBuilder builder(4);
+
+        builder.Submit(&cube, &wall, Translations(0.0f, 10));
+        builder.Build();
+
+        const auto batches = builder.GetBatches();
+        ASSERT_EQ(batches.size(), 3u);
+        EXPECT_EQ(batches[0].InstanceCount, 4u);
+        EXPECT_EQ(batches[1].FirstInstance, 4u);
+        EXPECT_EQ(batches[2].FirstInstance, 8u);
+        EXPECT_EQ(batches[2].InstanceCount, 2u);
+    }
+
+    TEST(InstanceBatchBuilderTest, ClearResetsForNextFrame)
+    {
+        Mesh cube;
+        Material wall;
+        InstanceBatchBuilder builder;
+
+        builder.Submit(&cube, &wall, Translations(0.0f, 3));
+        builder.Build();
+        builder.Clear();
+        builder.Submit(&cube, &wall, Translations(0.0f, 1));
+        builder.Build();
+
+        ASSERT_EQ(builder.GetBatches().size(), 1u);
+        EXPECT_EQ(builder.GetBatches()[0].InstanceCount, 1u);
+        EXPECT_EQ(builder.GetInstanceCount(), 1u);
+    }
+}
@@ -0,0 +1,374 @@
+#include <gtest/gtest.h>
+#include <Renderer/Geometry/MeshCooker.hpp>
+#include <Renderer/Geometry/MeshOptimizer.hpp>
+#include <Renderer/Geometry/NuMeshFile.hpp>
+#include <Renderer/Batching/InstanceBatchBuilder.hpp>
+#include <Renderer/Queue/ParallelRenderRecorder.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+	using namespace NuMath;
+
+	namespace
+	{
+		constexpr uint32_t k_Stride = 8;    // Position, UV, normal
+
+		struct TestMesh
+		{
+			std::vector<float> Vertices;
+			std::vector<uint32_t> Indices;
+
+			uint32_t GetVertexCount() const { return static_cast<uint32_t>(Vertices.size() / k_Stride); }
+		};
+
+		// size x size quad grid on the XZ plane spanning [-1, 1], facing +Y
+		TestMesh MakeGrid(uint32_t size)
+		{
+			TestMesh mesh;
+			for (uint32_t z = 0; z <= size; ++z)
+			{
+				for (uint32_t x = 0; x <= size; ++x)
+				{
+					const float u = static_cast<float>(x) / size;
+					const float v = static_cast<float>(z) / size;
+					mesh.Vertices.insert(mesh.Vertices.end(), { u * 2.0f - 1.0f, 0.0f, v * 2.0f - 1.0f, u, v, 0.0f, 1.0f, 0.0f });
+				}
+			}
+			for (uint32_t z = 0; z < size; ++z)
+			{
+				for (uint32_t x = 0; x < size; ++x)
+				{
+					const uint32_t i = z * (size + 1) + x;
+					mesh.Indices.insert(mesh.Indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+				}
+			}
+			return mesh;
+		}
+
+		// Closed sphere of the given radius around centre, normals pointing out
+		TestMesh MakeSphere(uint32_t rings, uint32_t segments, float radius, const Vector3& center)
+		{
+			TestMesh mesh;
+			const auto addVertex = [&](float theta, float phi, float u, float v)
+			{
+				const float nx = std::sin(theta) * std::cos(phi);
+				const float ny = std::cos(theta);
+				const float nz = std::sin(theta) * std::sin(phi);
+				mesh.Vertices.insert(mesh.Vertices.end(), { center.X() + nx * radius, center.Y() + ny * radius, center.Z() + nz * radius, u, v, nx, ny, nz });
+			};
+
+			addVertex(0.0f, 0.0f, 0.5f, 0.0f);
+			for (uint32_t r = 1; r < rings; ++r)
+			{
+				for (uint32_t s = 0; s < segments; ++s)
+				{
+					addVertex(3.14159265f * r / rings, 6.28318531f * s / segments, static_cast<float>(s) / segments, static_cast<float>(r) / rings);
+				}
+			}
+			addVertex(3.14159265f, 0.0f, 0.5f, 1.0f);
+
+			const uint32_t south = mesh.GetVertexCount() - 1;
+			const auto ring = [segments](uint32_t r, uint32_t s) { return 1 + (r - 1) * segments + s % segments; };
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				mesh.Indices.insert(mesh.Indices.end(), { 0, ring(1, s + 1), ring(1, s) });
+				mesh.Indices.insert(mesh.Indices.end(), { south, ring(rings - 1, s), ring(rings - 1, s + 1) });
+			}
+			for (uint32_t r = 1; r + 1 < rings; ++r)
+			{
+				for (uint32_t s = 0; s < segments; ++s)
+				{
+					mesh.Indices.insert(mesh.Indices.end(), { ring(r, s), ring(r, s + 1), ring(r + 1, s) });
+					mesh.Indices.insert(mesh.Indices.end(), { ring(r, s + 1), ring(r + 1, s + 1), ring(r + 1, s) });
+				}
+			}
+			return mesh;
+		}
+
+		void ShuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed)
+		{
+			std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+			std::memcpy(triangles.data(), indices.data(), indices.size() * sizeof(uint32_t));
+			std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+			std::memcpy(indices.data(), triangles.data(), indices.size() * sizeof(uint32_t));
+		}
+
+		// Triangles with their winding kept but rotated to start at the smallest index, sorted
+		std::vector<std::array<uint32_t, 3>> CanonicalTriangles(const std::vector<uint32_t>& indices)
+		{
+			std::vector<std::array<uint32_t, 3>> triangles;
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				std::array<uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+				std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+				triangles.push_back(triangle);
+			}
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+	}
+
+	TEST(MeshOptimizerTest, VertexCacheOrderLowersACMR)
+	{
+		TestMesh grid = MakeGrid(48);
+		ShuffleTriangles(grid.Indices, 7);
+		const auto before = CanonicalTriangles(grid.Indices);
+
+		const float shuffledACMR = MeshOptimizer::ComputeACMR(grid.Indices, grid.GetVertexCount());
+		MeshOptimizer::OptimizeVertexCache(grid.Indices, grid.GetVertexCount());
+		const float optimizedACMR = MeshOptimizer::ComputeACMR(grid.Indices, grid.GetVertexCount());
+
+		EXPECT_GT(shuffledACMR, 2.0f);
+		EXPECT_LT(optimizedACMR, 0.8f);
+		EXPECT_EQ(CanonicalTriangles(grid.Indices), before);
+	}
+
+	TEST(MeshOptimizerTest, OverdrawOrderDrawsOuterShellFirst)
+	{
+		// A small sphere inside a large one, the inner one listed first
+		TestMesh mesh = MakeSphere(12, 24, 0.25f, Vector3(0.0f, 0.0f, 0.0f));
+		const TestMesh outer = MakeSphere(24, 48, 1.0f, Vector3(0.0f, 0.0f, 0.0f));
+		const uint32_t innerTriangles = static_cast<uint32_t>(mesh.Indices.size() / 3);
+		const uint32_t base = mesh.GetVertexCount();
+		mesh.Vertices.insert(mesh.Vertices.end(), outer.Vertices.begin(), outer.Vertices.end());
+		for (const uint32_t index : outer.Indices)
+		{
+			mesh.Indices.push_back(base + index);
+		}
+
+		const auto before = CanonicalTriangles(mesh.Indices);
+		MeshOptimizer::OptimizeVertexCache(mesh.Indices, mesh.GetVertexCount());
+		const float cacheACMR = MeshOptimizer::ComputeACMR(mesh.Indices, mesh.GetVertexCount());
+
+		MeshOptimizer::OptimizeOverdraw(mesh.Indices, mesh.Vertices, k_Stride, 1.05f);
+
+		EXPECT_EQ(CanonicalTriangles(mesh.Indices), before);
+		EXPECT_LE(MeshOptimizer::ComputeACMR(mesh.Indices, mesh.GetVertexCount()), cacheACMR * 1.15f);
+
+		// The outer shell's triangles now come before most of the inner one's
+		uint32_t innerInFirstHalf = 0;
+		for (size_t i = 0; i < mesh.Indices.size() / 2; i += 3)
+		{
+			innerInFirstHalf += mesh.Indices[i] < base ? 1 : 0;
+		}
+		EXPECT_LT(innerInFirstHalf, innerTriangles / 4);
+	}
+
+	TEST(MeshOptimizerTest, VertexFetchFollowsFirstUseAndDropsUnusedVertices)
+	{
+		TestMesh grid = MakeGrid(8);
+		ShuffleTriangles(grid.Indices, 3);
+
+		// Drop the last row of quads so its far vertices go unused
+		const std::vector<uint32_t> kept(grid.Indices.begin(), grid.Indices.end());
+		std::vector<uint32_t> indices;
+		for (size_t i = 0; i < kept.size(); i += 3)
+		{
+			if (std::max({ kept[i], kept[i + 1], kept[i + 2] }) < 8 * 9)
+			{
+				indices.insert(indices.end(), kept.begin() + i, kept.begin() + i + 3);
+			}
+		}
+		const std::vector<uint32_t> original = indices;
+
+		const std::vector<uint32_t> order = MeshOptimizer::OptimizeVertexFetch(indices, grid.GetVertexCount());
+		EXPECT_EQ(order.size(), 8u * 9u);
+
+		uint32_t next = 0;
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			ASSERT_LE(indices[i], next);
+			next = std::max(next, indices[i] + 1);
+			EXPECT_EQ(order[indices[i]], original[i]);
+		}
+
+		const std::vector<float> remapped = MeshOptimizer::RemapVertices(grid.Vertices, k_Stride, order);
+		ASSERT_EQ(remapped.size(), order.size() * k_Stride);
+		EXPECT_EQ(std::memcmp(&remapped[5 * k_Stride], &grid.Vertices[order[5] * k_Stride], k_Stride * sizeof(float)), 0);
+	}
+
+	TEST(MeshCookerTest, SavedFileDecodesBackToTheSource)
+	{
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / "NuEngineTests" / "cooked.numesh";
+		const TestMesh sphere = MakeSphere(24, 48, 2.0f, Vector3(1.0f, -3.0f, 0.5f));
+
+		MeshCookOptions options;
+		options.Layout = { k_Stride, 3, 5, -1 };
+		const CookedMesh cooked = MeshCooker::Cook(sphere.Vertices, sphere.Indices, options);
+		ASSERT_GE(cooked.Levels.size(), 2u);
+		EXPECT_EQ(cooked.VertexCount, sphere.GetVertexCount());
+		EXPECT_EQ(cooked.IndexFormat, Graphics::IndexFormat::UInt16);
+		EXPECT_EQ(cooked.VertexStride, 16u);
+		ASSERT_TRUE(MeshCooker::Save(cooked, path).IsOk());
+
+		{
+			auto opened = NuMeshFile::Open(path);
+			ASSERT_TRUE(opened.IsOk());
+			const NuMeshFile& file = opened.Unwrap();
+
+			EXPECT_EQ(file.GetFlags(), NuMesh::k_FlagTexCoords | NuMesh::k_FlagNormals);
+			EXPECT_EQ(file.GetIndexFormat(), Graphics::IndexFormat::UInt16);
+			EXPECT_EQ(file.GetLayout().GetStride(), file.GetVertexStride());
+			ASSERT_EQ(file.GetLevels().size(), cooked.Levels.size());
+			EXPECT_EQ(file.GetLevels()[0].IndexCount, sphere.Indices.size());
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(file.GetVertexData().data()) % NuMesh::k_DataAlignment, 0u);
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(file.GetIndexData().data()) % NuMesh::k_DataAlignment, 0u);
+			EXPECT_NEAR(file.GetBounds().Radius, 2.0f, 1.0e-3f);
+
+			// Every stored vertex dequantizes onto the sphere, its UV and normal close to what went in
+			const Matrix4x4 dequantize = file.GetDequantizeTransform();
+			const std::byte* vertex = file.GetVertexData().data();
+			for (uint32_t v = 0; v < file.GetVertexCount(); ++v, vertex += file.GetVertexStride())
+			{
+				int16_t position[4];
+				uint16_t uv[2];
+				int8_t normal[4];
+				std::memcpy(position, vertex, sizeof(position));
+				std::memcpy(uv, vertex + 8, sizeof(uv));
+				std::memcpy(normal, vertex + 12, sizeof(normal));
+
+				const Vector4 local = dequantize * Vector4(position[0] / 32767.0f, position[1] / 32767.0f, position[2] / 32767.0f, position[3] / 32767.0f);
+				const Vector3 offset = Vector3(local.X(), local.Y(), local.Z()) - Vector3(1.0f, -3.0f, 0.5f);
+				EXPECT_NEAR(offset.Length(), 2.0f, 1.0e-3f);
+
+				const Vector3 decodedNormal(normal[0] / 127.0f, normal[1] / 127.0f, normal[2] / 127.0f);
+				EXPECT_GT(decodedNormal.Dot(offset * 0.5f), 0.99f);
+
+				const float u = NuMesh::HalfToFloat(uv[0]);
+				const float w = NuMesh::HalfToFloat(uv[1]);
+				EXPECT_TRUE(u >= 0.0f && u <= 1.0f && w >= 0.0f && w <= 1.0f);
+			}
+
+			// Zero-copy upload: one index buffer per level, 16-bit, sized as the table says
+			Graphics::Null::NullRenderDevice device;
+			const LodMesh mesh = file.CreateLodMesh(device);
+			ASSERT_EQ(mesh.Levels.size(), file.GetLevels().size());
+			for (size_t level = 0; level < mesh.Levels.size(); ++level)
+			{
+				const auto& indexBuffer = mesh.Levels[level].VertexArray->GetIndexBuffer();
+				ASSERT_TRUE(indexBuffer);
+				EXPECT_EQ(indexBuffer->GetFormat(), Graphics::IndexFormat::UInt16);
+				EXPECT_EQ(indexBuffer->GetCount(), file.GetLevels()[level].IndexCount);
+			}
+			EXPECT_EQ(device.GetStats().BuffersCreated, 1 + mesh.Levels.size());
+		}
+
+		std::filesystem::remove_all(path.parent_path());
+	}
+
+	TEST(MeshCookerTest, QuantizedMeshSubmitsInMeshUnits)
+	{
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / "NuEngineTests" / "submitted.numesh";
+		const TestMesh sphere = MakeSphere(12, 24, 2.0f, Vector3(1.0f, -3.0f, 0.5f));
+
+		MeshCookOptions options;
+		options.Layout = { k_Stride, 3, 5, -1 };
+		ASSERT_TRUE(MeshCooker::Save(MeshCooker::Cook(sphere.Vertices, sphere.Indices, options), path).IsOk());
+
+		{
+			auto opened = NuMeshFile::Open(path);
+			ASSERT_TRUE(opened.IsOk());
+			const NuMeshFile& file = opened.Unwrap();
+
+			Graphics::Null::NullRenderDevice device;
+			const LodMesh lodMesh = file.CreateLodMesh(device);
+			ASSERT_FALSE(lodMesh.Levels.empty());
+			const Mesh& mesh = lodMesh.Levels[0];
+			EXPECT_TRUE(mesh.IsQuantized);
+
+			// The same plain model matrix a MeshRendererComponent's transform produces
+			const Vector3 placement(10.0f, 0.0f, -20.0f);
+			const Matrix4x4 model = Matrix4x4::CreateTranslation(placement);
+			Material material;
+
+			ParallelRenderRecorder recorder;
+			recorder.BeginFrame(Matrix4x4::Identity(), Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f), 100.0f);
+			RenderQueue queue;
+			recorder.Submit(queue, mesh, material, RenderPass::Opaque, model);
+			ASSERT_EQ(queue.GetSize(), 1u);
+			const Matrix4x4& queued = queue.GetEntries()[0].Command->Transforms[0];
+
+			InstanceBatchBuilder batches;
+			batches.Submit(&mesh, &material, std::span<const Matrix4x4>(&model, 1));
+			batches.Build();
+			ASSERT_EQ(batches.GetInstanceData().size(), 1u);
+			const Matrix4x4& instanced = batches.GetInstanceData()[0];
+
+			// What the shader does with a stored snorm16 position must land on the placed sphere
+			const std::byte* vertex = file.GetVertexData().data();
+			for (uint32_t v = 0; v < file.GetVertexCount(); ++v, vertex += file.GetVertexStride())
+			{
+				int16_t position[4];
+				std::memcpy(position, vertex, sizeof(position));
+				const Vector4 stored(position[0] / 32767.0f, position[1] / 32767.0f, position[2] / 32767.0f, 1.0f);
+
+				for (const Matrix4x4* transform : { &queued, &instanced })
+				{
+					const Vector4 world = *transform * stored;
+					const Vector3 offset = Vector3(world.X(), world.Y(), world.Z()) - (placement + Vector3(1.0f, -3.0f, 0.5f));
+					EXPECT_NEAR(offset.Length(), 2.0f, 1.0e-3f);
+				}
+			}
+		}
+
+		std::filesystem::remove_all(path.parent_path());
+	}
+
+	TEST(MeshCookerTest, HalvesAndSnormsRoundTrip)
+	{
+		for (const float value : { 0.0f, 1.0f, -2.5f, 0.333333f, 65504.0f, 1.0e-3f })
+		{
+			EXPECT_NEAR(NuMesh::HalfToFloat(NuMesh::FloatToHalf(value)), value, std::abs(value) * 1.0e-3f) << value;
+		}
+		EXPECT_TRUE(std::isinf(NuMesh::HalfToFloat(NuMesh::FloatToHalf(1.0e6f))));
+
+		EXPECT_EQ(NuMesh::QuantizeSnorm16(1.0f), 32767);
+		EXPECT_EQ(NuMesh::QuantizeSnorm16(-2.0f), -32767);
+		EXPECT_EQ(NuMesh::QuantizeSnorm8(0.5f), 64);
+	}
+
+	TEST(MeshCookerTest, RejectsForeignAndTruncatedFiles)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "NuEngineTests";
+		std::filesystem::create_directories(directory);
+
+		const TestMesh grid = MakeGrid(4);
+		MeshCookOptions options;
+		options.Layout = { k_Stride, 3, -1, -1 };
+		options.GenerateLods = false;
+		ASSERT_TRUE(MeshCooker::Save(MeshCooker::Cook(grid.Vertices, grid.Indices, options), directory / "good.numesh").IsOk());
+
+		std::vector<char> bytes(std::filesystem::file_size(directory / "good.numesh"));
+		std::ifstream(directory / "good.numesh", std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+		const auto writeVariant = [&](const char* name, std::vector<char> contents)
+		{
+			std::ofstream(directory / name, std::ios::binary).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+			return directory / name;
+		};
+
+		std::vector<char> wrongMagic = bytes;
+		wrongMagic[0] = 'X';
+		std::vector<char> wrongStride = bytes;
+		wrongStride[20] = 7;
+		std::vector<char> truncated(bytes.begin(), bytes.end() - 2);
+
+		EXPECT_TRUE(NuMeshFile::Open(directory / "good.numesh").IsOk());
+		EXPECT_TRUE(NuMeshFile::Open(writeVariant("magic.numesh", wrongMagic)).IsError());
+		EXPECT_TRUE(NuMeshFile::Open(writeVariant("stride.numesh", wrongStride)).IsError());
+		EXPECT_TRUE(NuMeshFile::Open(writeVariant("truncated.numesh", truncated)).IsError());
+		EXPECT_TRUE(NuMeshFile::Open(directory / "missing.numesh").IsError());
+
+		std::filesystem::remove_all(directory);
+	}
+}
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include <Renderer/Geometry/MeshSimplifier.hpp>
+#include <Renderer/Geometry/LodMesh.hpp>
+#include <Renderer/Geometry/LodSelector.hpp>
+#include <Graphics/Backends/Null/NullRenderDevice.hpp>
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+	using namespace NuMath;
+
+	namespace
+	{
+		constexpr uint32_t k_Stride = 5;    // Position + UV, as the forward pipeline's meshes
+
+		struct TestMesh
+		{
+			std::vector<float> Vertices;
+			std::vector<uint32_t> Indices;
+		};
+
+		void AddVertex(TestMesh& mesh, float x, float y, float z, float u, float v)
+		{
+			mesh.Vertices.insert(mesh.Vertices.end(), { x, y, z, u, v });
+		}
+
+		// Flat size x size quad grid on the XZ plane spanning [-1, 1]
+		TestMesh MakeGrid(uint32_t size)
+		{
+			TestMesh mesh;
+			for (uint32_t z = 0; z <= size; ++z)
+			{
+				for (uint32_t x = 0; x <= size; ++x)
+				{
+					const float u = static_cast<float>(x) / size;
+					const float v = static_cast<float>(z) / size;
+					AddVertex(mesh, u * 2.0f - 1.0f, 0.0f, v * 2.0f - 1.0f, u, v);
+				}
+			}
+			for (uint32_t z = 0; z < size; ++z)
+			{
+				for (uint32_t x = 0; x < size; ++x)
+				{
+					const uint32_t i = z * (size + 1) + x;
+					mesh.Indices.insert(mesh.Indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+				}
+			}
+			return mesh;
+		}
+
+		// Closed unit sphere: the longitude wraps through shared indices, the poles are single vertices
+		TestMesh MakeSphere(uint32_t rings, uint32_t segments)
+		{
+			TestMesh mesh;
+			AddVertex(mesh, 0.0f, 1.0f, 0.0f, 0.5f, 0.0f);
+			for (uint32_t r = 1; r < rings; ++r)
+			{
+				const float theta = 3.14159265f * r / rings;
+				for (uint32_t s = 0; s < segments; ++s)
+				{
+					const float phi = 6.28318531f * s / segments;
+					AddVertex(mesh, std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi),
+						static_cast<float>(s) / segments, static_cast<float>(r) / rings);
+				}
+			}
+			AddVertex(mesh, 0.0f, -1.0f, 0.0f, 0.5f, 1.0f);
+
+			const uint32_t south = static_cast<uint32_t>(mesh.Vertices.size() / k_Stride) - 1;
+			const auto ring = [segments](uint32_t r, uint32_t s) { return 1 + (r - 1) * segments + s % segments; };
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				mesh.Indices.insert(mesh.Indices.end(), { 0, ring(1, s + 1), ring(1, s) });
+				mesh.Indices.insert(mesh.Indices.end(), { south, ring(rings - 1, s), ring(rings - 1, s + 1) });
+			}
+			for (uint32_t r = 1; r + 1 < rings; ++r)
+			{
+				for (uint32_t s = 0; s < segments; ++s)
+				{
+					mesh.Indices.insert(mesh.Indices.end(), { ring(r, s), ring(r, s + 1), ring(r + 1, s) });
+					mesh.Indices.insert(mesh.Indices.end(), { ring(r, s + 1), ring(r + 1, s + 1), ring(r + 1, s) });
+				}
+			}
+			return mesh;
+		}
+
+		Vector3 PositionOf(const TestMesh& mesh, uint32_t index)
+		{
+			const float* p = mesh.Vertices.data() + index * k_Stride;
+			return Vector3(p[0], p[1], p[2]);
+		}
+
+		float TriangleArea(const TestMesh& mesh, const uint32_t* triangle)
+		{
+			const Vector3 a = PositionOf(mesh, triangle[0]);
+			return (PositionOf(mesh, triangle[1]) - a).Cross(PositionOf(mesh, triangle[2]) - a).Length() * 0.5f;
+		}
+	}
+
+	TEST(MeshSimplifierTest, FlatGridCollapsesWithoutErrorAndKeepsItsBorder)
+	{
+		const TestMesh grid = MakeGrid(16);
+
+		float error = -1.0f;
+		const std::vector<uint32_t> simplified = MeshSimplifier::Simplify(grid.Vertices, k_Stride, grid.Indices, grid.Indices.size() / 8, 0.01f, &error);
+
+		EXPECT_LE(simplified.size(), grid.Indices.size() / 8);
+		EXPECT_NEAR(error, 0.0f, 1.0e-4f);
+
+		// Same area, and the outline is untouched: every border vertex is still used
+		float area = 0.0f;
+		std::set<uint32_t> used(simplified.begin(), simplified.end());
+		for (size_t i = 0; i < simplified.size(); i += 3)
+		{
+			area += TriangleArea(grid, &simplified[i]);
+		}
+		EXPECT_NEAR(area, 4.0f, 1.0e-3f);
+
+		for (uint32_t x = 0; x <= 16; ++x)
+		{
+			EXPECT_TRUE(used.count(x));
+			EXPECT_TRUE(used.count(16 * 17 + x));
+		}
+	}
+
+	TEST(MeshSimplifierTest, MaxErrorStopsSimplification)
+	{
+		const TestMesh sphere = MakeSphere(16, 32);
+
+		float error = 0.0f;
+		const std::vector<uint32_t> simplified = MeshSimplifier::Simplify(sphere.Vertices, k_Stride, sphere.Indices, 0, 0.02f, &error);
+
+		EXPECT_LE(error, 0.02f);
+		EXPECT_GT(simplified.size(), 0u);
+		EXPECT_LT(simplified.size(), sphere.Indices.size());
+	}
+
+	TEST(MeshSimplifierTest, LodChainShrinksAndStaysClosed)
+	{
+		const TestMesh sphere = MakeSphere(24, 48);
+		const uint32_t vertexCount = static_cast<uint32_t>(sphere.Vertices.size() / k_Stride);
+
+		LodChainOptions options;
+		options.MaxLevels = 4;
+		options.MaxError = 0.2f;
+		const MeshLodChain chain = MeshSimplifier::BuildLodChain(sphere.Vertices, k_Stride, sphere.Indices, options);
+
+		ASSERT_GE(chain.Levels.size(), 3u);
+		EXPECT_NEAR(chain.Bounds.Radius, 1.0f, 1.0e-3f);
+		EXPECT_EQ(chain.Levels[0].IndexCount, sphere.Indices.size());
+
+		for (size_t level = 1; level < chain.Levels.size(); ++level)
+		{
+			const MeshLodLevel& info = chain.Levels[level];
+			EXPECT_EQ(info.FirstIndex, chain.Levels[level - 1].FirstIndex + chain.Levels[level - 1].IndexCount);
+			EXPECT_LE(info.IndexCount, chain.Levels[level - 1].IndexCount * 6 / 10);
+			EXPECT_GE(info.Error, chain.Levels[level - 1].Error);
+
+			// Every triangle still faces outwards
+			for (uint32_t i = info.FirstIndex; i < info.FirstIndex + info.IndexCount; i += 3)
+			{
+				const uint32_t* triangle = &chain.Indices[i];
+				ASSERT_LT(std::max({ triangle[0], triangle[1], triangle[2] }), vertexCount);
+
+				const Vector3 a = PositionOf(sphere, triangle[0]);
+				const Vector3 b = PositionOf(sphere, triangle[1]);
+				const Vector3 c = PositionOf(sphere, triangle[2]);
+				EXPECT_GT((b - a).Cross(c - a).Dot(a + b + c), 0.0f);
+			}
+		}
+	}
+
+	TEST(LodSelectorTest, DistantObjectsTakeCoarserLevels)
+	{
+		const TestMesh sphere = MakeSphere(24, 48);
+		const MeshLodChain chain = MeshSimplifier::BuildLodChain(sphere.Vertices, k_Stride, sphere.Indices);
+
+		Graphics::Null::NullRenderDevice device;
+		const Graphics::BufferLayout layout = {
+			{ Graphics::ShaderDataType::Float3, "aPos" },
+			{ Graphics::ShaderDataType::Float2, "aTexCoord" }
+		};
+		const LodMesh mesh = CreateLodMesh(device, sphere.Vertices, layout, chain);
+		ASSERT_EQ(mesh.Levels.size(), chain.Levels.size());
+		ASSERT_GE(mesh.Levels.size(), 3u);
+
+		LodSelector selector(1.0f, 0.0f);
+		selector.SetView(Vector3(0.0f, 0.0f, 0.0f), 1.0f, 720.0f);
+
+		// Count not a multiple of any SIMD width, so the padded tail is exercised
+		constexpr uint32_t k_Objects = 13;
+		for (uint32_t i = 0; i < k_Objects; ++i)
+		{
+			selector.Add(Sphere(Vector3(0.0f, 0.0f, -3.0f - 40.0f * i), 1.0f), mesh);
+		}
+		selector.Select();
+
+		const auto levels = selector.GetLevels();
+		const auto radii = selector.GetScreenRadii();
+		ASSERT_EQ(levels.size(), k_Objects);
+		EXPECT_EQ(levels[0], 0u);
+		EXPECT_EQ(levels[k_Objects - 1], mesh.Levels.size() - 1);
+		for (uint32_t i = 1; i < k_Objects; ++i)
+		{
+			EXPECT_GE(levels[i], levels[i - 1]);
+			EXPECT_LT(radii[i], radii[i - 1]);
+		}
+
+		const float scale = 360.0f / std::tan(0.5f);
+		EXPECT_NEAR(radii[0], scale / 2.0f, 1.0e-2f);
+
+		const LodSelectionStats& stats = selector.GetStats();
+		EXPECT_EQ(stats.Objects, k_Objects);
+		EXPECT_LT(stats.IndicesSelected, stats.IndicesFull);
+
+		// Drawing the chosen levels sends fewer vertices through the device than level 0 would
+		for (uint32_t i = 0; i < k_Objects; ++i)
+		{
+			const Mesh& level = mesh.Levels[levels[i]];
+			device.DrawInstanced(level.VertexArray, level.VertexCount, 1, 0).Ignore();
+		}
+		EXPECT_EQ(device.GetStats().Vertices, stats.IndicesSelected);
+	}
+
+	TEST(LodSelectorTest, HysteresisHoldsLevelsNearTheSwitchPoint)
+	{
+		const TestMesh sphere = MakeSphere(24, 48);
+		const MeshLodChain chain = MeshSimplifier::BuildLodChain(sphere.Vertices, k_Stride, sphere.Indices);
+
+		Graphics::Null::NullRenderDevice device;
+		const Graphics::BufferLayout layout = {
+			{ Graphics::ShaderDataType::Float3, "aPos" },
+			{ Graphics::ShaderDataType::Float2, "aTexCoord" }
+		};
+		const LodMesh mesh = CreateLodMesh(device, sphere.Vertices, layout, chain);
+		ASSERT_GE(mesh.Levels.size(), 2u);
+
+		// Distance at which level 1's error projects to exactly one pixel
+		const float scale = 360.0f / std::tan(0.5f);
+		const float switchRadius = 1.0f / (chain.Levels[1].Error / chain.Bounds.Radius);
+		const float switchDistance = scale / switchRadius + 1.0f;
+
+		LodSelector selector(1.0f, 0.2f);
+		selector.SetView(Vector3(0.0f, 0.0f, 0.0f), 1.0f, 720.0f);
+
+		const auto selectAt = [&](float distance, uint32_t previous)
+		{
+			selector.Clear();
+			selector.Add(Sphere(Vector3(0.0f, 0.0f, -distance), 1.0f), mesh, previous);
+			selector.Select();
+			return static_cast<uint32_t>(selector.GetLevels()[0]);
+		};
+
+		// Just past the switch point either way, the previous level is kept
+		EXPECT_EQ(selectAt(switchDistance * 1.05f, 0), 0u);
+		EXPECT_EQ(selectAt(switchDistance * 0.95f, 1), 1u);
+		EXPECT_EQ(selector.GetStats().Switches, 0u);
+
+		// Well past it, the level changes
+		EXPECT_GE(selectAt(switchDistance * 1.5f, 0), 1u);
+		EXPECT_EQ(selectAt(switchDistance * 0.5f, 1), 0u);
+		EXPECT_EQ(selector.GetStats().Switches, 1u);
+	}
+}
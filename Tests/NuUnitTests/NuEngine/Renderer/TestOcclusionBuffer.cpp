@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <Renderer/Culling/OcclusionBuffer.hpp>
+#include <Renderer/Queue/ParallelRenderRecorder.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+	using namespace NuMath;
+
+	namespace
+	{
+		constexpr float k_FarClip = 100.0f;
+
+		Matrix4x4 MakeProjection()
+		{
+			return Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, k_FarClip);
+		}
+
+		// Camera at the origin looking down -Z; a 10 x 10 wall, 1 unit thick, ten units ahead
+		void BuildWall(OcclusionBuffer& occlusion)
+		{
+			occlusion.BeginFrame(MakeProjection());
+			occlusion.AddOccluderBox(Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -10.0f)), Vector3(5.0f, 5.0f, 0.5f));
+			occlusion.Rasterize();
+		}
+
+		AABB MakeBox(const Vector3& center, float halfSize)
+		{
+			return AABB::FromCenterExtents(center, Vector3(halfSize, halfSize, halfSize));
+		}
+	}
+
+	TEST(OcclusionBufferTest, EverythingIsVisibleWithoutOccluders)
+	{
+		OcclusionBuffer occlusion;
+		occlusion.BeginFrame(MakeProjection());
+		occlusion.Rasterize();
+
+		EXPECT_FALSE(occlusion.HasOccluders());
+		EXPECT_TRUE(occlusion.IsVisible(MakeBox(Vector3(0.0f, 0.0f, -50.0f), 1.0f)));
+		for (float depth : occlusion.GetDepth())
+		{
+			ASSERT_EQ(depth, 1.0f);
+		}
+	}
+
+	TEST(OcclusionBufferTest, WallHidesObjectsBehindIt)
+	{
+		OcclusionBuffer occlusion;
+		BuildWall(occlusion);
+		// Looking straight at it only the front face is rasterized
+		ASSERT_EQ(occlusion.GetTriangleCount(), 2u);
+
+		EXPECT_FALSE(occlusion.IsVisible(MakeBox(Vector3(0.0f, 0.0f, -30.0f), 1.0f)));
+		EXPECT_FALSE(occlusion.IsVisible(Sphere(Vector3(2.0f, 1.0f, -20.0f), 1.0f)));
+
+		// In front of the wall, beside it, or straddling its edge
+		EXPECT_TRUE(occlusion.IsVisible(MakeBox(Vector3(0.0f, 0.0f, -5.0f), 1.0f)));
+		EXPECT_TRUE(occlusion.IsVisible(MakeBox(Vector3(40.0f, 0.0f, -30.0f), 1.0f)));
+		EXPECT_TRUE(occlusion.IsVisible(MakeBox(Vector3(15.0f, 0.0f, -30.0f), 3.0f)));
+
+		// Reaching through the wall towards the camera
+		EXPECT_TRUE(occlusion.IsVisible(AABB(Vector3(-1.0f, -1.0f, -30.0f), Vector3(1.0f, 1.0f, -8.0f))));
+
+		// Crossing the near plane
+		EXPECT_TRUE(occlusion.IsVisible(MakeBox(Vector3(0.0f, 0.0f, 0.0f), 1.0f)));
+	}
+
+	TEST(OcclusionBufferTest, TileDepthIsTheFurthestPixel)
+	{
+		OcclusionBuffer occlusion;
+		BuildWall(occlusion);
+
+		const std::span<const float> depth = occlusion.GetDepth();
+		const std::span<const float> tiles = occlusion.GetTileDepth();
+
+		size_t coveredTiles = 0;
+		for (uint32_t tileY = 0; tileY < OcclusionBuffer::k_TilesY; ++tileY)
+		{
+			for (uint32_t tileX = 0; tileX < OcclusionBuffer::k_TilesX; ++tileX)
+			{
+				float furthest = -1.0f;
+				for (uint32_t y = 0; y < OcclusionBuffer::k_TileHeight; ++y)
+				{
+					for (uint32_t x = 0; x < OcclusionBuffer::k_TileWidth; ++x)
+					{
+						const uint32_t pixel = (tileY * OcclusionBuffer::k_TileHeight + y) * OcclusionBuffer::k_Width + tileX * OcclusionBuffer::k_TileWidth + x;
+						furthest = std::max(furthest, depth[pixel]);
+					}
+				}
+
+				EXPECT_EQ(tiles[tileY * OcclusionBuffer::k_TilesX + tileX], furthest);
+				coveredTiles += furthest < 1.0f ? 1 : 0;
+			}
+		}
+
+		EXPECT_GT(coveredTiles, 0u);
+		EXPECT_LT(coveredTiles, static_cast<size_t>(OcclusionBuffer::k_TilesX * OcclusionBuffer::k_TilesY));
+	}
+
+	TEST(OcclusionBufferTest, ParallelRasterizationMatchesSerial)
+	{
+		OcclusionBuffer serial;
+		BuildWall(serial);
+
+		Core::JobSystem::Get().Initialize(3);
+		OcclusionBuffer parallel;
+		BuildWall(parallel);
+		Core::JobSystem::Get().Shutdown();
+
+		const std::span<const float> expected = serial.GetDepth();
+		const std::span<const float> actual = parallel.GetDepth();
+		ASSERT_EQ(actual.size(), expected.size());
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			ASSERT_EQ(actual[i], expected[i]) << "pixel " << i;
+		}
+	}
+
+	TEST(OcclusionBufferTest, RecorderDropsOccludedRenderables)
+	{
+		OcclusionBuffer occlusion;
+		BuildWall(occlusion);
+
+		// Row of spheres behind the wall, half of them far enough to the side to peek past it
+		std::vector<Vector3> positions;
+		for (int i = 0; i < 40; ++i)
+		{
+			positions.emplace_back(static_cast<float>(i) * 2.0f - 40.0f, 0.0f, -30.0f);
+		}
+
+		Mesh mesh;
+		Material material;
+		ParallelRenderRecorder recorder;
+		const auto record = [&]()
+		{
+			recorder.BeginFrame(Matrix4x4::Identity(), MakeProjection(), k_FarClip);
+			recorder.RecordVisible(positions.size(),
+				[&](size_t i, Sphere& bounds)
+				{
+					bounds = Sphere(positions[i], 0.5f);
+					return true;
+				},
+				[&](size_t i, RenderQueue& queue)
+				{
+					recorder.Submit(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(positions[i]));
+				});
+			return recorder.GetRecordedCount();
+		};
+
+		const size_t withoutOcclusion = record();
+		recorder.SetOcclusionBuffer(&occlusion);
+		const size_t withOcclusion = record();
+
+		EXPECT_GT(withOcclusion, 0u);
+		EXPECT_LT(withOcclusion, withoutOcclusion);
+
+		for (size_t i = 0; i < positions.size(); ++i)
+		{
+			if (std::abs(positions[i].X()) < 10.0f)
+			{
+				EXPECT_FALSE(occlusion.IsVisible(Sphere(positions[i], 0.5f))) << "x = " << positions[i].X();
+			}
+		}
+	}
+}
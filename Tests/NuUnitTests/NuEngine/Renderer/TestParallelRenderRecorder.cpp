@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <Renderer/Queue/ParallelRenderRecorder.hpp>
+#include <Core/Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        constexpr float k_FarClip = 100.0f;
+
+        void BeginLookingDownNegativeZ(ParallelRenderRecorder& recorder)
+        {
+            const Matrix4x4 projection = Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, k_FarClip);
+            recorder.BeginFrame(Matrix4x4::Identity(), projection, k_FarClip);
+        }
+
+        std::vector<Matrix4x4> MakeGrid(size_t count)
+        {
+            std::vector<Matrix4x4> models;
+            models.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                // Half in front of the camera, half behind it
+                const float z = (i % 2 == 0) ? -10.0f - static_cast<float>(i % 50) : 10.0f;
+                models.push_back(Matrix4x4::CreateTranslation(Vector3(static_cast<float>(i % 7) - 3.0f, 0.0f, z)));
+            }
+            return models;
+        }
+    }
+
+    TEST(ParallelRenderRecorderTest, CullsSpheresOutsideTheFrustum)
+    {
+        Mesh mesh;
+        Material material;
+        ParallelRenderRecorder recorder;
+        BeginLookingDownNegativeZ(recorder);
+
+        RenderQueue queue;
+        EXPECT_TRUE(recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -5.0f)), 0.5f));
+        EXPECT_FALSE(recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, 5.0f)), 0.5f));
+        EXPECT_FALSE(recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -200.0f)), 0.5f));
+        EXPECT_FALSE(recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(50.0f, 0.0f, -5.0f)), 0.5f));
+
+        // Centre just behind the near plane, but the sphere still reaches into view
+        EXPECT_TRUE(recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, 0.5f)), 1.0f));
+
+        EXPECT_EQ(queue.GetSize(), 2u);
+    }
+
+    TEST(ParallelRenderRecorderTest, KeysSortNearToFarForOpaque)
+    {
+        Mesh mesh;
+        Material material;
+        ParallelRenderRecorder recorder;
+        BeginLookingDownNegativeZ(recorder);
+
+        RenderQueue queue;
+        recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -50.0f)), 0.5f);
+        recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -5.0f)), 0.5f);
+        queue.Sort();
+
+        ASSERT_EQ(queue.GetSize(), 2u);
+        EXPECT_FLOAT_EQ(queue.GetEntries()[0].Command->Transforms[0](2, 3), -5.0f);
+    }
+
+    TEST(ParallelRenderRecorderTest, ParallelRecordingMatchesSerial)
+    {
+        Mesh mesh;
+        Material material;
+        const std::vector<Matrix4x4> models = MakeGrid(20000);
+
+        const auto recordAll = [&](ParallelRenderRecorder& recorder, RenderQueue& target)
+        {
+            BeginLookingDownNegativeZ(recorder);
+            recorder.Record(models.size(), [&](size_t start, size_t end, RenderQueue& queue)
+            {
+                for (size_t i = start; i < end; ++i)
+                {
+                    recorder.SubmitCulled(queue, mesh, material, RenderPass::Opaque, models[i], 0.5f);
+                }
+            });
+            recorder.MergeInto(target);
+            target.Sort();
+        };
+
+        ParallelRenderRecorder serialRecorder;
+        RenderQueue serial;
+        recordAll(serialRecorder, serial);
+
+        Core::JobSystem::Get().Initialize(3);
+        ParallelRenderRecorder parallelRecorder;
+        RenderQueue parallel;
+        recordAll(parallelRecorder, parallel);
+        Core::JobSystem::Get().Shutdown();
+
+        EXPECT_EQ(serial.GetSize(), models.size() / 2);
+        EXPECT_EQ(parallelRecorder.GetRecordedCount(), serial.GetSize());
+        ASSERT_EQ(parallel.GetSize(), serial.GetSize());
+
+        for (size_t i = 0; i < serial.GetSize(); ++i)
+        {
+            EXPECT_EQ(parallel.GetEntries()[i].Key, serial.GetEntries()[i].Key);
+        }
+    }
+
+    TEST(ParallelRenderRecorderTest, BatchCulledRecordingMatchesPerObjectCulling)
+    {
+        Mesh mesh;
+        Material material;
+        const std::vector<Matrix4x4> models = MakeGrid(20000);
+
+        ParallelRenderRecorder perObject;
+        BeginLookingDownNegativeZ(perObject);
+        RenderQueue expected;
+        for (const Matrix4x4& model : models)
+        {
+            perObject.SubmitCulled(expected, mesh, material, RenderPass::Opaque, model, 0.5f);
+        }
+        expected.Sort();
+
+        Core::JobSystem::Get().Initialize(3);
+        ParallelRenderRecorder batched;
+        BeginLookingDownNegativeZ(batched);
+        batched.RecordVisible(models.size(),
+            [&](size_t i, Sphere& bounds)
+            {
+                // Every third element opts out, as an entity without a mesh would
+                if (i % 3 == 0)
+                {
+                    return false;
+                }
+                bounds = Sphere(Vector3(models[i](0, 3), models[i](1, 3), models[i](2, 3)), 0.5f);
+                return true;
+            },
+            [&](size_t i, RenderQueue& queue)
+            {
+                EXPECT_NE(i % 3, 0u);
+                batched.Submit(queue, mesh, material, RenderPass::Opaque, models[i]);
+            });
+        RenderQueue actual;
+        batched.MergeInto(actual);
+        actual.Sort();
+        Core::JobSystem::Get().Shutdown();
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < models.size(); ++i)
+        {
+            RenderQueue single;
+            if (i % 3 != 0 && perObject.SubmitCulled(single, mesh, material, RenderPass::Opaque, models[i], 0.5f))
+            {
+                ++expectedCount;
+            }
+        }
+
+        EXPECT_GT(expectedCount, 0u);
+        EXPECT_EQ(actual.GetSize(), expectedCount);
+        EXPECT_LT(actual.GetSize(), expected.GetSize());
+    }
+}
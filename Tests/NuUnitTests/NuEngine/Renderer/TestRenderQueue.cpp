@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <Renderer/Queue/RenderQueue.hpp>
+#include <Renderer/Mesh.hpp>
+#include <Renderer/Material.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Renderer::Tests
+{
+    using namespace NuMath;
+
+    TEST(RenderKeyTest, PassDominatesEverything)
+    {
+        const uint64_t farOpaque = RenderKey::Make(RenderPass::Opaque, 4095, 65535, 4095, 1.0f);
+        const uint64_t nearTransparent = RenderKey::Make(RenderPass::Transparent, 0, 0, 0, 0.0f);
+        const uint64_t overlay = RenderKey::Make(RenderPass::Overlay, 0, 0, 0, 0.0f);
+
+        EXPECT_LT(farOpaque, nearTransparent);
+        EXPECT_LT(nearTransparent, overlay);
+        EXPECT_EQ(RenderKey::GetPass(nearTransparent), RenderPass::Transparent);
+    }
+
+    TEST(RenderKeyTest, OpaqueGroupsByStateThenFrontToBack)
+    {
+        const uint64_t nearA = RenderKey::Make(RenderPass::Opaque, 1, 0, 0, 0.1f);
+        const uint64_t farA = RenderKey::Make(RenderPass::Opaque, 1, 0, 0, 0.9f);
+        const uint64_t nearB = RenderKey::Make(RenderPass::Opaque, 2, 0, 0, 0.0f);
+
+        EXPECT_LT(nearA, farA);
+        EXPECT_LT(farA, nearB);
+    }
+
+    TEST(RenderKeyTest, TransparentSortsBackToFrontFirst)
+    {
+        const uint64_t farB = RenderKey::Make(RenderPass::Transparent, 2, 0, 0, 0.9f);
+        const uint64_t nearA = RenderKey::Make(RenderPass::Transparent, 1, 0, 0, 0.1f);
+
+        EXPECT_LT(farB, nearA);
+    }
+
+    TEST(RenderQueueTest, SortMatchesStableSortOnRandomKeys)
+    {
+        Mesh mesh;
+        Material material;
+        RenderQueue queue;
+
+        std::mt19937_64 rng(1234);
+        std::vector<uint64_t> keys;
+        for (int i = 0; i < 5000; ++i)
+        {
+            // Few distinct values so that equal keys are common
+            const uint64_t key = (rng() % 64) << 40 | (rng() % 8);
+            keys.push_back(key);
+            queue.Submit(key, mesh, material, Matrix4x4::CreateTranslation(Vector3(static_cast<float>(i), 0.0f, 0.0f)));
+        }
+
+        std::vector<RenderQueueEntry> expected(queue.GetEntries().begin(), queue.GetEntries().end());
+        std::stable_sort(expected.begin(), expected.end(), [](const RenderQueueEntry& a, const RenderQueueEntry& b)
+        {
+            return a.Key < b.Key;
+        });
+
+        queue.Sort();
+
+        const auto sorted = queue.GetEntries();
+        ASSERT_EQ(sorted.size(), expected.size());
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            EXPECT_EQ(sorted[i].Key, expected[i].Key);
+            EXPECT_EQ(sorted[i].Command, expected[i].Command);
+        }
+    }
+
+    TEST(RenderQueueTest, SubmitCopiesTransformsIntoArena)
+    {
+        Mesh mesh;
+        Material material;
+        RenderQueue queue;
+
+        std::vector<Matrix4x4> transforms = {
+            Matrix4x4::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)),
+            Matrix4x4::CreateTranslation(Vector3(2.0f, 0.0f, 0.0f))
+        };
+        queue.Submit(7, mesh, material, transforms);
+        transforms.clear();
+
+        ASSERT_EQ(queue.GetSize(), 1u);
+        const DrawCommand* command = queue.GetEntries()[0].Command;
+        EXPECT_EQ(command->Mesh, &mesh);
+        EXPECT_EQ(command->Material, &material);
+        ASSERT_EQ(command->InstanceCount, 2u);
+        EXPECT_FLOAT_EQ(command->Transforms[1](0, 3), 2.0f);
+    }
+
+    TEST(RenderQueueTest, AppendThenResetClearsEntries)
+    {
+        Mesh mesh;
+        Material material;
+        RenderQueue main;
+        RenderQueue worker;
+
+        main.Submit(3, mesh, material, Matrix4x4::Identity());
+        worker.Submit(1, mesh, material, Matrix4x4::Identity());
+        worker.Submit(2, mesh, material, Matrix4x4::Identity());
+
+        main.Append(worker);
+        main.Sort();
+
+        ASSERT_EQ(main.GetSize(), 3u);
+        EXPECT_EQ(main.GetEntries()[0].Key, 1u);
+        EXPECT_EQ(main.GetEntries()[2].Key, 3u);
+
+        main.Reset();
+        EXPECT_EQ(main.GetSize(), 0u);
+    }
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <Runtime/Spatial/BVH.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Runtime::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        std::vector<AABB> MakeBoxes(size_t count, uint32_t seed)
+        {
+            std::mt19937 rng(seed);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> size(0.1f, 3.0f);
+
+            std::vector<AABB> boxes;
+            boxes.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Vector3 center(position(rng), position(rng), position(rng));
+                boxes.push_back(AABB::FromCenterExtents(center, Vector3(size(rng), size(rng), size(rng))));
+            }
+            return boxes;
+        }
+
+        template<typename QueryFn>
+        std::vector<uint32_t> Collect(QueryFn&& query)
+        {
+            std::vector<uint32_t> result;
+            query([&result](uint32_t index) { result.push_back(index); });
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        template<typename Predicate>
+        std::vector<uint32_t> BruteForce(const std::vector<AABB>& boxes, Predicate&& predicate)
+        {
+            std::vector<uint32_t> result;
+            for (uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                if (predicate(boxes[i]))
+                {
+                    result.push_back(i);
+                }
+            }
+            return result;
+        }
+
+        float BruteForceRay(const std::vector<AABB>& boxes, const Ray& ray, float maxDistance, uint32_t& outIndex)
+        {
+            float best = maxDistance;
+            outIndex = BVHRayHit::k_NoHit;
+            for (uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                float tNear = 0.0f;
+                float tFar = best;
+                bool hit = true;
+                for (int axis = 0; axis < 3 && hit; ++axis)
+                {
+                    const float origin = axis == 0 ? ray.Origin.X() : (axis == 1 ? ray.Origin.Y() : ray.Origin.Z());
+                    const float direction = axis == 0 ? ray.Direction.X() : (axis == 1 ? ray.Direction.Y() : ray.Direction.Z());
+                    const float min = axis == 0 ? boxes[i].Min.X() : (axis == 1 ? boxes[i].Min.Y() : boxes[i].Min.Z());
+                    const float max = axis == 0 ? boxes[i].Max.X() : (axis == 1 ? boxes[i].Max.Y() : boxes[i].Max.Z());
+                    const float t1 = (min - origin) / direction;
+                    const float t2 = (max - origin) / direction;
+                    tNear = std::max(tNear, std::min(t1, t2));
+                    tFar = std::min(tFar, std::max(t1, t2));
+                    hit = tNear <= tFar;
+                }
+
+                if (hit && tNear < best)
+                {
+                    best = tNear;
+                    outIndex = i;
+                }
+            }
+            return best;
+        }
+    }
+
+    TEST(BVHTest, EmptyAndTinyTrees)
+    {
+        BVH bvh;
+        bvh.Build({});
+        EXPECT_TRUE(bvh.IsEmpty());
+        EXPECT_TRUE(Collect([&](auto visit) { bvh.QuerySphere(Sphere(Vector3(0.0f, 0.0f, 0.0f), 1000.0f), visit); }).empty());
+        EXPECT_FALSE(bvh.Raycast(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)), 100.0f).IsHit());
+
+        const std::vector<AABB> boxes = MakeBoxes(3, 1);
+        bvh.Build(boxes);
+        EXPECT_EQ(bvh.GetNodeCount(), 1u);
+        EXPECT_EQ(Collect([&](auto visit) { bvh.QuerySphere(Sphere(Vector3(0.0f, 0.0f, 0.0f), 1000.0f), visit); }).size(), 3u);
+    }
+
+    TEST(BVHTest, QueriesMatchBruteForce)
+    {
+        const std::vector<AABB> boxes = MakeBoxes(5000, 7);
+        BVH bvh;
+        bvh.Build(boxes);
+        EXPECT_EQ(bvh.GetPrimitiveCount(), boxes.size());
+
+        const Frustum frustum = Frustum::FromViewProjection(Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 80.0f));
+        EXPECT_EQ(
+            Collect([&](auto visit) { bvh.QueryFrustum(frustum, visit); }),
+            BruteForce(boxes, [&](const AABB& box) { return Intersects(frustum, box); }));
+
+        const AABB region(Vector3(-20.0f, -10.0f, -30.0f), Vector3(25.0f, 15.0f, 5.0f));
+        EXPECT_EQ(
+            Collect([&](auto visit) { bvh.QueryAABB(region, visit); }),
+            BruteForce(boxes, [&](const AABB& box) { return Intersects(region, box); }));
+
+        const Sphere sphere(Vector3(10.0f, -5.0f, 20.0f), 18.0f);
+        const std::vector<uint32_t> inSphere = BruteForce(boxes, [&](const AABB& box) { return Intersects(box, sphere); });
+        EXPECT_GT(inSphere.size(), 0u);
+        EXPECT_EQ(Collect([&](auto visit) { bvh.QuerySphere(sphere, visit); }), inSphere);
+    }
+
+    TEST(BVHTest, RaycastFindsClosestBox)
+    {
+        const std::vector<AABB> boxes = MakeBoxes(5000, 11);
+        BVH bvh;
+        bvh.Build(boxes);
+
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        int hits = 0;
+        for (int i = 0; i < 200; ++i)
+        {
+            const Ray ray(Vector3(unit(rng) * 120.0f, unit(rng) * 120.0f, unit(rng) * 120.0f),
+                Vector3(unit(rng), unit(rng), unit(rng)).Normalize());
+
+            uint32_t expectedIndex = 0;
+            const float expectedDistance = BruteForceRay(boxes, ray, 500.0f, expectedIndex);
+            const BVHRayHit hit = bvh.Raycast(ray, 500.0f);
+
+            ASSERT_EQ(hit.Index, expectedIndex);
+            if (hit.IsHit())
+            {
+                EXPECT_NEAR(hit.Distance, expectedDistance, 1e-3f);
+                ++hits;
+            }
+        }
+        EXPECT_GT(hits, 0);
+    }
+
+    TEST(BVHTest, RefitTracksMovedObjects)
+    {
+        std::vector<AABB> boxes = MakeBoxes(3000, 5);
+        BVH full;
+        BVH partial;
+        full.Build(boxes);
+        partial.Build(boxes);
+
+        std::vector<uint32_t> moved;
+        for (uint32_t i = 0; i < boxes.size(); i += 37)
+        {
+            const Vector3 offset(50.0f, -40.0f, 30.0f);
+            boxes[i] = AABB(boxes[i].Min + offset, boxes[i].Max + offset);
+            moved.push_back(i);
+        }
+
+        full.Refit(boxes);
+        partial.Refit(boxes, moved);
+
+        const Sphere sphere(Vector3(60.0f, -40.0f, 30.0f), 25.0f);
+        const std::vector<uint32_t> expected = BruteForce(boxes, [&](const AABB& box) { return Intersects(box, sphere); });
+        EXPECT_EQ(Collect([&](auto visit) { full.QuerySphere(sphere, visit); }), expected);
+        EXPECT_EQ(Collect([&](auto visit) { partial.QuerySphere(sphere, visit); }), expected);
+
+        // Every node box must still contain its children after a partial refit
+        const auto nodes = partial.GetNodes();
+        for (const BVHNode& node : nodes)
+        {
+            for (int slot = 0; slot < 4; ++slot)
+            {
+                if (node.Children[slot] == BVHNode::k_EmptyChild || node.Counts[slot] > 0)
+                {
+                    continue;
+                }
+                const BVHNode& child = nodes[node.Children[slot]];
+                for (int childSlot = 0; childSlot < 4; ++childSlot)
+                {
+                    if (child.Children[childSlot] != BVHNode::k_EmptyChild)
+                    {
+                        EXPECT_LE(node.MinX[slot], child.MinX[childSlot]);
+                        EXPECT_GE(node.MaxY[slot], child.MaxY[childSlot]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(BVHTest, CoincidentBoundsStillBuild)
+    {
+        std::vector<AABB> boxes(1000, AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f)));
+        BVH bvh;
+        bvh.Build(boxes);
+
+        EXPECT_EQ(Collect([&](auto visit) { bvh.QueryAABB(AABB(Vector3(0.5f, 0.5f, 0.5f), Vector3(2.0f, 2.0f, 2.0f)), visit); }).size(), boxes.size());
+    }
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Vector/VectorBatchSoA.hpp>
+#include <NuMath/Batch/Geometry/CullingBatchSoA.hpp>
+
+#include <random>
+#include <vector>
+
+namespace NuEngine::Math::Tests
+{
+    using namespace NuMath;
+    using Simd::SimdLevel;
+
+    namespace
+    {
+        // Restores the level the process started with, whatever the test switched to
+        struct BatchLevelScope
+        {
+            SimdLevel Previous = Simd::GetBatchLevel();
+            ~BatchLevelScope() { Simd::SetBatchLevel(Previous); }
+        };
+
+        std::vector<SimdLevel> GetRunnableLevels()
+        {
+            std::vector<SimdLevel> levels;
+            for (uint8_t level = 0; level <= uint8_t(Simd::DetectSimdLevel()); ++level)
+            {
+                levels.push_back(SimdLevel(level));
+            }
+            return levels;
+        }
+
+        std::vector<float> RandomStream(size_t count, std::mt19937& rng, float min, float max)
+        {
+            std::uniform_real_distribution<float> dist(min, max);
+            std::vector<float> stream(count);
+            for (float& value : stream)
+            {
+                value = dist(rng);
+            }
+            return stream;
+        }
+    }
+
+    TEST(BatchDispatchTest, SetBatchLevelClampsToTheDetectedLevel)
+    {
+        BatchLevelScope scope;
+
+        EXPECT_EQ(Simd::SetBatchLevel(SimdLevel::AVX512), Simd::DetectSimdLevel());
+        EXPECT_EQ(Simd::GetBatchLevel(), Simd::DetectSimdLevel());
+
+        EXPECT_EQ(Simd::SetBatchLevel(SimdLevel::Scalar), SimdLevel::Scalar);
+        EXPECT_EQ(Simd::GetBatchLevel(), SimdLevel::Scalar);
+    }
+
+    TEST(BatchDispatchTest, EveryLevelComputesTheSameVectorOps)
+    {
+        BatchLevelScope scope;
+
+        // Odd count and one-float offsets: every level goes through its head, body and tail
+        constexpr size_t count = 1003;
+        std::mt19937 rng(7);
+        const std::vector<float> ax = RandomStream(count + 1, rng, -10.0f, 10.0f);
+        const std::vector<float> ay = RandomStream(count + 1, rng, -10.0f, 10.0f);
+        const std::vector<float> bx = RandomStream(count + 1, rng, 0.5f, 10.0f);
+        const std::vector<float> by = RandomStream(count + 1, rng, 0.5f, 10.0f);
+
+        const SoAVec2Const a{ ax.data() + 1, ay.data() + 1 };
+        const SoAVec2Const b{ bx.data() + 1, by.data() + 1 };
+
+        for (SimdLevel level : GetRunnableLevels())
+        {
+            SCOPED_TRACE(Simd::ToString(level));
+            ASSERT_EQ(Simd::SetBatchLevel(level), level);
+
+            std::vector<float> rx(count + 1), ry(count + 1), dot(count + 1);
+            const SoAVec2 r{ rx.data() + 1, ry.data() + 1 };
+
+            Batch::SoA::Add(r, a, b, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(r.X()[i], a.X()[i] + b.X()[i]);
+                ASSERT_EQ(r.Y()[i], a.Y()[i] + b.Y()[i]);
+            }
+
+            Batch::SoA::Div(r, a, b, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(r.X()[i], a.X()[i] / b.X()[i]);
+            }
+
+            Batch::SoA::Dot(dot.data() + 1, a, b, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                // Fused and unfused multiply-adds round differently
+                ASSERT_NEAR(dot[i + 1], a.X()[i] * b.X()[i] + a.Y()[i] * b.Y()[i], 1e-4f);
+            }
+        }
+    }
+
+    TEST(BatchDispatchTest, EveryLevelCullsTheSameBounds)
+    {
+        BatchLevelScope scope;
+
+        constexpr size_t count = 517;
+        std::mt19937 rng(11);
+        const std::vector<float> x = RandomStream(count + 1, rng, -120.0f, 120.0f);
+        const std::vector<float> y = RandomStream(count + 1, rng, -120.0f, 120.0f);
+        const std::vector<float> z = RandomStream(count + 1, rng, -120.0f, 120.0f);
+        const std::vector<float> size = RandomStream(count + 1, rng, 0.1f, 8.0f);
+
+        const Frustum frustum = Frustum::FromViewProjection(Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+        const SoAVec3Const centers{ x.data() + 1, y.data() + 1, z.data() + 1 };
+        const SoAVec3Const extents{ size.data() + 1, size.data() + 1, size.data() + 1 };
+
+        std::vector<uint32_t> expectedSpheres;
+        std::vector<uint32_t> expectedBoxes;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3 center(centers.X()[i], centers.Y()[i], centers.Z()[i]);
+            const float radius = size[i + 1];
+            if (Intersects(frustum, Sphere(center, radius)))
+            {
+                expectedSpheres.push_back(uint32_t(i));
+            }
+            if (Intersects(frustum, AABB::FromCenterExtents(center, Vector3(radius, radius, radius))))
+            {
+                expectedBoxes.push_back(uint32_t(i));
+            }
+        }
+        ASSERT_FALSE(expectedSpheres.empty());
+
+        for (SimdLevel level : GetRunnableLevels())
+        {
+            SCOPED_TRACE(Simd::ToString(level));
+            ASSERT_EQ(Simd::SetBatchLevel(level), level);
+
+            std::vector<uint32_t> visible(count);
+            visible.resize(Batch::SoA::CullSpheres(frustum, centers, size.data() + 1, count, visible.data()));
+            EXPECT_EQ(visible, expectedSpheres);
+
+            visible.assign(count, 0);
+            visible.resize(Batch::SoA::CullAABBs(frustum, centers, extents, count, visible.data()));
+            EXPECT_EQ(visible, expectedBoxes);
+        }
+    }
+}
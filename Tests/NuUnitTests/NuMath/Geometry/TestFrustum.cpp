@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Geometry/CullingBatchSoA.hpp>
+#include <NuEngine/Core/Memory/AlignedAllocator.hpp>
+
+#include <random>
+#include <vector>
+
+namespace NuEngine::Math::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        // Camera at the origin looking down -Z, far plane at 100
+        Frustum MakeFrustum()
+        {
+            return Frustum::FromViewProjection(Matrix4x4::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+        }
+
+        struct BoundsStreams
+        {
+            AlignedVector<float, 32> X, Y, Z, Radius, ExtentX, ExtentY, ExtentZ;
+
+            explicit BoundsStreams(size_t count)
+                : X(count), Y(count), Z(count), Radius(count), ExtentX(count), ExtentY(count), ExtentZ(count)
+            {
+                std::mt19937 rng(42);
+                std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+                std::uniform_real_distribution<float> size(0.1f, 8.0f);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    X[i] = position(rng);
+                    Y[i] = position(rng);
+                    Z[i] = position(rng);
+                    Radius[i] = size(rng);
+                    ExtentX[i] = size(rng);
+                    ExtentY[i] = size(rng);
+                    ExtentZ[i] = size(rng);
+                }
+            }
+
+            SoAVec3Const Centers() const { return { X.data(), Y.data(), Z.data() }; }
+            SoAVec3Const Extents() const { return { ExtentX.data(), ExtentY.data(), ExtentZ.data() }; }
+        };
+    }
+
+    TEST(FrustumTest, PlanesAreNormalizedAndPointInwards)
+    {
+        const Frustum frustum = MakeFrustum();
+
+        for (const Plane& plane : frustum.Planes)
+        {
+            EXPECT_NEAR(plane.Normal.Length(), 1.0f, 1e-5f);
+        }
+
+        EXPECT_NEAR(frustum.Planes[Frustum::Near].SignedDistance(Vector3(0.0f, 0.0f, -0.1f)), 0.0f, 1e-4f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Far].SignedDistance(Vector3(0.0f, 0.0f, -100.0f)), 0.0f, 1e-2f);
+
+        EXPECT_TRUE(frustum.Contains(Vector3(0.0f, 0.0f, -10.0f)));
+        EXPECT_FALSE(frustum.Contains(Vector3(0.0f, 0.0f, 10.0f)));
+        EXPECT_FALSE(frustum.Contains(Vector3(0.0f, 0.0f, -150.0f)));
+        EXPECT_FALSE(frustum.Contains(Vector3(50.0f, 0.0f, -10.0f)));
+    }
+
+    TEST(FrustumTest, ViewProjectionMovesPlanesWithTheCamera)
+    {
+        const Matrix4x4 projection = Matrix4x4::CreatePerspective(1.0f, 1.0f, 0.1f, 100.0f);
+        const Matrix4x4 view = Matrix4x4::CreateTranslation(Vector3(-50.0f, 0.0f, 0.0f));
+        const Frustum frustum = Frustum::FromViewProjection(projection * view);
+
+        EXPECT_TRUE(frustum.Contains(Vector3(50.0f, 0.0f, -10.0f)));
+        EXPECT_FALSE(frustum.Contains(Vector3(0.0f, 0.0f, -10.0f)));
+    }
+
+    TEST(FrustumTest, SphereAndBoxIntersection)
+    {
+        const Frustum frustum = MakeFrustum();
+
+        EXPECT_TRUE(Intersects(frustum, Sphere(Vector3(0.0f, 0.0f, -5.0f), 0.5f)));
+        EXPECT_FALSE(Intersects(frustum, Sphere(Vector3(0.0f, 0.0f, 5.0f), 0.5f)));
+        EXPECT_TRUE(Intersects(frustum, Sphere(Vector3(0.0f, 0.0f, 0.5f), 1.0f)));
+
+        EXPECT_TRUE(Intersects(frustum, AABB::FromCenterExtents(Vector3(0.0f, 0.0f, -5.0f), Vector3(0.5f, 0.5f, 0.5f))));
+        EXPECT_FALSE(Intersects(frustum, AABB::FromCenterExtents(Vector3(0.0f, 0.0f, 5.0f), Vector3(0.5f, 0.5f, 0.5f))));
+
+        // A long thin box whose centre is off to the side but which reaches into view
+        EXPECT_TRUE(Intersects(frustum, AABB::FromCenterExtents(Vector3(60.0f, 0.0f, -10.0f), Vector3(60.0f, 0.5f, 0.5f))));
+
+        EXPECT_TRUE(Intersects(AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f)), Sphere(Vector3(1.5f, 0.5f, 0.5f), 0.6f)));
+        EXPECT_FALSE(Intersects(AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f)), AABB(Vector3(2.0f, 0.0f, 0.0f), Vector3(3.0f, 1.0f, 1.0f))));
+    }
+
+    TEST(FrustumTest, BatchSphereCullingMatchesScalar)
+    {
+        // Not a multiple of any SIMD width, so the tail is covered too
+        constexpr size_t count = 1003;
+        const BoundsStreams bounds(count);
+        const Frustum frustum = MakeFrustum();
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (Intersects(frustum, Sphere(Vector3(bounds.X[i], bounds.Y[i], bounds.Z[i]), bounds.Radius[i])))
+            {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        std::vector<uint32_t> visible(count);
+        const size_t visibleCount = Batch::SoA::CullSpheres(frustum, bounds.Centers(), bounds.Radius.data(), count, visible.data());
+        visible.resize(visibleCount);
+
+        EXPECT_GT(expected.size(), 0u);
+        EXPECT_LT(expected.size(), count);
+        EXPECT_EQ(visible, expected);
+    }
+
+    TEST(FrustumTest, BatchBoxCullingMatchesScalar)
+    {
+        constexpr size_t count = 1003;
+        const BoundsStreams bounds(count);
+        const Frustum frustum = MakeFrustum();
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const AABB box = AABB::FromCenterExtents(Vector3(bounds.X[i], bounds.Y[i], bounds.Z[i]), Vector3(bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]));
+            if (Intersects(frustum, box))
+            {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        std::vector<uint32_t> visible(count);
+        const size_t visibleCount = Batch::SoA::CullAABBs(frustum, bounds.Centers(), bounds.Extents(), count, visible.data());
+        visible.resize(visibleCount);
+
+        EXPECT_GT(expected.size(), 0u);
+        EXPECT_EQ(visible, expected);
+    }
+}
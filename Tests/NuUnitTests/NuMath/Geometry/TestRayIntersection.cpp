@@ -0,0 +1,285 @@
+#include <gtest/gtest.h>
+#include <NuMath/NuMath.hpp>
+#include <NuMath/Batch/Geometry/RayBatchSoA.hpp>
+#include <NuEngine/Core/Memory/AlignedAllocator.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace NuEngine::Math::Tests
+{
+    using namespace NuMath;
+
+    namespace
+    {
+        // Not a multiple of any SIMD width, so the tails are covered too
+        constexpr size_t k_RayCount = 1003;
+        constexpr size_t k_PrimitiveCount = 203;
+        // Relative: grazing sphere hits lose a few bits when the compiler contracts to FMA
+        constexpr float k_Tolerance = 1e-4f;
+
+        /**
+         * @brief Random rays aimed roughly at a cloud of random triangles, boxes and spheres.
+         */
+        struct RayScene
+        {
+            AlignedVector<float, 32> OriginX, OriginY, OriginZ;
+            AlignedVector<float, 32> DirX, DirY, DirZ;
+            AlignedVector<float, 32> InvDirX, InvDirY, InvDirZ;
+            std::vector<Ray> Rays;
+
+            AlignedVector<float, 32> V0X, V0Y, V0Z, E1X, E1Y, E1Z, E2X, E2Y, E2Z;
+            AlignedVector<float, 32> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+            AlignedVector<float, 32> CenterX, CenterY, CenterZ, Radius;
+            std::vector<Triangle> Triangles;
+            std::vector<AABB> Boxes;
+            std::vector<Sphere> Spheres;
+
+            RayScene()
+            {
+                std::mt19937 rng(7);
+                std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+                std::uniform_real_distribution<float> offset(-3.0f, 3.0f);
+                std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+                for (size_t i = 0; i < k_RayCount; ++i)
+                {
+                    const Vector3 origin(position(rng), position(rng), 40.0f);
+                    const Vector3 target(position(rng), position(rng), position(rng));
+                    const Vector3 direction = (target - origin).Normalize();
+
+                    Rays.emplace_back(origin, direction);
+                    OriginX.push_back(origin.X());
+                    OriginY.push_back(origin.Y());
+                    OriginZ.push_back(origin.Z());
+                    DirX.push_back(direction.X());
+                    DirY.push_back(direction.Y());
+                    DirZ.push_back(direction.Z());
+                    InvDirX.push_back(1.0f / direction.X());
+                    InvDirY.push_back(1.0f / direction.Y());
+                    InvDirZ.push_back(1.0f / direction.Z());
+                }
+
+                for (size_t i = 0; i < k_PrimitiveCount; ++i)
+                {
+                    const Vector3 center(position(rng), position(rng), position(rng));
+                    const Triangle triangle(center,
+                        center + Vector3(offset(rng), offset(rng), offset(rng)),
+                        center + Vector3(offset(rng), offset(rng), offset(rng)));
+                    Triangles.push_back(triangle);
+                    V0X.push_back(triangle.V0.X());
+                    V0Y.push_back(triangle.V0.Y());
+                    V0Z.push_back(triangle.V0.Z());
+                    E1X.push_back(triangle.GetEdge1().X());
+                    E1Y.push_back(triangle.GetEdge1().Y());
+                    E1Z.push_back(triangle.GetEdge1().Z());
+                    E2X.push_back(triangle.GetEdge2().X());
+                    E2Y.push_back(triangle.GetEdge2().Y());
+                    E2Z.push_back(triangle.GetEdge2().Z());
+
+                    const AABB box = AABB::FromCenterExtents(Vector3(position(rng), position(rng), position(rng)), Vector3(size(rng), size(rng), size(rng)));
+                    Boxes.push_back(box);
+                    MinX.push_back(box.Min.X());
+                    MinY.push_back(box.Min.Y());
+                    MinZ.push_back(box.Min.Z());
+                    MaxX.push_back(box.Max.X());
+                    MaxY.push_back(box.Max.Y());
+                    MaxZ.push_back(box.Max.Z());
+
+                    const Sphere sphere(Vector3(position(rng), position(rng), position(rng)), size(rng));
+                    Spheres.push_back(sphere);
+                    CenterX.push_back(sphere.Center.X());
+                    CenterY.push_back(sphere.Center.Y());
+                    CenterZ.push_back(sphere.Center.Z());
+                    Radius.push_back(sphere.Radius);
+                }
+            }
+
+            SoAVec3Const Origins() const { return { OriginX.data(), OriginY.data(), OriginZ.data() }; }
+            SoAVec3Const Directions() const { return { DirX.data(), DirY.data(), DirZ.data() }; }
+            SoAVec3Const InvDirections() const { return { InvDirX.data(), InvDirY.data(), InvDirZ.data() }; }
+            SoAVec3Const V0() const { return { V0X.data(), V0Y.data(), V0Z.data() }; }
+            SoAVec3Const Edge1() const { return { E1X.data(), E1Y.data(), E1Z.data() }; }
+            SoAVec3Const Edge2() const { return { E2X.data(), E2Y.data(), E2Z.data() }; }
+            SoAVec3Const Mins() const { return { MinX.data(), MinY.data(), MinZ.data() }; }
+            SoAVec3Const Maxs() const { return { MaxX.data(), MaxY.data(), MaxZ.data() }; }
+            SoAVec3Const Centers() const { return { CenterX.data(), CenterY.data(), CenterZ.data() }; }
+        };
+
+        struct HitStreams
+        {
+            AlignedVector<float, 32> Distance, U, V;
+            std::vector<uint32_t> Primitive;
+
+            HitStreams() : Distance(k_RayCount), U(k_RayCount), V(k_RayCount), Primitive(k_RayCount)
+            {
+                Batch::SoA::ResetHits(Get(), k_RayCount);
+            }
+
+            Batch::SoA::RayHitsSoA Get() { return { Distance.data(), U.data(), V.data(), Primitive.data() }; }
+        };
+
+        /**
+         * @brief Closest hit of one ray over a list of primitives, using the scalar tests.
+         */
+        template <typename Primitive>
+        RayHit ClosestScalar(const Ray& ray, const std::vector<Primitive>& primitives)
+        {
+            RayHit best;
+            for (size_t i = 0; i < primitives.size(); ++i)
+            {
+                float distance = 0.0f;
+                float u = 0.0f;
+                float v = 0.0f;
+                bool hit = false;
+                if constexpr (std::is_same_v<Primitive, Triangle>)
+                {
+                    hit = Intersects(ray, primitives[i], distance, u, v);
+                }
+                else
+                {
+                    hit = Intersects(ray, primitives[i], distance);
+                }
+
+                if (hit && distance < best.Distance)
+                {
+                    best = { static_cast<uint32_t>(i), distance, u, v };
+                }
+            }
+            return best;
+        }
+
+        void ExpectSameHit(const RayHit& actual, const RayHit& expected)
+        {
+            ASSERT_EQ(actual.Primitive, expected.Primitive);
+            if (expected.IsHit())
+            {
+                EXPECT_NEAR(actual.Distance, expected.Distance, k_Tolerance * std::max(1.0f, expected.Distance));
+                EXPECT_NEAR(actual.U, expected.U, k_Tolerance);
+                EXPECT_NEAR(actual.V, expected.V, k_Tolerance);
+            }
+        }
+
+        template <typename B>
+        void ExpectPacketsMatchScalar(const RayScene& scene)
+        {
+            HitStreams triangles, boxes, spheres;
+            for (uint32_t p = 0; p < k_PrimitiveCount; ++p)
+            {
+                Batch::SoA::IntersectRays<B>(scene.Origins(), scene.Directions(), k_RayCount, scene.Triangles[p], p, triangles.Get());
+                Batch::SoA::IntersectRays<B>(scene.Origins(), scene.InvDirections(), k_RayCount, scene.Boxes[p], p, boxes.Get());
+                Batch::SoA::IntersectRays<B>(scene.Origins(), scene.Directions(), k_RayCount, scene.Spheres[p], p, spheres.Get());
+            }
+
+            size_t hitCount = 0;
+            for (size_t i = 0; i < k_RayCount; ++i)
+            {
+                const RayHit expected = ClosestScalar(scene.Rays[i], scene.Triangles);
+                ExpectSameHit({ triangles.Primitive[i], triangles.Distance[i], triangles.U[i], triangles.V[i] }, expected);
+                ExpectSameHit({ boxes.Primitive[i], boxes.Distance[i] }, ClosestScalar(scene.Rays[i], scene.Boxes));
+                ExpectSameHit({ spheres.Primitive[i], spheres.Distance[i] }, ClosestScalar(scene.Rays[i], scene.Spheres));
+                hitCount += expected.IsHit() ? 1 : 0;
+            }
+
+            EXPECT_GT(hitCount, 0u);
+            EXPECT_LT(hitCount, k_RayCount);
+        }
+
+        template <typename B>
+        void ExpectStreamsMatchScalar(const RayScene& scene)
+        {
+            for (size_t i = 0; i < k_RayCount; ++i)
+            {
+                const Ray& ray = scene.Rays[i];
+                ExpectSameHit(Batch::SoA::IntersectTriangles<B>(ray, scene.V0(), scene.Edge1(), scene.Edge2(), k_PrimitiveCount), ClosestScalar(ray, scene.Triangles));
+                ExpectSameHit(Batch::SoA::IntersectAABBs<B>(ray, scene.Mins(), scene.Maxs(), k_PrimitiveCount), ClosestScalar(ray, scene.Boxes));
+                ExpectSameHit(Batch::SoA::IntersectSpheres<B>(ray, scene.Centers(), scene.Radius.data(), k_PrimitiveCount), ClosestScalar(ray, scene.Spheres));
+            }
+        }
+    }
+
+    TEST(RayIntersectionTest, TriangleHitReportsDistanceAndBarycentrics)
+    {
+        const Triangle triangle(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+        float distance = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        ASSERT_TRUE(Intersects(Ray(Vector3(0.25f, 0.5f, 3.0f), Vector3(0.0f, 0.0f, -1.0f)), triangle, distance, u, v));
+        EXPECT_NEAR(distance, 3.0f, 1e-6f);
+        EXPECT_NEAR(u, 0.25f, 1e-6f);
+        EXPECT_NEAR(v, 0.5f, 1e-6f);
+
+        // Double-sided: the same hit from below
+        EXPECT_TRUE(Intersects(Ray(Vector3(0.25f, 0.5f, -3.0f), Vector3(0.0f, 0.0f, 1.0f)), triangle, distance, u, v));
+
+        EXPECT_FALSE(Intersects(Ray(Vector3(0.75f, 0.75f, 3.0f), Vector3(0.0f, 0.0f, -1.0f)), triangle, distance, u, v));
+        EXPECT_FALSE(Intersects(Ray(Vector3(0.25f, 0.25f, 3.0f), Vector3(0.0f, 0.0f, 1.0f)), triangle, distance, u, v));
+        EXPECT_FALSE(Intersects(Ray(Vector3(0.25f, 0.25f, 3.0f), Vector3(1.0f, 0.0f, 0.0f)), triangle, distance, u, v));
+    }
+
+    TEST(RayIntersectionTest, RaysStartingInsideBoxesAndSpheresHitAtZero)
+    {
+        const Ray ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f));
+
+        float distance = -1.0f;
+        EXPECT_TRUE(Intersects(ray, AABB(Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f)), distance));
+        EXPECT_FLOAT_EQ(distance, 0.0f);
+
+        distance = -1.0f;
+        EXPECT_TRUE(Intersects(ray, Sphere(Vector3(0.0f, 0.0f, 0.5f), 1.0f), distance));
+        EXPECT_FLOAT_EQ(distance, 0.0f);
+
+        EXPECT_TRUE(Intersects(ray, Sphere(Vector3(0.0f, 0.0f, -5.0f), 1.0f), distance));
+        EXPECT_NEAR(distance, 4.0f, 1e-5f);
+        EXPECT_TRUE(Intersects(ray, AABB(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f)), distance));
+        EXPECT_NEAR(distance, 4.0f, 1e-5f);
+
+        // Behind the origin
+        EXPECT_FALSE(Intersects(ray, Sphere(Vector3(0.0f, 0.0f, 5.0f), 1.0f), distance));
+        EXPECT_FALSE(Intersects(ray, AABB(Vector3(-1.0f, -1.0f, 4.0f), Vector3(1.0f, 1.0f, 6.0f)), distance));
+    }
+
+    TEST(RayIntersectionTest, PacketKernelsMatchScalar)
+    {
+        const RayScene scene;
+        ExpectPacketsMatchScalar<Batch::SoA::Backend>(scene);
+#if defined(__AVX__)
+        // The default backend is AVX here; the 4-wide path must agree as well
+        ExpectPacketsMatchScalar<Detail::SSE_Traits>(scene);
+#endif
+    }
+
+    TEST(RayIntersectionTest, StreamKernelsMatchScalar)
+    {
+        const RayScene scene;
+        ExpectStreamsMatchScalar<Batch::SoA::Backend>(scene);
+#if defined(__AVX__)
+        ExpectStreamsMatchScalar<Detail::SSE_Traits>(scene);
+#endif
+    }
+
+    TEST(RayIntersectionTest, PacketHitsKeepTheCloserPrimitive)
+    {
+        AlignedVector<float, 32> originX(5, 0.0f), originY(5, 0.0f), originZ(5, 10.0f);
+        AlignedVector<float, 32> dirX(5, 0.0f), dirY(5, 0.0f), dirZ(5, -1.0f);
+        const SoAVec3Const origins{ originX.data(), originY.data(), originZ.data() };
+        const SoAVec3Const directions{ dirX.data(), dirY.data(), dirZ.data() };
+
+        AlignedVector<float, 32> distance(5), u(5), v(5);
+        std::vector<uint32_t> primitive(5);
+        const Batch::SoA::RayHitsSoA hits{ distance.data(), u.data(), v.data(), primitive.data() };
+        Batch::SoA::ResetHits(hits, 5, 100.0f);
+
+        Batch::SoA::IntersectRays(origins, directions, 5, Sphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f), 1, hits);
+        Batch::SoA::IntersectRays(origins, directions, 5, Sphere(Vector3(0.0f, 0.0f, 5.0f), 1.0f), 2, hits);
+        Batch::SoA::IntersectRays(origins, directions, 5, Sphere(Vector3(0.0f, 0.0f, -50.0f), 1.0f), 3, hits);
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            EXPECT_EQ(primitive[i], 2u);
+            EXPECT_NEAR(distance[i], 4.0f, 1e-5f);
+        }
+    }
+}